@@ -31,7 +31,61 @@
 #endif
 
 #include "RECore/Log/LogFormatterText.h"
+#include "RECore/Log/LogRingBuffer.h"
 #include "RECore/Log/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace {
+  namespace detail {
+
+
+    //[-------------------------------------------------------]
+    //[ Structures                                            ]
+    //[-------------------------------------------------------]
+    /**
+    *  @brief
+    *    Ring buffer of the current thread, marks the ring buffer as orphaned when the thread exits
+    */
+    struct ThreadRingBuffer {
+      RECore::LogRingBuffer *pRingBuffer = nullptr;  ///< Owned by the log, can be a null pointer
+
+      ~ThreadRingBuffer() {
+        if (nullptr != pRingBuffer)
+          pRingBuffer->setOrphaned();
+      }
+    };
+
+    /**
+    *  @brief
+    *    Record inside the background thread batch
+    */
+    struct BatchRecord {
+      RECore::uint64 nTimestamp;
+      RECore::uint32 nOffset;  ///< Byte offset of the record header inside the batch data
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global variables                                      ]
+    //[-------------------------------------------------------]
+    thread_local ThreadRingBuffer g_cThreadRingBuffer;
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -40,6 +94,43 @@
 namespace RECore {
 
 
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Asynchronous mode data
+*/
+struct Log::AsynchronousData {
+  // Configuration, set by "startAsynchronous()"
+  uint32         nRingBufferSize = 0;
+  OverflowPolicy nOverflowPolicy = DropOnOverflow;
+  // Ring buffers of all logging threads
+  std::mutex                  cRingBuffersMutex;
+  std::vector<LogRingBuffer*> lstRingBuffers;        ///< Owned ring buffers, guarded by "cRingBuffersMutex"
+  uint32                      nNextThreadIndex = 0;  ///< Guarded by "cRingBuffersMutex"
+  std::atomic<uint32>         nNumberOfDroppedMessages{0};       ///< Dropped since the last report
+  std::atomic<uint32>         nTotalNumberOfDroppedMessages{0};  ///< Dropped since the log was created
+  // Background thread
+  std::thread             cThread;
+  std::mutex              cMutex;
+  std::condition_variable cWakeUpCondition;  ///< Wakes up the background thread
+  std::condition_variable cProcessedCondition;  ///< Signaled after each background thread processing pass
+  std::atomic<bool>       bWakeUpRequested{false};
+  bool                    bShutdown = false;  ///< Guarded by "cMutex"
+  uint64                  nFlushRequest = 0;  ///< Guarded by "cMutex"
+  uint64                  nFlushDone = 0;     ///< Guarded by "cMutex"
+  // Background thread only
+  std::vector<LogRingBuffer*>              lstProcessRingBuffers;
+  std::vector<uint8>                       lstBatchData;
+  std::vector<::detail::BatchRecord>       lstBatchRecords;
+  String                                   sText;
+  FILE                                    *pBinaryFile = nullptr;
+  std::unordered_map<const LogFormat*, uint32> mapFormatIds;  ///< Call site to binary log format ID
+  uint32                                   nNextFormatId = 1;
+};
+
+
 //[-------------------------------------------------------]
 //[ Global variables                                      ]
 //[-------------------------------------------------------]
@@ -102,6 +193,86 @@ String Log::logLevelToString(uint8 nLogLevel) const {
     return g_sLogLevelToString[nLogLevel - 1];
 }
 
+/**
+*  @brief
+*    Start the asynchronous mode
+*/
+bool Log::startAsynchronous(uint32 nRingBufferSize, OverflowPolicy nOverflowPolicy, const String &sBinaryFilename) {
+  // Already asynchronous?
+  if (isAsynchronous())
+    return false; // Error!
+
+  // The asynchronous data is kept alive once created, ring buffers of running threads are reused
+  if (nullptr == m_pAsynchronousData)
+    m_pAsynchronousData = new AsynchronousData();
+  AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+  cAsynchronousData.nRingBufferSize = nRingBufferSize;
+  cAsynchronousData.nOverflowPolicy = nOverflowPolicy;
+
+  // Open the binary log file
+  if (sBinaryFilename.length()) {
+    cAsynchronousData.pBinaryFile = fopen(sBinaryFilename.cstr(), "wb");
+    if (nullptr == cAsynchronousData.pBinaryFile)
+      return false; // Error!
+    if (!LogRecord::writeBinaryFileHeader(cAsynchronousData.pBinaryFile)) {
+      fclose(cAsynchronousData.pBinaryFile);
+      cAsynchronousData.pBinaryFile = nullptr;
+      return false; // Error!
+    }
+    cAsynchronousData.mapFormatIds.clear();
+    cAsynchronousData.nNextFormatId = 1;
+  }
+
+  // Start the background thread
+  cAsynchronousData.bShutdown = false;
+  cAsynchronousData.bWakeUpRequested.store(false, std::memory_order_relaxed);
+  cAsynchronousData.cThread = std::thread(&Log::asynchronousThread, this);
+  m_bAsynchronous.store(true, std::memory_order_release);
+
+  // Done
+  return true;
+}
+
+/**
+*  @brief
+*    Stop the asynchronous mode, all pending messages are written
+*/
+void Log::stopAsynchronous() {
+  if (isAsynchronous()) {
+    // From now on messages are written synchronously again
+    m_bAsynchronous.store(false, std::memory_order_seq_cst);
+
+    // Wait for messages which are already on the way into a ring buffer, the background thread keeps running so blocked producers get room
+    AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+    while (m_nNumberOfAsynchronousProducers.load(std::memory_order_seq_cst) > 0) {
+      wakeUpAsynchronousThread();
+      std::this_thread::yield();
+    }
+
+    // Let the background thread drain all ring buffers and exit, no further records can be committed
+    {
+      std::lock_guard<std::mutex> lock(cAsynchronousData.cMutex);
+      cAsynchronousData.bShutdown = true;
+    }
+    wakeUpAsynchronousThread();
+    cAsynchronousData.cThread.join();
+
+    // Close the binary log file
+    if (nullptr != cAsynchronousData.pBinaryFile) {
+      fclose(cAsynchronousData.pBinaryFile);
+      cAsynchronousData.pBinaryFile = nullptr;
+    }
+  }
+}
+
+/**
+*  @brief
+*    Get the total number of dropped messages
+*/
+uint32 Log::getNumberOfDroppedMessages() const {
+  return (nullptr != m_pAsynchronousData) ? m_pAsynchronousData->nTotalNumberOfDroppedMessages.load(std::memory_order_relaxed) : 0;
+}
+
 
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
@@ -117,7 +288,10 @@ Log::Log() :
   m_nFlushLogLevel(Error),
   m_nFlushMessages(0),
   m_nBufferedMessages(1000),
-  m_pLogFormatter(nullptr) {
+  m_pLogFormatter(nullptr),
+  m_bAsynchronous(false),
+  m_nNumberOfAsynchronousProducers(0),
+  m_pAsynchronousData(nullptr) {
 }
 
 /**
@@ -131,7 +305,10 @@ Log::Log(const Log &cSource) :
   m_nFlushLogLevel(Error),
   m_nFlushMessages(0),
   m_nBufferedMessages(1000),
-  m_pLogFormatter(nullptr) {
+  m_pLogFormatter(nullptr),
+  m_bAsynchronous(false),
+  m_nNumberOfAsynchronousProducers(0),
+  m_pAsynchronousData(nullptr) {
   // No implementation because the copy constructor is never used
 }
 
@@ -140,6 +317,16 @@ Log::Log(const Log &cSource) :
 *    Destructor
 */
 Log::~Log() {
+  // Write all pending messages
+  stopAsynchronous();
+
+  // Destroy the asynchronous data
+  if (nullptr != m_pAsynchronousData) {
+    for (LogRingBuffer *pRingBuffer : m_pAsynchronousData->lstRingBuffers)
+      delete pRingBuffer;
+    delete m_pAsynchronousData;
+  }
+
   // Close log
 }
 
@@ -157,6 +344,36 @@ Log &Log::operator=(const Log &cSource) {
 *    Writes a string into the log
 */
 bool Log::write(uint8 nLogLevel, const String &sText) {
+  // In asynchronous mode the text is passed to the background thread, unless we're the background thread
+  if (enterAsynchronousProducer()) {
+    // Truncate text not fitting into a ring buffer record instead of silently dropping it
+    const uint32 nMaximumArgumentsSize = getMaximumArgumentsSize();
+    if (LogRecord::getArgumentsSize(sText) > nMaximumArgumentsSize) {
+      leaveAsynchronousProducer();
+      static const String sTruncated = " [truncated]";
+      const uint32 nMaximumLength = nMaximumArgumentsSize - LogRecord::getArgumentsSize(String()) - sTruncated.length();
+      return write(nLogLevel, sText.substr(0, nMaximumLength) + sTruncated);
+    }
+
+    LogRecordHeader *pRecordHeader = reserveRecord(nLogLevel, LogRecord::getArgumentsSize(sText));
+    if (nullptr != pRecordHeader) {
+      pRecordHeader->nNumberOfArguments = 1;
+      LogRecord::writeArguments(reinterpret_cast<uint8*>(pRecordHeader + 1), sText);
+      commitRecord(nLogLevel);
+    }
+    leaveAsynchronousProducer();
+    return (nullptr != pRecordHeader); // 'false' if dropped
+  }
+
+  // Write directly
+  return writeText(nLogLevel, sText);
+}
+
+/**
+*  @brief
+*    Write a string into the console, the log formatter and the last messages queue
+*/
+bool Log::writeText(uint8 nLogLevel, const String &sText) {
   // Is there any text to write down?
   if (sText.length()) {
     // Write into the standard OS console?
@@ -248,7 +465,7 @@ bool Log::write(uint8 nLogLevel, const String &sText) {
         }
 
         // Emit the event
-        EventNewEntry();
+        EventNewEntry(nLogLevel, sText);
       }
     }
 
@@ -260,6 +477,269 @@ bool Log::write(uint8 nLogLevel, const String &sText) {
   return false;
 }
 
+/**
+*  @brief
+*    Enter passing a message to the background thread
+*/
+bool Log::enterAsynchronousProducer() {
+  // Register before checking the mode, "stopAsynchronous()" first leaves the mode and then waits for the registered producers
+  m_nNumberOfAsynchronousProducers.fetch_add(1, std::memory_order_seq_cst);
+  if (m_bAsynchronous.load(std::memory_order_seq_cst) && std::this_thread::get_id() != m_pAsynchronousData->cThread.get_id())
+    return true;
+  m_nNumberOfAsynchronousProducers.fetch_sub(1, std::memory_order_release);
+  return false;
+}
+
+/**
+*  @brief
+*    Leave passing a message to the background thread
+*/
+void Log::leaveAsynchronousProducer() {
+  m_nNumberOfAsynchronousProducers.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+*  @brief
+*    Get the ring buffer of the calling thread, created on the first call, asynchronous mode only
+*/
+LogRingBuffer &Log::getThreadRingBuffer() {
+  LogRingBuffer *pRingBuffer = ::detail::g_cThreadRingBuffer.pRingBuffer;
+  if (nullptr == pRingBuffer) {
+    AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+    std::lock_guard<std::mutex> lock(cAsynchronousData.cRingBuffersMutex);
+    pRingBuffer = new LogRingBuffer(cAsynchronousData.nRingBufferSize, cAsynchronousData.nNextThreadIndex++);
+    cAsynchronousData.lstRingBuffers.push_back(pRingBuffer);
+    ::detail::g_cThreadRingBuffer.pRingBuffer = pRingBuffer;
+  }
+  return *pRingBuffer;
+}
+
+/**
+*  @brief
+*    Get the maximum size of the encoded arguments of a record inside the ring buffer of the calling thread, asynchronous mode only
+*/
+uint32 Log::getMaximumArgumentsSize() {
+  return getThreadRingBuffer().getMaximumPayloadSize() - static_cast<uint32>(sizeof(LogRecordHeader));
+}
+
+/**
+*  @brief
+*    Reserve a record inside the ring buffer of the calling thread, asynchronous mode only
+*/
+LogRecordHeader *Log::reserveRecord(uint8 nLogLevel, uint32 nArgumentsSize) {
+  AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+
+  // Get the ring buffer of the calling thread, created on the first message
+  LogRingBuffer *pRingBuffer = &getThreadRingBuffer();
+
+  // Reserve the record, messages up to the flush log level are never dropped
+  const uint32 nPayloadSize = static_cast<uint32>(sizeof(LogRecordHeader)) + nArgumentsSize;
+  uint8 *pPayload = (nPayloadSize <= pRingBuffer->getMaximumPayloadSize()) ? pRingBuffer->reserve(nPayloadSize) : nullptr;
+  if (nullptr == pPayload && nPayloadSize <= pRingBuffer->getMaximumPayloadSize() &&
+      (BlockOnOverflow == cAsynchronousData.nOverflowPolicy || nLogLevel <= m_nFlushLogLevel)) {
+    // Block until the background thread made room, the background thread keeps running as long as there are producers
+    while (nullptr == pPayload) {
+      wakeUpAsynchronousThread();
+      {
+        std::unique_lock<std::mutex> lock(cAsynchronousData.cMutex);
+        cAsynchronousData.cProcessedCondition.wait_for(lock, std::chrono::milliseconds(1));
+      }
+      pPayload = pRingBuffer->reserve(nPayloadSize);
+    }
+  }
+  if (nullptr == pPayload) {
+    // Dropped, the background thread reports the number of dropped messages
+    cAsynchronousData.nNumberOfDroppedMessages.fetch_add(1, std::memory_order_relaxed);
+    cAsynchronousData.nTotalNumberOfDroppedMessages.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  // Initialize the record header
+  LogRecordHeader *pRecordHeader = reinterpret_cast<LogRecordHeader*>(pPayload);
+  pRecordHeader->nTimestamp = LogRecord::getTimestamp();
+  pRecordHeader->pLogFormat = nullptr;
+  pRecordHeader->nThreadIndex = pRingBuffer->getThreadIndex();
+  pRecordHeader->nArgumentsSize = nArgumentsSize;
+  pRecordHeader->nLogLevel = nLogLevel;
+  pRecordHeader->nNumberOfArguments = 0;
+
+  // Done
+  return pRecordHeader;
+}
+
+/**
+*  @brief
+*    Publish the previously reserved record to the background thread
+*/
+void Log::commitRecord(uint8 nLogLevel) {
+  LogRingBuffer *pRingBuffer = ::detail::g_cThreadRingBuffer.pRingBuffer;
+  pRingBuffer->commit();
+
+  // Don't let important messages wait for the next background thread pass, same for ring buffers running full
+  if (nLogLevel <= m_nFlushLogLevel || pRingBuffer->isHalfFull())
+    wakeUpAsynchronousThread();
+}
+
+/**
+*  @brief
+*    Flush in asynchronous mode
+*/
+bool Log::flushAsynchronous() {
+  AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+
+  // The background thread itself can flush directly
+  if (std::this_thread::get_id() == cAsynchronousData.cThread.get_id()) {
+    if (nullptr != cAsynchronousData.pBinaryFile)
+      return (0 == fflush(cAsynchronousData.pBinaryFile));
+    m_nFlushMessages = 0;
+    return (nullptr != m_pLogFormatter && m_pLogFormatter->flush());
+  }
+
+  // Request a flush and wait until the background thread processed it
+  std::unique_lock<std::mutex> lock(cAsynchronousData.cMutex);
+  const uint64 nFlushRequest = ++cAsynchronousData.nFlushRequest;
+  cAsynchronousData.bWakeUpRequested.store(true, std::memory_order_relaxed);
+  cAsynchronousData.cWakeUpCondition.notify_one();
+  cAsynchronousData.cProcessedCondition.wait(lock, [&cAsynchronousData, nFlushRequest]() {
+    return (cAsynchronousData.nFlushDone >= nFlushRequest || !cAsynchronousData.cThread.joinable());
+  });
+
+  // Done
+  return true;
+}
+
+/**
+*  @brief
+*    Wake up the background thread
+*/
+void Log::wakeUpAsynchronousThread() {
+  // Only notify if nobody else did, the background thread also wakes up periodically so a missed notification only adds latency
+  if (!m_pAsynchronousData->bWakeUpRequested.exchange(true, std::memory_order_acq_rel))
+    m_pAsynchronousData->cWakeUpCondition.notify_one();
+}
+
+/**
+*  @brief
+*    Background thread function
+*/
+void Log::asynchronousThread() {
+  AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+  bool bShutdown = false;
+  while (!bShutdown) {
+    // Wait for work
+    uint64 nFlushRequest = 0;
+    {
+      std::unique_lock<std::mutex> lock(cAsynchronousData.cMutex);
+      cAsynchronousData.cWakeUpCondition.wait_for(lock, std::chrono::milliseconds(10), [&cAsynchronousData]() {
+        return cAsynchronousData.bWakeUpRequested.load(std::memory_order_relaxed);
+      });
+      cAsynchronousData.bWakeUpRequested.store(false, std::memory_order_relaxed);
+      bShutdown = cAsynchronousData.bShutdown;
+      nFlushRequest = cAsynchronousData.nFlushRequest;
+    }
+
+    // Write all pending messages, after a shutdown request this is the final pass draining everything
+    processAsynchronousRecords();
+
+    // Flush if requested
+    if (nFlushRequest > cAsynchronousData.nFlushDone) {
+      if (nullptr != cAsynchronousData.pBinaryFile) {
+        fflush(cAsynchronousData.pBinaryFile);
+      } else {
+        fflush(stdout);
+        if (nullptr != m_pLogFormatter) {
+          m_nFlushMessages = 0;
+          m_pLogFormatter->flush();
+        }
+      }
+    }
+
+    // Inform waiting flush and blocked logging threads
+    {
+      std::lock_guard<std::mutex> lock(cAsynchronousData.cMutex);
+      cAsynchronousData.nFlushDone = nFlushRequest;
+    }
+    cAsynchronousData.cProcessedCondition.notify_all();
+  }
+}
+
+/**
+*  @brief
+*    Consume, sort and write all pending records of all threads, background thread only
+*/
+void Log::processAsynchronousRecords() {
+  AsynchronousData &cAsynchronousData = *m_pAsynchronousData;
+
+  // Get the current ring buffers, new ones are picked up during the next pass
+  {
+    std::lock_guard<std::mutex> lock(cAsynchronousData.cRingBuffersMutex);
+    cAsynchronousData.lstProcessRingBuffers = cAsynchronousData.lstRingBuffers;
+  }
+
+  // Copy the records of all ring buffers into one batch so the ring buffers are released as soon as possible
+  std::vector<uint8> &lstBatchData = cAsynchronousData.lstBatchData;
+  std::vector<::detail::BatchRecord> &lstBatchRecords = cAsynchronousData.lstBatchRecords;
+  lstBatchData.clear();
+  lstBatchRecords.clear();
+  for (LogRingBuffer *pRingBuffer : cAsynchronousData.lstProcessRingBuffers) {
+    // Read the orphaned state before consuming, an orphaned ring buffer is empty after consuming
+    const bool bOrphaned = pRingBuffer->isOrphaned();
+    pRingBuffer->consume([&lstBatchData, &lstBatchRecords](const uint8 *pPayload, uint32 nPayloadSize) {
+      // Payload sizes are multiples of 8, the record headers inside the batch data stay aligned
+      lstBatchRecords.push_back({reinterpret_cast<const LogRecordHeader*>(pPayload)->nTimestamp, static_cast<uint32>(lstBatchData.size())});
+      lstBatchData.insert(lstBatchData.end(), pPayload, pPayload + nPayloadSize);
+    });
+
+    // Destroy ring buffers of exited threads
+    if (bOrphaned) {
+      std::lock_guard<std::mutex> lock(cAsynchronousData.cRingBuffersMutex);
+      std::vector<LogRingBuffer*> &lstRingBuffers = cAsynchronousData.lstRingBuffers;
+      lstRingBuffers.erase(std::find(lstRingBuffers.begin(), lstRingBuffers.end(), pRingBuffer));
+      delete pRingBuffer;
+    }
+  }
+
+  // Merge the messages of the different threads in chronological order
+  std::stable_sort(lstBatchRecords.begin(), lstBatchRecords.end(), [](const ::detail::BatchRecord &cLeft, const ::detail::BatchRecord &cRight) {
+    return (cLeft.nTimestamp < cRight.nTimestamp);
+  });
+
+  // Write the messages
+  FILE *pBinaryFile = cAsynchronousData.pBinaryFile;
+  for (const ::detail::BatchRecord &cBatchRecord : lstBatchRecords) {
+    const LogRecordHeader &cRecordHeader = *reinterpret_cast<const LogRecordHeader*>(lstBatchData.data() + cBatchRecord.nOffset);
+    if (nullptr != pBinaryFile) {
+      // Write the call site description once, before the first record referencing it
+      uint32 nFormatId = 0;
+      if (nullptr != cRecordHeader.pLogFormat) {
+        std::unordered_map<const LogFormat*, uint32>::const_iterator iterator = cAsynchronousData.mapFormatIds.find(cRecordHeader.pLogFormat);
+        if (cAsynchronousData.mapFormatIds.cend() == iterator) {
+          nFormatId = cAsynchronousData.nNextFormatId++;
+          cAsynchronousData.mapFormatIds.emplace(cRecordHeader.pLogFormat, nFormatId);
+          LogRecord::writeBinaryFormat(pBinaryFile, nFormatId, *cRecordHeader.pLogFormat);
+        } else {
+          nFormatId = iterator->second;
+        }
+      }
+      LogRecord::writeBinaryRecord(pBinaryFile, nFormatId, cRecordHeader);
+    } else {
+      String &sText = cAsynchronousData.sText;
+      sText = "";
+      LogRecord::formatRecord(cRecordHeader, sText);
+      writeText(cRecordHeader.nLogLevel, sText);
+    }
+  }
+
+  // Report dropped messages
+  const uint32 nNumberOfDroppedMessages = cAsynchronousData.nNumberOfDroppedMessages.exchange(0, std::memory_order_relaxed);
+  if (nNumberOfDroppedMessages) {
+    if (nullptr != pBinaryFile)
+      LogRecord::writeBinaryDropped(pBinaryFile, nNumberOfDroppedMessages);
+    else
+      writeText(Warning, "[" + to_string(nNumberOfDroppedMessages) + " log messages dropped]");
+  }
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
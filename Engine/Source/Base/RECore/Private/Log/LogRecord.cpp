@@ -0,0 +1,396 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Log/LogRecord.h"
+#include "RECore/Log/Log.h"
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace {
+  namespace detail {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr RECore::uint32 BINARY_LOG_MAGIC   = 0x424C4552;  // "RELB"
+    static constexpr RECore::uint32 BINARY_LOG_VERSION = 1;
+
+    enum ChunkType {
+      FormatChunk = 1,
+      RecordChunk,
+      DroppedChunk
+    };
+
+    struct DecodedFormat {
+      RECore::uint8  nLogLevel;
+      RECore::uint32 nLine;
+      RECore::String sFormat;
+      RECore::String sFile;
+      RECore::String sFunction;
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    template <typename T>
+    [[nodiscard]] bool writeValue(FILE *pFile, const T &tValue) {
+      return (fwrite(&tValue, sizeof(T), 1, pFile) == 1);
+    }
+
+    [[nodiscard]] bool writeString(FILE *pFile, const char *pszString) {
+      const RECore::uint32 nLength = pszString ? static_cast<RECore::uint32>(strlen(pszString)) : 0;
+      return (writeValue(pFile, nLength) && (!nLength || fwrite(pszString, 1, nLength, pFile) == nLength));
+    }
+
+    template <typename T>
+    [[nodiscard]] bool readValue(const RECore::uint8 *&pCurrent, const RECore::uint8 *pEnd, T &tValue) {
+      if (pCurrent + sizeof(T) > pEnd)
+        return false;
+      memcpy(&tValue, pCurrent, sizeof(T));
+      pCurrent += sizeof(T);
+      return true;
+    }
+
+    [[nodiscard]] bool readString(const RECore::uint8 *&pCurrent, const RECore::uint8 *pEnd, RECore::String &sString) {
+      RECore::uint32 nLength = 0;
+      if (!readValue(pCurrent, pEnd, nLength) || pCurrent + nLength > pEnd)
+        return false;
+      sString = RECore::String(reinterpret_cast<const char*>(pCurrent), nLength);
+      pCurrent += nLength;
+      return true;
+    }
+
+    /**
+    *  @brief
+    *    Append a single encoded argument to the given string
+    *
+    *  @return
+    *    'true' if all went fine, else 'false' (truncated or invalid argument data)
+    */
+    [[nodiscard]] bool appendArgument(const RECore::uint8 *&pCurrent, const RECore::uint8 *pEnd, RECore::String &sText) {
+      RECore::uint8 nType = 0;
+      if (!readValue(pCurrent, pEnd, nType))
+        return false;
+      switch (nType) {
+        case RECore::LogRecord::BoolArgument:
+        {
+          RECore::uint8 nValue = 0;
+          if (!readValue(pCurrent, pEnd, nValue))
+            return false;
+          sText += nValue ? "true" : "false";
+          return true;
+        }
+
+        case RECore::LogRecord::StringArgument:
+        {
+          RECore::uint32 nLength = 0;
+          if (!readValue(pCurrent, pEnd, nLength) || pCurrent + nLength > pEnd)
+            return false;
+          sText.append(reinterpret_cast<const char*>(pCurrent), nLength);
+          pCurrent += nLength;
+          return true;
+        }
+
+        case RECore::LogRecord::Int64Argument:
+        case RECore::LogRecord::UInt64Argument:
+        case RECore::LogRecord::DoubleArgument:
+        case RECore::LogRecord::PointerArgument:
+        {
+          RECore::uint64 nValue = 0;
+          if (!readValue(pCurrent, pEnd, nValue))
+            return false;
+          if (RECore::LogRecord::Int64Argument == nType) {
+            sText.appendFormat("%lld", static_cast<long long>(static_cast<RECore::int64>(nValue)));
+          } else if (RECore::LogRecord::UInt64Argument == nType) {
+            sText.appendFormat("%llu", static_cast<unsigned long long>(nValue));
+          } else if (RECore::LogRecord::DoubleArgument == nType) {
+            double fValue = 0.0;
+            memcpy(&fValue, &nValue, sizeof(double));
+            sText.appendFormat("%g", fValue);
+          } else {
+            sText.appendFormat("0x%llx", static_cast<unsigned long long>(nValue));
+          }
+          return true;
+        }
+
+        default:
+          // Error!
+          return false;
+      }
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Get the current timestamp
+*/
+uint64 LogRecord::getTimestamp() {
+  return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+*  @brief
+*    Format a message
+*/
+void LogRecord::formatMessage(const char *pszFormat, const uint8 *pArguments, uint32 nArgumentsSize, uint8 nNumberOfArguments, String &sText) {
+  const uint8 *pCurrent = pArguments;
+  const uint8 *pEnd = pArguments + nArgumentsSize;
+  uint32 nNumberOfRemainingArguments = nNumberOfArguments;
+  const char *pszSegment = pszFormat;
+  for (const char *pszCurrent = pszFormat; '\0' != *pszCurrent; ) {
+    if ('{' == pszCurrent[0] && '}' == pszCurrent[1] && nNumberOfRemainingArguments) {
+      // Flush the text in front of the placeholder and replace the placeholder by the argument
+      sText.append(pszSegment, pszCurrent);
+      if (::detail::appendArgument(pCurrent, pEnd, sText)) {
+        --nNumberOfRemainingArguments;
+      } else {
+        // Invalid argument data, don't touch the remaining placeholders
+        nNumberOfRemainingArguments = 0;
+      }
+      pszCurrent += 2;
+      pszSegment = pszCurrent;
+    } else {
+      ++pszCurrent;
+    }
+  }
+  sText += pszSegment;
+}
+
+/**
+*  @brief
+*    Format a record
+*/
+void LogRecord::formatRecord(const LogRecordHeader &cRecordHeader, String &sText) {
+  const uint8 *pArguments = reinterpret_cast<const uint8*>(&cRecordHeader + 1);
+  if (nullptr != cRecordHeader.pLogFormat) {
+    formatMessage(cRecordHeader.pLogFormat->pszFormat, pArguments, cRecordHeader.nArgumentsSize, cRecordHeader.nNumberOfArguments, sText);
+
+    // Same as "RE_LOG": Add the source location to debug messages
+    if (cRecordHeader.nLogLevel >= Log::Debug) {
+      sText += cRecordHeader.pLogFormat->pszFile;
+      sText.appendFormat("%u", cRecordHeader.pLogFormat->nLine);
+      sText += cRecordHeader.pLogFormat->pszFunction;
+    }
+  } else {
+    // Plain text record
+    formatMessage("{}", pArguments, cRecordHeader.nArgumentsSize, cRecordHeader.nNumberOfArguments, sText);
+  }
+}
+
+/**
+*  @brief
+*    Write the binary log file header
+*/
+bool LogRecord::writeBinaryFileHeader(FILE *pFile) {
+  return (::detail::writeValue(pFile, ::detail::BINARY_LOG_MAGIC) && ::detail::writeValue(pFile, ::detail::BINARY_LOG_VERSION));
+}
+
+/**
+*  @brief
+*    Write a binary log format chunk
+*/
+bool LogRecord::writeBinaryFormat(FILE *pFile, uint32 nFormatId, const LogFormat &cLogFormat) {
+  return (::detail::writeValue(pFile, static_cast<uint8>(::detail::FormatChunk)) &&
+          ::detail::writeValue(pFile, nFormatId) &&
+          ::detail::writeValue(pFile, cLogFormat.nLogLevel) &&
+          ::detail::writeValue(pFile, cLogFormat.nLine) &&
+          ::detail::writeString(pFile, cLogFormat.pszFormat) &&
+          ::detail::writeString(pFile, cLogFormat.pszFile) &&
+          ::detail::writeString(pFile, cLogFormat.pszFunction));
+}
+
+/**
+*  @brief
+*    Write a binary log record chunk
+*/
+bool LogRecord::writeBinaryRecord(FILE *pFile, uint32 nFormatId, const LogRecordHeader &cRecordHeader) {
+  return (::detail::writeValue(pFile, static_cast<uint8>(::detail::RecordChunk)) &&
+          ::detail::writeValue(pFile, cRecordHeader.nTimestamp) &&
+          ::detail::writeValue(pFile, cRecordHeader.nThreadIndex) &&
+          ::detail::writeValue(pFile, nFormatId) &&
+          ::detail::writeValue(pFile, cRecordHeader.nLogLevel) &&
+          ::detail::writeValue(pFile, cRecordHeader.nNumberOfArguments) &&
+          ::detail::writeValue(pFile, cRecordHeader.nArgumentsSize) &&
+          (!cRecordHeader.nArgumentsSize || fwrite(&cRecordHeader + 1, 1, cRecordHeader.nArgumentsSize, pFile) == cRecordHeader.nArgumentsSize));
+}
+
+/**
+*  @brief
+*    Write a binary log dropped chunk
+*/
+bool LogRecord::writeBinaryDropped(FILE *pFile, uint32 nNumberOfDroppedRecords) {
+  return (::detail::writeValue(pFile, static_cast<uint8>(::detail::DroppedChunk)) && ::detail::writeValue(pFile, nNumberOfDroppedRecords));
+}
+
+/**
+*  @brief
+*    Offline decoder: convert a binary log file into a text log file
+*/
+bool LogRecord::decodeBinaryFile(const String &sBinaryFilename, const String &sTextFilename) {
+  // Read the whole binary log into memory
+  std::vector<uint8> lstData;
+  {
+    FILE *pFile = fopen(sBinaryFilename.cstr(), "rb");
+    if (nullptr == pFile)
+      return false; // Error!
+    uint8 nBuffer[64 * 1024];
+    size_t nNumberOfReadBytes = 0;
+    while ((nNumberOfReadBytes = fread(nBuffer, 1, sizeof(nBuffer), pFile)) > 0)
+      lstData.insert(lstData.end(), nBuffer, nBuffer + nNumberOfReadBytes);
+    fclose(pFile);
+  }
+  const uint8 *pCurrent = lstData.data();
+  const uint8 *pEnd = pCurrent + lstData.size();
+
+  // Check the file header
+  uint32 nMagic = 0;
+  uint32 nVersion = 0;
+  if (!::detail::readValue(pCurrent, pEnd, nMagic) || !::detail::readValue(pCurrent, pEnd, nVersion) ||
+      ::detail::BINARY_LOG_MAGIC != nMagic || ::detail::BINARY_LOG_VERSION != nVersion)
+    return false; // Error!
+
+  FILE *pTextFile = fopen(sTextFilename.cstr(), "w");
+  if (nullptr == pTextFile)
+    return false; // Error!
+
+  // Decode the chunks, timestamps are written relative to the first record
+  const Log &cLog = Log::instance();
+  std::unordered_map<uint32, ::detail::DecodedFormat> mapFormats;
+  uint64 nFirstTimestamp = 0;
+  bool bFirstRecord = true;
+  bool bResult = true;
+  String sLine;
+  while (pCurrent < pEnd && bResult) {
+    uint8 nChunkType = 0;
+    bResult = ::detail::readValue(pCurrent, pEnd, nChunkType);
+    if (!bResult)
+      break;
+    sLine = "";
+    switch (nChunkType) {
+      case ::detail::FormatChunk:
+      {
+        uint32 nFormatId = 0;
+        ::detail::DecodedFormat sDecodedFormat;
+        bResult = (::detail::readValue(pCurrent, pEnd, nFormatId) &&
+                   ::detail::readValue(pCurrent, pEnd, sDecodedFormat.nLogLevel) &&
+                   ::detail::readValue(pCurrent, pEnd, sDecodedFormat.nLine) &&
+                   ::detail::readString(pCurrent, pEnd, sDecodedFormat.sFormat) &&
+                   ::detail::readString(pCurrent, pEnd, sDecodedFormat.sFile) &&
+                   ::detail::readString(pCurrent, pEnd, sDecodedFormat.sFunction));
+        if (bResult)
+          mapFormats[nFormatId] = sDecodedFormat;
+        break;
+      }
+
+      case ::detail::RecordChunk:
+      {
+        uint64 nTimestamp = 0;
+        uint32 nThreadIndex = 0;
+        uint32 nFormatId = 0;
+        uint8 nLogLevel = 0;
+        uint8 nNumberOfArguments = 0;
+        uint32 nArgumentsSize = 0;
+        bResult = (::detail::readValue(pCurrent, pEnd, nTimestamp) &&
+                   ::detail::readValue(pCurrent, pEnd, nThreadIndex) &&
+                   ::detail::readValue(pCurrent, pEnd, nFormatId) &&
+                   ::detail::readValue(pCurrent, pEnd, nLogLevel) &&
+                   ::detail::readValue(pCurrent, pEnd, nNumberOfArguments) &&
+                   ::detail::readValue(pCurrent, pEnd, nArgumentsSize) &&
+                   pCurrent + nArgumentsSize <= pEnd);
+        if (!bResult)
+          break;
+        if (bFirstRecord) {
+          nFirstTimestamp = nTimestamp;
+          bFirstRecord = false;
+        }
+        const uint64 nRelativeTimestamp = (nTimestamp > nFirstTimestamp) ? (nTimestamp - nFirstTimestamp) : 0;
+        sLine.appendFormat("[%.6f] [%u] [", static_cast<double>(nRelativeTimestamp) * 1e-9, nThreadIndex);
+        sLine += cLog.logLevelToString(nLogLevel);
+        sLine += "]: ";
+        if (nFormatId) {
+          std::unordered_map<uint32, ::detail::DecodedFormat>::const_iterator iterator = mapFormats.find(nFormatId);
+          bResult = (mapFormats.cend() != iterator);
+          if (!bResult)
+            break;
+          formatMessage(iterator->second.sFormat.cstr(), pCurrent, nArgumentsSize, nNumberOfArguments, sLine);
+          sLine.appendFormat(" (%s:%u, %s)", iterator->second.sFile.cstr(), iterator->second.nLine, iterator->second.sFunction.cstr());
+        } else {
+          formatMessage("{}", pCurrent, nArgumentsSize, nNumberOfArguments, sLine);
+        }
+        pCurrent += nArgumentsSize;
+        sLine += '\n';
+        break;
+      }
+
+      case ::detail::DroppedChunk:
+      {
+        uint32 nNumberOfDroppedRecords = 0;
+        bResult = ::detail::readValue(pCurrent, pEnd, nNumberOfDroppedRecords);
+        if (bResult)
+          sLine.appendFormat("[%u log messages dropped]\n", nNumberOfDroppedRecords);
+        break;
+      }
+
+      default:
+        // Error!
+        bResult = false;
+        break;
+    }
+    if (bResult && sLine.length())
+      fputs(sLine.cstr(), pTextFile);
+  }
+  fclose(pTextFile);
+
+  // Done
+  return bResult;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Log/LogRingBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+LogRingBuffer::LogRingBuffer(uint32 nCapacity, uint32 nThreadIndex) :
+  m_pBuffer(nullptr),
+  m_nCapacity(1024),
+  m_nThreadIndex(nThreadIndex),
+  m_bOrphaned(false),
+  m_nHead(0),
+  m_nReservedHead(0),
+  m_nCachedTail(0),
+  m_nTail(0) {
+  // Round the capacity up to the next power of two
+  while (m_nCapacity < nCapacity && m_nCapacity < 0x80000000)
+    m_nCapacity <<= 1;
+
+  // Allocate the buffer, aligned to the record alignment
+  m_pBuffer = new uint8[m_nCapacity];
+  ASSERT((reinterpret_cast<uintptr_t>(m_pBuffer) % RECORD_ALIGNMENT) == 0, "Invalid log ring buffer alignment");
+}
+
+/**
+*  @brief
+*    Destructor
+*/
+LogRingBuffer::~LogRingBuffer() {
+  delete [] m_pBuffer;
+}
+
+/**
+*  @brief
+*    Reserve a record
+*/
+uint8 *LogRingBuffer::reserve(uint32 nPayloadSize) {
+  // Records which can never fit are rejected right away
+  if (nPayloadSize > getMaximumPayloadSize())
+    return nullptr;
+  const uint32 nRecordSize = (RECORD_HEADER_SIZE + nPayloadSize + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+
+  // If the record doesn't fit into the contiguous space until the end of the buffer, a padding record is required
+  const uint64 nHead = m_nHead.load(std::memory_order_relaxed);
+  const uint32 nOffset = static_cast<uint32>(nHead & (m_nCapacity - 1));
+  const uint32 nContiguousSize = m_nCapacity - nOffset;
+  const uint32 nPaddingSize = (nRecordSize > nContiguousSize) ? nContiguousSize : 0;
+  const uint64 nRequiredSize = nPaddingSize + nRecordSize;
+
+  // Check the free space, only reload the consumer position if the cached one isn't sufficient
+  if (nHead + nRequiredSize - m_nCachedTail > m_nCapacity) {
+    m_nCachedTail = m_nTail.load(std::memory_order_acquire);
+    if (nHead + nRequiredSize - m_nCachedTail > m_nCapacity) {
+      // Full
+      return nullptr;
+    }
+  }
+
+  // Write the padding record
+  uint64 nRecordPosition = nHead;
+  if (nPaddingSize) {
+    RecordHeader *pPaddingHeader = reinterpret_cast<RecordHeader*>(m_pBuffer + nOffset);
+    pPaddingHeader->nSize = nPaddingSize;
+    pPaddingHeader->nPadding = 1;
+    nRecordPosition += nPaddingSize;
+  }
+
+  // Write the record header
+  uint8 *pRecord = m_pBuffer + (nRecordPosition & (m_nCapacity - 1));
+  RecordHeader *pRecordHeader = reinterpret_cast<RecordHeader*>(pRecord);
+  pRecordHeader->nSize = nRecordSize;
+  pRecordHeader->nPadding = 0;
+  m_nReservedHead = nRecordPosition + nRecordSize;
+
+  // Done
+  return pRecord + RECORD_HEADER_SIZE;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Memory/LinearAllocator.h"
+
+#include <cstring>	// For "memmove()" and "memcpy()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+LinearAllocator::LinearAllocator(const char* tag, size_t capacity, IAllocator& backingAllocator) :
+  IAllocator(&LinearAllocator::staticReallocate),
+  mBackingAllocator(backingAllocator),
+  mBuffer(nullptr),
+  mCapacity(capacity),
+  mOffset(0),
+  mOverflowBlocks(nullptr),
+  mStatistics(tag)
+{
+  // Allocate the buffer, cache line aligned
+  if (0 != mCapacity)
+  {
+    mBuffer = static_cast<uint8*>(mBackingAllocator.reallocate(nullptr, 0, mCapacity, 64));
+    if (nullptr == mBuffer)
+    {
+      // Out of memory, every allocation will be passed to the backing allocator
+      mCapacity = 0;
+    }
+  }
+}
+
+LinearAllocator::~LinearAllocator()
+{
+  freeOverflowBlocks();
+  if (nullptr != mBuffer)
+  {
+    mBackingAllocator.reallocate(mBuffer, mCapacity, 0, 64);
+  }
+}
+
+void LinearAllocator::reset()
+{
+  freeOverflowBlocks();
+  mStatistics.onFree(mOffset.exchange(0, std::memory_order_relaxed));
+  mStatistics.beginFrame();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+void* LinearAllocator::staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+{
+  // Sanity check
+  ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The alignment must be a power of two")
+  LinearAllocator& linearAllocator = static_cast<LinearAllocator&>(allocator);
+
+  // Allocate
+  if (nullptr == oldPointer)
+  {
+    return (0 != newNumberOfBytes) ? linearAllocator.allocate(newNumberOfBytes, alignment) : nullptr;
+  }
+
+  // Free: Nothing to do in here, the memory is released by "reset()" (this includes overflow blocks)
+  if (0 == newNumberOfBytes)
+  {
+    return nullptr;
+  }
+
+  // Memory which didn't fit into the buffer is an overflow block, its header knows the number of bytes
+  if (!linearAllocator.isOwnedPointer(oldPointer))
+  {
+    const OverflowBlock& overflowBlock = getOverflowBlock(oldPointer);
+    if (newNumberOfBytes <= overflowBlock.numberOfBytes && 0 == (reinterpret_cast<uintptr_t>(oldPointer) & (alignment - 1)))
+    {
+      // Shrink in place, the surplus bytes are released by "reset()"
+      return oldPointer;
+    }
+    void* newPointer = linearAllocator.allocate(newNumberOfBytes, alignment);
+    if (nullptr != newPointer)
+    {
+      memcpy(newPointer, oldPointer, (overflowBlock.numberOfBytes < newNumberOfBytes) ? overflowBlock.numberOfBytes : newNumberOfBytes);
+    }
+    return newPointer;
+  }
+
+  // Resize in place if this is the most recent allocation
+  const size_t oldOffset = static_cast<size_t>(static_cast<uint8*>(oldPointer) - linearAllocator.mBuffer);
+  if (0 != oldNumberOfBytes && 0 == (reinterpret_cast<uintptr_t>(oldPointer) & (alignment - 1)) && oldOffset + newNumberOfBytes <= linearAllocator.mCapacity)
+  {
+    size_t expectedOffset = oldOffset + oldNumberOfBytes;
+    if (linearAllocator.mOffset.compare_exchange_strong(expectedOffset, oldOffset + newNumberOfBytes, std::memory_order_relaxed))
+    {
+      if (newNumberOfBytes > oldNumberOfBytes)
+      {
+        linearAllocator.mStatistics.onAllocate(newNumberOfBytes - oldNumberOfBytes);
+      }
+      else
+      {
+        linearAllocator.mStatistics.onFree(oldNumberOfBytes - newNumberOfBytes);
+      }
+      return oldPointer;
+    }
+  }
+
+  // Allocate and copy, if the old size is unknown copy as much as the buffer and the new size allow (copying surplus bytes is harmless)
+  void* newPointer = linearAllocator.allocate(newNumberOfBytes, alignment);
+  if (nullptr != newPointer)
+  {
+    size_t numberOfBytesToCopy = (0 != oldNumberOfBytes) ? oldNumberOfBytes : (linearAllocator.mCapacity - oldOffset);
+    if (numberOfBytesToCopy > newNumberOfBytes)
+    {
+      numberOfBytesToCopy = newNumberOfBytes;
+    }
+    memmove(newPointer, oldPointer, numberOfBytesToCopy);
+  }
+  return newPointer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void* LinearAllocator::allocate(size_t numberOfBytes, size_t alignment)
+{
+  const uintptr_t bufferAddress = reinterpret_cast<uintptr_t>(mBuffer);
+  size_t offset = mOffset.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    const size_t alignedOffset = static_cast<size_t>(((bufferAddress + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - bufferAddress);
+    const size_t newOffset = alignedOffset + numberOfBytes;
+    if (newOffset > mCapacity)
+    {
+      // Out of memory, pass the allocation to the backing allocator
+      return allocateOverflowBlock(numberOfBytes, alignment);
+    }
+    if (mOffset.compare_exchange_weak(offset, newOffset, std::memory_order_relaxed))
+    {
+      // The alignment padding is accounted as well so "reset()" can release the exact number of bytes
+      mStatistics.onAllocate(newOffset - offset);
+      return mBuffer + alignedOffset;
+    }
+  }
+}
+
+void* LinearAllocator::allocateOverflowBlock(size_t numberOfBytes, size_t alignment)
+{
+  // The overflow block header is directly in front of the returned pointer
+  const size_t blockAlignment = (alignment > alignof(OverflowBlock)) ? alignment : alignof(OverflowBlock);
+  const size_t headerSize = (sizeof(OverflowBlock) + blockAlignment - 1) & ~(blockAlignment - 1);
+  const size_t totalNumberOfBytes = headerSize + numberOfBytes;
+  uint8* basePointer = static_cast<uint8*>(mBackingAllocator.reallocate(nullptr, 0, totalNumberOfBytes, blockAlignment));
+  if (nullptr == basePointer)
+  {
+    // Error!
+    return nullptr;
+  }
+  uint8* pointer = basePointer + headerSize;
+  OverflowBlock& overflowBlock = getOverflowBlock(pointer);
+  overflowBlock.basePointer = basePointer;
+  overflowBlock.numberOfBytes = numberOfBytes;
+  overflowBlock.totalNumberOfBytes = totalNumberOfBytes;
+  overflowBlock.alignment = blockAlignment;
+
+  // Add the overflow block to the list so "reset()" can release it
+  overflowBlock.next = mOverflowBlocks.load(std::memory_order_relaxed);
+  while (!mOverflowBlocks.compare_exchange_weak(overflowBlock.next, &overflowBlock, std::memory_order_release, std::memory_order_relaxed))
+  {
+    // Try again, "overflowBlock.next" has been updated
+  }
+  mStatistics.onAllocate(numberOfBytes);
+  mStatistics.onBackingAllocation();
+
+  // Done
+  return pointer;
+}
+
+void LinearAllocator::freeOverflowBlocks()
+{
+  OverflowBlock* overflowBlock = mOverflowBlocks.exchange(nullptr, std::memory_order_acquire);
+  while (nullptr != overflowBlock)
+  {
+    OverflowBlock* nextOverflowBlock = overflowBlock->next;
+    mStatistics.onFree(overflowBlock->numberOfBytes);
+    mBackingAllocator.reallocate(overflowBlock->basePointer, overflowBlock->totalNumberOfBytes, 0, overflowBlock->alignment);
+    overflowBlock = nextOverflowBlock;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -31,6 +31,10 @@
 namespace RECore {
 
 MimallocAllocator Memory::SAllocator;
+#ifdef RECORE_MEMORY_TRACKING
+  // Must be defined after "SAllocator", the initialization order inside a single translation unit is the definition order
+  TrackingAllocator Memory::STrackingAllocator(Memory::SAllocator);
+#endif
 
 
 //[-------------------------------------------------------]
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Memory/MemoryTracker.h"
+#include "RECore/File/IFile.h"
+#include "RECore/File/IFileManager.h"
+#include "RECore/Log/Log.h"
+
+#include <algorithm>
+#include <cstring>	// For "strcmp()"
+#include <mutex>
+#include <string>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Classes                                               ]
+    //[-------------------------------------------------------]
+    /**
+    *  @brief
+    *    Registry of all memory tags
+    *
+    *  @note
+    *    - The statistics instances are intentionally never destroyed, memory might still be freed during static deinitialization
+    *    - A statistics pointer is written before the number of tags is increased, readers only access indices below the number of tags
+    */
+    struct TagRegistry final
+    {
+      std::mutex                  mutex;
+      std::atomic<RECore::uint32> numberOfTags;
+      RECore::AllocatorStatistics* statistics[RECore::MemoryTracker::MAXIMUM_NUMBER_OF_TAGS];
+      std::atomic<RECore::uint64> budgets[RECore::MemoryTracker::MAXIMUM_NUMBER_OF_TAGS];
+      std::atomic<bool>           overBudget[RECore::MemoryTracker::MAXIMUM_NUMBER_OF_TAGS];
+
+      TagRegistry() :
+        numberOfTags(1)
+      {
+        statistics[RECore::MemoryTracker::UNTAGGED] = new RECore::AllocatorStatistics("Untagged");
+        for (RECore::uint32 i = 0; i < RECore::MemoryTracker::MAXIMUM_NUMBER_OF_TAGS; ++i)
+        {
+          if (RECore::MemoryTracker::UNTAGGED != i)
+          {
+            statistics[i] = nullptr;
+          }
+          budgets[i].store(0, std::memory_order_relaxed);
+          overBudget[i].store(false, std::memory_order_relaxed);
+        }
+      }
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global variables                                      ]
+    //[-------------------------------------------------------]
+    thread_local RECore::uint32 g_ThreadTagIndex = RECore::MemoryTracker::UNTAGGED;
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    [[nodiscard]] TagRegistry& getTagRegistry()
+    {
+      // Function local static so the registry can be used during static initialization
+      static TagRegistry tagRegistry;
+      return tagRegistry;
+    }
+
+    [[nodiscard]] inline bool isValidTagIndex(const TagRegistry& tagRegistry, RECore::uint32 tagIndex)
+    {
+      return (tagIndex < tagRegistry.numberOfTags.load(std::memory_order_acquire));
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Public static methods                                 ]
+//[-------------------------------------------------------]
+uint32 MemoryTracker::registerTag(const char* tag)
+{
+  ASSERT(nullptr != tag, "Invalid memory tag")
+  ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  std::lock_guard<std::mutex> lock(tagRegistry.mutex);
+
+  // Is the tag already registered?
+  const uint32 numberOfTags = tagRegistry.numberOfTags.load(std::memory_order_relaxed);
+  for (uint32 i = 0; i < numberOfTags; ++i)
+  {
+    if (0 == strcmp(tagRegistry.statistics[i]->getTag(), tag))
+    {
+      return i;
+    }
+  }
+
+  // Register new tag
+  if (numberOfTags >= MAXIMUM_NUMBER_OF_TAGS)
+  {
+    RE_LOG(Warning, String("Maximum number of memory tags reached, \"") + tag + "\" will be tracked as untagged")
+    return UNTAGGED;
+  }
+  tagRegistry.statistics[numberOfTags] = new AllocatorStatistics(tag);
+  tagRegistry.numberOfTags.store(numberOfTags + 1, std::memory_order_release);
+  return numberOfTags;
+}
+
+uint32 MemoryTracker::getNumberOfTags()
+{
+  return ::detail::getTagRegistry().numberOfTags.load(std::memory_order_acquire);
+}
+
+const AllocatorStatistics& MemoryTracker::getStatistics(uint32 tagIndex)
+{
+  const ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  return *tagRegistry.statistics[tagIndex];
+}
+
+uint64 MemoryTracker::getBudget(uint32 tagIndex)
+{
+  const ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  return tagRegistry.budgets[tagIndex].load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::setBudget(uint32 tagIndex, uint64 numberOfBytes)
+{
+  ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  tagRegistry.budgets[tagIndex].store(numberOfBytes, std::memory_order_relaxed);
+  tagRegistry.overBudget[tagIndex].store(false, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::isOverBudget(uint32 tagIndex)
+{
+  const ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  const uint64 budget = tagRegistry.budgets[tagIndex].load(std::memory_order_relaxed);
+  return (0 != budget && tagRegistry.statistics[tagIndex]->getLiveBytes() > budget);
+}
+
+uint32 MemoryTracker::getThreadTag()
+{
+  return ::detail::g_ThreadTagIndex;
+}
+
+uint32 MemoryTracker::setThreadTag(uint32 tagIndex)
+{
+  const uint32 previousTagIndex = ::detail::g_ThreadTagIndex;
+  ::detail::g_ThreadTagIndex = tagIndex;
+  return previousTagIndex;
+}
+
+void MemoryTracker::onAllocate(uint32 tagIndex, uint64 numberOfBytes)
+{
+  ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  AllocatorStatistics& statistics = *tagRegistry.statistics[tagIndex];
+  statistics.onAllocate(numberOfBytes);
+
+  // Budget check, warn only once per budget violation
+  // -> Mark the violation before writing the log since writing the log might allocate memory as well
+  const uint64 budget = tagRegistry.budgets[tagIndex].load(std::memory_order_relaxed);
+  if (0 != budget && statistics.getLiveBytes() > budget && !tagRegistry.overBudget[tagIndex].exchange(true, std::memory_order_relaxed))
+  {
+    RE_LOG(Warning, String("Memory tag \"") + statistics.getTag() + "\" exceeded its budget of " + to_string(budget) + " bytes")
+  }
+}
+
+void MemoryTracker::onFree(uint32 tagIndex, uint64 numberOfBytes)
+{
+  ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  ASSERT(::detail::isValidTagIndex(tagRegistry, tagIndex), "Invalid memory tag index")
+  AllocatorStatistics& statistics = *tagRegistry.statistics[tagIndex];
+  statistics.onFree(numberOfBytes);
+
+  // Back inside the budget, warn again on the next violation
+  const uint64 budget = tagRegistry.budgets[tagIndex].load(std::memory_order_relaxed);
+  if (0 != budget && statistics.getLiveBytes() <= budget)
+  {
+    tagRegistry.overBudget[tagIndex].store(false, std::memory_order_relaxed);
+  }
+}
+
+void MemoryTracker::getSnapshot(Snapshot& snapshot)
+{
+  const ::detail::TagRegistry& tagRegistry = ::detail::getTagRegistry();
+  const uint32 numberOfTags = tagRegistry.numberOfTags.load(std::memory_order_acquire);
+  snapshot.reserve(snapshot.size() + numberOfTags);
+  for (uint32 i = 0; i < numberOfTags; ++i)
+  {
+    const AllocatorStatistics& statistics = *tagRegistry.statistics[i];
+    snapshot.push_back({ statistics.getTag(), statistics.getLiveBytes(), statistics.getPeakBytes(), statistics.getNumberOfAllocations(), tagRegistry.budgets[i].load(std::memory_order_relaxed) });
+  }
+}
+
+bool MemoryTracker::writeSnapshot(const Snapshot& snapshot, IFileManager& fileManager, VirtualFilename virtualFilename)
+{
+  // Sort by tag name so two snapshots can be compared line by line
+  std::vector<const SnapshotEntry*> sortedEntries;
+  sortedEntries.reserve(snapshot.size());
+  for (const SnapshotEntry& snapshotEntry : snapshot)
+  {
+    sortedEntries.push_back(&snapshotEntry);
+  }
+  std::sort(sortedEntries.begin(), sortedEntries.end(), [](const SnapshotEntry* left, const SnapshotEntry* right) { return (strcmp(left->tag, right->tag) < 0); });
+
+  // Comma-separated values
+  std::string text = "Tag,LiveBytes,PeakBytes,NumberOfAllocations,BudgetBytes\n";
+  for (const SnapshotEntry* snapshotEntry : sortedEntries)
+  {
+    text += snapshotEntry->tag;
+    text += ',' + std::to_string(snapshotEntry->liveBytes);
+    text += ',' + std::to_string(snapshotEntry->peakBytes);
+    text += ',' + std::to_string(snapshotEntry->numberOfAllocations);
+    text += ',' + std::to_string(snapshotEntry->budgetBytes);
+    text += '\n';
+  }
+
+  // Write the file
+  IFile* file = fileManager.openFile(IFileManager::FileMode::WRITE, virtualFilename);
+  if (nullptr != file)
+  {
+    file->write(text.data(), text.size());
+    fileManager.closeFile(*file);
+
+    // Done
+    return true;
+  }
+
+  // Error!
+  return false;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
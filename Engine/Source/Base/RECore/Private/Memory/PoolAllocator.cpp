@@ -0,0 +1,429 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Memory/PoolAllocator.h"
+
+#include <cstring>	// For "memcpy()"
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Structures                                            ]
+    //[-------------------------------------------------------]
+    struct ThreadCacheSlot final
+    {
+      RECore::uint64 allocatorId    = 0;        ///< ID of the pool allocator the cached blocks belong to, 0 = unused slot
+      void*          freeList       = nullptr;  ///< Linked cached free blocks, can be a null pointer
+      RECore::uint32 numberOfBlocks = 0;        ///< Number of cached free blocks
+    };
+
+    typedef std::unordered_map<RECore::uint64, RECore::PoolAllocator*> PoolAllocatorRegistry;
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    [[nodiscard]] std::mutex& getRegistryMutex()
+    {
+      static std::mutex registryMutex;
+      return registryMutex;
+    }
+
+    /**
+    *  @brief
+    *    Return the pool allocators which are currently alive, guarded by "getRegistryMutex()"
+    */
+    [[nodiscard]] PoolAllocatorRegistry& getRegistry()
+    {
+      static PoolAllocatorRegistry registry;
+      return registry;
+    }
+
+    [[nodiscard]] inline void*& getNextBlock(void* block)
+    {
+      return *static_cast<void**>(block);
+    }
+
+
+    //[-------------------------------------------------------]
+    //[ Classes                                               ]
+    //[-------------------------------------------------------]
+    /**
+    *  @brief
+    *    Free blocks cached by the current thread, given back to the pool allocators when the thread exits
+    */
+    class ThreadCache final
+    {
+    public:
+      ~ThreadCache()
+      {
+        std::lock_guard<std::mutex> registryMutexLock(getRegistryMutex());
+        const PoolAllocatorRegistry& registry = getRegistry();
+        for (ThreadCacheSlot& slot : slots)
+        {
+          if (nullptr != slot.freeList)
+          {
+            PoolAllocatorRegistry::const_iterator iterator = registry.find(slot.allocatorId);
+            if (registry.cend() != iterator)
+            {
+              iterator->second->releaseBlocks(slot.freeList);
+            }
+          }
+        }
+      }
+
+      [[nodiscard]] ThreadCacheSlot* getSlot(RECore::uint64 allocatorId)
+      {
+        // Fast path: The slot already exists
+        for (ThreadCacheSlot& slot : slots)
+        {
+          if (slot.allocatorId == allocatorId)
+          {
+            return &slot;
+          }
+        }
+
+        // Claim an unused slot
+        for (ThreadCacheSlot& slot : slots)
+        {
+          if (0 == slot.allocatorId)
+          {
+            slot.allocatorId = allocatorId;
+            return &slot;
+          }
+        }
+
+        // Claim a slot of a destroyed pool allocator, the cached blocks were part of the destroyed pool
+        std::lock_guard<std::mutex> registryMutexLock(getRegistryMutex());
+        const PoolAllocatorRegistry& registry = getRegistry();
+        for (ThreadCacheSlot& slot : slots)
+        {
+          if (registry.cend() == registry.find(slot.allocatorId))
+          {
+            slot.allocatorId = allocatorId;
+            slot.freeList = nullptr;
+            slot.numberOfBlocks = 0;
+            return &slot;
+          }
+        }
+
+        // All slots are in use
+        return nullptr;
+      }
+
+    private:
+      ThreadCacheSlot slots[RECore::PoolAllocator::MAXIMUM_NUMBER_OF_THREAD_CACHES];
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global variables                                      ]
+    //[-------------------------------------------------------]
+    std::atomic<RECore::uint64> g_NextPoolAllocatorId(1);
+    thread_local ThreadCache g_ThreadCache;
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+PoolAllocator::PoolAllocator(const char* tag, size_t blockSize, uint32 numberOfBlocks, IAllocator& backingAllocator, size_t blockAlignment) :
+  IAllocator(&PoolAllocator::staticReallocate),
+  mBackingAllocator(backingAllocator),
+  mId(::detail::g_NextPoolAllocatorId.fetch_add(1, std::memory_order_relaxed)),
+  mBlockSize(0),
+  mBlockAlignment(blockAlignment),
+  mNumberOfBlocks(numberOfBlocks),
+  mBuffer(nullptr),
+  mFreeList(nullptr),
+  mNextUntouchedBlock(0),
+  mStatistics(tag)
+{
+  // Sanity check
+  ASSERT(0 != mBlockAlignment && !(mBlockAlignment & (mBlockAlignment - 1)), "The block alignment must be a power of two")
+  ASSERT(mBlockAlignment >= sizeof(void*), "The block alignment must be at least the size of a pointer")
+
+  // A free block stores the pointer to the next free block
+  mBlockSize = (((blockSize < sizeof(void*)) ? sizeof(void*) : blockSize) + mBlockAlignment - 1) & ~(mBlockAlignment - 1);
+
+  // Allocate the memory of all blocks at once
+  if (0 != mNumberOfBlocks)
+  {
+    mBuffer = static_cast<uint8*>(mBackingAllocator.reallocate(nullptr, 0, mBlockSize * mNumberOfBlocks, mBlockAlignment));
+    if (nullptr == mBuffer)
+    {
+      // Out of memory, every allocation will be passed to the backing allocator
+      mNumberOfBlocks = 0;
+    }
+  }
+
+  // Register the pool allocator so thread caches are able to detect destroyed pool allocators
+  std::lock_guard<std::mutex> registryMutexLock(::detail::getRegistryMutex());
+  ::detail::getRegistry().emplace(mId, this);
+}
+
+PoolAllocator::~PoolAllocator()
+{
+  // Unregister the pool allocator, from now on thread caches consider the blocks cached for this pool allocator to be gone
+  {
+    std::lock_guard<std::mutex> registryMutexLock(::detail::getRegistryMutex());
+    ::detail::getRegistry().erase(mId);
+  }
+
+  // Free the memory of all blocks
+  if (nullptr != mBuffer)
+  {
+    mBackingAllocator.reallocate(mBuffer, mBlockSize * mNumberOfBlocks, 0, mBlockAlignment);
+  }
+}
+
+uint32 PoolAllocator::acquireBatch(void*& freeList)
+{
+  std::lock_guard<std::mutex> mutexLock(mMutex);
+  uint32 numberOfBlocks = 0;
+  freeList = nullptr;
+
+  // Take free blocks first
+  while (nullptr != mFreeList && numberOfBlocks < BATCH_SIZE)
+  {
+    void* block = mFreeList;
+    mFreeList = ::detail::getNextBlock(block);
+    ::detail::getNextBlock(block) = freeList;
+    freeList = block;
+    ++numberOfBlocks;
+  }
+
+  // Use never touched blocks, this way the memory of the pool is linked lazily
+  while (mNextUntouchedBlock < mNumberOfBlocks && numberOfBlocks < BATCH_SIZE)
+  {
+    void* block = mBuffer + mBlockSize * mNextUntouchedBlock;
+    ::detail::getNextBlock(block) = freeList;
+    freeList = block;
+    ++mNextUntouchedBlock;
+    ++numberOfBlocks;
+  }
+
+  // Done
+  return numberOfBlocks;
+}
+
+void PoolAllocator::releaseBlocks(void* freeList)
+{
+  if (nullptr != freeList)
+  {
+    // Find the last block outside of the lock
+    void* lastBlock = freeList;
+    while (nullptr != ::detail::getNextBlock(lastBlock))
+    {
+      lastBlock = ::detail::getNextBlock(lastBlock);
+    }
+
+    // Put the blocks in front of the shared free list
+    std::lock_guard<std::mutex> mutexLock(mMutex);
+    ::detail::getNextBlock(lastBlock) = mFreeList;
+    mFreeList = freeList;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+void* PoolAllocator::staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+{
+  // Sanity check
+  ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The alignment must be a power of two")
+  PoolAllocator& poolAllocator = static_cast<PoolAllocator&>(allocator);
+  const bool fitsIntoBlock = (newNumberOfBytes <= poolAllocator.mBlockSize && alignment <= poolAllocator.mBlockAlignment);
+
+  // Memory which didn't fit into the pool is owned by the backing allocator
+  if (nullptr != oldPointer && !poolAllocator.isOwnedPointer(oldPointer))
+  {
+    poolAllocator.mStatistics.onFree(oldNumberOfBytes);
+    if (0 != newNumberOfBytes)
+    {
+      poolAllocator.mStatistics.onAllocate(newNumberOfBytes);
+      poolAllocator.mStatistics.onBackingAllocation();
+    }
+    return poolAllocator.mBackingAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+  }
+
+  // Allocate
+  if (nullptr == oldPointer)
+  {
+    if (0 == newNumberOfBytes)
+    {
+      return nullptr;
+    }
+    if (fitsIntoBlock)
+    {
+      void* block = poolAllocator.allocateBlock();
+      if (nullptr != block)
+      {
+        poolAllocator.mStatistics.onAllocate(poolAllocator.mBlockSize);
+        return block;
+      }
+    }
+
+    // Pool exhausted or request too large, pass the allocation to the backing allocator
+    void* pointer = poolAllocator.mBackingAllocator.reallocate(nullptr, 0, newNumberOfBytes, alignment);
+    if (nullptr != pointer)
+    {
+      poolAllocator.mStatistics.onAllocate(newNumberOfBytes);
+      poolAllocator.mStatistics.onBackingAllocation();
+    }
+    return pointer;
+  }
+
+  // Free
+  if (0 == newNumberOfBytes)
+  {
+    poolAllocator.freeBlock(oldPointer);
+    poolAllocator.mStatistics.onFree(poolAllocator.mBlockSize);
+    return nullptr;
+  }
+
+  // Reallocate: Nothing to do as long as the block is large enough
+  if (fitsIntoBlock && 0 == (reinterpret_cast<uintptr_t>(oldPointer) & (alignment - 1)))
+  {
+    return oldPointer;
+  }
+
+  // Move the memory into the backing allocator
+  void* newPointer = poolAllocator.mBackingAllocator.reallocate(nullptr, 0, newNumberOfBytes, alignment);
+  if (nullptr != newPointer)
+  {
+    memcpy(newPointer, oldPointer, (poolAllocator.mBlockSize < newNumberOfBytes) ? poolAllocator.mBlockSize : newNumberOfBytes);
+    poolAllocator.freeBlock(oldPointer);
+    poolAllocator.mStatistics.onFree(poolAllocator.mBlockSize);
+    poolAllocator.mStatistics.onAllocate(newNumberOfBytes);
+    poolAllocator.mStatistics.onBackingAllocation();
+  }
+  return newPointer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void* PoolAllocator::allocateBlock()
+{
+  ::detail::ThreadCacheSlot* slot = ::detail::g_ThreadCache.getSlot(mId);
+  if (nullptr != slot)
+  {
+    // Refill the thread cache if required
+    if (nullptr == slot->freeList)
+    {
+      slot->numberOfBlocks = acquireBatch(slot->freeList);
+    }
+    if (nullptr != slot->freeList)
+    {
+      void* block = slot->freeList;
+      slot->freeList = ::detail::getNextBlock(block);
+      --slot->numberOfBlocks;
+      return block;
+    }
+    return nullptr;
+  }
+  else
+  {
+    // No thread cache available, use the shared free list
+    void* block = nullptr;
+    {
+      std::lock_guard<std::mutex> mutexLock(mMutex);
+      if (nullptr != mFreeList)
+      {
+        block = mFreeList;
+        mFreeList = ::detail::getNextBlock(block);
+      }
+      else if (mNextUntouchedBlock < mNumberOfBlocks)
+      {
+        block = mBuffer + mBlockSize * mNextUntouchedBlock;
+        ++mNextUntouchedBlock;
+      }
+    }
+    return block;
+  }
+}
+
+void PoolAllocator::freeBlock(void* pointer)
+{
+  ::detail::ThreadCacheSlot* slot = ::detail::g_ThreadCache.getSlot(mId);
+  if (nullptr != slot)
+  {
+    // Put the block into the thread cache
+    ::detail::getNextBlock(pointer) = slot->freeList;
+    slot->freeList = pointer;
+    ++slot->numberOfBlocks;
+
+    // Keep one batch inside the thread cache and give the rest back to the shared free list
+    if (slot->numberOfBlocks >= BATCH_SIZE * 2)
+    {
+      void* lastKeptBlock = slot->freeList;
+      for (uint32 i = 1; i < BATCH_SIZE; ++i)
+      {
+        lastKeptBlock = ::detail::getNextBlock(lastKeptBlock);
+      }
+      void* releasedBlocks = ::detail::getNextBlock(lastKeptBlock);
+      ::detail::getNextBlock(lastKeptBlock) = nullptr;
+      slot->numberOfBlocks = BATCH_SIZE;
+      releaseBlocks(releasedBlocks);
+    }
+  }
+  else
+  {
+    // No thread cache available, use the shared free list
+    std::lock_guard<std::mutex> mutexLock(mMutex);
+    ::detail::getNextBlock(pointer) = mFreeList;
+    mFreeList = pointer;
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
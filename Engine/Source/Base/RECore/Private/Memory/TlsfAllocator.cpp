@@ -0,0 +1,616 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Memory/TlsfAllocator.h"
+
+#include <cstring>	// For "memcpy()"
+#ifdef _MSC_VER
+  #include <intrin.h>	// For "_BitScanForward()" and "_BitScanReverse()"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr size_t FREE_BIT              = 1 << 0;
+    static constexpr size_t PREVIOUS_FREE_BIT     = 1 << 1;
+    static constexpr size_t ALIGN_SIZE            = static_cast<size_t>(1) << RECore::TlsfAllocator::ALIGN_SIZE_LOG2;
+    static constexpr size_t POOL_ALIGNMENT        = 16;
+    static constexpr size_t SMALL_BLOCK_SIZE      = static_cast<size_t>(1) << RECore::TlsfAllocator::FL_INDEX_SHIFT;
+    static constexpr size_t BLOCK_SIZE_MAX        = static_cast<size_t>(1) << RECore::TlsfAllocator::FL_INDEX_MAX;
+    // The previous physical block field of a block is located inside the previous block, so only the size field is overhead
+    static constexpr size_t BLOCK_HEADER_OVERHEAD = sizeof(size_t);
+    // User data starts directly behind the size field
+    static constexpr size_t BLOCK_START_OFFSET    = sizeof(void*) + sizeof(size_t);
+    // A free block must be able to store the size field and the two free list pointers
+    static constexpr size_t BLOCK_SIZE_MIN        = sizeof(size_t) + 2 * sizeof(void*);
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    /**
+    *  @brief
+    *    Find first set, returns the index of the least significant set bit, -1 if no bit is set
+    */
+    [[nodiscard]] inline int ffs(RECore::uint32 word)
+    {
+      #ifdef _MSC_VER
+        unsigned long index = 0;
+        return _BitScanForward(&index, word) ? static_cast<int>(index) : -1;
+      #else
+        return __builtin_ffs(static_cast<int>(word)) - 1;
+      #endif
+    }
+
+    /**
+    *  @brief
+    *    Find last set, returns the index of the most significant set bit, -1 if no bit is set
+    */
+    [[nodiscard]] inline int fls(RECore::uint32 word)
+    {
+      #ifdef _MSC_VER
+        unsigned long index = 0;
+        return _BitScanReverse(&index, word) ? static_cast<int>(index) : -1;
+      #else
+        return word ? (31 - __builtin_clz(word)) : -1;
+      #endif
+    }
+
+    [[nodiscard]] inline int flsSize(size_t size)
+    {
+      const RECore::uint64 value = static_cast<RECore::uint64>(size);
+      const RECore::uint32 high = static_cast<RECore::uint32>(value >> 32);
+      return high ? (32 + fls(high)) : fls(static_cast<RECore::uint32>(value & 0xffffffff));
+    }
+
+    [[nodiscard]] inline size_t alignUp(size_t value, size_t alignment)
+    {
+      return (value + (alignment - 1)) & ~(alignment - 1);
+    }
+
+    [[nodiscard]] inline RECore::uint8* alignPointer(RECore::uint8* pointer, size_t alignment)
+    {
+      return reinterpret_cast<RECore::uint8*>((reinterpret_cast<uintptr_t>(pointer) + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1));
+    }
+
+    /**
+    *  @brief
+    *    Adjust an allocation size to be aligned and not smaller than the minimum block size, 0 if the size is not supported
+    */
+    [[nodiscard]] inline size_t adjustRequestSize(size_t numberOfBytes, size_t alignment)
+    {
+      const size_t alignedNumberOfBytes = alignUp(numberOfBytes, alignment);
+      if (0 != numberOfBytes && alignedNumberOfBytes < BLOCK_SIZE_MAX)
+      {
+        return (alignedNumberOfBytes < BLOCK_SIZE_MIN) ? BLOCK_SIZE_MIN : alignedNumberOfBytes;
+      }
+      return 0;
+    }
+
+    /**
+    *  @brief
+    *    Map a block size to its free list indices
+    */
+    inline void mappingInsert(size_t numberOfBytes, RECore::uint32& firstLevelIndex, RECore::uint32& secondLevelIndex)
+    {
+      if (numberOfBytes < SMALL_BLOCK_SIZE)
+      {
+        // Small blocks are stored inside the first list
+        firstLevelIndex = 0;
+        secondLevelIndex = static_cast<RECore::uint32>(numberOfBytes / (SMALL_BLOCK_SIZE / RECore::TlsfAllocator::SL_INDEX_COUNT));
+      }
+      else
+      {
+        const int mostSignificantBit = flsSize(numberOfBytes);
+        secondLevelIndex = static_cast<RECore::uint32>(numberOfBytes >> (mostSignificantBit - RECore::TlsfAllocator::SL_INDEX_COUNT_LOG2)) ^ (1 << RECore::TlsfAllocator::SL_INDEX_COUNT_LOG2);
+        firstLevelIndex = static_cast<RECore::uint32>(mostSignificantBit - (RECore::TlsfAllocator::FL_INDEX_SHIFT - 1));
+      }
+    }
+
+    /**
+    *  @brief
+    *    Map an allocation size to the free list indices, rounded up to the next list so any block inside the list is large enough
+    */
+    inline void mappingSearch(size_t numberOfBytes, RECore::uint32& firstLevelIndex, RECore::uint32& secondLevelIndex)
+    {
+      if (numberOfBytes >= SMALL_BLOCK_SIZE)
+      {
+        numberOfBytes += (static_cast<size_t>(1) << (flsSize(numberOfBytes) - RECore::TlsfAllocator::SL_INDEX_COUNT_LOG2)) - 1;
+      }
+      mappingInsert(numberOfBytes, firstLevelIndex, secondLevelIndex);
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Block header                                          ]
+//[-------------------------------------------------------]
+inline TlsfAllocator::BlockHeader* TlsfAllocator::BlockHeader::fromPointer(void* pointer)
+{
+  return reinterpret_cast<BlockHeader*>(static_cast<uint8*>(pointer) - ::detail::BLOCK_START_OFFSET);
+}
+
+inline void* TlsfAllocator::BlockHeader::toPointer()
+{
+  return reinterpret_cast<uint8*>(this) + ::detail::BLOCK_START_OFFSET;
+}
+
+inline size_t TlsfAllocator::BlockHeader::getSize() const
+{
+  return size & ~(::detail::FREE_BIT | ::detail::PREVIOUS_FREE_BIT);
+}
+
+inline void TlsfAllocator::BlockHeader::setSize(size_t numberOfBytes)
+{
+  size = numberOfBytes | (size & (::detail::FREE_BIT | ::detail::PREVIOUS_FREE_BIT));
+}
+
+inline bool TlsfAllocator::BlockHeader::isFree() const
+{
+  return (0 != (size & ::detail::FREE_BIT));
+}
+
+inline bool TlsfAllocator::BlockHeader::isPreviousFree() const
+{
+  return (0 != (size & ::detail::PREVIOUS_FREE_BIT));
+}
+
+inline void TlsfAllocator::BlockHeader::setPreviousFree(bool previousFree)
+{
+  if (previousFree)
+  {
+    size |= ::detail::PREVIOUS_FREE_BIT;
+  }
+  else
+  {
+    size &= ~::detail::PREVIOUS_FREE_BIT;
+  }
+}
+
+inline TlsfAllocator::BlockHeader* TlsfAllocator::BlockHeader::getNextBlock()
+{
+  return reinterpret_cast<BlockHeader*>(static_cast<uint8*>(toPointer()) + getSize() - ::detail::BLOCK_HEADER_OVERHEAD);
+}
+
+inline TlsfAllocator::BlockHeader* TlsfAllocator::BlockHeader::linkNextBlock()
+{
+  BlockHeader* nextBlock = getNextBlock();
+  nextBlock->previousPhysicalBlock = this;
+  return nextBlock;
+}
+
+inline void TlsfAllocator::BlockHeader::markAsFree()
+{
+  linkNextBlock()->setPreviousFree(true);
+  size |= ::detail::FREE_BIT;
+}
+
+inline void TlsfAllocator::BlockHeader::markAsUsed()
+{
+  getNextBlock()->setPreviousFree(false);
+  size &= ~::detail::FREE_BIT;
+}
+
+inline bool TlsfAllocator::BlockHeader::canSplit(size_t numberOfBytes) const
+{
+  return (getSize() >= sizeof(BlockHeader) + numberOfBytes);
+}
+
+inline TlsfAllocator::BlockHeader* TlsfAllocator::BlockHeader::split(size_t numberOfBytes)
+{
+  // The remaining block starts right behind the user data of this block
+  BlockHeader* remainingBlock = reinterpret_cast<BlockHeader*>(static_cast<uint8*>(toPointer()) + numberOfBytes - ::detail::BLOCK_HEADER_OVERHEAD);
+  remainingBlock->size = getSize() - (numberOfBytes + ::detail::BLOCK_HEADER_OVERHEAD);
+  setSize(numberOfBytes);
+  remainingBlock->markAsFree();
+  return remainingBlock;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+TlsfAllocator::TlsfAllocator(const char* tag, size_t poolSize, IAllocator& backingAllocator) :
+  IAllocator(&TlsfAllocator::staticReallocate),
+  mBackingAllocator(backingAllocator),
+  mPoolSize(poolSize),
+  mFirstLevelBitmap(0),
+  mStatistics(tag)
+{
+  // Empty free lists point to the null block
+  mNullBlock.previousPhysicalBlock = nullptr;
+  mNullBlock.size = 0;
+  mNullBlock.nextFreeBlock = &mNullBlock;
+  mNullBlock.previousFreeBlock = &mNullBlock;
+  for (uint32 firstLevelIndex = 0; firstLevelIndex < FL_INDEX_COUNT; ++firstLevelIndex)
+  {
+    mSecondLevelBitmap[firstLevelIndex] = 0;
+    for (uint32 secondLevelIndex = 0; secondLevelIndex < SL_INDEX_COUNT; ++secondLevelIndex)
+    {
+      mBlocks[firstLevelIndex][secondLevelIndex] = &mNullBlock;
+    }
+  }
+}
+
+TlsfAllocator::~TlsfAllocator()
+{
+  for (const std::pair<void*, size_t>& pool : mPools)
+  {
+    mBackingAllocator.reallocate(pool.first, pool.second, 0, ::detail::POOL_ALIGNMENT);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+void* TlsfAllocator::staticReallocate(IAllocator& allocator, void* oldPointer, size_t, size_t newNumberOfBytes, size_t alignment)
+{
+  // Sanity check
+  ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The alignment must be a power of two")
+  TlsfAllocator& tlsfAllocator = static_cast<TlsfAllocator&>(allocator);
+
+  // Do the work, the block header knows the old size
+  std::lock_guard<std::mutex> mutexLock(tlsfAllocator.mMutex);
+  if (nullptr == oldPointer)
+  {
+    return (0 != newNumberOfBytes) ? tlsfAllocator.allocate(newNumberOfBytes, alignment) : nullptr;
+  }
+  if (0 == newNumberOfBytes)
+  {
+    tlsfAllocator.freeBlock(oldPointer);
+    return nullptr;
+  }
+  return tlsfAllocator.reallocateBlock(oldPointer, newNumberOfBytes, alignment);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void* TlsfAllocator::allocate(size_t numberOfBytes, size_t alignment)
+{
+  const size_t adjustedNumberOfBytes = ::detail::adjustRequestSize(numberOfBytes, ::detail::ALIGN_SIZE);
+  if (0 == adjustedNumberOfBytes)
+  {
+    // Error!
+    return nullptr;
+  }
+
+  // For larger alignments, search for a block which is large enough to cut off a leading gap which is a valid free block itself
+  const size_t minimumGapSize = sizeof(BlockHeader);
+  const size_t searchNumberOfBytes = (alignment > ::detail::ALIGN_SIZE) ? ::detail::adjustRequestSize(adjustedNumberOfBytes + alignment + minimumGapSize, alignment) : adjustedNumberOfBytes;
+  if (0 == searchNumberOfBytes)
+  {
+    // Error!
+    return nullptr;
+  }
+  BlockHeader* block = locateFreeBlock(searchNumberOfBytes);
+  if (nullptr == block)
+  {
+    // Out of memory, request a new pool from the backing allocator
+    if (!addPool(searchNumberOfBytes))
+    {
+      // Error!
+      return nullptr;
+    }
+    block = locateFreeBlock(searchNumberOfBytes);
+    if (nullptr == block)
+    {
+      // Error!
+      return nullptr;
+    }
+  }
+
+  // Cut off the leading gap
+  if (alignment > ::detail::ALIGN_SIZE)
+  {
+    uint8* pointer = static_cast<uint8*>(block->toPointer());
+    uint8* alignedPointer = ::detail::alignPointer(pointer, alignment);
+    size_t gap = static_cast<size_t>(alignedPointer - pointer);
+    if (0 != gap && gap < minimumGapSize)
+    {
+      // The gap is too small to be a free block, move on to the next aligned address
+      const size_t remainingGap = minimumGapSize - gap;
+      alignedPointer = ::detail::alignPointer(alignedPointer + ((remainingGap > alignment) ? remainingGap : alignment), alignment);
+      gap = static_cast<size_t>(alignedPointer - pointer);
+    }
+    if (0 != gap)
+    {
+      block = trimFreeLeadingBlock(block, gap);
+    }
+  }
+
+  // Done
+  return prepareUsedBlock(block, adjustedNumberOfBytes);
+}
+
+void* TlsfAllocator::reallocateBlock(void* pointer, size_t numberOfBytes, size_t alignment)
+{
+  BlockHeader* block = BlockHeader::fromPointer(pointer);
+  const size_t currentNumberOfBytes = block->getSize();
+  const size_t adjustedNumberOfBytes = ::detail::adjustRequestSize(numberOfBytes, ::detail::ALIGN_SIZE);
+  if (0 == adjustedNumberOfBytes)
+  {
+    // Error!
+    return nullptr;
+  }
+
+  // Allocate, copy and free if the block can't be resized in place
+  BlockHeader* nextBlock = block->getNextBlock();
+  const size_t combinedNumberOfBytes = currentNumberOfBytes + nextBlock->getSize() + ::detail::BLOCK_HEADER_OVERHEAD;
+  const bool isAligned = (0 == (reinterpret_cast<uintptr_t>(pointer) & (alignment - 1)));
+  if (!isAligned || (adjustedNumberOfBytes > currentNumberOfBytes && (!nextBlock->isFree() || adjustedNumberOfBytes > combinedNumberOfBytes)))
+  {
+    void* newPointer = allocate(numberOfBytes, alignment);
+    if (nullptr != newPointer)
+    {
+      memcpy(newPointer, pointer, (currentNumberOfBytes < numberOfBytes) ? currentNumberOfBytes : numberOfBytes);
+      freeBlock(pointer);
+    }
+    return newPointer;
+  }
+
+  // Grow into the next free block if required and give back what's not needed
+  mStatistics.onFree(currentNumberOfBytes);
+  if (adjustedNumberOfBytes > currentNumberOfBytes)
+  {
+    block = mergeNextBlock(block);
+    block->markAsUsed();
+  }
+  trimUsedBlock(block, adjustedNumberOfBytes);
+  mStatistics.onAllocate(block->getSize());
+  return pointer;
+}
+
+void TlsfAllocator::freeBlock(void* pointer)
+{
+  BlockHeader* block = BlockHeader::fromPointer(pointer);
+  ASSERT(!block->isFree(), "Block already freed")
+  mStatistics.onFree(block->getSize());
+  block->markAsFree();
+  block = mergePreviousBlock(block);
+  block = mergeNextBlock(block);
+  insertBlock(block);
+}
+
+bool TlsfAllocator::addPool(size_t minimumNumberOfBytes)
+{
+  // The pool must be large enough to hold a block which is found by the rounded up free list search
+  const size_t poolOverhead = 2 * ::detail::BLOCK_HEADER_OVERHEAD;
+  const size_t requiredNumberOfBytes = minimumNumberOfBytes + (minimumNumberOfBytes >> SL_INDEX_COUNT_LOG2) + poolOverhead + ::detail::ALIGN_SIZE;
+  const size_t numberOfBytes = (mPoolSize > requiredNumberOfBytes) ? mPoolSize : requiredNumberOfBytes;
+  const size_t blockNumberOfBytes = (numberOfBytes - poolOverhead) & ~(::detail::ALIGN_SIZE - 1);
+  if (blockNumberOfBytes < ::detail::BLOCK_SIZE_MIN || blockNumberOfBytes >= ::detail::BLOCK_SIZE_MAX)
+  {
+    // Error!
+    return false;
+  }
+  void* memory = mBackingAllocator.reallocate(nullptr, 0, numberOfBytes, ::detail::POOL_ALIGNMENT);
+  if (nullptr == memory)
+  {
+    // Error!
+    return false;
+  }
+  mPools.emplace_back(memory, numberOfBytes);
+  mStatistics.onBackingAllocation();
+
+  // The pool is one large free block, its previous physical block field is located in front of the pool but never accessed
+  BlockHeader* block = reinterpret_cast<BlockHeader*>(static_cast<uint8*>(memory) - ::detail::BLOCK_HEADER_OVERHEAD);
+  block->size = blockNumberOfBytes | ::detail::FREE_BIT;
+  insertBlock(block);
+
+  // Zero sized sentinel block at the end of the pool, never merged since it's marked as used
+  BlockHeader* sentinelBlock = block->linkNextBlock();
+  sentinelBlock->size = ::detail::PREVIOUS_FREE_BIT;
+
+  // Done
+  return true;
+}
+
+TlsfAllocator::BlockHeader* TlsfAllocator::searchSuitableBlock(uint32& firstLevelIndex, uint32& secondLevelIndex)
+{
+  // Search for a non-empty list inside the current first level list with a larger or equal second level index
+  uint32 secondLevelMap = mSecondLevelBitmap[firstLevelIndex] & (~0u << secondLevelIndex);
+  if (0 == secondLevelMap)
+  {
+    // Search inside the next larger first level lists
+    const uint32 firstLevelMap = (firstLevelIndex + 1 < 32) ? (mFirstLevelBitmap & (~0u << (firstLevelIndex + 1))) : 0;
+    if (0 == firstLevelMap)
+    {
+      // Out of memory
+      return nullptr;
+    }
+    firstLevelIndex = static_cast<uint32>(::detail::ffs(firstLevelMap));
+    secondLevelMap = mSecondLevelBitmap[firstLevelIndex];
+  }
+  secondLevelIndex = static_cast<uint32>(::detail::ffs(secondLevelMap));
+  return mBlocks[firstLevelIndex][secondLevelIndex];
+}
+
+TlsfAllocator::BlockHeader* TlsfAllocator::locateFreeBlock(size_t numberOfBytes)
+{
+  uint32 firstLevelIndex = 0;
+  uint32 secondLevelIndex = 0;
+  ::detail::mappingSearch(numberOfBytes, firstLevelIndex, secondLevelIndex);
+  if (firstLevelIndex < FL_INDEX_COUNT)
+  {
+    BlockHeader* block = searchSuitableBlock(firstLevelIndex, secondLevelIndex);
+    if (nullptr != block)
+    {
+      ASSERT(block->getSize() >= numberOfBytes, "Invalid TLSF free block")
+      removeFreeBlock(block, firstLevelIndex, secondLevelIndex);
+      return block;
+    }
+  }
+  return nullptr;
+}
+
+void TlsfAllocator::removeFreeBlock(BlockHeader* block, uint32 firstLevelIndex, uint32 secondLevelIndex)
+{
+  BlockHeader* previousFreeBlock = block->previousFreeBlock;
+  BlockHeader* nextFreeBlock = block->nextFreeBlock;
+  nextFreeBlock->previousFreeBlock = previousFreeBlock;
+  previousFreeBlock->nextFreeBlock = nextFreeBlock;
+
+  // Update the list head and the bitmaps if the list gets empty
+  if (mBlocks[firstLevelIndex][secondLevelIndex] == block)
+  {
+    mBlocks[firstLevelIndex][secondLevelIndex] = nextFreeBlock;
+    if (&mNullBlock == nextFreeBlock)
+    {
+      mSecondLevelBitmap[firstLevelIndex] &= ~(1u << secondLevelIndex);
+      if (0 == mSecondLevelBitmap[firstLevelIndex])
+      {
+        mFirstLevelBitmap &= ~(1u << firstLevelIndex);
+      }
+    }
+  }
+}
+
+void TlsfAllocator::insertFreeBlock(BlockHeader* block, uint32 firstLevelIndex, uint32 secondLevelIndex)
+{
+  BlockHeader* currentBlock = mBlocks[firstLevelIndex][secondLevelIndex];
+  block->nextFreeBlock = currentBlock;
+  block->previousFreeBlock = &mNullBlock;
+  currentBlock->previousFreeBlock = block;
+  mBlocks[firstLevelIndex][secondLevelIndex] = block;
+  mFirstLevelBitmap |= (1u << firstLevelIndex);
+  mSecondLevelBitmap[firstLevelIndex] |= (1u << secondLevelIndex);
+}
+
+void TlsfAllocator::removeBlock(BlockHeader* block)
+{
+  uint32 firstLevelIndex = 0;
+  uint32 secondLevelIndex = 0;
+  ::detail::mappingInsert(block->getSize(), firstLevelIndex, secondLevelIndex);
+  removeFreeBlock(block, firstLevelIndex, secondLevelIndex);
+}
+
+void TlsfAllocator::insertBlock(BlockHeader* block)
+{
+  uint32 firstLevelIndex = 0;
+  uint32 secondLevelIndex = 0;
+  ::detail::mappingInsert(block->getSize(), firstLevelIndex, secondLevelIndex);
+  insertFreeBlock(block, firstLevelIndex, secondLevelIndex);
+}
+
+TlsfAllocator::BlockHeader* TlsfAllocator::mergePreviousBlock(BlockHeader* block)
+{
+  if (block->isPreviousFree())
+  {
+    BlockHeader* previousBlock = block->previousPhysicalBlock;
+    removeBlock(previousBlock);
+    previousBlock->size += block->getSize() + ::detail::BLOCK_HEADER_OVERHEAD;
+    previousBlock->linkNextBlock();
+    block = previousBlock;
+  }
+  return block;
+}
+
+TlsfAllocator::BlockHeader* TlsfAllocator::mergeNextBlock(BlockHeader* block)
+{
+  BlockHeader* nextBlock = block->getNextBlock();
+  if (nextBlock->isFree())
+  {
+    removeBlock(nextBlock);
+    block->size += nextBlock->getSize() + ::detail::BLOCK_HEADER_OVERHEAD;
+    block->linkNextBlock();
+  }
+  return block;
+}
+
+void TlsfAllocator::trimFreeBlock(BlockHeader* block, size_t numberOfBytes)
+{
+  if (block->canSplit(numberOfBytes))
+  {
+    BlockHeader* remainingBlock = block->split(numberOfBytes);
+    block->linkNextBlock();
+    remainingBlock->setPreviousFree(true);
+    insertBlock(remainingBlock);
+  }
+}
+
+void TlsfAllocator::trimUsedBlock(BlockHeader* block, size_t numberOfBytes)
+{
+  if (block->canSplit(numberOfBytes))
+  {
+    // The remaining block is free and might be merged with the next block
+    BlockHeader* remainingBlock = block->split(numberOfBytes);
+    remainingBlock->setPreviousFree(false);
+    remainingBlock = mergeNextBlock(remainingBlock);
+    insertBlock(remainingBlock);
+  }
+}
+
+TlsfAllocator::BlockHeader* TlsfAllocator::trimFreeLeadingBlock(BlockHeader* block, size_t numberOfBytes)
+{
+  BlockHeader* remainingBlock = block;
+  if (block->canSplit(numberOfBytes))
+  {
+    // The leading gap becomes a free block of its own
+    remainingBlock = block->split(numberOfBytes - ::detail::BLOCK_HEADER_OVERHEAD);
+    remainingBlock->setPreviousFree(true);
+    block->linkNextBlock();
+    insertBlock(block);
+  }
+  return remainingBlock;
+}
+
+void* TlsfAllocator::prepareUsedBlock(BlockHeader* block, size_t numberOfBytes)
+{
+  trimFreeBlock(block, numberOfBytes);
+  block->markAsUsed();
+  mStatistics.onAllocate(block->getSize());
+  return block->toPointer();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Memory/TrackingAllocator.h"
+#include "RECore/Memory/MemoryTracker.h"
+
+#include <cstring>	// For "memcpy()"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+TrackingAllocator::TrackingAllocator(IAllocator& backingAllocator) :
+  IAllocator(&TrackingAllocator::staticReallocate),
+  mBackingAllocator(backingAllocator)
+{
+  // Nothing here
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static methods                                ]
+//[-------------------------------------------------------]
+void* TrackingAllocator::staticReallocate(IAllocator& allocator, void* oldPointer, size_t, size_t newNumberOfBytes, size_t alignment)
+{
+  // Sanity check
+  ASSERT(0 != alignment && 0 == (alignment & (alignment - 1)), "The alignment must be a power of two")
+  IAllocator& backingAllocator = static_cast<TrackingAllocator&>(allocator).mBackingAllocator;
+
+  // The header is placed directly in front of the user pointer, the offset keeps the user pointer aligned
+  const size_t offset = (alignment > sizeof(AllocationHeader)) ? alignment : sizeof(AllocationHeader);
+  if (alignment < alignof(AllocationHeader))
+  {
+    alignment = alignof(AllocationHeader);
+  }
+
+  // Free or reallocate
+  if (nullptr != oldPointer)
+  {
+    AllocationHeader* oldHeader = static_cast<AllocationHeader*>(oldPointer) - 1;
+    const uint64 oldNumberOfBytes = oldHeader->numberOfBytes;
+    const uint32 oldTagIndex = oldHeader->tagIndex;
+    uint8* oldBasePointer = static_cast<uint8*>(oldPointer) - oldHeader->offset;
+    const size_t oldTotalNumberOfBytes = static_cast<size_t>(oldHeader->offset + oldNumberOfBytes);
+
+    // Free
+    if (0 == newNumberOfBytes)
+    {
+      MemoryTracker::onFree(oldTagIndex, oldNumberOfBytes);
+      backingAllocator.reallocate(oldBasePointer, oldTotalNumberOfBytes, 0, alignment);
+      return nullptr;
+    }
+
+    // Reallocate, the backing allocator can resize in place if the offset stays the same
+    uint8* newBasePointer = nullptr;
+    if (oldHeader->offset == offset)
+    {
+      newBasePointer = static_cast<uint8*>(backingAllocator.reallocate(oldBasePointer, oldTotalNumberOfBytes, offset + newNumberOfBytes, alignment));
+      if (nullptr == newBasePointer)
+      {
+        // Out of memory, the old allocation stays valid
+        return nullptr;
+      }
+    }
+    else
+    {
+      newBasePointer = static_cast<uint8*>(backingAllocator.reallocate(nullptr, 0, offset + newNumberOfBytes, alignment));
+      if (nullptr == newBasePointer)
+      {
+        // Out of memory, the old allocation stays valid
+        return nullptr;
+      }
+      memcpy(newBasePointer + offset, oldPointer, static_cast<size_t>((oldNumberOfBytes < newNumberOfBytes) ? oldNumberOfBytes : newNumberOfBytes));
+      backingAllocator.reallocate(oldBasePointer, oldTotalNumberOfBytes, 0, alignment);
+    }
+    MemoryTracker::onFree(oldTagIndex, oldNumberOfBytes);
+
+    // The reallocated memory is attributed to the current memory tag
+    AllocationHeader* newHeader = reinterpret_cast<AllocationHeader*>(newBasePointer + offset) - 1;
+    newHeader->numberOfBytes = newNumberOfBytes;
+    newHeader->tagIndex = MemoryTracker::getThreadTag();
+    newHeader->offset = static_cast<uint32>(offset);
+    MemoryTracker::onAllocate(newHeader->tagIndex, newNumberOfBytes);
+    return newBasePointer + offset;
+  }
+
+  // Allocate
+  if (0 == newNumberOfBytes)
+  {
+    return nullptr;
+  }
+  uint8* basePointer = static_cast<uint8*>(backingAllocator.reallocate(nullptr, 0, offset + newNumberOfBytes, alignment));
+  if (nullptr == basePointer)
+  {
+    // Out of memory
+    return nullptr;
+  }
+  AllocationHeader* header = reinterpret_cast<AllocationHeader*>(basePointer + offset) - 1;
+  header->numberOfBytes = newNumberOfBytes;
+  header->tagIndex = MemoryTracker::getThreadTag();
+  header->offset = static_cast<uint32>(offset);
+  MemoryTracker::onAllocate(header->tagIndex, newNumberOfBytes);
+  return basePointer + offset;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
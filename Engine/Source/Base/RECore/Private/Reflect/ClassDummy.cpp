@@ -151,6 +151,13 @@ const VarDesc *ClassDummy::getAttribute(const String &sName) const
 	return pRealClassImpl ? pRealClassImpl->getAttribute(sName) : nullptr;
 }
 
+const VarDesc *ClassDummy::getAttributeById(StringId nNameId) const
+{
+	// For this action, we really need the real class: Requests the real class implementation
+	ClassImpl *pRealClassImpl = GetRealClassImpl();
+	return pRealClassImpl ? pRealClassImpl->getAttributeById(nNameId) : nullptr;
+}
+
 const std::list<FuncDesc*> &ClassDummy::getMethods() const
 {
 	// For this action, we really need the real class: Requests the real class implementation
@@ -165,6 +172,13 @@ const FuncDesc *ClassDummy::getMethod(const String &sName) const
 	return pRealClassImpl ? pRealClassImpl->getMethod(sName) : nullptr;
 }
 
+const FuncDesc *ClassDummy::getMethodById(StringId nNameId) const
+{
+	// For this action, we really need the real class: Requests the real class implementation
+	ClassImpl *pRealClassImpl = GetRealClassImpl();
+	return pRealClassImpl ? pRealClassImpl->getMethodById(nNameId) : nullptr;
+}
+
 const std::list<EventDesc*> &ClassDummy::getSignals() const
 {
 	// For this action, we really need the real class: Requests the real class implementation
@@ -354,6 +354,30 @@ void ClassManager::getClasses(std::list<const Class*> &lstClasses, const String
 }
 
 
+/**
+*  @brief
+*    Get class
+*/
+const Class *ClassManager::getClass(const String &sClass) const
+{
+	// Get class
+	std::unordered_map<uint32, const Class*>::const_iterator iterator = m_mapClasses.find(StringId::calculateFNV(sClass.cstr()));
+	if (m_mapClasses.end() != iterator) {
+		if (iterator->second->getClassName() == sClass)
+			return iterator->second;
+
+		// String ID collision, the class we're looking for can only be one of the colliding classes
+		for (const Class *pCollidingClass: m_lstCollidingClasses) {
+			if (pCollidingClass->getClassName() == sClass)
+				return pCollidingClass;
+		}
+	}
+
+	// Class could not be found
+	return nullptr;
+}
+
+
 //[-------------------------------------------------------]
 //[ Private functions                                     ]
 //[-------------------------------------------------------]
@@ -508,9 +532,8 @@ void ClassManager::registerClass(uint32 nModuleID, ClassImpl *pClassImpl)
 {
 	// Check for real/dummy class or duplicate class name
 	Module *pModule = nullptr;
-	const Class *pOldClass = nullptr;
-	if (m_mapClasses.find(pClassImpl->getClassName()) != m_mapClasses.end()) {
-    pOldClass = m_mapClasses.at(pClassImpl->getClassName());
+	const Class *pOldClass = getClass(pClassImpl->getClassName());
+	if (pOldClass) {
 		// Is the already registered implementation of the class currently a dummy?
 		if (pOldClass->m_pClassImpl->isDummy()) {
 			// Is the new given implementation also a dummy?
@@ -579,8 +602,13 @@ void ClassManager::registerClass(uint32 nModuleID, ClassImpl *pClassImpl)
 
 	// Add class to list
 	m_lstClasses.push_back(pClass);
-	if (!pOldClass)
-		m_mapClasses.emplace(pClass->getClassName(), pClass);
+	if (!pOldClass) {
+		if (!m_mapClasses.emplace(StringId::calculateFNV(pClass->getClassName().cstr()), pClass).second) {
+			// Different class name with the same string ID, keep it out of the hash map
+			ASSERT(false, "Reflection class name string ID collision, please rename the class")
+			m_lstCollidingClasses.push_back(pClass);
+		}
+	}
 
 	// Add class to module
 	pModule->addClass(pClass);
@@ -603,7 +631,11 @@ void ClassManager::unregisterClass(uint32 nModuleID, ClassImpl *pClassImpl)
 
 		// Remove class from list
 		m_lstClasses.remove(pClass);
-		m_mapClasses.erase(pClass->getClassName());
+		std::unordered_map<uint32, const Class*>::const_iterator iterator = m_mapClasses.find(StringId::calculateFNV(pClass->getClassName().cstr()));
+		if (m_mapClasses.end() != iterator && iterator->second == pClass)
+			m_mapClasses.erase(iterator);
+		else
+			m_lstCollidingClasses.remove(pClass);
 
 		// Remove class from module
 		pModule->removeClass(pClass);
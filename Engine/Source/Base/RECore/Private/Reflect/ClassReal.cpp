@@ -22,6 +22,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RECore/Log/Log.h"
 #include "RECore/Reflect/Class.h"
 #include "RECore/Reflect/ClassManager.h"
 #include "RECore/Reflect/Var/VarDesc.h"
@@ -107,25 +108,25 @@ void ClassReal::initClass() const
 				// Add attributes from base class
 				m_lstAttributes = m_pBaseClass->getAttributes();
 				for (VarDesc* pAttr: m_lstAttributes) {
-					m_mapMembers.emplace(pAttr->getName(), pAttr);
+					addBaseClassMember(*pAttr);
 				}
 
 				// Add methods from base class
 				m_lstMethods = m_pBaseClass->getMethods();
 				for (FuncDesc* pMethod: m_lstMethods) {
-					m_mapMembers.emplace(pMethod->getName(), pMethod);
+					addBaseClassMember(*pMethod);
 				}
 
 				// Add signals from base class
 				m_lstSignals = m_pBaseClass->getSignals();
 				for (EventDesc* pSignal: m_lstSignals) {
-					m_mapMembers.emplace(pSignal->getName(), pSignal);
+					addBaseClassMember(*pSignal);
 				}
 
 				// Add slots from base class
 				m_lstSlots = m_pBaseClass->getSlots();
 				for (EventHandlerDesc* pSlot: m_lstSlots) {
-					m_mapMembers.emplace(pSlot->getName(), pSlot);
+					addBaseClassMember(*pSlot);
 				}
 
 				// Constructors are not copied from base classes, only the own constructors can be used!
@@ -142,15 +143,20 @@ void ClassReal::initClass() const
 			for (MemberDesc* pMember: m_lstOwnMembers) {
 
 				// Add to hash map and overwrite variables from base classes that are already there (having the same name!)
-				auto iter = m_mapMembers.find(pMember->getName());
+				auto iter = m_mapMembers.find(pMember->getNameId());
         MemberDesc *pOverwriteMember = nullptr;
 				if (iter != m_mapMembers.end()) {
-          pOverwriteMember = iter->second;
-					// Overwrite base class member
-					m_mapMembers[pMember->getName()] = pMember;
+					if (iter->second->getName() == pMember->getName()) {
+						pOverwriteMember = iter->second;
+						// Overwrite base class member
+						iter->second = pMember;
+					} else {
+						// Different member name with the same string ID, keep it out of the hash map
+						addCollidingMember(*pMember, *iter->second);
+					}
 				} else {
 					// Add new member
-					m_mapMembers.emplace(pMember->getName(), pMember);
+					m_mapMembers.emplace(pMember->getNameId(), pMember);
 				}
 
 				// Check type and add to respective list
@@ -211,6 +217,7 @@ void ClassReal::deInitClass() const
 	// Clear lists
 	m_mapProperties.clear();
 	m_mapMembers.clear();
+	m_lstCollidingMembers.clear();
 	m_lstAttributes.clear();
 	m_lstMethods.clear();
 	m_lstSignals.clear();
@@ -247,12 +254,17 @@ const VarDesc *ClassReal::getAttribute(const String &sName) const
 		initClass();
 
 	// Get attribute
-	auto iter = m_mapMembers.find(sName);
-	if (iter != this->m_mapMembers.end() && iter->second->getMemberType() == MemberAttribute)
-		return static_cast<VarDesc*>(iter->second);
+	return static_cast<VarDesc*>(findMember(sName, MemberAttribute));
+}
 
-	// Attribute could not be found
-	return nullptr;
+const VarDesc *ClassReal::getAttributeById(StringId nNameId) const
+{
+	// Check if class has been initialized
+	if (!m_bInitialized)
+		initClass();
+
+	// Get attribute
+	return static_cast<VarDesc*>(findMemberById(nNameId, MemberAttribute));
 }
 
 const std::list<FuncDesc*> &ClassReal::getMethods() const
@@ -272,12 +284,17 @@ const FuncDesc *ClassReal::getMethod(const String &sName) const
 		initClass();
 
 	// Get method
-	auto iter = m_mapMembers.find(sName);
-	if (iter != m_mapMembers.end() && iter->second->getMemberType() == MemberMethod)
-		return static_cast<FuncDesc*>(iter->second);
+	return static_cast<FuncDesc*>(findMember(sName, MemberMethod));
+}
 
-	// Method could not be found
-	return nullptr;
+const FuncDesc *ClassReal::getMethodById(StringId nNameId) const
+{
+	// Check if class has been initialized
+	if (!m_bInitialized)
+		initClass();
+
+	// Get method
+	return static_cast<FuncDesc*>(findMemberById(nNameId, MemberMethod));
 }
 
 const std::list<EventDesc*> &ClassReal::getSignals() const
@@ -297,12 +314,7 @@ const EventDesc *ClassReal::getSignal(const String &sName) const
 		initClass();
 
 	// Get signal
-	auto iter = m_mapMembers.find(sName);
-	if (iter != this->m_mapMembers.end() && iter->second->getMemberType() == MemberEvent)
-		return static_cast<EventDesc*>(iter->second);
-
-	// Signal could not be found
-	return nullptr;
+	return static_cast<EventDesc*>(findMember(sName, MemberEvent));
 }
 
 const std::list<EventHandlerDesc*> &ClassReal::getSlots() const
@@ -322,12 +334,7 @@ const EventHandlerDesc *ClassReal::getSlot(const String &sName) const
 		initClass();
 
 	// Get slot
-	auto iter = m_mapMembers.find(sName);
-	if (iter != this->m_mapMembers.end() && iter->second->getMemberType() == MemberEventHandler)
-		return static_cast<EventHandlerDesc*>(iter->second);
-
-	// Slot could not be found
-	return nullptr;
+	return static_cast<EventHandlerDesc*>(findMember(sName, MemberEventHandler));
 }
 
 bool ClassReal::hasConstructor() const
@@ -377,12 +384,7 @@ const ConstructorDesc *ClassReal::getConstructor(const String &sName) const
 		initClass();
 
 	// Get constructor
-	auto iter = m_mapMembers.find(sName);
-	if (iter != this->m_mapMembers.end() && iter->second->getMemberType() == MemberConstructor)
-		return static_cast<ConstructorDesc*>(iter->second);
-
-	// Constructor could not be found
-	return nullptr;
+	return static_cast<ConstructorDesc*>(findMember(sName, MemberConstructor));
 }
 
 Object *ClassReal::create() const
@@ -487,6 +489,73 @@ void ClassReal::addMember(MemberDesc *pMemberDesc)
 }
 
 
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Add a member inherited from the base class to the hash map
+*/
+void ClassReal::addBaseClassMember(MemberDesc &cMember) const
+{
+	const auto result = m_mapMembers.emplace(cMember.getNameId(), &cMember);
+	if (!result.second && result.first->second != &cMember && result.first->second->getName() != cMember.getName()) {
+		// Different member name with the same string ID (e.g. colliding members of different base classes), keep it out of the hash map
+		addCollidingMember(cMember, *result.first->second);
+	}
+}
+
+/**
+*  @brief
+*    Add a member whose name string ID collides with the name of a member inside the hash map
+*/
+void ClassReal::addCollidingMember(MemberDesc &cMember, const MemberDesc &cHashMapMember) const
+{
+	RE_LOG(Error, "Class '" + m_sClassName + "': The string ID of the member name '" + cMember.getName() + "' collides with the member name '" + cHashMapMember.getName() + "', please rename one of the members")
+	ASSERT(false, "Reflection member name string ID collision, please rename the member")
+	m_lstCollidingMembers.push_back(&cMember);
+}
+
+/**
+*  @brief
+*    Find member by name
+*/
+MemberDesc *ClassReal::findMember(const String &sName, EMemberType nMemberType) const
+{
+	// Get member
+	auto iter = m_mapMembers.find(StringId::calculateFNV(sName.cstr()));
+	if (iter != m_mapMembers.end()) {
+		MemberDesc *pMember = iter->second;
+		if (pMember->getName() == sName)
+			return (pMember->getMemberType() == nMemberType) ? pMember : nullptr;
+
+		// String ID collision, the member we're looking for can only be one of the colliding members
+		for (MemberDesc *pCollidingMember: m_lstCollidingMembers) {
+			if (pCollidingMember->getMemberType() == nMemberType && pCollidingMember->getName() == sName)
+				return pCollidingMember;
+		}
+	}
+
+	// Member could not be found
+	return nullptr;
+}
+
+/**
+*  @brief
+*    Find member by string ID of the name
+*/
+MemberDesc *ClassReal::findMemberById(uint32 nNameId, EMemberType nMemberType) const
+{
+	// Get member
+	auto iter = m_mapMembers.find(nNameId);
+	if (iter != m_mapMembers.end() && iter->second->getMemberType() == nMemberType)
+		return iter->second;
+
+	// Member could not be found
+	return nullptr;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -104,6 +104,26 @@ DynFunc *DynFunc::clone() const
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Get the size of the typed parameters matching the signature of this function
+*/
+uint32 DynFunc::getParamsSize() const
+{
+	// No typed parameters by default
+	return 0;
+}
+
+/**
+*  @brief
+*    Construct typed parameters matching the signature of this function
+*/
+DynParams *DynFunc::constructParams(void *pMemory) const
+{
+	// No typed parameters by default
+	return nullptr;
+}
+
 
 //[-------------------------------------------------------]
 //[ Protected functions                                   ]
@@ -42,6 +42,7 @@ namespace RECore {
 MemberDesc::MemberDesc(EMemberType nMemberType, const String &sName, const String &sDescription, const String &sAnnotation) :
 	m_nMemberType(nMemberType),
 	m_sName(sName),
+	m_nNameId(StringId::calculateFNV(m_sName.cstr())),
 	m_sDescription(sDescription),
 	m_sAnnotation(sAnnotation)
 {
@@ -33,8 +33,229 @@
 #include "RECore/Reflect/Tools/ParamsParserXml.h"
 #include "RECore/Reflect/ClassManager.h"
 #include "RECore/Reflect/Class.h"
+#include "RECore/Reflect/MemberHandle.h"
 #include "RECore/Reflect/Object.h"
 
+#include <cstring>	// For "memcpy()"
+#include <algorithm>	// For "std::reverse()"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		// The binary format is little-endian, big-endian hosts have to swap the bytes of each value
+		#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+			static constexpr bool SWAP_BYTES = true;
+		#else
+			static constexpr bool SWAP_BYTES = false;
+		#endif
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		template <typename T>
+		void storeValue(RECore::uint8* destination, T value)
+		{
+			memcpy(destination, &value, sizeof(T));
+			if constexpr (SWAP_BYTES)
+			{
+				std::reverse(destination, destination + sizeof(T));
+			}
+		}
+
+		template <typename T>
+		void writeValue(std::vector<RECore::uint8>& data, T value)
+		{
+			const size_t offset = data.size();
+			data.resize(offset + sizeof(T));
+			storeValue(data.data() + offset, value);
+		}
+
+		template <typename T>
+		[[nodiscard]] bool readValue(const RECore::uint8*& data, const RECore::uint8* dataEnd, T& value)
+		{
+			if (static_cast<size_t>(dataEnd - data) < sizeof(T))
+			{
+				// Error! Truncated data.
+				return false;
+			}
+			if constexpr (SWAP_BYTES)
+			{
+				RECore::uint8 bytes[sizeof(T)];
+				std::reverse_copy(data, data + sizeof(T), bytes);
+				memcpy(&value, bytes, sizeof(T));
+			}
+			else
+			{
+				memcpy(&value, data, sizeof(T));
+			}
+			data += sizeof(T);
+			return true;
+		}
+
+		void writeAttribute(std::vector<RECore::uint8>& data, const RECore::DynVar& dynVar)
+		{
+			const int typeId = dynVar.getTypeID();
+			writeValue<RECore::uint8>(data, static_cast<RECore::uint8>(typeId));
+			switch (typeId)
+			{
+				case RECore::TypeBool:	 writeValue<RECore::uint8>(data, dynVar.getBool() ? 1u : 0u); break;
+				case RECore::TypeInt:
+				case RECore::TypeInt32:	 writeValue<RECore::int32>(data, dynVar.getInt32());  break;
+				case RECore::TypeInt8:	 writeValue<RECore::int8>(data, dynVar.getInt8());	  break;
+				case RECore::TypeInt16:	 writeValue<RECore::int16>(data, dynVar.getInt16());  break;
+				case RECore::TypeInt64:	 writeValue<RECore::int64>(data, dynVar.getInt64());  break;
+				case RECore::TypeUInt8:	 writeValue<RECore::uint8>(data, dynVar.getUInt8());  break;
+				case RECore::TypeUInt16: writeValue<RECore::uint16>(data, dynVar.getUInt16()); break;
+				case RECore::TypeUInt32: writeValue<RECore::uint32>(data, dynVar.getUInt32()); break;
+				case RECore::TypeUInt64: writeValue<RECore::uint64>(data, dynVar.getUInt64()); break;
+				case RECore::TypeFloat:	 writeValue<float>(data, dynVar.getFloat());  break;
+				case RECore::TypeDouble: writeValue<double>(data, dynVar.getDouble()); break;
+
+				default:
+				{
+					// Strings as well as all types without a native binary representation (e.g. vectors) are stored as string
+					const RECore::String value = dynVar.getString();
+					const RECore::uint32 numberOfBytes = static_cast<RECore::uint32>(value.length());
+					writeValue<RECore::uint32>(data, numberOfBytes);
+					const size_t offset = data.size();
+					data.resize(offset + numberOfBytes);
+					memcpy(data.data() + offset, value.cstr(), numberOfBytes);
+					break;
+				}
+			}
+		}
+
+		[[nodiscard]] bool readAttribute(const RECore::uint8*& data, const RECore::uint8* dataEnd, RECore::DynVar* dynVar)
+		{
+			// The attribute value is always read to be able to skip unknown attributes, the setters convert to the attribute type if it changed
+			RECore::uint8 typeId = 0;
+			if (!readValue(data, dataEnd, typeId))
+			{
+				return false;
+			}
+			switch (typeId)
+			{
+				case RECore::TypeBool:
+				{
+					RECore::uint8 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setBool(0 != value);
+					break;
+				}
+
+				case RECore::TypeInt:
+				case RECore::TypeInt32:
+				{
+					RECore::int32 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setInt32(value);
+					break;
+				}
+
+				case RECore::TypeInt8:
+				{
+					RECore::int8 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setInt8(value);
+					break;
+				}
+
+				case RECore::TypeInt16:
+				{
+					RECore::int16 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setInt16(value);
+					break;
+				}
+
+				case RECore::TypeInt64:
+				{
+					RECore::int64 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setInt64(value);
+					break;
+				}
+
+				case RECore::TypeUInt8:
+				{
+					RECore::uint8 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setUInt8(value);
+					break;
+				}
+
+				case RECore::TypeUInt16:
+				{
+					RECore::uint16 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setUInt16(value);
+					break;
+				}
+
+				case RECore::TypeUInt32:
+				{
+					RECore::uint32 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setUInt32(value);
+					break;
+				}
+
+				case RECore::TypeUInt64:
+				{
+					RECore::uint64 value = 0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setUInt64(value);
+					break;
+				}
+
+				case RECore::TypeFloat:
+				{
+					float value = 0.0f;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setFloat(value);
+					break;
+				}
+
+				case RECore::TypeDouble:
+				{
+					double value = 0.0;
+					if (!readValue(data, dataEnd, value)) return false;
+					if (nullptr != dynVar) dynVar->setDouble(value);
+					break;
+				}
+
+				default:
+				{
+					RECore::uint32 numberOfBytes = 0;
+					if (!readValue(data, dataEnd, numberOfBytes) || static_cast<size_t>(dataEnd - data) < numberOfBytes) return false;
+					if (nullptr != dynVar) dynVar->setString(RECore::String(reinterpret_cast<const char*>(data), numberOfBytes));
+					data += numberOfBytes;
+					break;
+				}
+			}
+
+			// Done
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -275,6 +496,27 @@ DynVarPtr Object::getAttribute(const String &sName) const
 	return nullptr;
 }
 
+/**
+*  @brief
+*    Get attribute by using a cached attribute handle
+*/
+DynVarPtr Object::getAttribute(MemberHandle<VarDesc> &cAttribute) const
+{
+	// Get class
+	Class *pClass = getClass();
+	if (pClass) {
+		// Get descriptor
+		const VarDesc *pDescriptor = cAttribute.getDesc(*pClass);
+		if (pDescriptor) {
+			// Return attribute
+			return pDescriptor->getAttribute(*this);
+		}
+	}
+
+	// Could not find attribute
+	return nullptr;
+}
+
 /**
 *  @brief
 *    Get all callable methods
@@ -311,6 +553,27 @@ DynFuncPtr Object::getMethod(const String &sName)
 	return DynFuncPtr(nullptr);
 }
 
+/**
+*  @brief
+*    Get callable method by using a cached method handle
+*/
+DynFuncPtr Object::getMethod(MemberHandle<FuncDesc> &cMethod)
+{
+	// Get class
+	Class *pClass = getClass();
+	if (pClass) {
+		// Get descriptor
+		const FuncDesc *pDescriptor = cMethod.getDesc(*pClass);
+		if (pDescriptor) {
+			// Return callable method
+			return pDescriptor->getMethod(*this);
+		}
+	}
+
+	// Could not find method
+	return DynFuncPtr(nullptr);
+}
+
 /**
 *  @brief
 *    Get a list of all signals
@@ -440,6 +703,34 @@ void Object::setAttribute(const String &sName, const DynVar *pVar)
 	}
 }
 
+/**
+*  @brief
+*    Set attribute value by using a cached attribute handle and a given string value
+*/
+void Object::setAttribute(MemberHandle<VarDesc> &cAttribute, const String &sValue)
+{
+	// Get attribute
+	DynVarPtr pAttribute = getAttribute(cAttribute);
+	if (pAttribute) {
+		// Set value
+		pAttribute->setString(sValue);
+	}
+}
+
+/**
+*  @brief
+*    Set attribute value by using a cached attribute handle and a given dynamic variable reference
+*/
+void Object::setAttribute(MemberHandle<VarDesc> &cAttribute, const DynVar &cVar)
+{
+	// Get attribute
+	DynVarPtr pAttribute = getAttribute(cAttribute);
+	if (pAttribute) {
+		// Set value
+		pAttribute->setVar(cVar);
+	}
+}
+
 /**
 *  @brief
 *    Set attribute to it's default value
@@ -496,6 +787,20 @@ void Object::callMethod(const String &sName, const String &sParams)
 	}
 }
 
+/**
+*  @brief
+*    Call method by using a cached method handle and given dynamic parameters
+*/
+void Object::callMethod(MemberHandle<FuncDesc> &cMethod, DynParams &cParams)
+{
+	// Get callable method
+	DynFuncPtr pMethod = getMethod(cMethod);
+	if (pMethod) {
+		// Call method
+		pMethod->call(cParams);
+	}
+}
+
 /**
 *  @brief
 *    Get attribute values as a string
@@ -573,6 +878,77 @@ void Object::setDefaultValues()
 }
 
 
+/**
+*  @brief
+*    Get attribute values in a compact binary form
+*/
+void Object::serialize(std::vector<uint8> &lstData, EDefaultValue nDefaultValue) const
+{
+	// Reserve the number of attributes, it's written as soon as it's known
+	const size_t nNumberOfAttributesOffset = lstData.size();
+	::detail::writeValue<uint32>(lstData, 0);
+	uint32 nNumberOfAttributes = 0;
+
+	// Get class
+	Class *pClass = getClass();
+	if (pClass) {
+		// Loop through attributes
+		for (VarDesc* pVarDesc: pClass->getAttributes()) {
+			if (pVarDesc) {
+				// Get attribute, skip it if there's no instance (e.g. a member type without dynamic variable support)
+				DynVarPtr pVar = pVarDesc->getAttribute(*this);
+				if (!pVar.GetPointer())
+					continue;
+
+				// Ignore variables with default values?
+				if (nDefaultValue == WithDefault || !pVar->isDefault()) {
+					// Add attribute
+					::detail::writeValue<uint32>(lstData, pVarDesc->getNameId());
+					::detail::writeAttribute(lstData, *pVar);
+					++nNumberOfAttributes;
+				}
+			}
+		}
+	}
+
+	// Write the number of attributes
+	::detail::storeValue<uint32>(lstData.data() + nNumberOfAttributesOffset, nNumberOfAttributes);
+}
+
+/**
+*  @brief
+*    Set attribute values from data written by "serialize()"
+*/
+uint32 Object::deserialize(const uint8 *pData, uint32 nNumberOfBytes)
+{
+	const uint8 *pCurrentData = pData;
+	const uint8 *pDataEnd	  = pData + nNumberOfBytes;
+
+	// Get the number of attributes
+	uint32 nNumberOfAttributes = 0;
+	if (!::detail::readValue(pCurrentData, pDataEnd, nNumberOfAttributes))
+		return 0;	// Error!
+
+	// Loop through attributes
+	Class *pClass = getClass();
+	for (uint32 i=0; i<nNumberOfAttributes; i++) {
+		// Get the attribute, there's no string lookup involved
+		uint32 nNameId = 0;
+		if (!::detail::readValue(pCurrentData, pDataEnd, nNameId))
+			return 0;	// Error!
+		const VarDesc *pVarDesc = pClass ? pClass->getAttributeById(nNameId) : nullptr;
+		DynVarPtr pVar = pVarDesc ? pVarDesc->getAttribute(*this) : DynVarPtr(nullptr);
+
+		// Set the attribute value, unknown attributes are skipped
+		if (!::detail::readAttribute(pCurrentData, pDataEnd, pVar.GetPointer()))
+			return 0;	// Error!
+	}
+
+	// Done
+	return static_cast<uint32>(pCurrentData - pData);
+}
+
+
 //[-------------------------------------------------------]
 //[ Public virtual Object functions                       ]
 //[-------------------------------------------------------]
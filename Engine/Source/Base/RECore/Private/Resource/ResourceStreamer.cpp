@@ -22,10 +22,12 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/Resource/ResourceStreamer.h"
+#include "RECore/Resource/IResourceListener.h"
 #include "RECore/Resource/IResourceLoader.h"
 #include "RECore/Resource/IResourceManager.h"
 #include "RECore/File/IFileManager.h"
 #include "RECore/Log/Log.h"
+#include "RECore/Memory/MemoryTracker.h"
 
 // TODO(naetherm) Can we do something about the warning which does not involve using "std::thread"-pointers?
 PRAGMA_WARNING_DISABLE_MSVC(4355)  // warning C4355: 'this': used in base member initializer list
@@ -37,6 +39,64 @@ PRAGMA_WARNING_DISABLE_MSVC(4355)  // warning C4355: 'this': used in base member
 namespace RECore {
 
 
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Resource listener scheduling a waiting coroutine as soon as the resource is no longer loading
+*
+*  @note
+*    - The coroutine isn't resumed inside "RECore::IResourceListener::onLoadingStateChange()" by intent: The resource is
+*      iterating its resource listeners at this point in time and the coroutine might e.g. connect or disconnect listeners
+*/
+class ResourceStreamer::CoroutineResourceListener final : public IResourceListener {
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline CoroutineResourceListener(ResourceStreamer &resourceStreamer, std::coroutine_handle<> coroutine, ResumeThread resumeThread) :
+    mResourceStreamer(resourceStreamer),
+    mCoroutine(coroutine),
+    mResumeThread(resumeThread),
+    mScheduled(false) {
+    // Nothing here
+  }
+
+  inline virtual ~CoroutineResourceListener() override {
+    // Nothing here
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Protected virtual RECore::IResourceListener methods   ]
+  //[-------------------------------------------------------]
+protected:
+  virtual void onLoadingStateChange(const IResource &resource) override {
+    const IResource::LoadingState loadingState = resource.getLoadingState();
+    if (!mScheduled && IResource::LoadingState::LOADING != loadingState && IResource::LoadingState::UNLOADING != loadingState) {
+      mScheduled = true;
+      std::lock_guard<std::mutex> resumeMutexLock(mResourceStreamer.mResumeMutex);
+      mResourceStreamer.mResumeQueue.push_back({mCoroutine, this, mResumeThread});
+    }
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  ResourceStreamer &mResourceStreamer;
+  std::coroutine_handle<> mCoroutine;
+  ResumeThread mResumeThread;
+  bool mScheduled;  ///< Resource listener calls after the coroutine was scheduled are ignored
+
+
+};
+
+
 //[-------------------------------------------------------]
 //[ Public RECore::ResourceStreamer::LoadRequest methods ]
 //[-------------------------------------------------------]
@@ -73,7 +133,7 @@ void ResourceStreamer::flushAllQueues() {
       // Resource streamer stage: 2. Asynchronous processing
       if (everythingFlushed) {
         std::lock_guard<std::mutex> processingMutexLock(mProcessingMutex);
-        everythingFlushed = mProcessingQueue.empty();
+        everythingFlushed = (mProcessingQueue.empty() && mWorkerResumeQueue.empty());
       }
 
       // Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
@@ -81,6 +141,12 @@ void ResourceStreamer::flushAllQueues() {
         std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
         everythingFlushed = (mDispatchQueue.empty() && mFullyLoadedWaitingQueue.empty());
       }
+
+      // Coroutines waiting to be resumed on the main thread
+      if (everythingFlushed) {
+        std::lock_guard<std::mutex> resumeMutexLock(mResumeMutex);
+        everythingFlushed = mResumeQueue.empty();
+      }
     }
     dispatch();
 
@@ -96,6 +162,8 @@ void ResourceStreamer::flushAllQueues() {
 }
 
 void ResourceStreamer::dispatch() {
+  RE_MEMORY_TAG_SCOPE("ResourceStreamer")
+
   // Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
 
   // Continue as long as there's a load request left inside the queue
@@ -134,6 +202,40 @@ void ResourceStreamer::dispatch() {
       ++iterator;
     }
   }
+
+  // Resume coroutines which were waiting for a resource or asked to continue on the main thread
+  // -> Coroutines scheduled by the resumed coroutines are handled during the next dispatch, so we're not blocking forever
+  {
+    std::lock_guard<std::mutex> resumeMutexLock(mResumeMutex);
+    std::swap(mResumeQueue, mDispatchResumeRequests);
+  }
+  for (const ResumeRequest &resumeRequest: mDispatchResumeRequests) {
+    // We're outside of any resource listener iteration now, so it's safe to get rid of the resource listener
+    delete resumeRequest.coroutineResourceListener;
+    if (ResumeThread::DISPATCH == resumeRequest.resumeThread) {
+      resumeRequest.coroutine.resume();
+    } else {
+      resumeCoroutine(resumeRequest.coroutine, resumeRequest.resumeThread);
+    }
+  }
+  mDispatchResumeRequests.clear();
+}
+
+void ResourceStreamer::resumeCoroutine(std::coroutine_handle<> coroutine, ResumeThread resumeThread) {
+  if (ResumeThread::DISPATCH == resumeThread) {
+    std::lock_guard<std::mutex> resumeMutexLock(mResumeMutex);
+    mResumeQueue.push_back({coroutine, nullptr, resumeThread});
+  } else {
+    std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
+    mWorkerResumeQueue.push_back(coroutine);
+    processingMutexLock.unlock();
+    mProcessingConditionVariable.notify_one();
+  }
+}
+
+void ResourceStreamer::resumeCoroutineAfterLoading(IResource &resource, std::coroutine_handle<> coroutine, ResumeThread resumeThread) {
+  // Connecting the resource listener directly informs it about the current loading state, so there's no gap we could miss
+  resource.connectResourceListener(*new CoroutineResourceListener(*this, coroutine, resumeThread));
 }
 
 
@@ -160,6 +262,12 @@ ResourceStreamer::~ResourceStreamer() {
   mDeserializationThread.join();
   mProcessingThread.join();
 
+  // Destroy the resource listeners of coroutines which never were resumed, the coroutines itself are leaked by intent
+  // since they might be owned by someone else
+  for (const ResumeRequest &resumeRequest: mResumeQueue) {
+    delete resumeRequest.coroutineResourceListener;
+  }
+
   // Destroy resource loader instances
   for (auto &resourceLoaderType: mResourceLoaderTypeManager) {
     for (IResourceLoader *resourceLoader: resourceLoaderType.second.freeResourceLoaders) {
@@ -170,6 +278,7 @@ ResourceStreamer::~ResourceStreamer() {
 
 void ResourceStreamer::deserializationThreadWorker() {
   RE_LOG(Info, "[RS: Stage 1] Renderer: Resource streamer stage: 1. Asynchronous deserialization")
+  RE_MEMORY_TAG_SCOPE("ResourceStreamer")
 
   // Resource streamer stage: 1. Asynchronous deserialization
   while (!mShutdownDeserializationThread) {
@@ -269,13 +378,24 @@ void ResourceStreamer::deserializationThreadWorker() {
 
 void ResourceStreamer::processingThreadWorker() {
   RE_LOG(Info, "[RS: Stage 2] Renderer: Resource streamer stage: 2. Asynchronous processing")
+  RE_MEMORY_TAG_SCOPE("ResourceStreamer")
 
   // Resource streamer stage: 2. Asynchronous processing
   while (!mShutdownProcessingThread) {
     // Continue as long as there's a load request left inside the queue, if it's empty go to sleep
     std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
     mProcessingConditionVariable.wait(processingMutexLock);
-    while (!mProcessingQueue.empty() && !mShutdownProcessingThread) {
+    while ((!mProcessingQueue.empty() || !mWorkerResumeQueue.empty()) && !mShutdownProcessingThread) {
+      // Coroutines which asked to continue on a worker thread
+      if (!mWorkerResumeQueue.empty()) {
+        std::coroutine_handle<> coroutine = mWorkerResumeQueue.front();
+        mWorkerResumeQueue.pop_front();
+        processingMutexLock.unlock();
+        coroutine.resume();
+        processingMutexLock.lock();
+        continue;
+      }
+
       // Get the load request
       LoadRequest loadRequest = mProcessingQueue.front();
       mProcessingQueue.pop_front();
@@ -31,6 +31,8 @@
 #include "RECore/RECore.h"
 #include "RECore/Reflect/Event/Event.h"
 #include "RECore/String/String.h"
+#include "RECore/Log/LogRecord.h"
+#include <atomic>
 #include <queue>
 
 
@@ -66,6 +68,28 @@
   } \
 }
 
+/**
+*  @brief
+*    Log macro with deferred formatting
+*
+*  @param[in] Level
+*    Log level
+*  @param[in] Format
+*    Format string literal using "{}" as argument placeholder, e.g. "Loaded {} meshes in {} seconds"
+*  @param[in] ...
+*    Arguments (boolean, integral, enumeration, floating point, "char*", "RECore::String" or pointer)
+*
+*  @remarks
+*    The format string and the source location are stored once per call site. In asynchronous mode only the raw arguments
+*    are captured on the calling thread, formatting and writing is done by the log background thread.
+*/
+#define RE_LOG_FORMAT(Level, Format, ...) { \
+  if (RECore::Log::instance().getLogLevel() >= RECore::Log::Level) { \
+    static const RECore::LogFormat SLogFormat = { RECore::Log::Level, Format, __FILE__, __LINE__, __FUNCTION__ }; \
+    RECore::Log::instance().outputFormat(SLogFormat, ##__VA_ARGS__); \
+  } \
+}
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -76,6 +100,7 @@ namespace RECore {
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 class LogFormatter;
+class LogRingBuffer;
 
 
 //[-------------------------------------------------------]
@@ -94,6 +119,10 @@ class LogFormatter;
 *      warning, error or critical are written to the log, too
 *    - You can define as many debug log levels as you want
 *    - Implementation of the strategy design pattern, this class is the context
+*    - By default the log is synchronous and not thread safe, after "startAsynchronous()" all threads can log concurrently:
+*      each thread writes into its own lock-free ring buffer and a background thread does the formatting and writing. In
+*      asynchronous mode, the console output, the log formatter, "EventNewEntry" and the last messages queue are driven
+*      by the background thread.
 */
 class Log {
 
@@ -120,12 +149,24 @@ public:
     Debug    /**< Should be used for debug level texts */
   };
 
+  /**
+  *  @brief
+  *    Asynchronous mode behaviour when the ring buffer of a thread is full
+  *
+  *  @remarks
+  *    Messages with a log level up to the flush log level (by default: all, critical and error) always block and are never dropped.
+  */
+  enum OverflowPolicy {
+    DropOnOverflow,  /**< Drop the message, the number of dropped messages is reported by a log warning */
+    BlockOnOverflow  /**< Block the logging thread until the background thread made room */
+  };
+
 
   //[-------------------------------------------------------]
   //[ Public events                                         ]
   //[-------------------------------------------------------]
 public:
-  Event<> EventNewEntry;  /**< A new log entry had been added, use e.g. "GetLastMessages()" to access the latest messages */
+  Event<uint8, String> EventNewEntry;  /**< A new log entry had been added, log level (see "LogLevel") and text of the message without the log level prefix */
 
 
   //[-------------------------------------------------------]
@@ -236,6 +277,7 @@ public:
   *
   *  @note
   *    - Only call this function if really required!
+  *    - In asynchronous mode, blocks until all messages logged before the call have been written and flushed
   */
   inline bool flush();
 
@@ -290,6 +332,73 @@ public:
   */
   inline LogFormatter *getLogFormatter() const;
 
+  /**
+  *  @brief
+  *    Write a formatted message into the log, see "RE_LOG_FORMAT"
+  *
+  *  @param[in] cLogFormat
+  *    Call site description, must stay valid as long as the log is alive (usually a static instance)
+  *  @param[in] tArguments
+  *    Arguments
+  *
+  *  @return
+  *    'true' if all went fine, else 'false' (e.g. log level filtered or message dropped)
+  */
+  template <typename... ARGUMENTS>
+  inline bool outputFormat(const LogFormat &cLogFormat, const ARGUMENTS &... tArguments);
+
+  //[-------------------------------------------------------]
+  //[ Asynchronous mode                                     ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Start the asynchronous mode
+  *
+  *  @param[in] nRingBufferSize
+  *    Size in bytes of the ring buffer each logging thread gets on its first message, messages larger than half of it are truncated
+  *  @param[in] nOverflowPolicy
+  *    Behaviour when the ring buffer of a thread is full
+  *  @param[in] sBinaryFilename
+  *    If not empty, all messages are written into this compact binary log file instead of the console and the log formatter,
+  *    use "RECore::LogRecord::decodeBinaryFile()" to convert it into a text file
+  *
+  *  @return
+  *    'true' if all went fine, else 'false' (already asynchronous or binary log file error)
+  *
+  *  @note
+  *    - Don't call this method while other threads are logging
+  */
+  RECORE_API bool startAsynchronous(uint32 nRingBufferSize = 256 * 1024, OverflowPolicy nOverflowPolicy = DropOnOverflow, const String &sBinaryFilename = "");
+
+  /**
+  *  @brief
+  *    Stop the asynchronous mode, all pending messages are written
+  *
+  *  @note
+  *    - Other threads may keep logging, they write synchronously as soon as the method was called and their messages which
+  *      were already on the way into a ring buffer are written before the method returns
+  *    - The synchronous mode is not thread safe, so other threads should stop logging before this method returns
+  */
+  RECORE_API void stopAsynchronous();
+
+  /**
+  *  @brief
+  *    Return whether or not the log is in asynchronous mode
+  *
+  *  @return
+  *    'true' if the log is in asynchronous mode, else 'false'
+  */
+  inline bool isAsynchronous() const;
+
+  /**
+  *  @brief
+  *    Get the total number of dropped messages
+  *
+  *  @return
+  *    The total number of messages dropped because of a full ring buffer
+  */
+  RECORE_API uint32 getNumberOfDroppedMessages() const;
+
 
   //[-------------------------------------------------------]
   //[ Private functions                                     ]
@@ -342,6 +451,116 @@ private:
   */
   RECORE_API bool write(uint8 nLogLevel, const String &sText);
 
+  /**
+  *  @brief
+  *    Write a string into the console, the log formatter and the last messages queue
+  *
+  *  @param[in] nLogLevel
+  *    Log Level
+  *  @param[in] sText
+  *    Text which should be written into the log
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  bool writeText(uint8 nLogLevel, const String &sText);
+
+  /**
+  *  @brief
+  *    Enter passing a message to the background thread
+  *
+  *  @return
+  *    'true' if the log is in asynchronous mode and the calling thread isn't the background thread, call "leaveAsynchronousProducer()"
+  *    after the record was committed or dropped in this case, else 'false'
+  *
+  *  @note
+  *    - The background thread consumes the ring buffers, so it must write its own messages directly instead of waiting for room
+  *    - "stopAsynchronous()" waits for all entered producers before the background thread does its final pass, so no committed record is lost
+  */
+  RECORE_API bool enterAsynchronousProducer();
+
+  /**
+  *  @brief
+  *    Leave passing a message to the background thread, see "enterAsynchronousProducer()"
+  */
+  RECORE_API void leaveAsynchronousProducer();
+
+  /**
+  *  @brief
+  *    Get the ring buffer of the calling thread, created on the first call, asynchronous mode only
+  *
+  *  @return
+  *    The ring buffer of the calling thread
+  */
+  LogRingBuffer &getThreadRingBuffer();
+
+  /**
+  *  @brief
+  *    Get the maximum size of the encoded arguments of a record inside the ring buffer of the calling thread, asynchronous mode only
+  *
+  *  @return
+  *    The maximum size of the encoded arguments in bytes, larger messages have to be truncated
+  */
+  RECORE_API uint32 getMaximumArgumentsSize();
+
+  /**
+  *  @brief
+  *    Reserve a record inside the ring buffer of the calling thread, asynchronous mode only
+  *
+  *  @param[in] nLogLevel
+  *    Log Level
+  *  @param[in] nArgumentsSize
+  *    Size of the encoded arguments in bytes
+  *
+  *  @return
+  *    The initialized record header followed by "nArgumentsSize" bytes for the encoded arguments, a null pointer if the
+  *    message was dropped, call "commitRecord()" after writing the arguments
+  */
+  RECORE_API LogRecordHeader *reserveRecord(uint8 nLogLevel, uint32 nArgumentsSize);
+
+  /**
+  *  @brief
+  *    Publish the previously reserved record to the background thread
+  *
+  *  @param[in] nLogLevel
+  *    Log Level
+  */
+  RECORE_API void commitRecord(uint8 nLogLevel);
+
+  /**
+  *  @brief
+  *    Flush in asynchronous mode
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  RECORE_API bool flushAsynchronous();
+
+  /**
+  *  @brief
+  *    Wake up the background thread
+  */
+  void wakeUpAsynchronousThread();
+
+  /**
+  *  @brief
+  *    Background thread function
+  */
+  void asynchronousThread();
+
+  /**
+  *  @brief
+  *    Consume, sort and write all pending records of all threads, background thread only
+  */
+  void processAsynchronousRecords();
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  struct AsynchronousData;
+
 
   //[-------------------------------------------------------]
   //[ Private data                                          ]
@@ -355,6 +574,9 @@ private:
   std::queue<String> m_qLastMessages;        /**< Holds the last log messages */
   uint32 m_nBufferedMessages;      /**< How much messages should be buffered */
   LogFormatter *m_pLogFormatter;        /**< Holds an instance of a log formatter class, can be a null pointer */
+  std::atomic<bool> m_bAsynchronous;    /**< Asynchronous mode active? */
+  std::atomic<uint32> m_nNumberOfAsynchronousProducers;  /**< Number of threads currently passing a message to the background thread */
+  AsynchronousData *m_pAsynchronousData;  /**< Asynchronous mode data, created on the first "startAsynchronous()" call and kept alive afterwards, can be a null pointer */
 };
 
 
@@ -23,6 +23,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/Log/LogFormatter.h"
+#include <vector>
 
 
 //[-------------------------------------------------------]
@@ -113,6 +114,10 @@ inline void Log::setFlushLogLevel(uint8 nFlushLogLevel) {
 *    Flush output buffer to disk
 */
 inline bool Log::flush() {
+  // In asynchronous mode the background thread owns the log formatter
+  if (isAsynchronous())
+    return flushAsynchronous();
+
   // Is there anything to flush?
   if (m_nFlushMessages && m_pLogFormatter) {
     // Flush on disc
@@ -148,6 +153,56 @@ inline LogFormatter *Log::getLogFormatter() const {
   return m_pLogFormatter;
 }
 
+/**
+*  @brief
+*    Write a formatted message into the log
+*/
+template <typename... ARGUMENTS>
+inline bool Log::outputFormat(const LogFormat &cLogFormat, const ARGUMENTS &... tArguments) {
+  // Check log level
+  if (cLogFormat.nLogLevel <= Quiet || cLogFormat.nLogLevel > m_nLogLevel)
+    return false;
+
+  // In asynchronous mode only capture the raw arguments, the background thread does the formatting (same rules as in "write()")
+  const uint32 nArgumentsSize = LogRecord::getArgumentsSize(tArguments...);
+  if (enterAsynchronousProducer()) {
+    if (nArgumentsSize <= getMaximumArgumentsSize()) {
+      LogRecordHeader *pRecordHeader = reserveRecord(cLogFormat.nLogLevel, nArgumentsSize);
+      if (nullptr != pRecordHeader) {
+        pRecordHeader->pLogFormat = &cLogFormat;
+        pRecordHeader->nNumberOfArguments = static_cast<uint8>(sizeof...(ARGUMENTS));
+        LogRecord::writeArguments(reinterpret_cast<uint8*>(pRecordHeader + 1), tArguments...);
+        commitRecord(cLogFormat.nLogLevel);
+      }
+      leaveAsynchronousProducer();
+      return (nullptr != pRecordHeader); // 'false' if dropped
+    }
+    leaveAsynchronousProducer();
+  }
+
+  // Format on the calling thread, use 64 bit elements to get a properly aligned record header. This is also the
+  // fallback for the background thread itself and for arguments not fitting into a ring buffer record, "write()"
+  // truncates the formatted text if required.
+  std::vector<uint64> lstRecord((sizeof(LogRecordHeader) + nArgumentsSize + sizeof(uint64) - 1) / sizeof(uint64));
+  LogRecordHeader *pRecordHeader = reinterpret_cast<LogRecordHeader*>(lstRecord.data());
+  pRecordHeader->pLogFormat = &cLogFormat;
+  pRecordHeader->nArgumentsSize = nArgumentsSize;
+  pRecordHeader->nLogLevel = cLogFormat.nLogLevel;
+  pRecordHeader->nNumberOfArguments = static_cast<uint8>(sizeof...(ARGUMENTS));
+  LogRecord::writeArguments(reinterpret_cast<uint8*>(pRecordHeader + 1), tArguments...);
+  String sText;
+  LogRecord::formatRecord(*pRecordHeader, sText);
+  return write(cLogFormat.nLogLevel, sText);
+}
+
+/**
+*  @brief
+*    Return whether or not the log is in asynchronous mode
+*/
+inline bool Log::isAsynchronous() const {
+  return m_bAsynchronous.load(std::memory_order_acquire);
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
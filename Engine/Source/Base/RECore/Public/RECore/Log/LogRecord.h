@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/String/String.h"
+#include <cstdio>
+#include <type_traits>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static description of a log call site
+*
+*  @remarks
+*    One static instance is created per "RE_LOG_FORMAT" call site, the address of the instance is the format ID. This way
+*    the format string and the source location are never copied, only the raw arguments are captured.
+*/
+struct LogFormat {
+  uint8       nLogLevel;    /**< Log level */
+  const char *pszFormat;    /**< Format string using "{}" as argument placeholder, always valid */
+  const char *pszFile;      /**< Source file, always valid */
+  uint32      nLine;        /**< Source line */
+  const char *pszFunction;  /**< Function name, always valid */
+};
+
+/**
+*  @brief
+*    Header of a captured log record, followed by the encoded arguments
+*/
+struct LogRecordHeader {
+  uint64           nTimestamp;          /**< Steady clock timestamp in nanoseconds, see "RECore::LogRecord::getTimestamp()" */
+  const LogFormat *pLogFormat;          /**< Call site description, a null pointer for plain text records which have a single string argument */
+  uint32           nThreadIndex;        /**< Index of the thread which wrote the record */
+  uint32           nArgumentsSize;      /**< Size of the encoded arguments in bytes */
+  uint8            nLogLevel;           /**< Log level */
+  uint8            nNumberOfArguments;  /**< Number of encoded arguments */
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Static log record helper: argument encoding, message formatting and the compact binary log format
+*
+*  @remarks
+*    Encoded argument layout: "uint8 type" followed by the value, 1 byte for booleans, 8 bytes for integers, floating points
+*    and pointers and "uint32 length" plus the characters (without terminating zero) for strings. Values are not aligned.
+*
+*    Binary log file layout: "uint32 magic", "uint32 version" followed by chunks starting with a "uint8 chunk type":
+*    - Format chunk:  "uint32 format ID", "uint8 log level", "uint32 line" and the length-prefixed format, file and function strings
+*    - Record chunk:  "uint64 timestamp", "uint32 thread index", "uint32 format ID" (0 = plain text), "uint8 log level",
+*                     "uint8 number of arguments", "uint32 arguments size" and the encoded arguments
+*    - Dropped chunk: "uint32 number of dropped records"
+*    A format chunk is always written before the first record chunk referencing it. Use "decodeBinaryFile()" to convert
+*    a binary log into a human readable text file.
+*/
+class LogRecord {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Encoded argument type
+  */
+  enum ArgumentType {
+    BoolArgument = 0,  /**< Boolean */
+    Int64Argument,     /**< Signed integer */
+    UInt64Argument,    /**< Unsigned integer or enumeration */
+    DoubleArgument,    /**< Floating point */
+    StringArgument,    /**< String */
+    PointerArgument    /**< Pointer, written as hexadecimal address */
+  };
+
+  static constexpr uint32 MAXIMUM_STRING_ARGUMENT_LENGTH = 16 * 1024;  /**< Longer string arguments are truncated */
+
+
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Get the current timestamp
+  *
+  *  @return
+  *    Steady clock timestamp in nanoseconds
+  */
+  static RECORE_API uint64 getTimestamp();
+
+  /**
+  *  @brief
+  *    Get the encoded size of the given arguments
+  *
+  *  @param[in] tArguments
+  *    Arguments (boolean, integral, enumeration, floating point, "char*", "RECore::String" or pointer)
+  *
+  *  @return
+  *    The encoded size in bytes
+  */
+  template <typename... ARGUMENTS>
+  static inline uint32 getArgumentsSize(const ARGUMENTS &... tArguments);
+
+  /**
+  *  @brief
+  *    Encode the given arguments
+  *
+  *  @param[out] pDestination
+  *    Destination, must be at least "getArgumentsSize()" bytes large
+  *  @param[in] tArguments
+  *    Arguments
+  */
+  template <typename... ARGUMENTS>
+  static inline void writeArguments(uint8 *pDestination, const ARGUMENTS &... tArguments);
+
+  /**
+  *  @brief
+  *    Format a message
+  *
+  *  @param[in] pszFormat
+  *    Format string using "{}" as argument placeholder, surplus placeholders are kept as they are
+  *  @param[in] pArguments
+  *    Encoded arguments
+  *  @param[in] nArgumentsSize
+  *    Size of the encoded arguments in bytes
+  *  @param[in] nNumberOfArguments
+  *    Number of encoded arguments
+  *  @param[out] sText
+  *    Receives the formatted message, the message is appended
+  */
+  static RECORE_API void formatMessage(const char *pszFormat, const uint8 *pArguments, uint32 nArgumentsSize, uint8 nNumberOfArguments, String &sText);
+
+  /**
+  *  @brief
+  *    Format a record
+  *
+  *  @param[in] cRecordHeader
+  *    Record header, the encoded arguments must follow directly
+  *  @param[out] sText
+  *    Receives the formatted message, the message is appended
+  */
+  static RECORE_API void formatRecord(const LogRecordHeader &cRecordHeader, String &sText);
+
+  //[-------------------------------------------------------]
+  //[ Binary log                                            ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Write the binary log file header
+  *
+  *  @param[in] pFile
+  *    File to write into, must be valid
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  static RECORE_API bool writeBinaryFileHeader(FILE *pFile);
+
+  /**
+  *  @brief
+  *    Write a binary log format chunk
+  *
+  *  @param[in] pFile
+  *    File to write into, must be valid
+  *  @param[in] nFormatId
+  *    Format ID, must not be 0
+  *  @param[in] cLogFormat
+  *    Call site description
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  static RECORE_API bool writeBinaryFormat(FILE *pFile, uint32 nFormatId, const LogFormat &cLogFormat);
+
+  /**
+  *  @brief
+  *    Write a binary log record chunk
+  *
+  *  @param[in] pFile
+  *    File to write into, must be valid
+  *  @param[in] nFormatId
+  *    Format ID written by "writeBinaryFormat()", 0 for plain text records
+  *  @param[in] cRecordHeader
+  *    Record header, the encoded arguments must follow directly
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  static RECORE_API bool writeBinaryRecord(FILE *pFile, uint32 nFormatId, const LogRecordHeader &cRecordHeader);
+
+  /**
+  *  @brief
+  *    Write a binary log dropped chunk
+  *
+  *  @param[in] pFile
+  *    File to write into, must be valid
+  *  @param[in] nNumberOfDroppedRecords
+  *    Number of dropped records
+  *
+  *  @return
+  *    'true' if all went fine, else 'false'
+  */
+  static RECORE_API bool writeBinaryDropped(FILE *pFile, uint32 nNumberOfDroppedRecords);
+
+  /**
+  *  @brief
+  *    Offline decoder: convert a binary log file into a text log file
+  *
+  *  @param[in] sBinaryFilename
+  *    Binary log filename
+  *  @param[in] sTextFilename
+  *    Text log filename, an existing file is overwritten
+  *
+  *  @return
+  *    'true' if all went fine, else 'false' (file error or invalid/truncated binary log, all complete records are still written)
+  */
+  static RECORE_API bool decodeBinaryFile(const String &sBinaryFilename, const String &sTextFilename);
+
+
+  //[-------------------------------------------------------]
+  //[ Private static functions                              ]
+  //[-------------------------------------------------------]
+private:
+  template <typename T>
+  static inline uint32 getArgumentSize(const T &tArgument);
+
+  template <typename T>
+  static inline void writeArgument(uint8 *&pDestination, const T &tArgument);
+
+  template <typename T>
+  static inline uint32 getStringArgumentLength(const T &tArgument);
+
+  template <typename T>
+  static inline const char *getStringArgumentData(const T &tArgument);
+
+  template <typename T>
+  struct IsStringArgument : std::integral_constant<bool, std::is_same<T, String>::value ||
+                                                         std::is_same<typename std::decay<T>::type, const char*>::value ||
+                                                         std::is_same<typename std::decay<T>::type, char*>::value> {};
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RECore/Log/LogRecord.inl"
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <cstring>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Get the encoded size of the given arguments
+*/
+template <typename... ARGUMENTS>
+inline uint32 LogRecord::getArgumentsSize(const ARGUMENTS &... tArguments) {
+  static_assert(sizeof...(ARGUMENTS) <= 255, "Too many log arguments");
+  return (0 + ... + getArgumentSize(tArguments));
+}
+
+/**
+*  @brief
+*    Encode the given arguments
+*/
+template <typename... ARGUMENTS>
+inline void LogRecord::writeArguments(uint8 *pDestination, const ARGUMENTS &... tArguments) {
+  (writeArgument(pDestination, tArguments), ...);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+template <typename T>
+inline uint32 LogRecord::getArgumentSize(const T &tArgument) {
+  if constexpr (std::is_same<T, bool>::value)
+    return 1 + 1;
+  else if constexpr (IsStringArgument<T>::value)
+    return 1 + sizeof(uint32) + getStringArgumentLength(tArgument);
+  else if constexpr (std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value || std::is_null_pointer<T>::value)
+    return 1 + 8;
+  else
+    static_assert(std::is_arithmetic<T>::value, "Unsupported log argument type");
+}
+
+template <typename T>
+inline void LogRecord::writeArgument(uint8 *&pDestination, const T &tArgument) {
+  if constexpr (std::is_same<T, bool>::value) {
+    *pDestination++ = BoolArgument;
+    *pDestination++ = tArgument ? 1 : 0;
+  } else if constexpr (IsStringArgument<T>::value) {
+    const uint32 nLength = getStringArgumentLength(tArgument);
+    *pDestination++ = StringArgument;
+    memcpy(pDestination, &nLength, sizeof(uint32));
+    pDestination += sizeof(uint32);
+    if (nLength) {
+      memcpy(pDestination, getStringArgumentData(tArgument), nLength);
+      pDestination += nLength;
+    }
+  } else {
+    uint64 nValue = 0;
+    if constexpr (std::is_floating_point<T>::value) {
+      *pDestination++ = DoubleArgument;
+      const double fValue = static_cast<double>(tArgument);
+      memcpy(&nValue, &fValue, sizeof(double));
+    } else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value) {
+      *pDestination++ = Int64Argument;
+      nValue = static_cast<uint64>(static_cast<int64>(tArgument));
+    } else if constexpr (std::is_integral<T>::value || std::is_enum<T>::value) {
+      *pDestination++ = UInt64Argument;
+      nValue = static_cast<uint64>(tArgument);
+    } else {
+      *pDestination++ = PointerArgument;
+      nValue = static_cast<uint64>(reinterpret_cast<uintptr_t>(tArgument));
+    }
+    memcpy(pDestination, &nValue, sizeof(uint64));
+    pDestination += sizeof(uint64);
+  }
+}
+
+template <typename T>
+inline uint32 LogRecord::getStringArgumentLength(const T &tArgument) {
+  uint32 nLength = 0;
+  if constexpr (std::is_same<T, String>::value)
+    nLength = static_cast<uint32>(tArgument.length());
+  else if (tArgument)
+    nLength = static_cast<uint32>(strlen(tArgument));
+  return (nLength > MAXIMUM_STRING_ARGUMENT_LENGTH) ? MAXIMUM_STRING_ARGUMENT_LENGTH : nLength;
+}
+
+template <typename T>
+inline const char *LogRecord::getStringArgumentData(const T &tArgument) {
+  if constexpr (std::is_same<T, String>::value)
+    return tArgument.cstr();
+  else
+    return tArgument;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
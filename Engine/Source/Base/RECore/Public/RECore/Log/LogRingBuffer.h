@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include <atomic>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Lock-free single producer single consumer byte ring buffer for log records
+*
+*  @remarks
+*    Each record is 8 byte aligned and starts with a small record header holding the record size. If a record does not
+*    fit into the remaining contiguous space until the end of the buffer, a padding record fills the gap and the record
+*    starts at the beginning of the buffer, meaning a record is always contiguous in memory.
+*
+*    Head and tail are monotonically increasing 64 bit byte positions, the buffer offset is "position & (capacity - 1)".
+*
+*  @note
+*    - Exactly one producer thread may call "reserve()" and "commit()"
+*    - Exactly one consumer thread may call "consume()"
+*/
+class LogRingBuffer {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  static constexpr uint32 RECORD_ALIGNMENT   = 8;  /**< Record alignment in bytes */
+  static constexpr uint32 RECORD_HEADER_SIZE = 8;  /**< Size of the record header in bytes */
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] nCapacity
+  *    Capacity in bytes, is rounded up to the next power of two (minimum is 1024 bytes)
+  *  @param[in] nThreadIndex
+  *    Index of the producer thread, stored inside each record so records can be associated with their thread
+  */
+  RECORE_API LogRingBuffer(uint32 nCapacity, uint32 nThreadIndex);
+
+  /**
+  *  @brief
+  *    Destructor
+  */
+  RECORE_API ~LogRingBuffer();
+
+  /**
+  *  @brief
+  *    Get the capacity in bytes
+  *
+  *  @return
+  *    The capacity in bytes, always a power of two
+  */
+  inline uint32 getCapacity() const;
+
+  /**
+  *  @brief
+  *    Get the maximum payload size of a single record
+  *
+  *  @return
+  *    The maximum payload size of a single record in bytes
+  */
+  inline uint32 getMaximumPayloadSize() const;
+
+  /**
+  *  @brief
+  *    Get the index of the producer thread
+  *
+  *  @return
+  *    The index of the producer thread
+  */
+  inline uint32 getThreadIndex() const;
+
+  /**
+  *  @brief
+  *    Return whether or not the ring buffer is empty
+  *
+  *  @return
+  *    'true' if there are no committed records left to consume, else 'false'
+  */
+  inline bool isEmpty() const;
+
+  /**
+  *  @brief
+  *    Return whether or not the producer thread has gone
+  *
+  *  @return
+  *    'true' if the producer thread has exited, meaning no further records will be written, else 'false'
+  */
+  inline bool isOrphaned() const;
+
+  /**
+  *  @brief
+  *    Mark the ring buffer as orphaned, called when the producer thread exits
+  */
+  inline void setOrphaned();
+
+  //[-------------------------------------------------------]
+  //[ Producer                                              ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Reserve a record
+  *
+  *  @param[in] nPayloadSize
+  *    Payload size in bytes
+  *
+  *  @return
+  *    Pointer to the 8 byte aligned payload memory, a null pointer if there's currently not enough free space or the
+  *    payload is larger than "getMaximumPayloadSize()"
+  *
+  *  @note
+  *    - The record is not visible to the consumer until "commit()" has been called
+  *    - There can only be one reserved record at a time
+  */
+  RECORE_API uint8 *reserve(uint32 nPayloadSize);
+
+  /**
+  *  @brief
+  *    Publish the previously reserved record to the consumer
+  */
+  inline void commit();
+
+  /**
+  *  @brief
+  *    Return whether or not at least half of the capacity is in use
+  *
+  *  @return
+  *    'true' if at least half of the capacity is in use, else 'false'
+  *
+  *  @note
+  *    - Producer side, used to wake up the consumer early
+  */
+  inline bool isHalfFull();
+
+  //[-------------------------------------------------------]
+  //[ Consumer                                              ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Consume all committed records
+  *
+  *  @param[in] cFunction
+  *    Function called as "cFunction(const uint8 *pPayload, uint32 nPayloadSize)" for each record in the order the records were written
+  *
+  *  @return
+  *    The number of consumed records
+  *
+  *  @note
+  *    - The payload memory is released after all records have been passed to the function
+  */
+  template <typename FUNCTION>
+  uint32 consume(FUNCTION cFunction);
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  struct RecordHeader {
+    uint32 nSize;     /**< Record size in bytes including the header and the alignment padding */
+    uint32 nPadding;  /**< 1 if this is a padding record without payload, else 0 */
+  };
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  /**
+  *  @brief
+  *    Copy constructor
+  *
+  *  @param[in] cSource
+  *    Source to copy from
+  */
+  LogRingBuffer(const LogRingBuffer &cSource) = delete;
+
+  /**
+  *  @brief
+  *    Copy operator
+  *
+  *  @param[in] cSource
+  *    Source to copy from
+  *
+  *  @return
+  *    Reference to this instance
+  */
+  LogRingBuffer &operator=(const LogRingBuffer &cSource) = delete;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  uint8 *m_pBuffer;        /**< Ring buffer memory, always valid */
+  uint32 m_nCapacity;      /**< Capacity in bytes, always a power of two */
+  uint32 m_nThreadIndex;   /**< Index of the producer thread */
+  std::atomic<bool> m_bOrphaned;  /**< Set as soon as the producer thread has exited */
+  // Producer side, the tail is cached to avoid touching the consumer cache line for every record
+  alignas(64) std::atomic<uint64> m_nHead;  /**< Position of the end of the last committed record */
+  uint64 m_nReservedHead;  /**< Position of the end of the currently reserved record */
+  uint64 m_nCachedTail;    /**< Last known consumer position */
+  // Consumer side
+  alignas(64) std::atomic<uint64> m_nTail;  /**< Position of the first not yet consumed record */
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RECore/Log/LogRingBuffer.inl"
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Get the capacity in bytes
+*/
+inline uint32 LogRingBuffer::getCapacity() const {
+  return m_nCapacity;
+}
+
+/**
+*  @brief
+*    Get the maximum payload size of a single record
+*/
+inline uint32 LogRingBuffer::getMaximumPayloadSize() const {
+  // A record including a worst case padding record must always fit into the buffer
+  return m_nCapacity / 2 - RECORD_HEADER_SIZE;
+}
+
+/**
+*  @brief
+*    Get the index of the producer thread
+*/
+inline uint32 LogRingBuffer::getThreadIndex() const {
+  return m_nThreadIndex;
+}
+
+/**
+*  @brief
+*    Return whether or not the ring buffer is empty
+*/
+inline bool LogRingBuffer::isEmpty() const {
+  return (m_nHead.load(std::memory_order_acquire) == m_nTail.load(std::memory_order_acquire));
+}
+
+/**
+*  @brief
+*    Return whether or not the producer thread has gone
+*/
+inline bool LogRingBuffer::isOrphaned() const {
+  return m_bOrphaned.load(std::memory_order_acquire);
+}
+
+/**
+*  @brief
+*    Mark the ring buffer as orphaned, called when the producer thread exits
+*/
+inline void LogRingBuffer::setOrphaned() {
+  m_bOrphaned.store(true, std::memory_order_release);
+}
+
+/**
+*  @brief
+*    Publish the previously reserved record to the consumer
+*/
+inline void LogRingBuffer::commit() {
+  m_nHead.store(m_nReservedHead, std::memory_order_release);
+}
+
+/**
+*  @brief
+*    Return whether or not at least half of the capacity is in use
+*/
+inline bool LogRingBuffer::isHalfFull() {
+  // The cached tail is only refreshed when it indicates a half full buffer
+  if (m_nReservedHead - m_nCachedTail < m_nCapacity / 2)
+    return false;
+  m_nCachedTail = m_nTail.load(std::memory_order_acquire);
+  return (m_nReservedHead - m_nCachedTail >= m_nCapacity / 2);
+}
+
+/**
+*  @brief
+*    Consume all committed records
+*/
+template <typename FUNCTION>
+uint32 LogRingBuffer::consume(FUNCTION cFunction) {
+  const uint64 nHead = m_nHead.load(std::memory_order_acquire);
+  uint64 nTail = m_nTail.load(std::memory_order_relaxed);
+  uint32 nNumberOfRecords = 0;
+  while (nTail != nHead) {
+    const uint8 *pRecord = m_pBuffer + (nTail & (m_nCapacity - 1));
+    const RecordHeader *pRecordHeader = reinterpret_cast<const RecordHeader*>(pRecord);
+    if (!pRecordHeader->nPadding) {
+      cFunction(pRecord + RECORD_HEADER_SIZE, pRecordHeader->nSize - RECORD_HEADER_SIZE);
+      ++nNumberOfRecords;
+    }
+    nTail += pRecordHeader->nSize;
+  }
+
+  // Release the memory to the producer
+  m_nTail.store(nTail, std::memory_order_release);
+
+  // Done
+  return nNumberOfRecords;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
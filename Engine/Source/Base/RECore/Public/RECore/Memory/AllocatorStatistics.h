@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+
+#include <atomic>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Allocator statistics of a single allocator tag
+*
+*  @note
+*    - All methods are multithreading safe, the counters are updated using relaxed atomics
+*    - "Backing allocations" are allocations an allocator couldn't serve on its own and hence passed to its backing
+*      general-purpose allocator, in a steady-state frame this number should stay constant
+*/
+class AllocatorStatistics final
+{
+
+  // Public methods
+public:
+  inline explicit AllocatorStatistics(const char* tag) :
+    mTag(tag),
+    mLiveBytes(0),
+    mPeakBytes(0),
+    mNumberOfAllocations(0),
+    mNumberOfFrameAllocations(0),
+    mNumberOfBackingAllocations(0)
+  {
+    ASSERT(nullptr != mTag, "Invalid allocator tag")
+  }
+
+  [[nodiscard]] inline const char* getTag() const
+  {
+    return mTag;
+  }
+
+  /**
+  *  @brief
+  *    Return the number of currently allocated bytes
+  */
+  [[nodiscard]] inline uint64 getLiveBytes() const
+  {
+    return mLiveBytes.load(std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Return the maximum number of allocated bytes at any point in time
+  */
+  [[nodiscard]] inline uint64 getPeakBytes() const
+  {
+    return mPeakBytes.load(std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Return the total number of allocations
+  */
+  [[nodiscard]] inline uint64 getNumberOfAllocations() const
+  {
+    return mNumberOfAllocations.load(std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Return the number of allocations since the last "RECore::AllocatorStatistics::beginFrame()"
+  */
+  [[nodiscard]] inline uint64 getNumberOfFrameAllocations() const
+  {
+    return mNumberOfFrameAllocations.load(std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Return the total number of allocations which had to be passed to the backing allocator
+  */
+  [[nodiscard]] inline uint64 getNumberOfBackingAllocations() const
+  {
+    return mNumberOfBackingAllocations.load(std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Start a new frame, resets the per frame allocation counter
+  */
+  inline void beginFrame()
+  {
+    mNumberOfFrameAllocations.store(0, std::memory_order_relaxed);
+  }
+
+  inline void onAllocate(uint64 numberOfBytes)
+  {
+    mNumberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    mNumberOfFrameAllocations.fetch_add(1, std::memory_order_relaxed);
+    const uint64 liveBytes = mLiveBytes.fetch_add(numberOfBytes, std::memory_order_relaxed) + numberOfBytes;
+    uint64 peakBytes = mPeakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes && !mPeakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+    {
+      // Nothing here, "peakBytes" has been updated by "compare_exchange_weak()"
+    }
+  }
+
+  inline void onFree(uint64 numberOfBytes)
+  {
+    mLiveBytes.fetch_sub(numberOfBytes, std::memory_order_relaxed);
+  }
+
+  inline void onBackingAllocation()
+  {
+    mNumberOfBackingAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+  *  @brief
+  *    Set the number of live bytes, used by allocators releasing all memory at once
+  */
+  inline void setLiveBytes(uint64 numberOfBytes)
+  {
+    mLiveBytes.store(numberOfBytes, std::memory_order_relaxed);
+  }
+
+  explicit AllocatorStatistics(const AllocatorStatistics&) = delete;
+  AllocatorStatistics& operator=(const AllocatorStatistics&) = delete;
+
+  // Private data
+private:
+  const char*         mTag;  ///< Allocator tag, e.g. "RenderFrame", always valid, not owned
+  std::atomic<uint64> mLiveBytes;
+  std::atomic<uint64> mPeakBytes;
+  std::atomic<uint64> mNumberOfAllocations;
+  std::atomic<uint64> mNumberOfFrameAllocations;
+  std::atomic<uint64> mNumberOfBackingAllocations;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -32,6 +32,11 @@
 #include "RECore/Memory/IAllocator.h"
 
 #include <stdlib.h>
+#include <string.h>	// For "memcpy()"
+#ifndef _MSC_VER
+	#include <malloc.h>	// For "malloc_usable_size()"
+	#include <cstddef>	// For "std::max_align_t"
+#endif
 
 
 //[-------------------------------------------------------]
@@ -46,7 +51,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		[[nodiscard]] void* reallocate(RECore::IAllocator&, void* oldPointer, size_t, size_t newNumberOfBytes, size_t alignment)
+		[[nodiscard]] void* defaultReallocate(RECore::IAllocator&, void* oldPointer, [[maybe_unused]] size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
 		{
 			// Sanity check
 			ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The alignment must be a power of two")
@@ -58,8 +63,23 @@ namespace
 				#ifdef _MSC_VER
 					return _aligned_realloc(oldPointer, newNumberOfBytes, alignment);
 				#else
-					// TODO(naetherm) Need aligned version, see e.g. https://github.com/philiptaylor/vulkan-sxs/blob/9cb21b3/common/AllocationCallbacks.cpp#L87 or XSIMD "xsimd_aligned_allocator"
-					return realloc(oldPointer, newNumberOfBytes);
+					// "realloc()" only guarantees the fundamental alignment
+					if (alignment <= alignof(std::max_align_t))
+					{
+						return realloc(oldPointer, newNumberOfBytes);
+					}
+
+					// Move the data into a new properly aligned block, on failure the old block stays untouched like with "realloc()"
+					void* newPointer = nullptr;
+					if (0 != posix_memalign(&newPointer, alignment, newNumberOfBytes))
+					{
+						// Error!
+						return nullptr;
+					}
+					const size_t numberOfOldBytes = (0 != oldNumberOfBytes) ? oldNumberOfBytes : malloc_usable_size(oldPointer);
+					memcpy(newPointer, oldPointer, (numberOfOldBytes < newNumberOfBytes) ? numberOfOldBytes : newNumberOfBytes);
+					::free(oldPointer);
+					return newPointer;
 				#endif
 			}
 			else
@@ -98,8 +118,8 @@ namespace
 						::free(oldPointer);
 					}
 
-					// Allocate
-					return (0 != newNumberOfBytes) ? ::aligned_alloc(alignment, newNumberOfBytes) : nullptr;
+					// Allocate, "aligned_alloc()" requires the number of bytes to be a multiple of the alignment
+					return (0 != newNumberOfBytes) ? ::aligned_alloc(alignment, (newNumberOfBytes + alignment - 1) & ~(alignment - 1)) : nullptr;
 				#endif
 			}
 		}
@@ -139,7 +159,7 @@ namespace RECore
 	//[-------------------------------------------------------]
 	public:
 		inline DefaultAllocator() :
-			IAllocator(&::detail::reallocate)
+			IAllocator(&::detail::defaultReallocate)
 		{
 			// Nothing here
 		}
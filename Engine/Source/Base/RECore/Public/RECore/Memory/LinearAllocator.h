@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Memory/IAllocator.h"
+#include "RECore/Memory/AllocatorStatistics.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Linear (bump) memory allocator for frame-scoped allocations
+*
+*  @remarks
+*    The memory is allocated once from the backing allocator. An allocation only moves an atomic offset forward,
+*    freeing memory does nothing. Call "RECore::LinearAllocator::reset()" at the end of the frame to release all
+*    allocations at once. If the allocator runs out of memory, allocations are passed to the backing allocator and
+*    counted as backing allocations, pick a capacity which is sufficient for a steady-state frame. Such overflow blocks
+*    are tracked and released by "RECore::LinearAllocator::reset()" as well.
+*
+*  @note
+*    - Multithreading safe, lock-free
+*    - Reallocating the most recent allocation grows or shrinks it in place if "oldNumberOfBytes" is known
+*    - "reset()" must not be called while other threads are allocating
+*/
+class RECORE_API LinearAllocator final : public IAllocator
+{
+
+  // Public methods
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] tag
+  *    Statistics tag, must stay valid as long as the allocator instance exists
+  *  @param[in] capacity
+  *    Capacity in bytes
+  *  @param[in] backingAllocator
+  *    Backing allocator, must stay valid as long as the allocator instance exists
+  */
+  LinearAllocator(const char* tag, size_t capacity, IAllocator& backingAllocator);
+
+  virtual ~LinearAllocator() override;
+
+  [[nodiscard]] inline size_t getCapacity() const
+  {
+    return mCapacity;
+  }
+
+  [[nodiscard]] inline size_t getNumberOfUsedBytes() const
+  {
+    return mOffset.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] inline const AllocatorStatistics& getStatistics() const
+  {
+    return mStatistics;
+  }
+
+  /**
+  *  @brief
+  *    Release all allocations at once and start a new frame
+  */
+  void reset();
+
+  explicit LinearAllocator(const LinearAllocator&) = delete;
+  LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+  // Private definitions
+private:
+  /**
+  *  @brief
+  *    Header in front of each memory block allocated from the backing allocator because the buffer was full
+  */
+  struct OverflowBlock final
+  {
+    OverflowBlock* next;                ///< Next overflow block, can be a null pointer
+    void*          basePointer;         ///< Pointer returned by the backing allocator
+    size_t         numberOfBytes;       ///< Number of bytes requested by the caller
+    size_t         totalNumberOfBytes;  ///< Number of bytes allocated from the backing allocator
+    size_t         alignment;           ///< Alignment used for the backing allocator
+  };
+
+  // Private static methods
+private:
+  [[nodiscard]] static void* staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment);
+
+  [[nodiscard]] static inline OverflowBlock& getOverflowBlock(void* pointer)
+  {
+    return *(static_cast<OverflowBlock*>(pointer) - 1);
+  }
+
+  // Private methods
+private:
+  [[nodiscard]] inline bool isOwnedPointer(const void* pointer) const
+  {
+    return (pointer >= mBuffer && pointer < mBuffer + mCapacity);
+  }
+
+  [[nodiscard]] void* allocate(size_t numberOfBytes, size_t alignment);
+
+  [[nodiscard]] void* allocateOverflowBlock(size_t numberOfBytes, size_t alignment);
+
+  void freeOverflowBlocks();
+
+  // Private data
+private:
+  IAllocator&         mBackingAllocator;
+  uint8*              mBuffer;    ///< Memory allocated from the backing allocator, can be a null pointer if the capacity is zero
+  size_t              mCapacity;  ///< Capacity in bytes
+  std::atomic<size_t> mOffset;    ///< Offset of the first unused byte inside the buffer
+  std::atomic<OverflowBlock*> mOverflowBlocks;  ///< Lock-free singly linked list of the blocks allocated from the backing allocator since the last reset, can be a null pointer
+  AllocatorStatistics mStatistics;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -30,6 +30,9 @@
 //[-------------------------------------------------------]
 #include "RECore/RECore.h"
 #include "RECore/Memory/MimallocAllocator.h"
+#ifdef RECORE_MEMORY_TRACKING
+  #include "RECore/Memory/TrackingAllocator.h"
+#endif
 
 
 //[-------------------------------------------------------]
@@ -113,9 +116,21 @@ public:
 
   static inline void* reallocate(void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment);
 
+  /**
+  *  @brief
+  *    Return the global general-purpose allocator, e.g. as backing allocator for "RECore::LinearAllocator", "RECore::PoolAllocator" or "RECore::TlsfAllocator"
+  *
+  *  @return
+  *    The global general-purpose allocator
+  */
+  static inline IAllocator& getAllocator();
+
 private:
 
   static MimallocAllocator SAllocator;
+#ifdef RECORE_MEMORY_TRACKING
+  static TrackingAllocator STrackingAllocator;  ///< Wraps "SAllocator", attributes all allocations to the memory tag of the calling thread
+#endif
 };
 
 
@@ -131,15 +146,17 @@ private:
 #include "RECore/Memory/Memory.inl"
 
 
+// RHI memory, "context" is the RHI context providing the allocator, see "RERHI::RHIContext::getAllocator()"
+
 // Malloc and free
 #define RHI_MALLOC(context, newNumberOfBytes) (context).getAllocator().reallocate(nullptr, 0, newNumberOfBytes, 1)
-#define RHI_MALLOC_TYPED(context, type, newNumberOfElements) reinterpret_cast<type*>(RECore::Memory::reallocate(nullptr, 0, sizeof(type) * (newNumberOfElements), 1))
-#define RHI_FREE(context, oldPointer) RECore::Memory::reallocate(oldPointer, 0, 0, 1)
+#define RHI_MALLOC_TYPED(context, type, newNumberOfElements) reinterpret_cast<type*>((context).getAllocator().reallocate(nullptr, 0, sizeof(type) * (newNumberOfElements), 1))
+#define RHI_FREE(context, oldPointer) (context).getAllocator().reallocate(oldPointer, 0, 0, 1)
 
 // New and delete
 // - Using placement new and explicit destructor call
 // - See http://cnicholson.net/2009/02/stupid-c-tricks-adventures-in-assert/ - "2.  Wrap your macros in do { � } while(0)." for background information about the do-while wrap
-#define RHI_NEW(context, type) new (RECore::Memory::reallocate(nullptr, 0, sizeof(type), 1)) type
+#define RHI_NEW(context, type) new ((context).getAllocator().reallocate(nullptr, 0, sizeof(type), 1)) type
 #define RHI_DELETE(context, type, oldPointer) \
 		do \
 		{ \
@@ -147,6 +164,6 @@ private:
 			{ \
 				typedef type destructor; \
 				static_cast<type*>(oldPointer)->~destructor(); \
-				RECore::Memory::reallocate(oldPointer, 0, 0, 1); \
+				(context).getAllocator().reallocate(oldPointer, 0, 0, 1); \
 			} \
 		} while (0)
@@ -71,7 +71,19 @@ inline int Memory::compare(const void *pFirstBuffer, const void *pSecondBuffer,
 }
 
 inline void* Memory::reallocate(void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment) {
+#ifdef RECORE_MEMORY_TRACKING
+  return STrackingAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+#else
   return SAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+#endif
+}
+
+inline IAllocator& Memory::getAllocator() {
+#ifdef RECORE_MEMORY_TRACKING
+  return STrackingAllocator;
+#else
+  return SAllocator;
+#endif
 }
 
 
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Memory/AllocatorStatistics.h"
+#include "RECore/File/FileTypes.h"
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class IFileManager;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Global memory tracker attributing allocations to tags
+*
+*  @remarks
+*    Every thread has a current memory tag, "RECore::TrackingAllocator" instances attribute their allocations to the
+*    tag which was current when the allocation was made. Use "RE_MEMORY_TAG_SCOPE()" to set the tag of a code
+*    section, e.g. a resource manager, the RHI backend, the resource streamer or the GUI.
+*
+*    A byte budget can be assigned to each tag. The first allocation which exceeds the budget writes a warning into
+*    the log, "RECore::MemoryTracker::isOverBudget()" can be used to enforce the budget at runtime.
+*
+*  @note
+*    - All methods are multithreading safe
+*    - Tag names must stay valid as long as the process is running, use string literals
+*/
+class RECORE_API MemoryTracker final
+{
+
+  // Public definitions
+public:
+  static constexpr uint32 MAXIMUM_NUMBER_OF_TAGS = 64;
+  static constexpr uint32 UNTAGGED               = 0;  ///< Tag index of allocations made outside of a memory tag scope
+
+  struct SnapshotEntry final
+  {
+    const char* tag;
+    uint64      liveBytes;
+    uint64      peakBytes;
+    uint64      numberOfAllocations;
+    uint64      budgetBytes;          ///< 0 if there's no budget
+  };
+  typedef std::vector<SnapshotEntry> Snapshot;
+
+  // Public static methods
+public:
+  /**
+  *  @brief
+  *    Register a memory tag
+  *
+  *  @param[in] tag
+  *    Tag name, must stay valid as long as the process is running
+  *
+  *  @return
+  *    Tag index, registering the same name twice returns the same index; "RECore::MemoryTracker::UNTAGGED" if the maximum number of tags has been reached
+  */
+  [[nodiscard]] static uint32 registerTag(const char* tag);
+
+  [[nodiscard]] static uint32 getNumberOfTags();
+
+  [[nodiscard]] static const AllocatorStatistics& getStatistics(uint32 tagIndex);
+
+  [[nodiscard]] static uint64 getBudget(uint32 tagIndex);
+
+  /**
+  *  @brief
+  *    Set the byte budget of a memory tag
+  *
+  *  @param[in] tagIndex
+  *    Tag index
+  *  @param[in] numberOfBytes
+  *    Budget in bytes, 0 for no budget
+  */
+  static void setBudget(uint32 tagIndex, uint64 numberOfBytes);
+
+  [[nodiscard]] static bool isOverBudget(uint32 tagIndex);
+
+  /**
+  *  @brief
+  *    Return the memory tag index of the calling thread
+  */
+  [[nodiscard]] static uint32 getThreadTag();
+
+  /**
+  *  @brief
+  *    Set the memory tag index of the calling thread
+  *
+  *  @param[in] tagIndex
+  *    New tag index
+  *
+  *  @return
+  *    Previous tag index
+  */
+  static uint32 setThreadTag(uint32 tagIndex);
+
+  static void onAllocate(uint32 tagIndex, uint64 numberOfBytes);
+
+  static void onFree(uint32 tagIndex, uint64 numberOfBytes);
+
+  /**
+  *  @brief
+  *    Append the current state of all memory tags to the given snapshot
+  *
+  *  @param[out] snapshot
+  *    Receives the snapshot entries, existing entries are kept, e.g. to combine the snapshot with resource manager entries
+  */
+  static void getSnapshot(Snapshot& snapshot);
+
+  /**
+  *  @brief
+  *    Write a snapshot as comma-separated values, one line per entry sorted by tag name so snapshots can be diffed
+  *
+  *  @param[in] snapshot
+  *    Snapshot to write
+  *  @param[in] fileManager
+  *    File manager to use
+  *  @param[in] virtualFilename
+  *    Virtual filename of the snapshot file to write
+  *
+  *  @return
+  *    "true" if all went fine, else "false"
+  */
+  static bool writeSnapshot(const Snapshot& snapshot, IFileManager& fileManager, VirtualFilename virtualFilename);
+
+  // Private methods
+private:
+  MemoryTracker() = delete;
+
+};
+
+/**
+*  @brief
+*    Set the memory tag of the calling thread for the lifetime of the scope
+*/
+class MemoryTagScope final
+{
+
+  // Public methods
+public:
+  inline explicit MemoryTagScope(uint32 tagIndex) :
+    mPreviousTagIndex(MemoryTracker::setThreadTag(tagIndex))
+  {
+    // Nothing here
+  }
+
+  inline ~MemoryTagScope()
+  {
+    MemoryTracker::setThreadTag(mPreviousTagIndex);
+  }
+
+  explicit MemoryTagScope(const MemoryTagScope&) = delete;
+  MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+  // Private data
+private:
+  uint32 mPreviousTagIndex;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
+
+
+//[-------------------------------------------------------]
+//[ Macros & definitions                                  ]
+//[-------------------------------------------------------]
+#ifdef RECORE_MEMORY_TRACKING
+  /**
+  *  @brief
+  *    Attribute all allocations of the calling thread inside the current scope to the given memory tag
+  *
+  *  @param[in] tag
+  *    Tag name as string literal, e.g. "TextureResourceManager"
+  *
+  *  @note
+  *    - Only one memory tag scope per C++ scope
+  */
+  #define RE_MEMORY_TAG_SCOPE(tag) \
+    static const RECore::uint32 memoryTagIndex = RECore::MemoryTracker::registerTag(tag); \
+    const RECore::MemoryTagScope memoryTagScope(memoryTagIndex);
+#else
+  #define RE_MEMORY_TAG_SCOPE(tag)
+#endif
@@ -51,7 +51,7 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		[[nodiscard]] void* reallocate(RECore::IAllocator&, void* oldPointer, size_t, size_t newNumberOfBytes, size_t alignment)
+		[[nodiscard]] void* mimallocReallocate(RECore::IAllocator&, void* oldPointer, size_t, size_t newNumberOfBytes, size_t alignment)
 		{
 			// Sanity check
 			ASSERT(0 != alignment && !(alignment & (alignment - 1)), "The alignment must be a power of two")
@@ -112,12 +112,12 @@ namespace RECore
 	//[-------------------------------------------------------]
 	public:
 		inline MimallocAllocator() :
-			IAllocator(&::detail::reallocate)
+			IAllocator(&::detail::mimallocReallocate)
 		{
 			// Nothing here
 		}
     inline MimallocAllocator(const MimallocAllocator&) :
-      IAllocator(&::detail::reallocate)
+      IAllocator(&::detail::mimallocReallocate)
     {
       // Nothing here
     }
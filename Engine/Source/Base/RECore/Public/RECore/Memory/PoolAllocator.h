@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Memory/IAllocator.h"
+#include "RECore/Memory/AllocatorStatistics.h"
+
+#include <mutex>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Fixed-size block pool memory allocator with thread-local caches, for small objects like RHI resources and command packets
+*
+*  @remarks
+*    The memory of all blocks is allocated once from the backing allocator. Each thread keeps a local free list per pool
+*    allocator, allocating and freeing a block usually touches no lock and no memory shared with other threads. Only when
+*    a thread-local free list runs empty or grows too large, a batch of blocks is moved from or to the shared free list.
+*    Blocks freed by another thread than the allocating one simply move over into the freeing threads cache.
+*
+*    Requests which are larger than the block size, require a larger alignment or don't fit into the pool anymore are
+*    passed to the backing allocator and counted as backing allocations.
+*
+*  @note
+*    - Multithreading safe
+*    - A thread caches blocks of up to "RECore::PoolAllocator::MAXIMUM_NUMBER_OF_THREAD_CACHES" pool allocators at once,
+*      further pool allocators are served by the shared free list
+*/
+class RECORE_API PoolAllocator final : public IAllocator
+{
+
+  // Public definitions
+public:
+  static constexpr uint32 MAXIMUM_NUMBER_OF_THREAD_CACHES = 8;   ///< Maximum number of pool allocators a single thread caches blocks for
+  static constexpr uint32 BATCH_SIZE                      = 32;  ///< Number of blocks moved between a thread-local and the shared free list at once
+
+  // Public methods
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] tag
+  *    Statistics tag, must stay valid as long as the allocator instance exists
+  *  @param[in] blockSize
+  *    Block size in bytes, rounded up to a multiple of the block alignment
+  *  @param[in] numberOfBlocks
+  *    Number of blocks inside the pool
+  *  @param[in] backingAllocator
+  *    Backing allocator, must stay valid as long as the allocator instance exists
+  *  @param[in] blockAlignment
+  *    Block alignment, must be a power of two and at least the size of a pointer
+  */
+  PoolAllocator(const char* tag, size_t blockSize, uint32 numberOfBlocks, IAllocator& backingAllocator, size_t blockAlignment = 16);
+
+  virtual ~PoolAllocator() override;
+
+  [[nodiscard]] inline size_t getBlockSize() const
+  {
+    return mBlockSize;
+  }
+
+  [[nodiscard]] inline uint32 getNumberOfBlocks() const
+  {
+    return mNumberOfBlocks;
+  }
+
+  [[nodiscard]] inline const AllocatorStatistics& getStatistics() const
+  {
+    return mStatistics;
+  }
+
+  /**
+  *  @brief
+  *    Start a new frame, resets the per frame statistics
+  */
+  inline void beginFrame()
+  {
+    mStatistics.beginFrame();
+  }
+
+  explicit PoolAllocator(const PoolAllocator&) = delete;
+  PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+  // Internal methods, don't use them directly
+public:
+  /**
+  *  @brief
+  *    Move a batch of blocks from the shared free list into the given free list
+  *
+  *  @param[out] freeList
+  *    Receives the first block of the linked batch, a null pointer if the pool is exhausted
+  *
+  *  @return
+  *    Number of blocks inside the batch
+  */
+  uint32 acquireBatch(void*& freeList);
+
+  /**
+  *  @brief
+  *    Move the given linked blocks into the shared free list
+  *
+  *  @param[in] freeList
+  *    First block of the linked blocks, can be a null pointer
+  */
+  void releaseBlocks(void* freeList);
+
+  // Private static methods
+private:
+  [[nodiscard]] static void* staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment);
+
+  // Private methods
+private:
+  [[nodiscard]] inline bool isOwnedPointer(const void* pointer) const
+  {
+    return (pointer >= mBuffer && pointer < mBuffer + mBlockSize * mNumberOfBlocks);
+  }
+
+  [[nodiscard]] void* allocateBlock();
+  void freeBlock(void* pointer);
+
+  // Private data
+private:
+  IAllocator&         mBackingAllocator;
+  uint64              mId;                  ///< Unique pool allocator ID, never reused so thread caches of destroyed pool allocators can be detected
+  size_t              mBlockSize;           ///< Block size in bytes
+  size_t              mBlockAlignment;      ///< Block alignment in bytes
+  uint32              mNumberOfBlocks;      ///< Number of blocks inside the buffer
+  uint8*              mBuffer;              ///< Memory of all blocks, can be a null pointer if the number of blocks is zero
+  // Shared free list
+  std::mutex          mMutex;
+  void*               mFreeList;            ///< Linked free blocks, the first pointer sized bytes of a free block point to the next free block, guarded by "mMutex"
+  uint32              mNextUntouchedBlock;  ///< Index of the first never used block, blocks are linked lazily, guarded by "mMutex"
+  AllocatorStatistics mStatistics;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
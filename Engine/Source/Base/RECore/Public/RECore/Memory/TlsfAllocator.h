@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Memory/IAllocator.h"
+#include "RECore/Memory/AllocatorStatistics.h"
+
+#include <mutex>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Two-level segregated fit (TLSF) memory allocator for long-lived variable-size blocks
+*
+*  @remarks
+*    Free blocks are kept in segregated free lists, the first level is the power of two of the block size and the second
+*    level linearly subdivides each power of two range. Two bitmaps make finding a suitable free block an O(1) operation,
+*    adjacent free blocks are merged immediately to keep fragmentation low.
+*
+*    The memory is requested in pools from the backing allocator, a new pool is added when no suitable free block is left.
+*    Pools are only given back to the backing allocator on destruction. Each added pool is counted as backing allocation.
+*
+*    See "TLSF: a New Dynamic Memory Allocator for Real-Time Systems" by M. Masmano, I. Ripoll, A. Crespo, and J. Real
+*
+*  @note
+*    - Multithreading safe, guarded by a mutex
+*/
+class RECORE_API TlsfAllocator final : public IAllocator
+{
+
+  // Public definitions
+public:
+  static constexpr uint32 SL_INDEX_COUNT_LOG2 = 5;
+  static constexpr uint32 SL_INDEX_COUNT      = (1 << SL_INDEX_COUNT_LOG2);  ///< Number of second level subdivisions
+  static constexpr uint32 ALIGN_SIZE_LOG2     = 3;
+  static constexpr uint32 FL_INDEX_MAX        = 32;                          ///< Blocks up to 4 GiB, larger requests fail
+  static constexpr uint32 FL_INDEX_SHIFT      = SL_INDEX_COUNT_LOG2 + ALIGN_SIZE_LOG2;
+  static constexpr uint32 FL_INDEX_COUNT      = FL_INDEX_MAX - FL_INDEX_SHIFT + 1;
+
+  // Public methods
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] tag
+  *    Statistics tag, must stay valid as long as the allocator instance exists
+  *  @param[in] poolSize
+  *    Size in bytes of a pool requested from the backing allocator, pools for larger allocations are sized accordingly
+  *  @param[in] backingAllocator
+  *    Backing allocator, must stay valid as long as the allocator instance exists
+  */
+  TlsfAllocator(const char* tag, size_t poolSize, IAllocator& backingAllocator);
+
+  virtual ~TlsfAllocator() override;
+
+  [[nodiscard]] inline size_t getPoolSize() const
+  {
+    return mPoolSize;
+  }
+
+  [[nodiscard]] inline const AllocatorStatistics& getStatistics() const
+  {
+    return mStatistics;
+  }
+
+  /**
+  *  @brief
+  *    Start a new frame, resets the per frame statistics
+  */
+  inline void beginFrame()
+  {
+    mStatistics.beginFrame();
+  }
+
+  explicit TlsfAllocator(const TlsfAllocator&) = delete;
+  TlsfAllocator& operator=(const TlsfAllocator&) = delete;
+
+  // Private definitions
+private:
+  /**
+  *  @brief
+  *    Block header
+  *
+  *  @remarks
+  *    "previousPhysicalBlock" is stored inside the last bytes of the previous block and is only valid if the previous block
+  *    is free. "nextFreeBlock" and "previousFreeBlock" are stored inside the user data and are only valid if the block is free.
+  */
+  struct BlockHeader final
+  {
+    BlockHeader* previousPhysicalBlock;
+    size_t       size;  ///< Size of the user data, the two least significant bits are the free and previous free flags
+    BlockHeader* nextFreeBlock;
+    BlockHeader* previousFreeBlock;
+
+    [[nodiscard]] static BlockHeader* fromPointer(void* pointer);
+    [[nodiscard]] void* toPointer();
+    [[nodiscard]] size_t getSize() const;
+    void setSize(size_t numberOfBytes);
+    [[nodiscard]] bool isFree() const;
+    [[nodiscard]] bool isPreviousFree() const;
+    void setPreviousFree(bool previousFree);
+    [[nodiscard]] BlockHeader* getNextBlock();
+    BlockHeader* linkNextBlock();
+    void markAsFree();
+    void markAsUsed();
+    [[nodiscard]] bool canSplit(size_t numberOfBytes) const;
+    [[nodiscard]] BlockHeader* split(size_t numberOfBytes);
+  };
+
+  // Private static methods
+private:
+  [[nodiscard]] static void* staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment);
+
+  // Private methods
+private:
+  // Allocation, the mutex must be locked
+  [[nodiscard]] void* allocate(size_t numberOfBytes, size_t alignment);
+  [[nodiscard]] void* reallocateBlock(void* pointer, size_t numberOfBytes, size_t alignment);
+  void freeBlock(void* pointer);
+  [[nodiscard]] bool addPool(size_t minimumNumberOfBytes);
+
+  // Free lists
+  [[nodiscard]] BlockHeader* searchSuitableBlock(uint32& firstLevelIndex, uint32& secondLevelIndex);
+  [[nodiscard]] BlockHeader* locateFreeBlock(size_t numberOfBytes);
+  void removeFreeBlock(BlockHeader* block, uint32 firstLevelIndex, uint32 secondLevelIndex);
+  void insertFreeBlock(BlockHeader* block, uint32 firstLevelIndex, uint32 secondLevelIndex);
+  void removeBlock(BlockHeader* block);
+  void insertBlock(BlockHeader* block);
+
+  // Splitting and merging
+  [[nodiscard]] BlockHeader* mergePreviousBlock(BlockHeader* block);
+  [[nodiscard]] BlockHeader* mergeNextBlock(BlockHeader* block);
+  void trimFreeBlock(BlockHeader* block, size_t numberOfBytes);
+  void trimUsedBlock(BlockHeader* block, size_t numberOfBytes);
+  [[nodiscard]] BlockHeader* trimFreeLeadingBlock(BlockHeader* block, size_t numberOfBytes);
+  [[nodiscard]] void* prepareUsedBlock(BlockHeader* block, size_t numberOfBytes);
+
+  // Private data
+private:
+  IAllocator&                           mBackingAllocator;
+  size_t                                mPoolSize;  ///< Default pool size in bytes
+  std::mutex                            mMutex;
+  BlockHeader                           mNullBlock;  ///< Free lists end with this block instead of a null pointer
+  uint32                                mFirstLevelBitmap;
+  uint32                                mSecondLevelBitmap[FL_INDEX_COUNT];
+  BlockHeader*                          mBlocks[FL_INDEX_COUNT][SL_INDEX_COUNT];  ///< Free list heads
+  std::vector<std::pair<void*, size_t>> mPools;  ///< Memory and size in bytes of the pools requested from the backing allocator
+  AllocatorStatistics                   mStatistics;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Memory/IAllocator.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Allocator wrapper attributing all allocations of the wrapped allocator to memory tags
+*
+*  @remarks
+*    Every allocation is prefixed by a small header storing its size and memory tag, this way frees and reallocations
+*    can be attributed correctly although the "RECore::IAllocator" interface doesn't require the old number of bytes.
+*    The memory tag of an allocation is the memory tag of the calling thread, see "RECore::MemoryTracker".
+*
+*  @note
+*    - Multithreading safe if the backing allocator is multithreading safe
+*    - Pointers must only be freed or reallocated by the tracking allocator which allocated them
+*    - Enable "RECORE_MEMORY_TRACKING" to route the global "RECore::Memory" allocations through a tracking allocator
+*/
+class RECORE_API TrackingAllocator final : public IAllocator
+{
+
+  // Public methods
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] backingAllocator
+  *    Backing allocator, must stay valid as long as the allocator instance exists
+  */
+  explicit TrackingAllocator(IAllocator& backingAllocator);
+
+  inline virtual ~TrackingAllocator() override
+  {
+    // Nothing here
+  }
+
+  explicit TrackingAllocator(const TrackingAllocator&) = delete;
+  TrackingAllocator& operator=(const TrackingAllocator&) = delete;
+
+  // Private definitions
+private:
+  struct AllocationHeader final
+  {
+    uint64 numberOfBytes;  ///< Number of bytes requested by the user
+    uint32 tagIndex;       ///< Memory tag index the allocation is attributed to
+    uint32 offset;         ///< Offset from the backing allocation to the user pointer
+  };
+
+  // Private static methods
+private:
+  [[nodiscard]] static void* staticReallocate(IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment);
+
+  // Private data
+private:
+  IAllocator& mBackingAllocator;
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
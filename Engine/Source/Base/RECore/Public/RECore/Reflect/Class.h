@@ -29,6 +29,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/String/String.h"
+#include "RECore/String/StringId.h"
 #include <list>
 #include <map>
 
@@ -216,6 +217,21 @@ class Class {
 		*/
 		inline const VarDesc *getAttribute(const String &sName) const;
 
+		/**
+		*  @brief
+		*    Get attribute by using the string ID of its name
+		*
+		*  @param[in] nNameId
+		*    String ID of the attribute name (e.g. "STRING_ID("Position")")
+		*
+		*  @return
+		*    Attribute descriptor (can be a null pointer, if no member with that name could be found, do not destroy the returned instance!)
+		*
+		*  @note
+		*    - Unlike "getAttribute()" no string is hashed and compared, use "AttributeHandle" to cache the lookup result per class
+		*/
+		inline const VarDesc *getAttributeById(StringId nNameId) const;
+
 		/**
 		*  @brief
 		*    Get methods
@@ -237,6 +253,21 @@ class Class {
 		*/
 		inline const FuncDesc *getMethod(const String &sName) const;
 
+		/**
+		*  @brief
+		*    Get method by using the string ID of its name
+		*
+		*  @param[in] nNameId
+		*    String ID of the method name (e.g. "STRING_ID("SetPosition")")
+		*
+		*  @return
+		*    Method descriptor (can be a null pointer, if no member with that name could be found, do not destroy the returned instance!)
+		*
+		*  @note
+		*    - Unlike "getMethod()" no string is hashed and compared, use "MethodHandle" to cache the lookup result per class
+		*/
+		inline const FuncDesc *getMethodById(StringId nNameId) const;
+
 		/**
 		*  @brief
 		*    Get signals
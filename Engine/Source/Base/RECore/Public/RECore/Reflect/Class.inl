@@ -154,6 +154,16 @@ inline const VarDesc *Class::getAttribute(const String &sName) const
 	return m_pClassImpl->getAttribute(sName);
 }
 
+/**
+*  @brief
+*    Get attribute by using the string ID of its name
+*/
+inline const VarDesc *Class::getAttributeById(StringId nNameId) const
+{
+	// Get attribute
+	return m_pClassImpl->getAttributeById(nNameId);
+}
+
 /**
 *  @brief
 *    Get methods
@@ -174,6 +184,16 @@ inline const FuncDesc *Class::getMethod(const String &sName) const
 	return m_pClassImpl->getMethod(sName);
 }
 
+/**
+*  @brief
+*    Get method by using the string ID of its name
+*/
+inline const FuncDesc *Class::getMethodById(StringId nNameId) const
+{
+	// Get method
+	return m_pClassImpl->getMethodById(nNameId);
+}
+
 /**
 *  @brief
 *    Get signals
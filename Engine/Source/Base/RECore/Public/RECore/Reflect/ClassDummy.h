@@ -62,8 +62,10 @@ class ClassDummy : public ClassImpl {
 		virtual void deInitClass() const override;
 		virtual const std::list<VarDesc*> &getAttributes() const override;
 		virtual const VarDesc *getAttribute(const String &sName) const override;
+		virtual const VarDesc *getAttributeById(StringId nNameId) const override;
 		virtual const std::list<FuncDesc*> &getMethods() const override;
 		virtual const FuncDesc *getMethod(const String &sName) const override;
+		virtual const FuncDesc *getMethodById(StringId nNameId) const override;
 		virtual const std::list<EventDesc*> &getSignals() const override;
 		virtual const EventDesc *getSignal(const String &sName) const override;
 		virtual const std::list<EventHandlerDesc*> &getSlots() const override;
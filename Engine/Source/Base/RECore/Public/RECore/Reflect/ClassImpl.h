@@ -29,6 +29,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/String/String.h"
+#include "RECore/String/StringId.h"
 #include <list>
 #include <map>
 
@@ -297,6 +298,18 @@ class ClassImpl {
 		*/
 		virtual const VarDesc *getAttribute(const String &sName) const = 0;
 
+		/**
+		*  @brief
+		*    Get attribute by using the string ID of its name
+		*
+		*  @param[in] nNameId
+		*    String ID of the attribute name
+		*
+		*  @return
+		*    Attribute descriptor (can be a null pointer, if no member with that name could be found)
+		*/
+		virtual const VarDesc *getAttributeById(StringId nNameId) const = 0;
+
 		/**
 		*  @brief
 		*    Get methods
@@ -318,6 +331,18 @@ class ClassImpl {
 		*/
 		virtual const FuncDesc *getMethod(const String &sName) const = 0;
 
+		/**
+		*  @brief
+		*    Get method by using the string ID of its name
+		*
+		*  @param[in] nNameId
+		*    String ID of the method name
+		*
+		*  @return
+		*    Method descriptor (can be a null pointer, if no member with that name could be found)
+		*/
+		virtual const FuncDesc *getMethodById(StringId nNameId) const = 0;
+
 		/**
 		*  @brief
 		*    Get signals
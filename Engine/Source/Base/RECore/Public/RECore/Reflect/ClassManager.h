@@ -30,8 +30,10 @@
 //[-------------------------------------------------------]
 #include "RECore/Reflect/ReflectTypes.h"
 #include "RECore/Reflect/Event/Event.h"
+#include "RECore/String/StringId.h"
 #include <list>
 #include <map>
+#include <unordered_map>
 
 
 //[-------------------------------------------------------]
@@ -246,7 +248,22 @@ class ClassManager {
 		*  @return
 		*    Pointer to the class, or a null pointer on error (do not destroy the returned instance)
 		*/
-		inline const Class *getClass(const String &sClass) const;
+		RECORE_API const Class *getClass(const String &sClass) const;
+
+		/**
+		*  @brief
+		*    Get class by using the string ID of its name
+		*
+		*  @param[in] nClassNameId
+		*    String ID of the class name (with namespace, e.g. "STRING_ID("RECore::Object")")
+		*
+		*  @return
+		*    Pointer to the class, or a null pointer on error (do not destroy the returned instance)
+		*
+		*  @note
+		*    - Unlike "getClass()" no string is hashed and compared
+		*/
+		inline const Class *getClassById(StringId nClassNameId) const;
 
 
 	//[-------------------------------------------------------]
@@ -378,7 +395,8 @@ class ClassManager {
 		std::map<uint32, const Module*>	m_mapModules;	/**< Hash-map of module IDs to modules */
 		// Classes
 		std::list<const Class*>				m_lstClasses;	/**< std::list of all classes */
-		std::map<String, const Class*>	m_mapClasses;	/**< Hash-map of class names to classes (with namespace) */
+		std::unordered_map<uint32, const Class*>	m_mapClasses;			/**< Hash-map of class name string IDs to classes (with namespace) */
+		std::list<const Class*>					m_lstCollidingClasses;	/**< Classes whose name string ID collides with another class name, not inside the hash map (should be empty) */
 
 
 };
@@ -60,12 +60,13 @@ inline const std::list<const Class*> &ClassManager::getClasses() const
 
 /**
 *  @brief
-*    Get class
+*    Get class by using the string ID of its name
 */
-inline const Class *ClassManager::getClass(const String &sClass) const
+inline const Class *ClassManager::getClassById(StringId nClassNameId) const
 {
 	// Get class
-	return m_mapClasses.find(sClass)->second;
+	std::unordered_map<uint32, const Class*>::const_iterator iterator = m_mapClasses.find(nClassNameId);
+	return (m_mapClasses.end() != iterator) ? iterator->second : nullptr;
 }
 
 
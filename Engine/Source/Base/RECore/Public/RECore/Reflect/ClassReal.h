@@ -29,6 +29,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/Reflect/ClassImpl.h"
+#include "RECore/Reflect/ReflectTypes.h"
+#include <unordered_map>
 
 
 //[-------------------------------------------------------]
@@ -66,8 +68,10 @@ class ClassReal : public ClassImpl {
 		RECORE_API virtual void deInitClass() const override;
 		RECORE_API virtual const std::list<VarDesc*> &getAttributes() const override;
 		RECORE_API virtual const VarDesc *getAttribute(const String &sName) const override;
+		RECORE_API virtual const VarDesc *getAttributeById(StringId nNameId) const override;
 		RECORE_API virtual const std::list<FuncDesc*> &getMethods() const override;
 		RECORE_API virtual const FuncDesc *getMethod(const String &sName) const override;
+		RECORE_API virtual const FuncDesc *getMethodById(StringId nNameId) const override;
 		RECORE_API virtual const std::list<EventDesc*> &getSignals() const override;
 		RECORE_API virtual const EventDesc *getSignal(const String &sName) const override;
 		RECORE_API virtual const std::list<EventHandlerDesc*> &getSlots() const override;
@@ -124,6 +128,68 @@ class ClassReal : public ClassImpl {
 		RECORE_API void addMember(MemberDesc *pMemberDesc);
 
 
+	//[-------------------------------------------------------]
+	//[ Private functions                                     ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Add a member inherited from the base class to the hash map
+		*
+		*  @param[in] cMember
+		*    Member of the base class
+		*
+		*  @note
+		*    - Members whose name string ID collides with the name of a member already inside the hash map are reported and added to the colliding members
+		*/
+		void addBaseClassMember(MemberDesc &cMember) const;
+
+		/**
+		*  @brief
+		*    Report a member whose name string ID collides with the name of a member inside the hash map and add it to the colliding members
+		*
+		*  @param[in] cMember
+		*    Colliding member which is kept out of the hash map
+		*  @param[in] cHashMapMember
+		*    Member inside the hash map with the same name string ID
+		*/
+		void addCollidingMember(MemberDesc &cMember, const MemberDesc &cHashMapMember) const;
+
+		/**
+		*  @brief
+		*    Find member by name
+		*
+		*  @param[in] sName
+		*    Member name
+		*  @param[in] nMemberType
+		*    Member type
+		*
+		*  @return
+		*    Member descriptor, a null pointer if there's no member of the given type with that name
+		*
+		*  @note
+		*    - Class must be initialized
+		*/
+		MemberDesc *findMember(const String &sName, EMemberType nMemberType) const;
+
+		/**
+		*  @brief
+		*    Find member by string ID of the name
+		*
+		*  @param[in] nNameId
+		*    String ID of the member name
+		*  @param[in] nMemberType
+		*    Member type
+		*
+		*  @return
+		*    Member descriptor, a null pointer if there's no member of the given type with that name
+		*
+		*  @note
+		*    - Class must be initialized
+		*/
+		MemberDesc *findMemberById(uint32 nNameId, EMemberType nMemberType) const;
+
+
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
 	//[-------------------------------------------------------]
@@ -131,7 +197,8 @@ class ClassReal : public ClassImpl {
 		// Own data (does not include data from base classes)
 		std::list<MemberDesc*>						m_lstOwnMembers;	/**< std::list of members */
 		// Member lists (also including the members from base classes)
-		mutable std::map<String, MemberDesc*>	m_mapMembers;		/**< Hash map of names -> members */
+		mutable std::unordered_map<uint32, MemberDesc*>	m_mapMembers;			/**< Hash map of name string IDs -> members */
+		mutable std::list<MemberDesc*>						m_lstCollidingMembers;	/**< Members whose name string ID collides with another member name, not inside the hash map (should be empty) */
 		mutable std::list<VarDesc*>					m_lstAttributes;	/**< std::list of attributes */
 		mutable std::list<FuncDesc*>					m_lstMethods;		/**< std::list of methods */
 		mutable std::list<EventDesc*>				m_lstSignals;		/**< std::list of signals */
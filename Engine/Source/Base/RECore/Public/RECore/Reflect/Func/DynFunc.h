@@ -132,6 +132,33 @@ class DynFunc : public DynSignature {
 		*/
 		RECORE_API virtual DynFunc *clone() const;
 
+		/**
+		*  @brief
+		*    Get the size of the typed parameters matching the signature of this function
+		*
+		*  @return
+		*    Size in bytes of the parameters created by "constructParams()", 0 if typed parameters are not supported
+		*/
+		RECORE_API virtual uint32 getParamsSize() const;
+
+		/**
+		*  @brief
+		*    Construct typed parameters matching the signature of this function
+		*
+		*  @param[in] pMemory
+		*    Memory to construct the parameters in, must be at least "getParamsSize()" bytes and suitably aligned for any fundamental type
+		*
+		*  @return
+		*    The constructed parameters initialized with default values, null pointer if typed parameters are not supported
+		*
+		*  @remarks
+		*    This allows to call a function through its typed parameters without knowing the signature at compile time and without any
+		*    heap allocation or string conversion: Write the values using "DynParams::getPointerToParameterValue()" according to
+		*    "getParameterTypeID()", call the function and read "DynParams::getPointerToReturnValue()" according to "getReturnTypeID()".
+		*    The caller is responsible for destroying the parameters by explicitly calling their destructor.
+		*/
+		RECORE_API virtual DynParams *constructParams(void *pMemory) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected functions                                   ]
@@ -33,6 +33,7 @@
 #include "RECore/Reflect/Func/Params.h"
 #include "RECore/Reflect/Func/DynFunc.h"
 #include "RECore/Reflect/Func/Func.h"
+#include <new>
 
 
 //[-------------------------------------------------------]
@@ -44,6 +45,24 @@ namespace RECore {
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+/**
+*  @brief
+*    DynFunc base of all function wrappers, constructs the typed parameters matching the wrapper signature
+*/
+template <typename R, typename... T>
+class FuncWrapperBase : public DynFunc {
+	public:
+		virtual uint32 getParamsSize() const override
+		{
+			return sizeof(Params<R, T...>);
+		}
+
+		virtual DynParams *constructParams(void *pMemory) const override
+		{
+			return new (pMemory) Params<R, T...>(DefaultValue<T>::defaultValue()...);
+		}
+};
+
 /**
 *  @brief
 *    DynFunc wrapper to a Function object (object that can be 'called' like a function / functoid)
@@ -52,7 +71,7 @@ namespace RECore {
 *    Implementation for up to 16 parameters and a return value
 */
 template <typename R, typename T0 = NullType, typename T1 = NullType, typename T2 = NullType, typename T3 = NullType, typename T4 = NullType, typename T5 = NullType, typename T6 = NullType, typename T7 = NullType, typename T8 = NullType, typename T9 = NullType, typename T10 = NullType, typename T11 = NullType, typename T12 = NullType, typename T13 = NullType, typename T14 = NullType, typename T15 = NullType>
-class FuncWrapper : public DynFunc {
+class FuncWrapper : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -197,7 +216,7 @@ class FuncWrapper : public DynFunc {
 *    Implementation for up to 16 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14, typename T15>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -336,7 +355,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T
 *    Implementation for up to 15 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -479,7 +498,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13,
 *    Implementation for up to 15 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13, typename T14>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -616,7 +635,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T
 *    Implementation for up to 14 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -757,7 +776,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>
 *    Implementation for up to 14 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12, typename T13>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -892,7 +911,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T
 *    Implementation for up to 13 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -1031,7 +1050,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> : pu
 *    Implementation for up to 13 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -1164,7 +1183,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12> :
 *    Implementation for up to 12 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -1299,7 +1318,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : public
 *    Implementation for up to 12 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -1428,7 +1447,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11> : publ
 *    Implementation for up to 11 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -1561,7 +1580,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public DynFu
 *    Implementation for up to 11 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -1688,7 +1707,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10> : public Dy
 *    Implementation for up to 10 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -1819,7 +1838,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public DynFunc {
 *    Implementation for up to 10 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -1944,7 +1963,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> : public DynFunc
 *    Implementation for up to 9 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7, T8> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -2073,7 +2092,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public DynFunc {
 *    Implementation for up to 9 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7, T8> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -2196,7 +2215,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7, T8> : public DynFunc {
 *    Implementation for up to 8 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6, T7> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -2321,7 +2340,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6, T7> : public DynFunc {
 *    Implementation for up to 8 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6, T7> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -2440,7 +2459,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6, T7> : public DynFunc {
 *    Implementation for up to 7 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5, T6> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -2563,7 +2582,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5, T6> : public DynFunc {
 *    Implementation for up to 7 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5, T6> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -2680,7 +2699,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5, T6> : public DynFunc {
 *    Implementation for up to 6 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4, typename T5>
-class FuncWrapper<R, T0, T1, T2, T3, T4, T5> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4, T5> : public FuncWrapperBase<R, T0, T1, T2, T3, T4, T5> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -2801,7 +2820,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4, T5> : public DynFunc {
 *    Implementation for up to 6 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5>
-class FuncWrapper<void, T0, T1, T2, T3, T4, T5> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4, T5> : public FuncWrapperBase<void, T0, T1, T2, T3, T4, T5> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -2916,7 +2935,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4, T5> : public DynFunc {
 *    Implementation for up to 5 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3, typename T4>
-class FuncWrapper<R, T0, T1, T2, T3, T4> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3, T4> : public FuncWrapperBase<R, T0, T1, T2, T3, T4> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -3035,7 +3054,7 @@ class FuncWrapper<R, T0, T1, T2, T3, T4> : public DynFunc {
 *    Implementation for up to 5 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3, typename T4>
-class FuncWrapper<void, T0, T1, T2, T3, T4> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3, T4> : public FuncWrapperBase<void, T0, T1, T2, T3, T4> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -3148,7 +3167,7 @@ class FuncWrapper<void, T0, T1, T2, T3, T4> : public DynFunc {
 *    Implementation for up to 4 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2, typename T3>
-class FuncWrapper<R, T0, T1, T2, T3> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2, T3> : public FuncWrapperBase<R, T0, T1, T2, T3> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -3263,7 +3282,7 @@ class FuncWrapper<R, T0, T1, T2, T3> : public DynFunc {
 *    Implementation for up to 4 parameters without a return value
 */
 template <typename T0, typename T1, typename T2, typename T3>
-class FuncWrapper<void, T0, T1, T2, T3> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2, T3> : public FuncWrapperBase<void, T0, T1, T2, T3> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -3372,7 +3391,7 @@ class FuncWrapper<void, T0, T1, T2, T3> : public DynFunc {
 *    Implementation for up to 3 parameters and a return value
 */
 template <typename R, typename T0, typename T1, typename T2>
-class FuncWrapper<R, T0, T1, T2> : public DynFunc {
+class FuncWrapper<R, T0, T1, T2> : public FuncWrapperBase<R, T0, T1, T2> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -3485,7 +3504,7 @@ class FuncWrapper<R, T0, T1, T2> : public DynFunc {
 *    Implementation for up to 3 parameters without a return value
 */
 template <typename T0, typename T1, typename T2>
-class FuncWrapper<void, T0, T1, T2> : public DynFunc {
+class FuncWrapper<void, T0, T1, T2> : public FuncWrapperBase<void, T0, T1, T2> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -3592,7 +3611,7 @@ class FuncWrapper<void, T0, T1, T2> : public DynFunc {
 *    Implementation for up to 2 parameters and a return value
 */
 template <typename R, typename T0, typename T1>
-class FuncWrapper<R, T0, T1> : public DynFunc {
+class FuncWrapper<R, T0, T1> : public FuncWrapperBase<R, T0, T1> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -3701,7 +3720,7 @@ class FuncWrapper<R, T0, T1> : public DynFunc {
 *    Implementation for up to 2 parameters without a return value
 */
 template <typename T0, typename T1>
-class FuncWrapper<void, T0, T1> : public DynFunc {
+class FuncWrapper<void, T0, T1> : public FuncWrapperBase<void, T0, T1> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef typename Type<T1> ::_Type _T1;
@@ -3804,7 +3823,7 @@ class FuncWrapper<void, T0, T1> : public DynFunc {
 *    Implementation for up to 1 parameters and a return value
 */
 template <typename R, typename T0>
-class FuncWrapper<R, T0> : public DynFunc {
+class FuncWrapper<R, T0> : public FuncWrapperBase<R, T0> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef typename Type<T0> ::_Type _T0;
@@ -3911,7 +3930,7 @@ class FuncWrapper<R, T0> : public DynFunc {
 *    Implementation for up to 1 parameters without a return value
 */
 template <typename T0>
-class FuncWrapper<void, T0> : public DynFunc {
+class FuncWrapper<void, T0> : public FuncWrapperBase<void, T0> {
 	public:
 		typedef typename Type<T0> ::_Type _T0;
 		typedef Func<void, _T0> FuncType;
@@ -4012,7 +4031,7 @@ class FuncWrapper<void, T0> : public DynFunc {
 *    Implementation for 0 parameters and a return value
 */
 template <typename R>
-class FuncWrapper<R> : public DynFunc {
+class FuncWrapper<R> : public FuncWrapperBase<R> {
 	public:
 		typedef typename Type<R>  ::_Type _R;
 		typedef Func<_R> FuncType;
@@ -4112,7 +4131,7 @@ class FuncWrapper<R> : public DynFunc {
 *    Implementation for 0 parameters without a return value
 */
 template <>
-class FuncWrapper<void> : public DynFunc {
+class FuncWrapper<void> : public FuncWrapperBase<void> {
 	public:
 		typedef Func<void> FuncType;
 
@@ -29,6 +29,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/String/String.h"
+#include "RECore/String/StringId.h"
 #include "RECore/Reflect/ReflectTypes.h"
 
 
@@ -99,7 +100,16 @@ class MemberDesc {
 		*  @return
 		*    Name
 		*/
-		inline String getName() const;
+		inline const String &getName() const;
+
+		/**
+		*  @brief
+		*    Get name ID
+		*
+		*  @return
+		*    String ID of the name, calculated once at construction
+		*/
+		inline StringId getNameId() const;
 
 		/**
 		*  @brief
@@ -140,6 +150,7 @@ class MemberDesc {
 	protected:
 		EMemberType	m_nMemberType;	/**< Member type */
 		String		m_sName;		/**< Name */
+		StringId	m_nNameId;		/**< String ID of the name */
 		String		m_sDescription;	/**< Description */
 		String		m_sAnnotation;	/**< Annotation */
 
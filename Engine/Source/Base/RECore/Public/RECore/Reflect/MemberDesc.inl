@@ -42,12 +42,22 @@ inline EMemberType MemberDesc::getMemberType() const
 *  @brief
 *    Get name
 */
-inline String MemberDesc::getName() const
+inline const String &MemberDesc::getName() const
 {
 	// Return name of var
 	return m_sName;
 }
 
+/**
+*  @brief
+*    Get name ID
+*/
+inline StringId MemberDesc::getNameId() const
+{
+	// Return string ID of the name
+	return m_nNameId;
+}
+
 /**
 *  @brief
 *    Get description
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/Reflect/Class.h"
+#include "RECore/Reflect/Var/VarDesc.h"
+#include "RECore/Reflect/Func/FuncDesc.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Cached member handle
+*
+*  @remarks
+*    Resolving a member by name means hashing and comparing the name on each access. A member handle resolves the
+*    member descriptor once per class and caches it, as long as the handle is used with objects of the same class
+*    the member access doesn't touch any strings at all. Use "AttributeHandle" and "MethodHandle" together with
+*    "Object::getAttribute()", "Object::setAttribute()" and "Object::callMethod()".
+*    @code
+*    static AttributeHandle cPosition("Position");
+*    pObject->setAttribute(cPosition, "1 2 3");
+*    @endcode
+*
+*  @note
+*    - A member handle must not outlive the module the classes it was used with are defined in
+*    - A member handle is not thread-safe, use one handle instance per thread
+*/
+template <typename TDesc>
+class MemberHandle {
+
+
+	//[-------------------------------------------------------]
+	//[ Public functions                                      ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] sName
+		*    Member name
+		*/
+		inline explicit MemberHandle(const String &sName);
+
+		/**
+		*  @brief
+		*    Get member name
+		*
+		*  @return
+		*    Member name
+		*/
+		inline const String &getName() const;
+
+		/**
+		*  @brief
+		*    Get member name ID
+		*
+		*  @return
+		*    String ID of the member name
+		*/
+		inline StringId getNameId() const;
+
+		/**
+		*  @brief
+		*    Get member descriptor
+		*
+		*  @param[in] cClass
+		*    Class to get the member descriptor from
+		*
+		*  @return
+		*    Member descriptor (can be a null pointer, if the class has no member with that name)
+		*
+		*  @note
+		*    - The member descriptor is only resolved if the class differs from the previous call
+		*/
+		inline const TDesc *getDesc(const Class &cClass);
+
+
+	//[-------------------------------------------------------]
+	//[ Private static functions                              ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Find the member descriptor by using the string ID of the name
+		*
+		*  @param[in] cClass
+		*    Class to get the member descriptor from
+		*  @param[in] nNameId
+		*    String ID of the member name
+		*
+		*  @return
+		*    Member descriptor (can be a null pointer)
+		*/
+		static inline const TDesc *findDescById(const Class &cClass, StringId nNameId);
+
+		/**
+		*  @brief
+		*    Find the member descriptor by using the name
+		*
+		*  @param[in] cClass
+		*    Class to get the member descriptor from
+		*  @param[in] sName
+		*    Member name
+		*
+		*  @return
+		*    Member descriptor (can be a null pointer)
+		*/
+		static inline const TDesc *findDesc(const Class &cClass, const String &sName);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		String		 m_sName;	/**< Member name */
+		StringId	 m_nNameId;	/**< String ID of the member name */
+		const Class	*m_pClass;	/**< Class the member descriptor was resolved for, can be a null pointer */
+		const TDesc	*m_pDesc;	/**< Cached member descriptor of "m_pClass", can be a null pointer */
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Type definitions                                      ]
+//[-------------------------------------------------------]
+typedef MemberHandle<VarDesc>  AttributeHandle;
+typedef MemberHandle<FuncDesc> MethodHandle;
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
+
+
+//[-------------------------------------------------------]
+//[ Implementation                                        ]
+//[-------------------------------------------------------]
+#include "RECore/Reflect/MemberHandle.inl"
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Constructor
+*/
+template <typename TDesc>
+inline MemberHandle<TDesc>::MemberHandle(const String &sName) :
+	m_sName(sName),
+	m_nNameId(StringId::calculateFNV(sName.cstr())),
+	m_pClass(nullptr),
+	m_pDesc(nullptr)
+{
+}
+
+/**
+*  @brief
+*    Get member name
+*/
+template <typename TDesc>
+inline const String &MemberHandle<TDesc>::getName() const
+{
+	return m_sName;
+}
+
+/**
+*  @brief
+*    Get member name ID
+*/
+template <typename TDesc>
+inline StringId MemberHandle<TDesc>::getNameId() const
+{
+	return m_nNameId;
+}
+
+/**
+*  @brief
+*    Get member descriptor
+*/
+template <typename TDesc>
+inline const TDesc *MemberHandle<TDesc>::getDesc(const Class &cClass)
+{
+	// Resolve the member descriptor, if the class changed
+	if (m_pClass != &cClass) {
+		m_pClass = &cClass;
+		m_pDesc  = findDescById(cClass, m_nNameId);
+
+		// In the rare case of a name string ID collision, fall back to the lookup by name
+		if (!m_pDesc || m_pDesc->getName() != m_sName)
+			m_pDesc = findDesc(cClass, m_sName);
+	}
+
+	// Return the cached member descriptor
+	return m_pDesc;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private static functions                              ]
+//[-------------------------------------------------------]
+template <>
+inline const VarDesc *MemberHandle<VarDesc>::findDescById(const Class &cClass, StringId nNameId)
+{
+	return cClass.getAttributeById(nNameId);
+}
+
+template <>
+inline const VarDesc *MemberHandle<VarDesc>::findDesc(const Class &cClass, const String &sName)
+{
+	return cClass.getAttribute(sName);
+}
+
+template <>
+inline const FuncDesc *MemberHandle<FuncDesc>::findDescById(const Class &cClass, StringId nNameId)
+{
+	return cClass.getMethodById(nNameId);
+}
+
+template <>
+inline const FuncDesc *MemberHandle<FuncDesc>::findDesc(const Class &cClass, const String &sName)
+{
+	return cClass.getMethod(sName);
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -31,6 +31,7 @@
 #include "RECore/Reflect/ReflectTypes.h"
 #include "RECore/Reflect/Rtti.h"
 #include <list>
+#include <vector>
 
 
 //[-------------------------------------------------------]
@@ -44,8 +45,11 @@ namespace RECore {
 //[-------------------------------------------------------]
 class Class;
 class DynVar;
+class VarDesc;
+class FuncDesc;
 class DynConstructor;
 class DynParams;
+template <typename TDesc> class MemberHandle;
 
 
 //[-------------------------------------------------------]
@@ -251,6 +255,18 @@ class Object : public ObjectBase {
 		*/
 		RECORE_API DynVarPtr getAttribute(const String &sName) const;
 
+		/**
+		*  @brief
+		*    Get attribute by using a cached attribute handle
+		*
+		*  @param[in] cAttribute
+		*    Attribute handle ("AttributeHandle", see "RECore/Reflect/MemberHandle.h"), caches the attribute descriptor of the class of this object
+		*
+		*  @return
+		*    Attribute (can be a null pointer, if no attribute with that name could be found)
+		*/
+		RECORE_API DynVarPtr getAttribute(MemberHandle<VarDesc> &cAttribute) const;
+
 		/**
 		*  @brief
 		*    Get all callable methods
@@ -282,6 +298,18 @@ class Object : public ObjectBase {
 		*/
 		RECORE_API DynFuncPtr getMethod(const String &sName);
 
+		/**
+		*  @brief
+		*    Get callable method by using a cached method handle
+		*
+		*  @param[in] cMethod
+		*    Method handle ("MethodHandle", see "RECore/Reflect/MemberHandle.h"), caches the method descriptor of the class of this object
+		*
+		*  @return
+		*    Callable method (can be a null pointer, if no method with that name could be found)
+		*/
+		RECORE_API DynFuncPtr getMethod(MemberHandle<FuncDesc> &cMethod);
+
 		/**
 		*  @brief
 		*    Get a list of all signals
@@ -379,6 +407,28 @@ class Object : public ObjectBase {
 		*/
 		RECORE_API void setAttribute(const String &sName, const DynVar *pVar);
 
+		/**
+		*  @brief
+		*    Set attribute value by using a cached attribute handle and a given string value
+		*
+		*  @param[in] cAttribute
+		*    Attribute handle
+		*  @param[in] sValue
+		*    Attribute value as string
+		*/
+		RECORE_API void setAttribute(MemberHandle<VarDesc> &cAttribute, const String &sValue);
+
+		/**
+		*  @brief
+		*    Set attribute value by using a cached attribute handle and a given dynamic variable reference
+		*
+		*  @param[in] cAttribute
+		*    Attribute handle
+		*  @param[in] cVar
+		*    Attribute value as dynamic variable reference
+		*/
+		RECORE_API void setAttribute(MemberHandle<VarDesc> &cAttribute, const DynVar &cVar);
+
 		/**
 		*  @brief
 		*    Set attribute to it's default value
@@ -421,6 +471,17 @@ class Object : public ObjectBase {
 		*/
 		RECORE_API void callMethod(const String &sName, const String &sParams);
 
+		/**
+		*  @brief
+		*    Call method by using a cached method handle and given dynamic parameters
+		*
+		*  @param[in] cMethod
+		*    Method handle
+		*  @param[in] cParams
+		*    Dynamic parameters
+		*/
+		RECORE_API void callMethod(MemberHandle<FuncDesc> &cMethod, DynParams &cParams);
+
 		//[-------------------------------------------------------]
 		//[ Object state functions                                ]
 		//[-------------------------------------------------------]
@@ -455,6 +516,44 @@ class Object : public ObjectBase {
 		*/
 		RECORE_API void setDefaultValues();
 
+		/**
+		*  @brief
+		*    Get attribute values in a compact binary form
+		*
+		*  @param[out] lstData
+		*    Receives the binary attribute values, the data is appended
+		*  @param[in] nDefaultValue
+		*    'WithDefault' to retrieve all attributes, 'NoDefault' to only retrieve attributes that are not set to default
+		*
+		*  @remarks
+		*    Binary counterpart of "getValues()". Attributes are identified by the string ID of their name and numeric
+		*    values are stored in their native representation, so no text conversion is required. Layout:
+		*    "<number of attributes:uint32> { <name ID:uint32> <type ID:uint8> <value> }", where value is the raw value
+		*    for boolean and numeric types, else "<number of bytes:uint32> <UTF-8 string without terminating zero>".
+		*
+		*  @note
+		*    - All values are stored in little-endian byte order, big-endian hosts swap the bytes when writing and reading
+		*    - Attributes without a dynamic variable instance are skipped
+		*/
+		RECORE_API void serialize(std::vector<uint8> &lstData, EDefaultValue nDefaultValue = NoDefault) const;
+
+		/**
+		*  @brief
+		*    Set attribute values from data written by "serialize()"
+		*
+		*  @param[in] pData
+		*    Binary attribute values, can be a null pointer if "nNumberOfBytes" is 0
+		*  @param[in] nNumberOfBytes
+		*    Number of available bytes
+		*
+		*  @return
+		*    Number of consumed bytes, 0 on error (truncated data)
+		*
+		*  @note
+		*    - Unknown attributes are skipped, values of attributes whose type changed are converted
+		*/
+		RECORE_API uint32 deserialize(const uint8 *pData, uint32 nNumberOfBytes);
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Object functions                       ]
@@ -78,6 +78,20 @@ public:
 
   virtual void update() = 0;
 
+  /**
+  *  @brief
+  *    Return the number of bytes used by the resources of this resource manager, e.g. to enforce memory budgets
+  *
+  *  @return
+  *    Number of bytes, 0 if the resource manager doesn't track the size of its resources
+  *
+  *  @note
+  *    - The size is an estimate of the data owned by the resources, e.g. RHI texture or buffer data, not the size of the resource instances itself
+  */
+  [[nodiscard]] inline virtual uint64 getNumberOfResourceBytes() const {
+    return 0;
+  }
+
 
   //[-------------------------------------------------------]
   //[ Protected methods                                     ]
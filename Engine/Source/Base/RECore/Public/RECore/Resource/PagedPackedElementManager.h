@@ -0,0 +1,280 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Core/Manager.h"
+#include "RECore/Utility/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore {
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Growable packed element manager template
+*
+*  @remarks
+*    Same interface and ID lookup table scheme as "RECore::PackedElementManager", but without a fixed compile-time capacity:
+*    - Elements are stored in pages of "NUMBER_OF_ELEMENTS_PER_PAGE" elements which are allocated on demand, so there's no up-front memory cost for unused capacity
+*    - Pages are never moved, so element references stay valid as long as the element isn't removed (removing an element moves the last element into the gap)
+*    - An ID consists of a 24 bit index and an 8 bit generation counter which is incremented each time an index is reused
+*    - The capacity grows on demand up to "MAXIMUM_NUMBER_OF_ELEMENTS" (16777215) elements
+*    - An index whose generation counter is used up is retired instead of wrapping the generation counter around, so a stale ID can never match a live
+*      element (ABA). Each retired index costs one ID lookup table entry after 255 uses, so the number of element additions over the lifetime of the
+*      manager is limited to roughly four billion.
+*    - The elements are dense in memory, iterate over them using "RECore::PagedPackedElementManager::getElementByIndex()" or the page-wise "RECore::PagedPackedElementManager::forEachElement()"
+*
+*  @note
+*    - Basing on "Managing Decoupling Part 4 -- The ID Lookup Table" https://github.com/niklasfrykholm/blog/blob/master/2011/managing-decoupling-4.md by Niklas Frykholm ( http://www.frykholm.se/ )
+*/
+template<class ELEMENT_TYPE, typename ID_TYPE, uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
+class PagedPackedElementManager final : private RECore::Manager {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  static constexpr uint32 INDEX_MASK = 0x00ffffff;
+  static constexpr uint32 MAXIMUM_NUMBER_OF_ELEMENTS = INDEX_MASK;	///< The maximum index is reserved so that an ID can never be the invalid ID
+  static_assert(NUMBER_OF_ELEMENTS_PER_PAGE <= MAXIMUM_NUMBER_OF_ELEMENTS, "The number of elements per page must not exceed the maximum number of elements");
+  static_assert(sizeof(ID_TYPE) == sizeof(uint32), "The ID layout requires 32 bit IDs");
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline PagedPackedElementManager() :
+    mNumberOfElements(0),
+    mFreeListEnqueue(getInvalid<uint32>()),
+    mFreeListDequeue(getInvalid<uint32>()) {
+    static_assert(NUMBER_OF_ELEMENTS_PER_PAGE > 0, "The number of elements per page must not be zero");
+  }
+
+  inline ~PagedPackedElementManager() {
+    // If there are any elements left alive, smash them
+    for (uint32 i = 0; i < mNumberOfElements; ++i) {
+      getElementByIndex(i).deinitializeElement();
+    }
+    for (ELEMENT_TYPE *page : mPages) {
+      delete[] page;
+    }
+  }
+
+  [[nodiscard]] inline uint32 getNumberOfElements() const {
+    return mNumberOfElements;
+  }
+
+  [[nodiscard]] inline uint32 getCapacity() const {
+    return static_cast<uint32>(mPages.size()) * NUMBER_OF_ELEMENTS_PER_PAGE;
+  }
+
+  [[nodiscard]] inline ELEMENT_TYPE &getElementByIndex(uint32 index) const {
+    ASSERT(index < mNumberOfElements, "Invalid index")
+    return mPages[index / NUMBER_OF_ELEMENTS_PER_PAGE][index % NUMBER_OF_ELEMENTS_PER_PAGE];
+  }
+
+  [[nodiscard]] inline bool isElementIdValid(ID_TYPE id) const {
+    if (RECore::isValid(id) && (id & INDEX_MASK) < mIndices.size()) {
+      const Index &index = mIndices[id & INDEX_MASK];
+      return (index.id == id && RECore::isValid(index.index));
+    }
+    return false;
+  }
+
+  [[nodiscard]] inline ELEMENT_TYPE &getElementById(ID_TYPE id) const {
+    ASSERT(isElementIdValid(id), "Invalid ID")
+    return getElementByIndex(mIndices[id & INDEX_MASK].index);
+  }
+
+  [[nodiscard]] inline ELEMENT_TYPE *tryGetElementById(ID_TYPE id) const {
+    return isElementIdValid(id) ? &getElementByIndex(mIndices[id & INDEX_MASK].index) : nullptr;
+  }
+
+  [[nodiscard]] inline ELEMENT_TYPE &addElement() {
+    ASSERT(mNumberOfElements < MAXIMUM_NUMBER_OF_ELEMENTS, "Packed element manager capacity exceeded")
+
+    // Grow the ID lookup table and element storage on demand
+    if (RECore::isInvalid(mFreeListDequeue)) {
+      growIndices();
+      ASSERT(RECore::isValid(mFreeListDequeue), "Packed element manager ID lookup table capacity exceeded")
+    }
+    if (mNumberOfElements == getCapacity()) {
+      mPages.push_back(new ELEMENT_TYPE[NUMBER_OF_ELEMENTS_PER_PAGE]);
+    }
+
+    // Dequeue the oldest free index, this maximizes the time until a generation is reused
+    Index &index = mIndices[mFreeListDequeue];
+    mFreeListDequeue = index.next;
+    if (RECore::isInvalid(mFreeListDequeue)) {
+      RECore::setInvalid(mFreeListEnqueue);
+    }
+    index.id += NEW_OBJECT_ID_ADD;
+    index.index = mNumberOfElements++;
+
+    // Initialize the added element
+    // -> "placement new" ("new (static_cast<void*>(&element)) ELEMENT_TYPE(index.id);") is not used by intent to avoid some nasty STL issues
+    ELEMENT_TYPE &element = getElementByIndex(index.index);
+    element.initializeElement(index.id);
+
+    // Return the added element
+    return element;
+  }
+
+  inline void removeElement(ID_TYPE id) {
+    ASSERT(isElementIdValid(id), "Invalid ID")
+    const uint32 indexOfIndex = (id & INDEX_MASK);
+    Index &index = mIndices[indexOfIndex];
+    ELEMENT_TYPE &element = getElementByIndex(index.index);
+
+    // Deinitialize the removed element
+    // -> Calling the destructor ("element.~ELEMENT_TYPE();") is not used by intent to avoid some nasty STL issues
+    element.deinitializeElement();
+    --mNumberOfElements;
+
+    // If this is the last element, there's no need to swap it with itself
+    if (index.index != mNumberOfElements) {
+      element = std::move(mPages[mNumberOfElements / NUMBER_OF_ELEMENTS_PER_PAGE][mNumberOfElements % NUMBER_OF_ELEMENTS_PER_PAGE]);
+      mIndices[element.getId() & INDEX_MASK].index = index.index;
+    }
+
+    // Update free list, retire the index if its generation counter is used up
+    RECore::setInvalid(index.index);
+    if ((index.id & GENERATION_MASK) != GENERATION_MASK) {
+      enqueueFreeIndex(indexOfIndex);
+    }
+  }
+
+  /**
+  *  @brief
+  *    Dense iteration over all elements, page by page
+  *
+  *  @param[in] function
+  *    Function to call for each element, signature "void(ELEMENT_TYPE&)"
+  */
+  template<typename FUNCTION>
+  inline void forEachElement(FUNCTION function) const {
+    uint32 numberOfRemainingElements = mNumberOfElements;
+    for (ELEMENT_TYPE *page : mPages) {
+      const uint32 numberOfPageElements = (numberOfRemainingElements < NUMBER_OF_ELEMENTS_PER_PAGE) ? numberOfRemainingElements : NUMBER_OF_ELEMENTS_PER_PAGE;
+      for (uint32 i = 0; i < numberOfPageElements; ++i) {
+        function(page[i]);
+      }
+      numberOfRemainingElements -= numberOfPageElements;
+      if (0 == numberOfRemainingElements) {
+        break;
+      }
+    }
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private methods                                       ]
+  //[-------------------------------------------------------]
+private:
+  explicit PagedPackedElementManager(const PagedPackedElementManager &) = delete;
+
+  PagedPackedElementManager &operator=(const PagedPackedElementManager &) = delete;
+
+  inline void growIndices() {
+    const uint32 numberOfIndices = static_cast<uint32>(mIndices.size());
+    uint32 newNumberOfIndices = numberOfIndices + NUMBER_OF_ELEMENTS_PER_PAGE;
+    if (newNumberOfIndices > MAXIMUM_NUMBER_OF_ELEMENTS) {
+      newNumberOfIndices = MAXIMUM_NUMBER_OF_ELEMENTS;
+    }
+    mIndices.resize(newNumberOfIndices);
+    for (uint32 i = numberOfIndices; i < newNumberOfIndices; ++i) {
+      Index &index = mIndices[i];
+      index.id = i;
+      RECore::setInvalid(index.index);
+      enqueueFreeIndex(i);
+    }
+  }
+
+  inline void enqueueFreeIndex(uint32 indexOfIndex) {
+    RECore::setInvalid(mIndices[indexOfIndex].next);
+    if (RECore::isInvalid(mFreeListEnqueue)) {
+      mFreeListDequeue = indexOfIndex;
+    } else {
+      mIndices[mFreeListEnqueue].next = indexOfIndex;
+    }
+    mFreeListEnqueue = indexOfIndex;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  static constexpr uint32 NEW_OBJECT_ID_ADD = INDEX_MASK + 1;	///< Generation counter increment, the generation is stored inside the upper 8 bits of an ID
+  static constexpr uint32 GENERATION_MASK = ~INDEX_MASK;
+
+  struct Index final {
+    ID_TYPE id;		///< Current ID using this index, including the generation counter
+    uint32  index;	///< Index of the element, invalid if the ID is currently not in use
+    uint32  next;	///< Next free index, invalid if this is the end of the free list
+  };
+
+  typedef std::vector<ELEMENT_TYPE*> Pages;
+  typedef std::vector<Index> Indices;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  uint32  mNumberOfElements;
+  Pages   mPages;			///< Element pages, each page has "NUMBER_OF_ELEMENTS_PER_PAGE" elements, destroy the pages if you no longer need them
+  Indices mIndices;		///< ID lookup table
+  uint32  mFreeListEnqueue;	///< Last free index, invalid if there's no free index
+  uint32  mFreeListDequeue;	///< First free index, invalid if there's no free index
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
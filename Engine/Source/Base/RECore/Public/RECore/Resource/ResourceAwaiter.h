@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+#include "RECore/Resource/IResource.h"
+#include "RECore/Resource/IResourceManager.h"
+#include "RECore/Resource/ResourceStreamer.h"
+#include "RECore/Utility/GetInvalid.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Awaitable waiting until a resource is no longer loading
+*
+*  @remarks
+*    Coroutine counterpart of "RECore::IResourceListener": Instead of splitting the code into a load request and a loading
+*    state change callback, a coroutine can just "co_await" the resource. In case the resource is already loaded, the
+*    coroutine doesn't suspend at all. The result of "co_await" is the resource, or a null pointer if loading failed.
+*
+*    Usage example:
+*    @code
+*    RERenderer::MeshResource* meshResource = co_await RERenderer::loadAsync<RERenderer::MeshResource>(renderer, assetId);
+*    @endcode
+*
+*  @note
+*    - Must be awaited on the main thread, the resource listeners of resources are not multithreading safe
+*    - The awaiting coroutine is resumed by "RECore::ResourceStreamer", see "RECore::ResourceStreamer::ResumeThread"
+*/
+template<typename TYPE = IResource>
+class ResourceAwaiter final {
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline ResourceAwaiter(ResourceStreamer &resourceStreamer, IResourceManager &resourceManager, ResourceId resourceId,
+                         ResourceStreamer::ResumeThread resumeThread = ResourceStreamer::ResumeThread::DISPATCH) :
+    mResourceStreamer(&resourceStreamer),
+    mResourceManager(&resourceManager),
+    mResourceId(resourceId),
+    mResumeThread(resumeThread) {
+    // Nothing here
+  }
+
+  [[nodiscard]] inline ResourceId getResourceId() const {
+    return mResourceId;
+  }
+
+  [[nodiscard]] inline bool await_ready() const {
+    const IResource *resource = tryGetResource();
+    if (nullptr == resource) {
+      // Unknown resource, there's nothing we could wait for
+      return true;
+    }
+    const IResource::LoadingState loadingState = resource->getLoadingState();
+    return (IResource::LoadingState::LOADING != loadingState && IResource::LoadingState::UNLOADING != loadingState);
+  }
+
+  inline void await_suspend(std::coroutine_handle<> coroutine) const {
+    mResourceStreamer->resumeCoroutineAfterLoading(*tryGetResource(), coroutine, mResumeThread);
+  }
+
+  [[nodiscard]] inline TYPE *await_resume() const {
+    IResource *resource = tryGetResource();
+    return (nullptr != resource && IResource::LoadingState::LOADED == resource->getLoadingState()) ? static_cast<TYPE *>(resource) : nullptr;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private methods                                       ]
+  //[-------------------------------------------------------]
+private:
+  [[nodiscard]] inline IResource *tryGetResource() const {
+    return RECore::isValid(mResourceId) ? mResourceManager->tryGetResourceByResourceId(mResourceId) : nullptr;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  ResourceStreamer *mResourceStreamer;    ///< Resource streamer instance, always valid, do not destroy the instance
+  IResourceManager *mResourceManager;    ///< Owner resource manager, always valid, do not destroy the instance
+  ResourceId mResourceId;          ///< Can be invalid
+  ResourceStreamer::ResumeThread mResumeThread;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -28,7 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RECore/RECore.h"
-#include "RECore/Resource/PackedElementManager.h"
+#include "RECore/Resource/PagedPackedElementManager.h"
 #include "RECore/Asset/AssetManager.h"
 #include "RECore/Resource/ResourceStreamer.h"
 #include "RECore/Resource/ResourceTypes.h"
@@ -55,8 +55,11 @@ class IResourceListener;
 /**
 *  @brief
 *    Internal resource manager template; not public used to keep template instantiation overhead under control
+*
+*  @note
+*    - The resources are stored inside a growable paged packed element manager, "NUMBER_OF_ELEMENTS_PER_PAGE" is the allocation granularity and not a capacity limit
 */
-template<class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
+template<class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
 class ResourceManagerTemplate : private RECore::Manager {
 
 
@@ -64,7 +67,7 @@ class ResourceManagerTemplate : private RECore::Manager {
   //[ Public definitions                                    ]
   //[-------------------------------------------------------]
 public:
-  typedef PackedElementManager<TYPE, ID_TYPE, MAXIMUM_NUMBER_OF_ELEMENTS> Resources;
+  typedef PagedPackedElementManager<TYPE, ID_TYPE, NUMBER_OF_ELEMENTS_PER_PAGE> Resources;
 
 
   //[-------------------------------------------------------]
@@ -51,6 +51,7 @@ PRAGMA_WARNING_DISABLE_MSVC(
 #include <thread>
 #include <unordered_map>
 #include <condition_variable>
+#include <coroutine>
 
 #include <deque>
 #include <vector>
@@ -91,6 +92,10 @@ class IResourceManager;
 *    2. Asynchronous processing
 *    3. Synchronous dispatch, e.g. to the RHI implementation
 *
+*    Coroutines can await resources via "RECore::ResourceAwaiter" instead of implementing "RECore::IResourceListener".
+*    The resource streamer resumes them either on the main thread during "RECore::ResourceStreamer::dispatch()" or on
+*    the processing worker thread, see "RECore::ResourceStreamer::ResumeThread".
+*
 *  @todo
 *    - TODO(naetherm) It might make sense to use lock-free-queues in here
 */
@@ -107,6 +112,36 @@ class RECORE_API ResourceStreamer final {
   //[ Public definitions                                    ]
   //[-------------------------------------------------------]
 public:
+  /**
+  *  @brief
+  *    Thread a coroutine waiting for the resource streamer is resumed on
+  */
+  enum class ResumeThread {
+    DISPATCH,  ///< Main thread during "RECore::ResourceStreamer::dispatch()", safe to access resource managers and the RHI
+    WORKER    ///< Resource streamer processing thread, for CPU work not touching resource managers or the RHI
+  };
+
+  /**
+  *  @brief
+  *    Awaitable switching the awaiting coroutine to the given thread, see "RECore::ResourceStreamer::resumeOn()"
+  */
+  struct ResumeOnAwaiter final {
+    ResourceStreamer &resourceStreamer;
+    ResumeThread resumeThread;
+
+    [[nodiscard]] inline bool await_ready() const noexcept {
+      return false;
+    }
+
+    inline void await_suspend(std::coroutine_handle<> coroutine) const {
+      resourceStreamer.resumeCoroutine(coroutine, resumeThread);
+    }
+
+    inline void await_resume() const noexcept {
+      // Nothing here
+    }
+  };
+
   struct LoadRequest final {
     // Data provided from the outside
     const RECore::Asset *asset;          ///< Used asset, must be valid
@@ -156,6 +191,47 @@ public:
   */
   void dispatch();
 
+  /**
+  *  @brief
+  *    Schedule the given suspended coroutine for resumption on the given thread
+  *
+  *  @param[in] coroutine
+  *    Suspended coroutine to resume, must stay valid until it's resumed
+  *  @param[in] resumeThread
+  *    Thread to resume the coroutine on
+  *
+  *  @note
+  *    - Multithreading safe
+  */
+  void resumeCoroutine(std::coroutine_handle<> coroutine, ResumeThread resumeThread);
+
+  /**
+  *  @brief
+  *    Return an awaitable switching the awaiting coroutine to the given thread
+  *
+  *  @remarks
+  *    Usage example: "co_await resourceStreamer.resumeOn(RECore::ResourceStreamer::ResumeThread::WORKER);"
+  */
+  [[nodiscard]] inline ResumeOnAwaiter resumeOn(ResumeThread resumeThread) {
+    return ResumeOnAwaiter{*this, resumeThread};
+  }
+
+  /**
+  *  @brief
+  *    Resume the given suspended coroutine as soon as the given resource is no longer loading
+  *
+  *  @param[in] resource
+  *    Resource to wait for
+  *  @param[in] coroutine
+  *    Suspended coroutine to resume, must stay valid until it's resumed
+  *  @param[in] resumeThread
+  *    Thread to resume the coroutine on
+  *
+  *  @note
+  *    - Must be called from the main thread, usually done by "RECore::ResourceAwaiter"
+  */
+  void resumeCoroutineAfterLoading(IResource &resource, std::coroutine_handle<> coroutine, ResumeThread resumeThread);
+
 
   //[-------------------------------------------------------]
   //[ Private methods                                       ]
@@ -188,6 +264,14 @@ private:
     LoadRequests waitingLoadRequests;
   };
   typedef std::unordered_map<uint32, ResourceLoaderType> ResourceLoaderTypeManager;  ///< Key = "Renderer::ResourceLoaderTypeId"
+  class CoroutineResourceListener;
+  struct ResumeRequest final {
+    std::coroutine_handle<> coroutine;
+    CoroutineResourceListener *coroutineResourceListener;  ///< Can be a null pointer, destroyed on the main thread before the coroutine is resumed
+    ResumeThread resumeThread;
+  };
+  typedef std::vector<ResumeRequest> ResumeRequests;
+  typedef std::deque<std::coroutine_handle<>> Coroutines;
 
 
   //[-------------------------------------------------------]
@@ -210,11 +294,16 @@ private:
   std::mutex mProcessingMutex;
   std::condition_variable mProcessingConditionVariable;
   LoadRequests mProcessingQueue;
+  Coroutines mWorkerResumeQueue;  ///< Coroutines to resume on the processing thread, do only touch if "mProcessingMutex" is locked
   std::thread mProcessingThread;
   // Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
   std::mutex mDispatchMutex;
   LoadRequests mDispatchQueue;
   LoadRequests mFullyLoadedWaitingQueue;
+  // Coroutines waiting to be resumed on the main thread
+  std::mutex mResumeMutex;
+  ResumeRequests mResumeQueue;
+  ResumeRequests mDispatchResumeRequests;  ///< Only touched by "RECore::ResourceStreamer::dispatch()", to avoid reallocations
 
 
 };
@@ -0,0 +1,601 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RECore/RECore.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+PRAGMA_WARNING_DISABLE_MSVC(
+  4668)  // warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RECore
+{
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+template<typename TYPE>
+class Task;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Promise base of "RECore::Task", not meant to be used directly
+*/
+class TaskPromiseBase {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  struct FinalAwaiter final {
+    [[nodiscard]] inline bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename PROMISE>
+    [[nodiscard]] inline std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> coroutine) noexcept {
+      // Continue with the awaiting coroutine by symmetric transfer, a detached task destroys itself
+      TaskPromiseBase& promise = coroutine.promise();
+      if (promise.mContinuation) {
+        return promise.mContinuation;
+      }
+      if (promise.mDetached) {
+        coroutine.destroy();
+      }
+      return std::noop_coroutine();
+    }
+
+    inline void await_resume() const noexcept {
+      // Nothing here
+    }
+  };
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  [[nodiscard]] inline std::suspend_always initial_suspend() const noexcept {
+    return {};
+  }
+
+  [[nodiscard]] inline FinalAwaiter final_suspend() const noexcept {
+    return {};
+  }
+
+  inline void unhandled_exception() const noexcept {
+    // The engine doesn't use exceptions, there's nobody we could hand the exception to
+    std::terminate();
+  }
+
+  inline void setContinuation(std::coroutine_handle<> continuation) {
+    mContinuation = continuation;
+  }
+
+  inline void setDetached() {
+    mDetached = true;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  std::coroutine_handle<> mContinuation;  ///< Coroutine awaiting this task, resumed as soon as this task is done
+  bool mDetached = false;          ///< "true" if nobody owns the task and it has to destroy itself when done
+
+
+};
+
+/**
+*  @brief
+*    Promise of "RECore::Task", not meant to be used directly
+*/
+template<typename TYPE>
+class TaskPromise final : public TaskPromiseBase {
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  [[nodiscard]] inline Task<TYPE> get_return_object() noexcept;
+
+  template<typename VALUE>
+  inline void return_value(VALUE&& value) {
+    mValue = std::forward<VALUE>(value);
+  }
+
+  [[nodiscard]] inline TYPE& getValue() {
+    return mValue;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  TYPE mValue{};
+
+
+};
+
+template<>
+class TaskPromise<void> final : public TaskPromiseBase {
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  [[nodiscard]] inline Task<void> get_return_object() noexcept;
+
+  inline void return_void() const noexcept {
+    // Nothing here
+  }
+
+  inline void getValue() const noexcept {
+    // Nothing here
+  }
+
+
+};
+
+/**
+*  @brief
+*    Lazily started coroutine task
+*
+*  @remarks
+*    A function becomes a coroutine task by returning "RECore::Task<TYPE>" and using "co_await" or "co_return". The coroutine
+*    doesn't run until the task is awaited by another coroutine using "co_await", started via "RECore::Task::start()" or
+*    handed over to itself using "RECore::Task::detach()". When the coroutine is done, the awaiting coroutine is resumed
+*    directly on the thread the coroutine finished on.
+*
+*    Usage example:
+*    @code
+*    RECore::Task<void> setupLevel(RERenderer::IRenderer& renderer)
+*    {
+*      auto [meshResource, textureResource] = co_await RECore::whenAll(RERenderer::loadAsync<RERenderer::MeshResource>(renderer, meshAssetId),
+*                                                                      RERenderer::loadAsync<RERenderer::TextureResource>(renderer, textureAssetId));
+*      // ... use the loaded resources, a null pointer means loading failed...
+*    }
+*    setupLevel(renderer).detach();
+*    @endcode
+*
+*  @note
+*    - Move only, destroying a task destroys the coroutine, this must not happen while the coroutine is suspended
+*    - There's no exception support, an exception escaping the coroutine terminates the application
+*/
+template<typename TYPE>
+class Task final {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  typedef TaskPromise<TYPE> promise_type;
+  typedef std::coroutine_handle<promise_type> Handle;
+
+  struct Awaiter final {
+    Handle coroutine;
+
+    [[nodiscard]] inline bool await_ready() const noexcept {
+      return (!coroutine || coroutine.done());
+    }
+
+    [[nodiscard]] inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept {
+      // Start the task by symmetric transfer, it resumes the awaiting coroutine when it's done
+      coroutine.promise().setContinuation(awaitingCoroutine);
+      return coroutine;
+    }
+
+    inline TYPE await_resume() {
+      if constexpr (!std::is_void_v<TYPE>) {
+        return std::move(coroutine.promise().getValue());
+      }
+    }
+  };
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline Task() noexcept = default;
+
+  inline explicit Task(Handle coroutine) noexcept :
+    mCoroutine(coroutine) {
+    // Nothing here
+  }
+
+  inline Task(Task&& task) noexcept :
+    mCoroutine(std::exchange(task.mCoroutine, nullptr)) {
+    // Nothing here
+  }
+
+  inline Task& operator=(Task&& task) noexcept {
+    if (this != &task) {
+      destroy();
+      mCoroutine = std::exchange(task.mCoroutine, nullptr);
+    }
+    return *this;
+  }
+
+  inline ~Task() {
+    destroy();
+  }
+
+  explicit Task(const Task&) = delete;
+
+  Task& operator=(const Task&) = delete;
+
+  [[nodiscard]] inline bool isValid() const {
+    return static_cast<bool>(mCoroutine);
+  }
+
+  [[nodiscard]] inline bool isDone() const {
+    return (!mCoroutine || mCoroutine.done());
+  }
+
+  /**
+  *  @brief
+  *    Run the coroutine until its first suspension point, does nothing if the task was already started
+  */
+  inline void start() {
+    if (mCoroutine && !mStarted) {
+      mStarted = true;
+      mCoroutine.resume();
+    }
+  }
+
+  /**
+  *  @brief
+  *    Start the coroutine and give up ownership, the coroutine destroys itself when done
+  *
+  *  @note
+  *    - The task must not have been started or awaited before
+  */
+  inline void detach() {
+    if (mCoroutine) {
+      Handle coroutine = std::exchange(mCoroutine, nullptr);
+      coroutine.promise().setDetached();
+      coroutine.resume();
+    }
+  }
+
+  [[nodiscard]] inline Awaiter operator co_await() && noexcept {
+    mStarted = true;
+    return Awaiter{mCoroutine};
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private methods                                       ]
+  //[-------------------------------------------------------]
+private:
+  inline void destroy() {
+    if (mCoroutine) {
+      mCoroutine.destroy();
+      mCoroutine = nullptr;
+    }
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  Handle mCoroutine;
+  bool mStarted = false;
+
+
+};
+
+template<typename TYPE>
+inline Task<TYPE> TaskPromise<TYPE>::get_return_object() noexcept {
+  return Task<TYPE>(std::coroutine_handle<TaskPromise<TYPE>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+  return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+/**
+*  @brief
+*    Synchronization of a "RECore::whenAll()" call, not meant to be used directly
+*
+*  @remarks
+*    The counter starts with the number of awaitables plus one for the awaiting coroutine itself. Whoever decrements
+*    the counter to zero - the last finished awaitable or the awaiting coroutine in case everything is done already -
+*    continues the awaiting coroutine.
+*/
+class WhenAllLatch final {
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline explicit WhenAllLatch(size_t numberOfAwaitables) :
+    mCounter(numberOfAwaitables + 1) {
+    // Nothing here
+  }
+
+  explicit WhenAllLatch(const WhenAllLatch&) = delete;
+
+  WhenAllLatch& operator=(const WhenAllLatch&) = delete;
+
+  [[nodiscard]] inline bool tryAwait(std::coroutine_handle<> awaitingCoroutine) {
+    mAwaitingCoroutine = awaitingCoroutine;
+    return (mCounter.fetch_sub(1, std::memory_order_acq_rel) > 1);
+  }
+
+  inline void notifyAwaitableDone() {
+    if (mCounter.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      mAwaitingCoroutine.resume();
+    }
+  }
+
+  [[nodiscard]] inline auto operator co_await() noexcept {
+    struct Awaiter final {
+      WhenAllLatch& latch;
+
+      [[nodiscard]] inline bool await_ready() const noexcept {
+        return false;
+      }
+
+      [[nodiscard]] inline bool await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept {
+        return latch.tryAwait(awaitingCoroutine);
+      }
+
+      inline void await_resume() const noexcept {
+        // Nothing here
+      }
+    };
+    return Awaiter{*this};
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  std::atomic<size_t> mCounter;
+  std::coroutine_handle<> mAwaitingCoroutine;
+
+
+};
+
+/**
+*  @brief
+*    Coroutine awaiting a single awaitable of a "RECore::whenAll()" call, not meant to be used directly
+*/
+class WhenAllTask final {
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  struct promise_type final {
+    WhenAllLatch* latch = nullptr;
+
+    [[nodiscard]] inline WhenAllTask get_return_object() noexcept {
+      return WhenAllTask(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    [[nodiscard]] inline std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+
+    [[nodiscard]] inline auto final_suspend() const noexcept {
+      struct FinalAwaiter final {
+        [[nodiscard]] inline bool await_ready() const noexcept {
+          return false;
+        }
+
+        inline void await_suspend(std::coroutine_handle<promise_type> coroutine) const noexcept {
+          // The frame stays alive, the owning "RECore::whenAll()" coroutine destroys it
+          coroutine.promise().latch->notifyAwaitableDone();
+        }
+
+        inline void await_resume() const noexcept {
+          // Nothing here
+        }
+      };
+      return FinalAwaiter{};
+    }
+
+    inline void return_void() const noexcept {
+      // Nothing here
+    }
+
+    inline void unhandled_exception() const noexcept {
+      std::terminate();
+    }
+  };
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  inline explicit WhenAllTask(std::coroutine_handle<promise_type> coroutine) noexcept :
+    mCoroutine(coroutine) {
+    // Nothing here
+  }
+
+  inline WhenAllTask(WhenAllTask&& whenAllTask) noexcept :
+    mCoroutine(std::exchange(whenAllTask.mCoroutine, nullptr)) {
+    // Nothing here
+  }
+
+  inline ~WhenAllTask() {
+    if (mCoroutine) {
+      mCoroutine.destroy();
+    }
+  }
+
+  explicit WhenAllTask(const WhenAllTask&) = delete;
+
+  WhenAllTask& operator=(const WhenAllTask&) = delete;
+
+  inline void start(WhenAllLatch& latch) {
+    mCoroutine.promise().latch = &latch;
+    mCoroutine.resume();
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  std::coroutine_handle<promise_type> mCoroutine;
+
+
+};
+
+template<typename AWAITABLE>
+auto getAwaiter(AWAITABLE&& awaitable, int) -> decltype(std::forward<AWAITABLE>(awaitable).operator co_await());
+
+template<typename AWAITABLE>
+auto getAwaiter(AWAITABLE&& awaitable, long) -> AWAITABLE&;
+
+/**
+*  @brief
+*    Return type of "co_await" on an instance of the given awaitable type
+*/
+template<typename AWAITABLE>
+using AwaitResult = decltype(getAwaiter(std::declval<AWAITABLE>(), 0).await_resume());
+
+template<typename AWAITABLE>
+[[nodiscard]] WhenAllTask makeWhenAllTask(AWAITABLE awaitable, AwaitResult<AWAITABLE>& result) {
+  result = co_await std::move(awaitable);
+}
+
+template<typename AWAITABLE>
+[[nodiscard]] WhenAllTask makeWhenAllVoidTask(AWAITABLE awaitable) {
+  co_await std::move(awaitable);
+}
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Await all given awaitables concurrently
+*
+*  @param[in] awaitables
+*    Awaitables to await, e.g. "RECore::Task" or "RECore::ResourceAwaiter" instances, none of them may return "void"
+*
+*  @return
+*    Task returning a tuple with the results of all awaitables, in the order of the given awaitables
+*
+*  @remarks
+*    All awaitables are started at once, so e.g. independent resource loads are in-flight at the same time inside the
+*    resource streamer. The awaiting coroutine is resumed on the thread the last awaitable finished on.
+*/
+template<typename... AWAITABLES>
+[[nodiscard]] Task<std::tuple<AwaitResult<AWAITABLES>...>> whenAll(AWAITABLES... awaitables) {
+  std::tuple<AwaitResult<AWAITABLES>...> results;
+  WhenAllLatch latch(sizeof...(AWAITABLES));
+  std::array<WhenAllTask, sizeof...(AWAITABLES)> whenAllTasks = std::apply([&](auto&... result) {
+    return std::array<WhenAllTask, sizeof...(AWAITABLES)>{makeWhenAllTask(std::move(awaitables), result)...};
+  }, results);
+  for (WhenAllTask& whenAllTask : whenAllTasks) {
+    whenAllTask.start(latch);
+  }
+  co_await latch;
+  co_return std::move(results);
+}
+
+/**
+*  @brief
+*    Await all awaitables of the given list concurrently
+*
+*  @param[in] awaitables
+*    Awaitables to await, all of the same type
+*
+*  @return
+*    Task returning the results of all awaitables in list order, or "void" if the awaitables return "void"
+*/
+template<typename AWAITABLE>
+[[nodiscard]] auto whenAll(std::vector<AWAITABLE> awaitables) -> Task<std::conditional_t<std::is_void_v<AwaitResult<AWAITABLE>>, void, std::vector<AwaitResult<AWAITABLE>>>> {
+  typedef AwaitResult<AWAITABLE> ResultType;
+  WhenAllLatch latch(awaitables.size());
+  std::vector<WhenAllTask> whenAllTasks;
+  whenAllTasks.reserve(awaitables.size());
+  if constexpr (std::is_void_v<ResultType>) {
+    for (AWAITABLE& awaitable : awaitables) {
+      whenAllTasks.push_back(makeWhenAllVoidTask(std::move(awaitable)));
+    }
+    for (WhenAllTask& whenAllTask : whenAllTasks) {
+      whenAllTask.start(latch);
+    }
+    co_await latch;
+  } else {
+    std::vector<ResultType> results(awaitables.size());
+    for (size_t i = 0; i < awaitables.size(); ++i) {
+      whenAllTasks.push_back(makeWhenAllTask(std::move(awaitables[i]), results[i]));
+    }
+    for (WhenAllTask& whenAllTask : whenAllTasks) {
+      whenAllTask.start(latch);
+    }
+    co_await latch;
+    co_return std::move(results);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
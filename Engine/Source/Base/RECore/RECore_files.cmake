@@ -67,6 +67,8 @@ set(FILES
   Private/Log/Log.cpp
   Private/Log/LogFormatter.cpp
   Private/Log/LogFormatterText.cpp
+  Private/Log/LogRecord.cpp
+  Private/Log/LogRingBuffer.cpp
 
   # Math
   Private/Math/EulerAngles.cpp
@@ -76,8 +78,13 @@ set(FILES
   Private/Math/Vec2i.cpp
 
   # Memory
+  Private/Memory/LinearAllocator.cpp
   Private/Memory/Memory.cpp
+  Private/Memory/MemoryTracker.cpp
+  Private/Memory/PoolAllocator.cpp
   Private/Memory/StdAllocator.cpp
+  Private/Memory/TlsfAllocator.cpp
+  Private/Memory/TrackingAllocator.cpp
 
   # Null
   Private/Null/FrontendNull.cpp
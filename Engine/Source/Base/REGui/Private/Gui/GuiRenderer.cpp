@@ -24,6 +24,7 @@
 //[-------------------------------------------------------]
 #include "REGui/Gui/GuiRenderer.h"
 #include <RECore/Log/Log.h>
+#include <RECore/Math/Math.h>
 #include "REGui/Application/GuiContext.h"
 #include "REGui/Gui/Keys.h"
 #include "REGui/Gui/Gui.h"
@@ -33,7 +34,9 @@
 #include <RECore/Asset/Asset.h>
 #include <RECore/Log/Log.h>
 #include <RECore/Memory/Memory.h>
+#include <RECore/Memory/MemoryTracker.h>
 #include <RERenderer/Resource/Texture/TextureResourceManager.h>
+#include <RERenderer/Core/Renderer/RenderThread.h>
 #if defined(LINUX)
 #include "REGui/Backend/Linux/GuiLinux.h"
 #include <RERHI/Linux/X11Context.h>
@@ -41,6 +44,7 @@
 #include <RERenderer/RendererImpl.h>
 #include <imgui.h>
 #include <imgui_internal.h>
+#include <algorithm>
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -97,6 +101,10 @@ static constexpr RERHI::VertexAttribute VertexAttributesLayout[] =
   };
 const RERHI::VertexAttributes VertexAttributes(static_cast<RECore::uint32>(GLM_COUNTOF(VertexAttributesLayout)), VertexAttributesLayout);
 
+// Initial vertex and index buffer sizes, the buffers grow geometrically from there on
+static constexpr RECore::uint32 MINIMUM_NUMBER_OF_VERTICES = 8192;
+static constexpr RECore::uint32 MINIMUM_NUMBER_OF_INDICES = 16384;
+
 
 //[-------------------------------------------------------]
 //[ Global functions                                      ]
@@ -111,6 +119,27 @@ void FreeFunc(void* ptr, void* user_data)
   RECore::Memory::reallocate(ptr, 0, 0, 1);
 }
 
+[[nodiscard]] RECore::uint64 hashBytes(const void* data, size_t numberOfBytes, RECore::uint64 hash)
+{
+  // Word-wise FNV-1a variant, bytewise FNV-1a would be slower than the upload we try to avoid
+  const RECore::uint8* bytes = static_cast<const RECore::uint8*>(data);
+  const size_t numberOfWords = numberOfBytes / sizeof(RECore::uint64);
+  for (size_t i = 0; i < numberOfWords; ++i, bytes += sizeof(RECore::uint64))
+  {
+    RECore::uint64 word;
+    memcpy(&word, bytes, sizeof(RECore::uint64));
+    hash = (hash ^ word) * 0x100000001b3u;
+  }
+  return RECore::Math::calculateFNV1a64(bytes, static_cast<RECore::uint32>(numberOfBytes - numberOfWords * sizeof(RECore::uint64)), hash);
+}
+
+[[nodiscard]] RECore::uint64 calculateDrawListHash(const ImDrawList& imDrawList)
+{
+  RECore::uint64 hash = RECore::Math::FNV1a_INITIAL_HASH_64;
+  hash = hashBytes(imDrawList.VtxBuffer.Data, static_cast<size_t>(imDrawList.VtxBuffer.size()) * sizeof(ImDrawVert), hash);
+  return hashBytes(imDrawList.IdxBuffer.Data, static_cast<size_t>(imDrawList.IdxBuffer.size()) * sizeof(ImDrawIdx), hash);
+}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -143,6 +172,9 @@ GuiRenderer::GuiRenderer(Gui *gui)
 , mObjectSpaceToClipSpaceMatrixUniformHandle(NULL_HANDLE)
 , mNumberOfAllocatedVertices(0)
 , mNumberOfAllocatedIndices(0)
+, mNumberOfUsedVertices(0)
+, mNumberOfUsedIndices(0)
+, mFrame(0)
 , mTime(0) {
 
 }
@@ -253,6 +285,7 @@ GuiTextureManager* GuiRenderer::getGuiTextureManager() const {
 
 
 void GuiRenderer::createFixedBuildInRhiConfigurationResources() {
+  RE_MEMORY_TAG_SCOPE("Gui")
   RERHI::RHIDynamicRHI* rhi = getRhi();
 
   { // Create the root signature instance
@@ -360,6 +393,7 @@ void GuiRenderer::createFixedBuildInRhiConfigurationResources() {
 }
 
 void GuiRenderer::startFrame(MainWindow* mainWindow) {
+  RE_MEMORY_TAG_SCOPE("Gui")
   {
     ImGuiIO& imGuiIo = ImGui::GetIO();
 
@@ -392,61 +426,7 @@ const RERHI::RHIVertexArrayPtr& GuiRenderer::getFillVertexArrayPtr(RERHI::RHICom
   {
     // Ask ImGui to render into the internal command buffer and then request the resulting draw data
     ImGui::Render();
-    const ImDrawData* imDrawData = ImGui::GetDrawData();
-    RERHI::RHIDynamicRHI& rhi = mRenderer->getRhi();
-    RERHI::RHIBufferManager& bufferManager = mRenderer->getBufferManager();
-
-    { // Vertex and index buffers
-      // Create and grow vertex/index buffers if needed
-      if (nullptr == mVertexBuffer || mNumberOfAllocatedVertices < static_cast<RECore::uint32>(imDrawData->TotalVtxCount))
-      {
-        mNumberOfAllocatedVertices = static_cast<RECore::uint32>(imDrawData->TotalVtxCount + 5000);	// Add some reserve to reduce reallocations
-        mVertexBuffer = bufferManager.createVertexBuffer(mNumberOfAllocatedVertices * sizeof(ImDrawVert), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
-        mVertexArray = nullptr;
-      }
-      if (nullptr == mIndexBuffer || mNumberOfAllocatedIndices < static_cast<RECore::uint32>(imDrawData->TotalIdxCount))
-      {
-        mNumberOfAllocatedIndices = static_cast<RECore::uint32>(imDrawData->TotalIdxCount + 10000);	// Add some reserve to reduce reallocations
-        mIndexBuffer = bufferManager.createIndexBuffer(mNumberOfAllocatedIndices * sizeof(ImDrawIdx), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
-        mVertexArray = nullptr;
-      }
-      if (nullptr == mVertexArray)
-      {
-        RHI_ASSERT(nullptr != mVertexBuffer, "Invalid vertex buffer")
-        RHI_ASSERT(nullptr != mIndexBuffer, "Invalid index buffer")
-
-        // Create vertex array object (VAO)
-        const RERHI::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { mVertexBuffer };
-        mVertexArray = bufferManager.createVertexArray(::detail::VertexAttributes, static_cast<RECore::uint32>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, mIndexBuffer RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
-      }
-
-      { // Copy and convert all vertices and indices into a single contiguous buffer
-        RERHI::MappedSubresource vertexBufferMappedSubresource;
-        if (rhi.map(*mVertexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, vertexBufferMappedSubresource))
-        {
-          RERHI::MappedSubresource indexBufferMappedSubresource;
-          if (rhi.map(*mIndexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, indexBufferMappedSubresource))
-          {
-            ImDrawVert* imDrawVert = static_cast<ImDrawVert*>(vertexBufferMappedSubresource.data);
-            ImDrawIdx* imDrawIdx = static_cast<ImDrawIdx*>(indexBufferMappedSubresource.data);
-            for (int i = 0; i < imDrawData->CmdListsCount; ++i)
-            {
-              const ImDrawList* imDrawList = imDrawData->CmdLists[i];
-              memcpy(imDrawVert, &imDrawList->VtxBuffer[0], imDrawList->VtxBuffer.size() * sizeof(ImDrawVert));
-              memcpy(imDrawIdx, &imDrawList->IdxBuffer[0], imDrawList->IdxBuffer.size() * sizeof(ImDrawIdx));
-              imDrawVert += imDrawList->VtxBuffer.size();
-              imDrawIdx += imDrawList->IdxBuffer.size();
-            }
-
-            // Unmap the index buffer
-            rhi.unmap(*mIndexBuffer, 0);
-          }
-
-          // Unmap the vertex buffer
-          rhi.unmap(*mVertexBuffer, 0);
-        }
-      }
-    }
+    uploadDrawData(*ImGui::GetDrawData());
   }
 
   // Done
@@ -455,94 +435,84 @@ const RERHI::RHIVertexArrayPtr& GuiRenderer::getFillVertexArrayPtr(RERHI::RHICom
 
 void GuiRenderer::fillGraphicsCommandBuffer(RERHI::RHICommandBuffer& commandBuffer)
 {
+  RE_MEMORY_TAG_SCOPE("Gui")
   if (GImGui->Initialized)
   {
     // No combined scoped profiler CPU and GPU sample as well as renderer debug event command by intent, this is something the caller has to take care of
     // RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "Debug GUI")
+    const ImDrawData* imDrawData = ImGui::GetDrawData();
+    if (nullptr == imDrawData || static_cast<int>(mFrameDrawListRanges.size()) != imDrawData->CmdListsCount)
+    {
+      // The draw data wasn't uploaded, nothing we could draw
+      return;
+    }
+
+    // The projection only depends on the display size, so one update is sufficient for all commands
+    fillObjectSpaceToClipSpaceMatrix(commandBuffer);
 
     // Render command lists
     // -> There's no need to try to gather draw calls and batch them into multi-draw-indirect buffers, ImGui does already a pretty good job
-    int vertexOffset = 0;
-    int indexOffset = 0;
-    const ImDrawData* imDrawData = ImGui::GetDrawData();
+    // -> Adjacent commands sharing texture and clip rectangle are merged, resource groups and scissor rectangles are only set on change
+    RERHI::RHITexture2D* currentTexture = nullptr;
+    const ImVec4* currentClipRect = nullptr;
+    bool samplerStateGroupSet = false;
     for (int commandListIndex = 0; commandListIndex < imDrawData->CmdListsCount; ++commandListIndex)
     {
       const ImDrawList* imDrawList = imDrawData->CmdLists[commandListIndex];
-      for (int commandIndex = 0; commandIndex < imDrawList->CmdBuffer.size(); ++commandIndex)
+      const DrawListRange& drawListRange = *mFrameDrawListRanges[static_cast<size_t>(commandListIndex)];
+      const int numberOfCommands = imDrawList->CmdBuffer.size();
+      for (int commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex)
       {
         const ImDrawCmd* pcmd = &imDrawList->CmdBuffer[commandIndex];
         if (nullptr != pcmd->UserCallback)
         {
           RE_LOG(Info, "Callback method")
           pcmd->UserCallback(imDrawList, pcmd);
+
+          // The callback might have changed any state
+          currentTexture = nullptr;
+          currentClipRect = nullptr;
+          samplerStateGroupSet = false;
+          continue;
         }
-        else
+
+        // Merge the following commands as long as they continue this one seamlessly
+        RECore::uint32 numberOfIndices = pcmd->ElemCount;
+        while (commandIndex + 1 < numberOfCommands)
         {
-          if (pcmd->TextureId) {
-            { // Setup orthographic projection matrix into our vertex shader uniform buffer
-              const ImVec2& displaySize = ImGui::GetIO().DisplaySize;
-              ImVec2 texelOffset(0.0f, 0.0f);
-              if (mRenderer->getRhi().getNameId() == RERHI::NameId::DIRECT3D9)
-              {
-                // Take care of the Direct3D 9 half-pixel/half-texel offset
-                // -> See "Directly Mapping Texels to Pixels (Direct3D 9)" at https://docs.microsoft.com/en-gb/windows/win32/direct3d9/directly-mapping-texels-to-pixels?redirectedfrom=MSDN
-                texelOffset.x += 0.5f;
-                texelOffset.y += 0.5f;
-              }
-              const float l = texelOffset.x;
-              const float r = displaySize.x + texelOffset.x;
-              const float t = texelOffset.y;
-              const float b = displaySize.y + texelOffset.y;
-              const float objectSpaceToClipSpaceMatrix[4][4] =
-                {
-                  { 2.0f / (r - l),	 0.0f,        0.0f, 0.0f },
-                  { 0.0f,				 2.0f/(t-b),  0.0f, 0.0f },
-                  { 0.0f,				 0.0f,        0.5f, 0.0f },
-                  { (r + l) / (l - r), (t+b)/(b-t), 0.5f, 1.0f }
-                };
-              if (nullptr != mVertexShaderUniformBuffer)
-              {
-                // Copy data into the uniform buffer
-                RERHI::Command::CopyUniformBufferData::create(commandBuffer, *mVertexShaderUniformBuffer, objectSpaceToClipSpaceMatrix, sizeof(objectSpaceToClipSpaceMatrix));
-              }
-              else
-              {
-                // Set legacy uniforms
-                RERHI::Command::SetUniform::createMatrix4fv(commandBuffer, *mGraphicsProgram, mObjectSpaceToClipSpaceMatrixUniformHandle, &objectSpaceToClipSpaceMatrix[0][0]);
-              }
-            }
-            RERHI::RHITexture2D *tex = reinterpret_cast<RERHI::RHITexture2D *>(pcmd->TextureId);
-
-            //RERHI::Command::SetGraphicsRootSignature::create(commandBuffer, mRootSignature);
-
-            // Set the used graphics pipeline state object (PSO)
-            //RERHI::Command::SetGraphicsPipelineState::create(commandBuffer, mGraphicsPipelineState);
-
-            // Set graphics resource groups
-            RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 0, this->getResourceGroupByTexture(tex));
-            RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 1, mSamplerStateGroup);
-            //RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 0, tex);
-          } else {
-
-            //RERHI::Command::SetGraphicsRootSignature::create(commandBuffer, mRootSignature);
-
-            // Set the used graphics pipeline state object (PSO)
-            //RERHI::Command::SetGraphicsPipelineState::create(commandBuffer, mGraphicsPipelineState);
-
-            // Set graphics resource groups
-            RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 0, this->getResourceGroupByTexture(mDefaultFontTexture));
-            RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 1, mSamplerStateGroup);
+          const ImDrawCmd& nextCmd = imDrawList->CmdBuffer[commandIndex + 1];
+          if (nullptr != nextCmd.UserCallback || nextCmd.TextureId != pcmd->TextureId || nextCmd.VtxOffset != pcmd->VtxOffset ||
+              nextCmd.IdxOffset != pcmd->IdxOffset + numberOfIndices || 0 != memcmp(&nextCmd.ClipRect, &pcmd->ClipRect, sizeof(ImVec4)))
+          {
+            break;
           }
+          numberOfIndices += nextCmd.ElemCount;
+          ++commandIndex;
+        }
 
-          // Set graphics scissor rectangle
-          RERHI::Command::SetGraphicsScissorRectangles::create(commandBuffer, static_cast<long>(pcmd->ClipRect.x), static_cast<long>(pcmd->ClipRect.y), static_cast<long>(pcmd->ClipRect.z), static_cast<long>(pcmd->ClipRect.w));
+        // Set graphics resource groups
+        RERHI::RHITexture2D* tex = (nullptr != pcmd->TextureId) ? reinterpret_cast<RERHI::RHITexture2D*>(pcmd->TextureId) : mDefaultFontTexture.GetPointer();
+        if (tex != currentTexture)
+        {
+          RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 0, this->getResourceGroupByTexture(tex));
+          currentTexture = tex;
+        }
+        if (!samplerStateGroupSet)
+        {
+          RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 1, mSamplerStateGroup);
+          samplerStateGroupSet = true;
+        }
 
-          // Draw graphics
-          RERHI::Command::DrawIndexedGraphics::create(commandBuffer, static_cast<RECore::uint32>(pcmd->ElemCount), 1, static_cast<RECore::uint32>(indexOffset), static_cast<RECore::int32>(vertexOffset));
+        // Set graphics scissor rectangle
+        if (nullptr == currentClipRect || 0 != memcmp(currentClipRect, &pcmd->ClipRect, sizeof(ImVec4)))
+        {
+          RERHI::Command::SetGraphicsScissorRectangles::create(commandBuffer, static_cast<long>(pcmd->ClipRect.x), static_cast<long>(pcmd->ClipRect.y), static_cast<long>(pcmd->ClipRect.z), static_cast<long>(pcmd->ClipRect.w));
+          currentClipRect = &pcmd->ClipRect;
         }
-        indexOffset += pcmd->ElemCount;
+
+        // Draw graphics
+        RERHI::Command::DrawIndexedGraphics::create(commandBuffer, numberOfIndices, 1, drawListRange.indexOffset + pcmd->IdxOffset, static_cast<RECore::int32>(drawListRange.vertexOffset + pcmd->VtxOffset));
       }
-      vertexOffset += imDrawList->VtxBuffer.size();
     }
   }
 }
@@ -560,39 +530,6 @@ void GuiRenderer::fillGraphicsCommandBufferUsingFixedBuildInRhiConfiguration(RER
       createFixedBuildInRhiConfigurationResources();
     }
 
-    { // Setup orthographic projection matrix into our vertex shader uniform buffer
-      const ImVec2& displaySize = ImGui::GetIO().DisplaySize;
-      ImVec2 texelOffset(0.0f, 0.0f);
-      if (mRenderer->getRhi().getNameId() == RERHI::NameId::DIRECT3D9)
-      {
-        // Take care of the Direct3D 9 half-pixel/half-texel offset
-        // -> See "Directly Mapping Texels to Pixels (Direct3D 9)" at https://docs.microsoft.com/en-gb/windows/win32/direct3d9/directly-mapping-texels-to-pixels?redirectedfrom=MSDN
-        texelOffset.x += 0.5f;
-        texelOffset.y += 0.5f;
-      }
-      const float l = texelOffset.x;
-      const float r = displaySize.x + texelOffset.x;
-      const float t = texelOffset.y;
-      const float b = displaySize.y + texelOffset.y;
-      const float objectSpaceToClipSpaceMatrix[4][4] =
-        {
-          { 2.0f / (r - l),	 0.0f,        0.0f, 0.0f },
-          { 0.0f,				 2.0f/(t-b),  0.0f, 0.0f },
-          { 0.0f,				 0.0f,        0.5f, 0.0f },
-          { (r + l) / (l - r), (t+b)/(b-t), 0.5f, 1.0f }
-        };
-      if (nullptr != mVertexShaderUniformBuffer)
-      {
-        // Copy data into the uniform buffer
-        RERHI::Command::CopyUniformBufferData::create(commandBuffer, *mVertexShaderUniformBuffer, objectSpaceToClipSpaceMatrix, sizeof(objectSpaceToClipSpaceMatrix));
-      }
-      else
-      {
-        // Set legacy uniforms
-        RERHI::Command::SetUniform::createMatrix4fv(commandBuffer, *mGraphicsProgram, mObjectSpaceToClipSpaceMatrixUniformHandle, &objectSpaceToClipSpaceMatrix[0][0]);
-      }
-    }
-
     { // RHI configuration
       // Set the used graphics root signature
       RERHI::Command::SetGraphicsRootSignature::create(commandBuffer, mRootSignature);
@@ -635,6 +572,189 @@ void GuiRenderer::registerTexture(RERHI::RHITexture2D *texture) {
   }
 }
 
+void GuiRenderer::uploadDrawData(const ImDrawData& imDrawData) {
+  RE_MEMORY_TAG_SCOPE("Gui")
+  ++mFrame;
+  mFrameDrawListRanges.clear();
+  mChangedDrawListRanges.clear();
+
+  // Find out which draw lists changed since they were uploaded the last time
+  RECore::uint32 numberOfChangedVertices = 0;
+  RECore::uint32 numberOfChangedIndices = 0;
+  for (int i = 0; i < imDrawData.CmdListsCount; ++i)
+  {
+    const ImDrawList* imDrawList = imDrawData.CmdLists[i];
+    const RECore::uint32 numberOfVertices = static_cast<RECore::uint32>(imDrawList->VtxBuffer.size());
+    const RECore::uint32 numberOfIndices = static_cast<RECore::uint32>(imDrawList->IdxBuffer.size());
+    const RECore::uint64 hash = ::detail::calculateDrawListHash(*imDrawList);
+    auto [iterator, inserted] = mDrawListRanges.try_emplace(imDrawList, DrawListRange{0, 0, 0, 0, 0, 0});
+    DrawListRange& drawListRange = iterator->second;
+    if (inserted || drawListRange.hash != hash || drawListRange.numberOfVertices != numberOfVertices || drawListRange.numberOfIndices != numberOfIndices)
+    {
+      drawListRange.hash = hash;
+      drawListRange.numberOfVertices = numberOfVertices;
+      drawListRange.numberOfIndices = numberOfIndices;
+      mChangedDrawListRanges.emplace_back(imDrawList, &drawListRange);
+      numberOfChangedVertices += numberOfVertices;
+      numberOfChangedIndices += numberOfIndices;
+    }
+    drawListRange.frame = mFrame;
+    mFrameDrawListRanges.push_back(&drawListRange);
+  }
+
+  // Forget about draw lists which are gone, e.g. of closed windows
+  if (mDrawListRanges.size() > static_cast<size_t>(imDrawData.CmdListsCount))
+  {
+    for (auto iterator = mDrawListRanges.begin(); iterator != mDrawListRanges.end(); )
+    {
+      iterator = (iterator->second.frame != mFrame) ? mDrawListRanges.erase(iterator) : std::next(iterator);
+    }
+  }
+
+  // Nothing changed? Then the buffers already contain everything we need.
+  if (mChangedDrawListRanges.empty() && nullptr != mVertexArray)
+  {
+    return;
+  }
+
+  // Append the changed draw lists behind the used part of the buffers, if there's no space left we have to discard
+  // the buffers and pack all draw lists again
+  const bool repack = (nullptr == mVertexArray ||
+                       mNumberOfUsedVertices + numberOfChangedVertices > mNumberOfAllocatedVertices ||
+                       mNumberOfUsedIndices + numberOfChangedIndices > mNumberOfAllocatedIndices);
+
+  // The RHI might be used by the render thread at the same time
+  // -> Appending is fine while submitted frames are in flight, they never reference the part behind the used vertices and indices
+  // -> A repack discards the buffer content submitted frames which haven't been dispatched yet might still reference, so wait for them
+  const RERenderer::RenderThread::RhiLock rhiLock = mRenderer->getRenderThread().lockRhi(repack);
+  if (repack)
+  {
+    // Grow the buffers geometrically, after a repack at least half of the buffers is left for appending
+    const RECore::uint32 totalNumberOfVertices = static_cast<RECore::uint32>(imDrawData.TotalVtxCount);
+    const RECore::uint32 totalNumberOfIndices = static_cast<RECore::uint32>(imDrawData.TotalIdxCount);
+    RERHI::RHIBufferManager& bufferManager = mRenderer->getBufferManager();
+    if (nullptr == mVertexBuffer || mNumberOfAllocatedVertices < totalNumberOfVertices * 2)
+    {
+      mNumberOfAllocatedVertices = std::max(mNumberOfAllocatedVertices, ::detail::MINIMUM_NUMBER_OF_VERTICES);
+      while (mNumberOfAllocatedVertices < totalNumberOfVertices * 2)
+      {
+        mNumberOfAllocatedVertices *= 2;
+      }
+      mVertexBuffer = bufferManager.createVertexBuffer(mNumberOfAllocatedVertices * sizeof(ImDrawVert), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+      mVertexArray = nullptr;
+    }
+    if (nullptr == mIndexBuffer || mNumberOfAllocatedIndices < totalNumberOfIndices * 2)
+    {
+      mNumberOfAllocatedIndices = std::max(mNumberOfAllocatedIndices, ::detail::MINIMUM_NUMBER_OF_INDICES);
+      while (mNumberOfAllocatedIndices < totalNumberOfIndices * 2)
+      {
+        mNumberOfAllocatedIndices *= 2;
+      }
+      mIndexBuffer = bufferManager.createIndexBuffer(mNumberOfAllocatedIndices * sizeof(ImDrawIdx), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+      mVertexArray = nullptr;
+    }
+    if (nullptr == mVertexArray)
+    {
+      RHI_ASSERT(nullptr != mVertexBuffer, "Invalid vertex buffer")
+      RHI_ASSERT(nullptr != mIndexBuffer, "Invalid index buffer")
+
+      // Create vertex array object (VAO)
+      const RERHI::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { mVertexBuffer };
+      mVertexArray = bufferManager.createVertexArray(::detail::VertexAttributes, static_cast<RECore::uint32>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, mIndexBuffer RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+    }
+
+    // All draw lists have to be written again
+    mChangedDrawListRanges.clear();
+    for (int i = 0; i < imDrawData.CmdListsCount; ++i)
+    {
+      mChangedDrawListRanges.emplace_back(imDrawData.CmdLists[i], mFrameDrawListRanges[static_cast<size_t>(i)]);
+    }
+    mNumberOfUsedVertices = 0;
+    mNumberOfUsedIndices = 0;
+  }
+
+  { // Copy the vertices and indices of the changed draw lists
+    // -> "RERHI::MapType::WRITE_NO_OVERWRITE" is fine since the GPU never references the part behind the used vertices and indices
+    const RERHI::MapType mapType = repack ? RERHI::MapType::WRITE_DISCARD : RERHI::MapType::WRITE_NO_OVERWRITE;
+    RERHI::RHIDynamicRHI& rhi = mRenderer->getRhi();
+    bool uploaded = false;
+    RERHI::MappedSubresource vertexBufferMappedSubresource;
+    if (rhi.map(*mVertexBuffer, 0, mapType, 0, vertexBufferMappedSubresource))
+    {
+      RERHI::MappedSubresource indexBufferMappedSubresource;
+      if (rhi.map(*mIndexBuffer, 0, mapType, 0, indexBufferMappedSubresource))
+      {
+        ImDrawVert* imDrawVert = static_cast<ImDrawVert*>(vertexBufferMappedSubresource.data);
+        ImDrawIdx* imDrawIdx = static_cast<ImDrawIdx*>(indexBufferMappedSubresource.data);
+        for (auto& [imDrawList, drawListRange] : mChangedDrawListRanges)
+        {
+          drawListRange->vertexOffset = mNumberOfUsedVertices;
+          drawListRange->indexOffset = mNumberOfUsedIndices;
+          if (drawListRange->numberOfVertices > 0)
+          {
+            memcpy(imDrawVert + mNumberOfUsedVertices, imDrawList->VtxBuffer.Data, drawListRange->numberOfVertices * sizeof(ImDrawVert));
+          }
+          if (drawListRange->numberOfIndices > 0)
+          {
+            memcpy(imDrawIdx + mNumberOfUsedIndices, imDrawList->IdxBuffer.Data, drawListRange->numberOfIndices * sizeof(ImDrawIdx));
+          }
+          mNumberOfUsedVertices += drawListRange->numberOfVertices;
+          mNumberOfUsedIndices += drawListRange->numberOfIndices;
+        }
+        uploaded = true;
+
+        // Unmap the index buffer
+        rhi.unmap(*mIndexBuffer, 0);
+      }
+
+      // Unmap the vertex buffer
+      rhi.unmap(*mVertexBuffer, 0);
+    }
+
+    // In case of a failed upload, don't draw anything this frame and pack everything again the next one
+    if (!uploaded)
+    {
+      mDrawListRanges.clear();
+      mFrameDrawListRanges.clear();
+      mNumberOfUsedVertices = mNumberOfAllocatedVertices;
+      mNumberOfUsedIndices = mNumberOfAllocatedIndices;
+    }
+  }
+}
+
+void GuiRenderer::fillObjectSpaceToClipSpaceMatrix(RERHI::RHICommandBuffer& commandBuffer) {
+  const ImVec2& displaySize = ImGui::GetIO().DisplaySize;
+  ImVec2 texelOffset(0.0f, 0.0f);
+  if (mRenderer->getRhi().getNameId() == RERHI::NameId::DIRECT3D9)
+  {
+    // Take care of the Direct3D 9 half-pixel/half-texel offset
+    // -> See "Directly Mapping Texels to Pixels (Direct3D 9)" at https://docs.microsoft.com/en-gb/windows/win32/direct3d9/directly-mapping-texels-to-pixels?redirectedfrom=MSDN
+    texelOffset.x += 0.5f;
+    texelOffset.y += 0.5f;
+  }
+  const float l = texelOffset.x;
+  const float r = displaySize.x + texelOffset.x;
+  const float t = texelOffset.y;
+  const float b = displaySize.y + texelOffset.y;
+  const float objectSpaceToClipSpaceMatrix[4][4] =
+    {
+      { 2.0f / (r - l),	 0.0f,        0.0f, 0.0f },
+      { 0.0f,				 2.0f/(t-b),  0.0f, 0.0f },
+      { 0.0f,				 0.0f,        0.5f, 0.0f },
+      { (r + l) / (l - r), (t+b)/(b-t), 0.5f, 1.0f }
+    };
+  if (nullptr != mVertexShaderUniformBuffer)
+  {
+    // Copy data into the uniform buffer
+    RERHI::Command::CopyUniformBufferData::create(commandBuffer, *mVertexShaderUniformBuffer, objectSpaceToClipSpaceMatrix, sizeof(objectSpaceToClipSpaceMatrix));
+  }
+  else
+  {
+    // Set legacy uniforms
+    RERHI::Command::SetUniform::createMatrix4fv(commandBuffer, *mGraphicsProgram, mObjectSpaceToClipSpaceMatrixUniformHandle, &objectSpaceToClipSpaceMatrix[0][0]);
+  }
+}
+
 void GuiRenderer::initializeKeyMap() {
   ImGuiIO& imGuiIo = ImGui::GetIO();
 
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "REGui/Widget/Table/VirtualTable.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace REGui {
+
+
+//[-------------------------------------------------------]
+//[ RTTI interface                                        ]
+//[-------------------------------------------------------]
+re_class_metadata(VirtualTable, "REGui", REGui::Widget, "Application class")
+  // Constructors
+re_class_metadata_end(VirtualTable)
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+VirtualTable::VirtualTable()
+: mNumberOfRows(0)
+, mScrollToRow(NO_ROW)
+, mNumberOfDrawnRows(0)
+, mRowHeight(0.0f)
+, mAutoScroll(false) {
+
+}
+
+VirtualTable::~VirtualTable() {
+
+}
+
+
+void VirtualTable::construct(ConstructionArguments args) {
+  mColumns = args.getColumns();
+  mNumberOfRows = args.getNumberOfRows();
+  mAutoScroll = args.getAutoScroll();
+  mCellCallback = args.getCellCallback();
+}
+
+void VirtualTable::onUpdate(float deltaTime) {
+
+}
+
+void VirtualTable::onDraw() {
+  mNumberOfDrawnRows = 0;
+
+  // Without columns the table is a plain list
+  const int numberOfColumns = mColumns.empty() ? 1 : static_cast<int>(mColumns.size());
+  ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg;
+  if (!mColumns.empty()) {
+    flags |= ImGuiTableFlags_BordersV | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_Resizable;
+  }
+  if (!ImGui::BeginTable(mWidgetId, numberOfColumns, flags)) {
+    return;
+  }
+
+  // Header row stays visible while scrolling
+  if (!mColumns.empty()) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    for (const RECore::String& column : mColumns) {
+      ImGui::TableSetupColumn(column);
+    }
+    ImGui::TableHeadersRow();
+  }
+
+  // Follow the end if the table was scrolled to the end during the last draw, check before rows are emitted
+  const bool followEnd = mAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+
+  // Scrolling to a row is a multiplication as soon as the row height is known, it's measured during the first draw
+  if (NO_ROW != mScrollToRow && mRowHeight > 0.0f) {
+    const RECore::uint32 row = (mScrollToRow < mNumberOfRows) ? mScrollToRow : (mNumberOfRows > 0 ? mNumberOfRows - 1 : 0);
+    ImGui::SetScrollY(static_cast<float>(row) * mRowHeight);
+    mScrollToRow = NO_ROW;
+  }
+
+  // Only emit the rows inside the visible region, the clipper advances the cursor over the others
+  ImGuiListClipper clipper;
+  clipper.Begin(static_cast<int>(mNumberOfRows), (mRowHeight > 0.0f) ? mRowHeight : -1.0f);
+  while (clipper.Step()) {
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+      ImGui::TableNextRow();
+      for (int column = 0; column < numberOfColumns; ++column) {
+        ImGui::TableSetColumnIndex(column);
+        if (mCellCallback) {
+          mCellCallback(static_cast<RECore::uint32>(row), static_cast<RECore::uint32>(column));
+        }
+      }
+    }
+    mNumberOfDrawnRows += static_cast<RECore::uint32>(clipper.DisplayEnd - clipper.DisplayStart);
+  }
+  if (clipper.ItemsHeight > 0.0f) {
+    mRowHeight = clipper.ItemsHeight;
+  }
+  clipper.End();
+
+  if (followEnd) {
+    ImGui::SetScrollHereY(1.0f);
+  }
+
+  ImGui::EndTable();
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // REGui
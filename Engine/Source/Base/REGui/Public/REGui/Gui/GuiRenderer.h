@@ -33,6 +33,7 @@
 #include <RERenderer/Context.h>
 #include <imgui.h>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 
@@ -101,10 +102,43 @@ public:
     }
     return this->mTextures.find(this->mDefaultFontTexture)->second;
   }
+private:
+  /**
+   * @brief
+   *   Location of an uploaded ImGui draw list inside the vertex and index buffer
+   */
+  struct DrawListRange {
+    /** Hash of the vertex and index data, used to detect unchanged draw lists */
+    RECore::uint64 hash;
+    RECore::uint32 vertexOffset;
+    RECore::uint32 numberOfVertices;
+    RECore::uint32 indexOffset;
+    RECore::uint32 numberOfIndices;
+    /** Frame the draw list was last seen in, used to drop draw lists of closed windows */
+    RECore::uint32 frame;
+  };
+
 private:
 
   void createFixedBuildInRhiConfigurationResources();
 
+  /**
+   * @brief
+   *   Upload the vertices and indices of the draw lists which changed since the last frame
+   *
+   * @param[in] imDrawData
+   *   ImGui draw data of the current frame
+   *
+   * @remarks
+   *   Changed draw lists are appended behind the used part of the buffers using "RERHI::MapType::WRITE_NO_OVERWRITE",
+   *   unchanged draw lists keep their location and aren't uploaded at all. Only when the free part of the buffers is
+   *   exhausted, the buffers are discarded and all draw lists are packed again from the start, growing the buffers
+   *   geometrically if required.
+   */
+  void uploadDrawData(const ImDrawData& imDrawData);
+
+  void fillObjectSpaceToClipSpaceMatrix(RERHI::RHICommandBuffer& commandBuffer);
+
   void initializeKeyMap();
 
 protected:
@@ -144,6 +178,16 @@ protected:
   RERHI::RHIIndexBufferPtr mIndexBuffer;
   RECore::uint32 mNumberOfAllocatedIndices;
   RERHI::RHIVertexArrayPtr mVertexArray;
+  /** Number of vertices and indices written since the buffers were discarded the last time */
+  RECore::uint32 mNumberOfUsedVertices;
+  RECore::uint32 mNumberOfUsedIndices;
+  /** Location of every known draw list inside the vertex and index buffer */
+  std::unordered_map<const ImDrawList*, DrawListRange> mDrawListRanges;
+  /** Draw list locations of the current frame in ImGui draw order, parallel to "ImDrawData::CmdLists" */
+  std::vector<DrawListRange*> mFrameDrawListRanges;
+  /** Scratch list of the draw lists which need an upload in the current frame */
+  std::vector<std::pair<const ImDrawList*, DrawListRange*>> mChangedDrawListRanges;
+  RECore::uint32 mFrame;
 
 
   RECore::uint64 mTime;
@@ -92,6 +92,17 @@ public:
    */
   void construct(ConstructionArguments args);
 
+  /**
+   * @brief
+   * Get the current value.
+   *
+   * @return
+   * True if the checkbox is checked.
+   */
+  [[nodiscard]] inline bool getValue() const {
+    return mValue;
+  }
+
 public:
 
   /**
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "REGui/REGui.h"
+#include "REGui/Widget/Widget.h"
+#include <functional>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace REGui {
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Gui;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+ * @class
+ * VirtualTable
+ *
+ * @brief
+ * Table which only draws its visible rows.
+ *
+ * @remarks
+ * The table doesn't own any row data or child widgets, instead the cell callback is called for the cells
+ * of the rows currently inside the visible scroll region and is expected to emit the ImGui items of the cell.
+ * All rows must have the same height, this way the visible row range, scrolling to a row and appending rows
+ * are independent of the number of rows. Without columns the table is drawn as a plain list without header.
+ */
+class VirtualTable : public Widget {
+
+  //[-------------------------------------------------------]
+  //[ RTTI interface                                        ]
+  //[-------------------------------------------------------]
+  re_class_def(REGUI_API)
+  re_class_def_end
+
+public:
+
+  /** Called as "callback(row, column)" for each visible cell */
+  typedef std::function<void(RECore::uint32, RECore::uint32)> CellCallback;
+
+
+  regui_begin_construction_args(VirtualTable)
+    : mValueNumberOfRows(0)
+    , mValueAutoScroll(false) {}
+    regui_value(std::vector<RECore::String>, Columns)
+    regui_value(RECore::uint32, NumberOfRows)
+    regui_value(bool, AutoScroll)
+    regui_value(CellCallback, CellCallback)
+  regui_end_construction_args()
+
+public:
+
+  /**
+   * @brief
+   * Default constructor.
+   */
+  VirtualTable();
+
+  /**
+   * @brief
+   * Destructor.
+   */
+  ~VirtualTable() override;
+
+
+  /**
+   * @brief
+   * Construct this widget.
+   *
+   * @param[in] args
+   * The declaration data for this widget.
+   */
+  void construct(ConstructionArguments args);
+
+public:
+
+  /**
+   * @brief
+   * Get the number of rows.
+   *
+   * @return
+   * Number of rows.
+   */
+  [[nodiscard]] inline RECore::uint32 getNumberOfRows() const {
+    return mNumberOfRows;
+  }
+
+  /**
+   * @brief
+   * Set the number of rows, the data source has to provide the cells of all these rows.
+   *
+   * @param[in] numberOfRows
+   * Number of rows.
+   */
+  inline void setNumberOfRows(RECore::uint32 numberOfRows) {
+    mNumberOfRows = numberOfRows;
+  }
+
+  /**
+   * @brief
+   * Append rows at the end, when auto scroll is enabled and the table was scrolled to the end it keeps
+   * following the end.
+   *
+   * @param[in] numberOfRows
+   * Number of rows to append.
+   */
+  inline void appendRows(RECore::uint32 numberOfRows) {
+    mNumberOfRows += numberOfRows;
+  }
+
+  /**
+   * @brief
+   * Scroll the given row to the top of the visible region during the next draw.
+   *
+   * @param[in] row
+   * Row index, clamped to the number of rows.
+   */
+  inline void scrollToRow(RECore::uint32 row) {
+    mScrollToRow = row;
+  }
+
+  /**
+   * @brief
+   * Set the cell callback.
+   *
+   * @param[in] cellCallback
+   * Called as "callback(row, column)" for each visible cell.
+   */
+  inline void setCellCallback(const CellCallback& cellCallback) {
+    mCellCallback = cellCallback;
+  }
+
+  /**
+   * @brief
+   * Get the number of rows drawn during the last draw, useful to verify the per frame costs.
+   *
+   * @return
+   * Number of drawn rows.
+   */
+  [[nodiscard]] inline RECore::uint32 getNumberOfDrawnRows() const {
+    return mNumberOfDrawnRows;
+  }
+
+public:
+
+  /**
+   * @brief
+   * Called when the widget is updated.
+   *
+   * @param[in] deltaTime
+   * The time between the this and the last update in seconds.
+   */
+  void onUpdate(float deltaTime) override;
+
+  /**
+   * @brief
+   * Called in the drawing process.
+   */
+  void onDraw() override;
+
+protected:
+
+  static constexpr RECore::uint32 NO_ROW = ~0u;
+
+  std::vector<RECore::String> mColumns;
+  CellCallback mCellCallback;
+  RECore::uint32 mNumberOfRows;
+  /** Row to scroll to during the next draw, "NO_ROW" if there's none */
+  RECore::uint32 mScrollToRow;
+  RECore::uint32 mNumberOfDrawnRows;
+  /** Row height measured during the last draw, 0 if not known yet */
+  float mRowHeight;
+  bool mAutoScroll;
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // REGui
@@ -280,7 +280,7 @@ private:
  * where the freshly created instance should be assigned to.
  */
 #define gui_assign(VAR, TYPE, ...) \
-  REGui::MakeDecl<TYPE>(VAR = new TYPE(__VA_ARGS__), REGui::RequiredArgs::makeRequiredArgs()) <<= TYPE::ConstructionArguments()
+  REGui::MakeDecl<TYPE>(VAR = new TYPE(__VA_ARGS__), REGui::RequiredArgs<__VA_ARGS__>::makeRequiredArgs()) <<= TYPE::ConstructionArguments()
 
 
 //[-------------------------------------------------------]
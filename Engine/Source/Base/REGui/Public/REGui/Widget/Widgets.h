@@ -83,6 +83,7 @@
 #include "REGui/Widget/Slider/FloatSlider.h"
 // Table
 #include "REGui/Widget/Table/Table.h"
+#include "REGui/Widget/Table/VirtualTable.h"
 // TabBar
 #include "REGui/Widget/Tab/TabBar.h"
 #include "REGui/Widget/Tab/TabItem.h"
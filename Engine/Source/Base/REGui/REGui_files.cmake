@@ -104,6 +104,7 @@ set(FILES
   Private/Widget/Tab/TabItem.cpp
   # Widget/Table
   Private/Widget/Table/Table.cpp
+  Private/Widget/Table/VirtualTable.cpp
   # Widget/Text
   Private/Widget/Text/Text.cpp
   Private/Widget/Text/ClickableText.cpp
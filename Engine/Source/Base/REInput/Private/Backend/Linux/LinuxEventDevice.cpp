@@ -22,6 +22,48 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "REInput/Backend/Linux/LinuxEventDevice.h"
+#include "REInput/Backend/Linux/LinuxEventReader.h"
+#include "REInput/Input/Control/Axis.h"
+#include "REInput/Input/Control/Button.h"
+#include "REInput/Input/Devices/Device.h"
+#include <sys/ioctl.h>
+#include <time.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace {
+namespace detail {
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+[[nodiscard]] inline bool isBitSet(const unsigned long *pBits, unsigned int nBit)
+{
+  static constexpr unsigned int BITS_PER_LONG = sizeof(unsigned long) * 8;
+  return ((pBits[nBit / BITS_PER_LONG] >> (nBit % BITS_PER_LONG)) & 1) != 0;
+}
+
+[[nodiscard]] REInput::Axis *getAxis(REInput::Device &cDevice, const char *szName)
+{
+  REInput::Control *pControl = cDevice.getControl(szName);
+  return (nullptr != pControl && pControl->getControlType() == REInput::ControlType::AXIS) ? static_cast<REInput::Axis*>(pControl) : nullptr;
+}
+
+[[nodiscard]] REInput::Button *getButton(REInput::Device &cDevice, const std::string &sName)
+{
+  REInput::Control *pControl = cDevice.getControl(sName);
+  return (nullptr != pControl && pControl->getControlType() == REInput::ControlType::BUTTON) ? static_cast<REInput::Button*>(pControl) : nullptr;
+}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -31,8 +73,199 @@ namespace REInput {
 
 
 //[-------------------------------------------------------]
-//[ Classes                                               ]
+//[ Public static functions                               ]
+//[-------------------------------------------------------]
+bool LinuxEventDevice::hasEventCode(int nFile, RECore::uint16 nType, RECore::uint16 nCode)
+{
+  unsigned long nBits[KEY_CNT / (sizeof(unsigned long) * 8) + 1] = {};
+  return (ioctl(nFile, EVIOCGBIT(nType, sizeof(nBits)), nBits) >= 0 && ::detail::isBitSet(nBits, nCode));
+}
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+LinuxEventDevice::LinuxEventDevice(LinuxEventReader &cReader, int nFile) :
+  m_cReader(cReader),
+  m_nFile(nFile),
+  m_nDeviceID(0),
+  m_nBusType(0),
+  m_nVendor(0),
+  m_nProduct(0),
+  m_nVersion(0),
+  m_nTimestamp(0),
+  m_bControlsResolved(false),
+  m_bDropped(false)
+{
+  // Destroy device implementation automatically, the file itself is closed by the event reader
+  m_bDelete = true;
+
+  // Get device info
+  input_id sDeviceInfo;
+  if (!ioctl(m_nFile, EVIOCGID, &sDeviceInfo)) {
+    // Save device info
+    m_nBusType = sDeviceInfo.bustype;
+    m_nVendor  = sDeviceInfo.vendor;
+    m_nProduct = sDeviceInfo.product;
+    m_nVersion = sDeviceInfo.version;
+  }
+
+  // Timestamp events with the monotonic clock instead of the wall clock which can jump
+  int nClockID = CLOCK_MONOTONIC;
+  ioctl(m_nFile, EVIOCSCLOCKID, &nClockID);
+
+  // Get the ranges of the absolute axes once instead of per event
+  for (int i=0; i<ABS_CNT; i++) {
+    input_absinfo sAbsInfo;
+    if (!ioctl(m_nFile, EVIOCGABS(i), &sAbsInfo) && sAbsInfo.maximum > sAbsInfo.minimum) {
+      m_nAbsMinimum[i] = sAbsInfo.minimum;
+      m_nAbsMaximum[i] = sAbsInfo.maximum;
+    } else {
+      m_nAbsMinimum[i] = -32768;
+      m_nAbsMaximum[i] =  32767;
+    }
+  }
+  memset(m_pAbsAxes, 0, sizeof(m_pAbsAxes));
+  memset(m_pRelAxes, 0, sizeof(m_pRelAxes));
+  memset(m_fRelValues, 0, sizeof(m_fRelValues));
+  memset(m_pButtons, 0, sizeof(m_pButtons));
+
+  // Start reading
+  m_nDeviceID = m_cReader.addDevice(*this, m_nFile);
+}
+
+LinuxEventDevice::~LinuxEventDevice()
+{
+  // Stop reading, this also closes the file
+  m_cReader.removeDevice(m_nDeviceID);
+}
+
+void LinuxEventDevice::processEvent(const LinuxEvent &sEvent)
+{
+  // Check if input device is valid
+  if (!m_pDevice)
+    return;
+  if (!m_bControlsResolved)
+    resolveControls();
+  m_nTimestamp = sEvent.nTimestamp;
+
+  // After the kernel dropped events, ignore everything up to and including the next SYN_REPORT and then re-read the state
+  if (EV_SYN == sEvent.nType) {
+    if (SYN_DROPPED == sEvent.nCode) {
+      m_bDropped = true;
+    } else if (SYN_REPORT == sEvent.nCode && m_bDropped) {
+      m_bDropped = false;
+      synchronizeState();
+    }
+    return;
+  }
+  if (m_bDropped)
+    return;
+
+  // Set control value
+  if (EV_KEY == sEvent.nType && sEvent.nCode < KEY_CNT) {
+    // Button, a value of 2 is an auto repeat which doesn't change the state
+    Button *pButton = m_pButtons[sEvent.nCode];
+    if (pButton && 2 != sEvent.nValue)
+      pButton->setPressed(sEvent.nValue != 0);
+  } else if (EV_ABS == sEvent.nType && sEvent.nCode < ABS_CNT) {
+    // Absolute axis
+    setAbsoluteAxisValue(sEvent.nCode, sEvent.nValue);
+  } else if (EV_REL == sEvent.nType && sEvent.nCode < REL_CNT) {
+    // Relative axis, accumulate until the next update()
+    m_fRelValues[sEvent.nCode] += static_cast<float>(sEvent.nValue);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual UpdateDevice functions                 ]
 //[-------------------------------------------------------]
+void LinuxEventDevice::update()
+{
+  // Apply the relative movement of this frame, like the X11 mouse a relative axis is reset to 0 when there was no movement
+  for (int i=0; i<REL_CNT; i++) {
+    Axis *pAxis = m_pRelAxes[i];
+    if (pAxis) {
+      if (pAxis->getValue() != m_fRelValues[i])
+        pAxis->setValue(m_fRelValues[i], true);
+      m_fRelValues[i] = 0.0f;
+    }
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+void LinuxEventDevice::resolveControls()
+{
+  m_bControlsResolved = true;
+
+  // Axes
+  m_pRelAxes[REL_X]		= ::detail::getAxis(*m_pDevice, "X");
+  m_pRelAxes[REL_Y]		= ::detail::getAxis(*m_pDevice, "Y");
+  m_pRelAxes[REL_WHEEL]	= ::detail::getAxis(*m_pDevice, "Wheel");
+  m_pAbsAxes[ABS_X]		= ::detail::getAxis(*m_pDevice, "X");
+  m_pAbsAxes[ABS_Y]		= ::detail::getAxis(*m_pDevice, "Y");
+  m_pAbsAxes[ABS_Z]		= ::detail::getAxis(*m_pDevice, "Z");
+  m_pAbsAxes[ABS_RX]		= ::detail::getAxis(*m_pDevice, "RX");
+  m_pAbsAxes[ABS_RY]		= ::detail::getAxis(*m_pDevice, "RY");
+  m_pAbsAxes[ABS_RZ]		= ::detail::getAxis(*m_pDevice, "RZ");
+  m_pAbsAxes[ABS_HAT0X]	= ::detail::getAxis(*m_pDevice, "Hat");
+
+  // Buttons
+  m_pButtons[BTN_LEFT]	= ::detail::getButton(*m_pDevice, "Left");
+  m_pButtons[BTN_RIGHT]	= ::detail::getButton(*m_pDevice, "Right");
+  m_pButtons[BTN_MIDDLE]	= ::detail::getButton(*m_pDevice, "Middle");
+  for (int i=BTN_JOYSTICK; i<BTN_GAMEPAD; i++)
+    m_pButtons[i] = ::detail::getButton(*m_pDevice, std::string("Button") + std::to_string(i - BTN_JOYSTICK));
+  for (int i=BTN_GAMEPAD; i<BTN_DIGI; i++)
+    m_pButtons[i] = ::detail::getButton(*m_pDevice, std::string("Button") + std::to_string(i - BTN_GAMEPAD));
+}
+
+void LinuxEventDevice::setAbsoluteAxisValue(RECore::uint16 nCode, int nValue)
+{
+  // Get value in a range of -1.0 - +1.0
+  Axis *pAxis = m_pAbsAxes[nCode];
+  if (pAxis) {
+    const int nMinimum = m_nAbsMinimum[nCode];
+    const int nMaximum = m_nAbsMaximum[nCode];
+    float fValue = (static_cast<float>(nValue - nMinimum) / static_cast<float>(nMaximum - nMinimum)) * 2.0f - 1.0f;
+    if (fValue >  1.0f)
+      fValue =  1.0f;
+    if (fValue < -1.0f)
+      fValue = -1.0f;
+    pAxis->setValue(fValue, false);
+  }
+}
+
+void LinuxEventDevice::synchronizeState()
+{
+  // Recorded event streams have no state which could be queried, the ioctl-calls fail in this case
+
+  // Buttons
+  unsigned long nBits[KEY_CNT / (sizeof(unsigned long) * 8) + 1] = {};
+  if (ioctl(m_nFile, EVIOCGKEY(sizeof(nBits)), nBits) >= 0) {
+    for (unsigned int i=0; i<KEY_CNT; i++) {
+      Button *pButton = m_pButtons[i];
+      if (pButton) {
+        const bool bPressed = ::detail::isBitSet(nBits, i);
+        if (pButton->isPressed() != bPressed)
+          pButton->setPressed(bPressed);
+      }
+    }
+  }
+
+  // Absolute axes
+  for (RECore::uint16 i=0; i<ABS_CNT; i++) {
+    if (m_pAbsAxes[i]) {
+      input_absinfo sAbsInfo = {};
+      if (!ioctl(m_nFile, EVIOCGABS(i), &sAbsInfo))
+        setAbsoluteAxisValue(i, sAbsInfo.value);
+    }
+  }
+}
 
 
 //[-------------------------------------------------------]
@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "REInput/Backend/Linux/LinuxEventReader.h"
+#include "REInput/Backend/Linux/LinuxEventDevice.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <linux/input.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace {
+namespace detail {
+
+
+//[-------------------------------------------------------]
+//[ Global definitions                                    ]
+//[-------------------------------------------------------]
+static constexpr RECore::uint64 WAKE_UP_ID					  = ~static_cast<RECore::uint64>(0);	///< epoll user data of the wake up eventfd
+static constexpr int			MAXIMUM_NUMBER_OF_READ_EVENTS = 64;								///< Maximum number of events read per read()-call
+static constexpr int			REPLAY_TIMEOUT				  = 1;								///< epoll timeout in milliseconds while replaying recorded streams
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+[[nodiscard]] inline RECore::uint64 getTimestamp(const input_event &sEvent)
+{
+  // Newer kernel headers hide the timeval behind accessor macros to be year 2038 safe on 32 bit systems
+  #ifdef input_event_sec
+    return static_cast<RECore::uint64>(sEvent.input_event_sec) * 1000000 + static_cast<RECore::uint64>(sEvent.input_event_usec);
+  #else
+    return static_cast<RECore::uint64>(sEvent.time.tv_sec) * 1000000 + static_cast<RECore::uint64>(sEvent.time.tv_usec);
+  #endif
+}
+
+[[nodiscard]] inline RECore::uint64 getCurrentTimestamp()
+{
+  // Same clock the event devices select via "EVIOCSCLOCKID"
+  timespec sTime = {};
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+  return static_cast<RECore::uint64>(sTime.tv_sec) * 1000000 + static_cast<RECore::uint64>(sTime.tv_nsec) / 1000;
+}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace REInput {
+
+
+//[-------------------------------------------------------]
+//[ Public functions                                      ]
+//[-------------------------------------------------------]
+LinuxEventReader::LinuxEventReader() :
+  m_bShutdown(false),
+  m_nNumberOfReplays(0),
+  m_nNumberOfDroppedEvents(0),
+  m_nEpoll(epoll_create1(EPOLL_CLOEXEC)),
+  m_nWakeUp(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+  m_nNextDeviceID(0)
+{
+  // Register the wake up eventfd
+  epoll_event sEpollEvent = {};
+  sEpollEvent.events   = EPOLLIN;
+  sEpollEvent.data.u64 = ::detail::WAKE_UP_ID;
+  epoll_ctl(m_nEpoll, EPOLL_CTL_ADD, m_nWakeUp, &sEpollEvent);
+
+  // Start the reader thread
+  m_cThread = std::thread(&LinuxEventReader::threadFunction, this);
+}
+
+LinuxEventReader::~LinuxEventReader()
+{
+  // Stop the reader thread
+  m_bShutdown.store(true, std::memory_order_release);
+  const RECore::uint64 nValue = 1;
+  [[maybe_unused]] const ssize_t nResult = write(m_nWakeUp, &nValue, sizeof(nValue));
+  m_cThread.join();
+
+  // Close all files, including the ones of not yet executed add commands
+  executeCommands();
+  for (const Source &sSource : m_lstSources)
+    close(sSource.nFile);
+  m_lstSources.clear();
+  close(m_nWakeUp);
+  close(m_nEpoll);
+}
+
+RECore::uint32 LinuxEventReader::addDevice(LinuxEventDevice &cDevice, int nFile)
+{
+  const RECore::uint32 nDeviceID = m_nNextDeviceID++;
+  m_mapDevices.emplace(nDeviceID, &cDevice);
+
+  // Regular files are replayed, the counter is decremented by the reader thread as soon as the end of the file has been reached
+  struct stat sStat;
+  if (!fstat(nFile, &sStat) && S_ISREG(sStat.st_mode))
+    m_nNumberOfReplays.fetch_add(1, std::memory_order_acq_rel);
+
+  postCommand({ true, nFile, nDeviceID });
+  return nDeviceID;
+}
+
+void LinuxEventReader::removeDevice(RECore::uint32 nDeviceID)
+{
+  m_mapDevices.erase(nDeviceID);
+  postCommand({ false, -1, nDeviceID });
+}
+
+RECore::uint32 LinuxEventReader::dispatchEvents()
+{
+  // Consecutive events usually belong to the same device, so cache the last lookup
+  RECore::uint32 nLastDeviceID = ~0u;
+  LinuxEventDevice *pLastDevice = nullptr;
+  return m_cQueue.consume([this, &nLastDeviceID, &pLastDevice](const LinuxEvent &sEvent) {
+    if (sEvent.nDeviceID != nLastDeviceID) {
+      DeviceMap::const_iterator iterator = m_mapDevices.find(sEvent.nDeviceID);
+      nLastDeviceID = sEvent.nDeviceID;
+      pLastDevice = (m_mapDevices.cend() != iterator) ? iterator->second : nullptr;
+    }
+
+    // Events of removed devices are discarded
+    if (pLastDevice)
+      pLastDevice->processEvent(sEvent);
+  });
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+void LinuxEventReader::postCommand(const Command &sCommand)
+{
+  {
+    std::lock_guard<std::mutex> mutexLock(m_cCommandMutex);
+    m_lstCommands.push_back(sCommand);
+  }
+
+  // Wake up the reader thread
+  const RECore::uint64 nValue = 1;
+  [[maybe_unused]] const ssize_t nResult = write(m_nWakeUp, &nValue, sizeof(nValue));
+}
+
+void LinuxEventReader::threadFunction()
+{
+  epoll_event sEpollEvents[16];
+  while (!m_bShutdown.load(std::memory_order_acquire)) {
+    // Tell devices which lost events as soon as the queue has room again, even if they don't produce new input
+    bool bResynchronize = false;
+    for (Source &sSource : m_lstSources) {
+      if (sSource.bResynchronize && sSource.bActive && !pushResynchronize(sSource))
+        bResynchronize = true;
+    }
+    m_cQueue.commit();
+
+    // Sleep until there's input, while replaying recorded streams or waiting for room to resynchronize poll in short intervals so the consumer can catch up
+    const int nTimeout = (bResynchronize || m_nNumberOfReplays.load(std::memory_order_acquire) > 0) ? ::detail::REPLAY_TIMEOUT : -1;
+    const int nNumberOfEpollEvents = epoll_wait(m_nEpoll, sEpollEvents, 16, nTimeout);
+
+    // Read the devices first, executing a remove command closes the file
+    bool bWakeUp = false;
+    for (int i=0; i<nNumberOfEpollEvents; i++) {
+      if (sEpollEvents[i].data.u64 == ::detail::WAKE_UP_ID) {
+        bWakeUp = true;
+      } else {
+        Source &sSource = m_lstSources[static_cast<size_t>(sEpollEvents[i].data.u64)];
+        if (sSource.bActive)
+          readSource(sSource);
+      }
+    }
+
+    // Replay recorded streams
+    for (Source &sSource : m_lstSources) {
+      if (sSource.bReplay && sSource.bActive)
+        readSource(sSource);
+    }
+
+    // Execute the commands of the main thread
+    if (bWakeUp) {
+      RECore::uint64 nValue = 0;
+      [[maybe_unused]] const ssize_t nResult = read(m_nWakeUp, &nValue, sizeof(nValue));
+      executeCommands();
+    }
+  }
+}
+
+void LinuxEventReader::executeCommands()
+{
+  Commands lstCommands;
+  {
+    std::lock_guard<std::mutex> mutexLock(m_cCommandMutex);
+    lstCommands.swap(m_lstCommands);
+  }
+
+  for (const Command &sCommand : lstCommands) {
+    if (sCommand.bAdd) {
+      // Add source, the epoll user data is the source index
+      struct stat sStat;
+      const bool bReplay = (!fstat(sCommand.nFile, &sStat) && S_ISREG(sStat.st_mode));
+      m_lstSources.push_back({ sCommand.nFile, sCommand.nDeviceID, bReplay, true, false });
+      if (!bReplay) {
+        epoll_event sEpollEvent = {};
+        sEpollEvent.events   = EPOLLIN;
+        sEpollEvent.data.u64 = m_lstSources.size() - 1;
+        epoll_ctl(m_nEpoll, EPOLL_CTL_ADD, sCommand.nFile, &sEpollEvent);
+      }
+    } else {
+      // Remove source
+      for (size_t i=0; i<m_lstSources.size(); i++) {
+        Source &sSource = m_lstSources[i];
+        if (sSource.nDeviceID == sCommand.nDeviceID) {
+          if (sSource.bReplay && sSource.bActive)
+            m_nNumberOfReplays.fetch_sub(1, std::memory_order_acq_rel);
+          if (!sSource.bReplay)
+            epoll_ctl(m_nEpoll, EPOLL_CTL_DEL, sSource.nFile, nullptr);
+          close(sSource.nFile);
+
+          // Move the last source into the free slot and update its epoll user data
+          if (i != m_lstSources.size() - 1) {
+            sSource = m_lstSources.back();
+            if (!sSource.bReplay && sSource.bActive) {
+              epoll_event sEpollEvent = {};
+              sEpollEvent.events   = EPOLLIN;
+              sEpollEvent.data.u64 = i;
+              epoll_ctl(m_nEpoll, EPOLL_CTL_MOD, sSource.nFile, &sEpollEvent);
+            }
+          }
+          m_lstSources.pop_back();
+          break;
+        }
+      }
+    }
+  }
+}
+
+void LinuxEventReader::readSource(Source &sSource)
+{
+  input_event sEvents[::detail::MAXIMUM_NUMBER_OF_READ_EVENTS];
+  for (;;) {
+    // Replayed streams must not lose events, so only read as much as fits into the queue
+    int nMaximumNumberOfEvents = ::detail::MAXIMUM_NUMBER_OF_READ_EVENTS;
+    if (sSource.bReplay) {
+      const RECore::uint32 nNumberOfFreeEvents = m_cQueue.getNumberOfFreeEvents();
+      if (nNumberOfFreeEvents < static_cast<RECore::uint32>(nMaximumNumberOfEvents))
+        nMaximumNumberOfEvents = static_cast<int>(nNumberOfFreeEvents);
+      if (0 == nMaximumNumberOfEvents)
+        return;
+    }
+
+    // Event devices always return whole events
+    const ssize_t nSize = read(sSource.nFile, sEvents, sizeof(input_event) * static_cast<size_t>(nMaximumNumberOfEvents));
+    if (nSize <= 0) {
+      if (0 == nSize || (EAGAIN != errno && EINTR != errno)) {
+        // End of the recorded stream or the device is gone (ENODEV), stop reading until the device gets removed
+        sSource.bActive = false;
+        if (sSource.bReplay)
+          m_nNumberOfReplays.fetch_sub(1, std::memory_order_acq_rel);
+        else
+          epoll_ctl(m_nEpoll, EPOLL_CTL_DEL, sSource.nFile, nullptr);
+      }
+      return;
+    }
+
+    // Push the events and publish them in one go, once an event got dropped no further event of this source
+    // is delivered before the device has been told to resynchronize its state
+    const int nNumberOfEvents = static_cast<int>(static_cast<size_t>(nSize) / sizeof(input_event));
+    RECore::uint64 nNumberOfDroppedEvents = 0;
+    for (int i=0; i<nNumberOfEvents; i++) {
+      const input_event &sEvent = sEvents[i];
+      if ((sSource.bResynchronize && !pushResynchronize(sSource)) ||
+        !m_cQueue.push({ ::detail::getTimestamp(sEvent), sSource.nDeviceID, sEvent.type, sEvent.code, sEvent.value })) {
+        sSource.bResynchronize = true;
+        nNumberOfDroppedEvents++;
+      }
+    }
+    m_cQueue.commit();
+    if (nNumberOfDroppedEvents > 0)
+      m_nNumberOfDroppedEvents.fetch_add(nNumberOfDroppedEvents, std::memory_order_relaxed);
+
+    // Less events than requested means the device has no more pending events
+    if (nNumberOfEvents < nMaximumNumberOfEvents)
+      return;
+  }
+}
+
+bool LinuxEventReader::pushResynchronize(Source &sSource)
+{
+  // Both events or none, a lone "SYN_DROPPED" would make the device ignore the next real report
+  if (m_cQueue.getNumberOfFreeEvents() < 2)
+    return false;
+  const RECore::uint64 nTimestamp = ::detail::getCurrentTimestamp();
+  m_cQueue.push({ nTimestamp, sSource.nDeviceID, EV_SYN, SYN_DROPPED, 0 });
+  m_cQueue.push({ nTimestamp, sSource.nDeviceID, EV_SYN, SYN_REPORT, 0 });
+  sSource.bResynchronize = false;
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // REInput
@@ -22,6 +22,14 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "REInput/Backend/Linux/LinuxProvider.h"
+#include "REInput/Backend/Linux/LinuxEventDevice.h"
+#include "REInput/Backend/Linux/LinuxKeyboardDevice.h"
+#include "REInput/Backend/Linux/LinuxMouseDevice.h"
+#include "REInput/Input/Devices/Joystick.h"
+#include "REInput/Input/InputManager.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 
 //[-------------------------------------------------------]
@@ -31,8 +39,130 @@ namespace REInput {
 
 
 //[-------------------------------------------------------]
-//[ Classes                                               ]
+//[ Public functions                                      ]
 //[-------------------------------------------------------]
+Device *LinuxProvider::replayEventStream(const std::string &sFilename, const std::string &sDevice, bool bMouse)
+{
+  // The device must not exist yet
+  if (mInputManager.getDevice(sDevice))
+    return nullptr;
+
+  // Open the recorded event stream
+  const int nFile = open(sFilename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (nFile < 0)
+    return nullptr;
+
+  // Create device
+  LinuxEventDevice *pImpl = new LinuxEventDevice(m_cReader, nFile);
+  Device *pDevice = bMouse ? static_cast<Device*>(new Mouse(this->mInputManager, sDevice, pImpl)) : static_cast<Device*>(new Joystick(this->mInputManager, sDevice, pImpl));
+  if (!addDevice(sDevice, pDevice)) {
+    // Error! This also destroys the device implementation and closes the file.
+    delete pDevice;
+    return nullptr;
+  }
+  m_lstReplayDevices.push_back(sDevice);
+
+  // Done
+  return pDevice;
+}
+
+
+//[-------------------------------------------------------]
+//[ Public virtual Provider functions                     ]
+//[-------------------------------------------------------]
+void LinuxProvider::update()
+{
+  // Pass the events read since the last frame to the event devices
+  m_cReader.dispatchEvents();
+}
+
+
+//[-------------------------------------------------------]
+//[ Private virtual Provider functions                    ]
+//[-------------------------------------------------------]
+void LinuxProvider::queryDevices()
+{
+  // Create a keyboard device
+  if (!checkDevice("Keyboard")) {
+    // Add device
+    LinuxKeyboardDevice *pImpl = new LinuxKeyboardDevice();
+    addDevice("Keyboard", new Keyboard(this->mInputManager, std::string("Keyboard"), pImpl));
+  }
+
+  // Create a mouse device
+  if (!checkDevice("Mouse")) {
+    LinuxMouseDevice *pImpl = new LinuxMouseDevice();
+    addDevice("Mouse", new Mouse(this->mInputManager, std::string("Mouse"),
+                                 pImpl));
+  }
+
+  // Keep the replay devices, they are gone as soon as the user destroyed them via a reset
+  std::vector<std::string> lstReplayDevices;
+  for (const std::string &sDevice : m_lstReplayDevices) {
+    if (checkDevice(sDevice))
+      lstReplayDevices.push_back(sDevice);
+  }
+  m_lstReplayDevices.swap(lstReplayDevices);
+
+  // List devices in "/dev/input/event*", event files which are no longer there drop out of the new map
+  EventFileMap mapEventFiles;
+  DIR *pDir = opendir("/dev/input");
+  if (pDir) {
+    // Read first entry
+    dirent *pEntry = readdir(pDir);
+    while (pEntry) {
+      // Check if filename is "eventX"
+      const std::string sFilename = std::string("/dev/input/") + pEntry->d_name;
+      if (!strncmp(pEntry->d_name, "event", 5)) {
+        // Keep devices which are already known
+        EventFileMap::const_iterator iterator = m_mapEventFiles.find(sFilename);
+        if (m_mapEventFiles.cend() != iterator && checkDevice(iterator->second)) {
+          mapEventFiles.emplace(iterator->first, iterator->second);
+        } else {
+          // Try to open the device, only reading is required
+          const int nFile = open(sFilename.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+          if (nFile >= 0) {
+            // Only mice and joysticks are of interest, keyboards are handled via X11
+            const bool bMouse	 = (LinuxEventDevice::hasEventCode(nFile, EV_REL, REL_X) && LinuxEventDevice::hasEventCode(nFile, EV_KEY, BTN_LEFT));
+            const bool bJoystick = (!bMouse && (LinuxEventDevice::hasEventCode(nFile, EV_ABS, ABS_X) || LinuxEventDevice::hasEventCode(nFile, EV_KEY, BTN_JOYSTICK) || LinuxEventDevice::hasEventCode(nFile, EV_KEY, BTN_GAMEPAD)));
+            if (bMouse || bJoystick) {
+              // Create device
+              LinuxEventDevice *pImpl = new LinuxEventDevice(m_cReader, nFile);
+              const std::string sName = getFreeDeviceName(bMouse ? "Mouse" : "Joystick");
+              Device *pDevice = bMouse ? static_cast<Device*>(new Mouse(this->mInputManager, sName, pImpl)) : static_cast<Device*>(new Joystick(this->mInputManager, sName, pImpl));
+              if (addDevice(sName, pDevice))
+                mapEventFiles.emplace(sFilename, sName);
+              else
+                delete pDevice;
+            } else {
+              close(nFile);
+            }
+          }
+        }
+      }
+
+      // Read next entry
+      pEntry = readdir(pDir);
+    }
+
+    // Be polite and close the directory after we're done...
+    closedir(pDir);
+  }
+  m_mapEventFiles.swap(mapEventFiles);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private functions                                     ]
+//[-------------------------------------------------------]
+std::string LinuxProvider::getFreeDeviceName(const std::string &sPrefix) const
+{
+  for (RECore::uint32 i=0; ; i++) {
+    std::string sName = sPrefix + std::to_string(i);
+    if (!mInputManager.getDevice(sName))
+      return sName;
+  }
+}
 
 
 //[-------------------------------------------------------]
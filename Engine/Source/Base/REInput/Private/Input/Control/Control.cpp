@@ -40,7 +40,8 @@ Control::Control(Controller& controller, ControlType controlType, const std::str
   mController(controller),
   mControlType(controlType),
   mName(sName),
-  mDescription(sDescription)
+  mDescription(sDescription),
+  mUpdated(false)
 {
   // Add control to controller
   mController.addControl(this);
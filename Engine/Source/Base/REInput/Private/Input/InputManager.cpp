@@ -56,27 +56,31 @@ InputManager::~InputManager()
 
 void InputManager::update()
 {
-  Controls lstUpdatedControls;
+  // Update providers, passes input which has been read asynchronously to the devices
+  for (RECore::uint32 i=0; i<m_lstProviders.size(); i++)
+    m_lstProviders[i]->update();
+
+  // Update devices, done before informing the controllers so the input of this frame is processed within this frame
+  for (RECore::uint32 i=0; i<m_lstDevices.size(); i++)
+    m_lstDevices[i]->update();
+
   {
     std::lock_guard<std::mutex> mutexLock(*mMutex);
 
-    // Copy list of controls that have changed
-    lstUpdatedControls = m_lstUpdatedControls;
-
-    // Clear list
+    // Take over the list of controls that have changed and clear it
+    m_lstInformControls.swap(m_lstUpdatedControls);
     m_lstUpdatedControls.clear();
+    for (Control* pControl : m_lstInformControls)
+      pControl->mUpdated = false;
   }
 
   // Inform controllers about changed controls
-  for (size_t i=0; i<lstUpdatedControls.size(); i++) {
+  for (size_t i=0; i<m_lstInformControls.size(); i++) {
     // Inform controller
-    Control* pControl = lstUpdatedControls[i];
+    Control* pControl = m_lstInformControls[i];
     pControl->getController().informControl(pControl);
   }
-
-  // Update devices
-  for (RECore::uint32 i=0; i<m_lstDevices.size(); i++)
-    m_lstDevices[i]->update();
+  m_lstInformControls.clear();
 }
 
 void InputManager::detectDevices(bool bReset)
@@ -162,10 +166,10 @@ void InputManager::removeControl(Control *pControl)
   if (pControl) {
     // Remove control from list (if it's within the list at all)
     std::lock_guard<std::mutex> mutexLock(*mMutex);
-    Controls::const_iterator iterator = std::find(m_lstUpdatedControls.cbegin(), m_lstUpdatedControls.cend(), pControl);
-    if (m_lstUpdatedControls.cend() != iterator)
+    if (pControl->mUpdated)
     {
-      m_lstUpdatedControls.erase(iterator);
+      m_lstUpdatedControls.erase(std::find(m_lstUpdatedControls.cbegin(), m_lstUpdatedControls.cend(), pControl));
+      pControl->mUpdated = false;
     }
   }
 }
@@ -176,8 +180,9 @@ void InputManager::updateControl(Control *pControl)
   if (pControl) {
     // Add control to list, but only if it's not already within the list!
     std::lock_guard<std::mutex> mutexLock(*mMutex);
-    if (std::find(m_lstUpdatedControls.cbegin(), m_lstUpdatedControls.cend(), pControl) == m_lstUpdatedControls.cend())
+    if (!pControl->mUpdated)
     {
+      pControl->mUpdated = true;
       m_lstUpdatedControls.push_back(pControl);
     }
   }
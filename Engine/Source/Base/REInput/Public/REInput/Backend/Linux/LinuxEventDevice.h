@@ -29,18 +29,18 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "REInput/REInput.h"
-#include "REInput/Backend/Linux/Linux.h"
 #include "REInput/Backend/UpdateDevice.h"
-#include "REInput/Input/Control/Axis.h"
-#include "REInput/Input/Control/Button.h"
 #include <linux/input.h>
-#include <unistd.h>
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 namespace REInput {
+class Axis;
+class Button;
+class LinuxEventReader;
+struct LinuxEvent;
 
 
 //[-------------------------------------------------------]
@@ -49,11 +49,42 @@ namespace REInput {
 /**
 *  @brief
 *    Linux device implementation using the event subsystem of input.h
+*
+*  @remarks
+*    The device file is read by the epoll thread of "REInput::LinuxEventReader", the events are passed to
+*    "processEvent()" when the main thread drains the event queue. Absolute axes and buttons are applied
+*    immediately, relative axes (e.g. mouse movement) are accumulated and applied once per frame inside
+*    "update()", so a high-rate mouse results in exactly one control update per axis and frame.
+*
+*    Controls are mapped by event code: REL_X/ABS_X -> "X", REL_Y/ABS_Y -> "Y", REL_WHEEL -> "Wheel",
+*    ABS_Z/RX/RY/RZ -> "Z"/"RX"/"RY"/"RZ", ABS_HAT0X -> "Hat", BTN_LEFT/RIGHT/MIDDLE -> "Left"/"Right"/"Middle"
+*    and joystick/gamepad buttons -> "Button<n>". Codes without a matching control of the device are ignored.
 */
 class LinuxEventDevice : public UpdateDevice
 {
 
 
+  //[-------------------------------------------------------]
+  //[ Public static functions                               ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Check whether or not an event device supports a certain event code
+  *
+  *  @param[in] nFile
+  *    Event device file handle
+  *  @param[in] nType
+  *    Event type (e.g. EV_REL)
+  *  @param[in] nCode
+  *    Event code (e.g. REL_X)
+  *
+  *  @return
+  *    'true' if the device reports the event code, else 'false'
+  */
+  [[nodiscard]] static bool hasEventCode(int nFile, RECore::uint16 nType, RECore::uint16 nCode);
+
+
   //[-------------------------------------------------------]
   //[ Public functions                                      ]
   //[-------------------------------------------------------]
@@ -62,39 +93,22 @@ public:
   *  @brief
   *    Constructor
   *
+  *  @param[in] cReader
+  *    Event reader which reads the file, must stay valid as long as the device exists
   *  @param[in] nFile
-  *    File handle
+  *    Non-blocking event device file handle or regular file containing a recorded event stream,
+  *    the event reader takes over the ownership
+  *
+  *  @note
+  *    - Absolute axis ranges can't be queried from a recorded event stream, the 16 bit signed range is assumed instead
   */
-  explicit LinuxEventDevice(int nFile):
-    m_nFile(nFile),
-    m_nBusType(0),
-    m_nVendor(0),
-    m_nProduct(0),
-    m_nVersion(0)
-  {
-    // Do not destroy device implementation automatically, because this is managed by HIDLinux
-    m_bDelete = false;
-
-    // Get device info
-    input_id sDeviceInfo;
-    if (!ioctl(m_nFile, EVIOCGID, &sDeviceInfo)) {
-      // Save device info
-      m_nBusType = sDeviceInfo.bustype;
-      m_nVendor  = sDeviceInfo.vendor;
-      m_nProduct = sDeviceInfo.product;
-      m_nVersion = sDeviceInfo.version;
-    }
-  }
+  LinuxEventDevice(LinuxEventReader &cReader, int nFile);
 
   /**
   *  @brief
   *    Destructor
   */
-  inline virtual ~LinuxEventDevice() override
-  {
-    // Close file
-    close(m_nFile);
-  }
+  virtual ~LinuxEventDevice() override;
 
   /**
   *  @brief
@@ -144,78 +158,87 @@ public:
     return m_nVersion;
   }
 
+  /**
+  *  @brief
+  *    Get the kernel timestamp of the last processed event
+  *
+  *  @return
+  *    Timestamp in microseconds, CLOCK_MONOTONIC based for live devices so it can be compared against
+  *    "std::chrono::steady_clock" to measure the input latency, 0 if there was no event yet
+  */
+  [[nodiscard]] inline RECore::uint64 getTimestamp() const
+  {
+    return m_nTimestamp;
+  }
+
+  /**
+  *  @brief
+  *    Process an event read by the event reader
+  *
+  *  @param[in] sEvent
+  *    Event to process
+  */
+  void processEvent(const LinuxEvent &sEvent);
+
 
   //[-------------------------------------------------------]
   //[ Public virtual UpdateDevice functions                 ]
   //[-------------------------------------------------------]
 public:
-  virtual void update() override
-  {
-    // Read input events
-    struct input_event pEvents[64];
-    ssize_t nSize = read(m_nFile, pEvents, sizeof(struct input_event)*64);
-    int nEvents = (nSize > 0 ? static_cast<int>(nSize / sizeof(struct input_event)) : 0);
-    for (int i=0; i<nEvents; i++) {
-      // Get corresponding control
-      Control *pControl = nullptr;
-      if (pEvents[i].code == ABS_X)
-        pControl = m_pDevice->getControl("X");
-      else if (pEvents[i].code == ABS_Y)
-        pControl = m_pDevice->getControl("Y");
-      else if (pEvents[i].code == ABS_Z)
-        pControl = m_pDevice->getControl("Z");
-      else if (pEvents[i].code == ABS_RX)
-        pControl = m_pDevice->getControl("RX");
-      else if (pEvents[i].code == ABS_RY)
-        pControl = m_pDevice->getControl("RY");
-      else if (pEvents[i].code == ABS_RZ)
-        pControl = m_pDevice->getControl("RZ");
-      else if (pEvents[i].code == ABS_HAT0X)
-        pControl = m_pDevice->getControl("Hat");
-      else if (pEvents[i].code >= BTN_JOYSTICK && pEvents[i].code < BTN_GAMEPAD)
-        pControl = m_pDevice->getControl(std::string("Button") + std::to_string(pEvents[i].code - BTN_JOYSTICK));
-      else if (pEvents[i].code >= BTN_GAMEPAD && pEvents[i].code < BTN_DIGI)
-        pControl = m_pDevice->getControl(std::string("Button") + std::to_string(pEvents[i].code - BTN_GAMEPAD));
-
-      // Get control type
-      Axis   *pAxis   = (pControl != nullptr && pControl->getControlType() == ControlType::AXIS)   ? static_cast<Axis*>  (pControl) : nullptr;
-      Button *pButton = (pControl != nullptr && pControl->getControlType() == ControlType::BUTTON) ? static_cast<Button*>(pControl) : nullptr;
-
-      // Set control value
-      if (pEvents[i].type == EV_KEY && pButton)
-      {
-        // Button
-        pButton->setPressed(pEvents[i].value != 0);
-      }
-      else if ((pEvents[i].type == EV_ABS || pEvents[i].type == EV_REL) && pAxis)
-      {
-        // Absolute or relative axis
-        // Get minimum and maximum values
-        input_absinfo sAbsInfo;
-        if (!ioctl(m_nFile, EVIOCGABS(0), &sAbsInfo))
-        {
-          // Get value in a range of -1.0 - +1.0
-          float fValue = (static_cast<float>(pEvents[i].value - sAbsInfo.minimum) / static_cast<float>(sAbsInfo.maximum - sAbsInfo.minimum)) * 2.0f - 1.0f;
-          if (fValue >  1.0f)
-            fValue =  1.0f;
-          if (fValue < -1.0f)
-            fValue = -1.0f;
-          pAxis->setValue(fValue, false);
-        }
-      }
-    }
-  }
+  virtual void update() override;
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  LinuxEventDevice(const LinuxEventDevice &cSource) = delete;
+  LinuxEventDevice &operator =(const LinuxEventDevice &cSource) = delete;
+
+  /**
+  *  @brief
+  *    Resolve the controls of the owning device, done once on the first event
+  */
+  void resolveControls();
+
+  /**
+  *  @brief
+  *    Set the value of an absolute axis
+  *
+  *  @param[in] nCode
+  *    Absolute axis code, must be below "ABS_CNT"
+  *  @param[in] nValue
+  *    Raw axis value, mapped into a range of -1.0 - +1.0
+  */
+  void setAbsoluteAxisValue(RECore::uint16 nCode, int nValue);
+
+  /**
+  *  @brief
+  *    Re-read the button and absolute axis states after events were dropped (SYN_DROPPED)
+  */
+  void synchronizeState();
 
 
   //[-------------------------------------------------------]
   //[ Private data                                          ]
   //[-------------------------------------------------------]
 private:
-  int		 m_nFile;		///< File handle
-  RECore::uint16 m_nBusType;	///< Bus type (e.g. USB)
-  RECore::uint16 m_nVendor;		///< Vendor ID
-  RECore::uint16 m_nProduct;	///< Product ID
-  RECore::uint16 m_nVersion;	///< Version
+  LinuxEventReader &m_cReader;			///< Event reader
+  int			 m_nFile;				///< File handle, owned by the event reader
+  RECore::uint32 m_nDeviceID;			///< Device ID within the event reader
+  RECore::uint16 m_nBusType;			///< Bus type (e.g. USB)
+  RECore::uint16 m_nVendor;				///< Vendor ID
+  RECore::uint16 m_nProduct;			///< Product ID
+  RECore::uint16 m_nVersion;			///< Version
+  RECore::uint64 m_nTimestamp;			///< Kernel timestamp of the last processed event in microseconds
+  bool		 m_bControlsResolved;		///< 'true' if the control pointers below are valid
+  bool		 m_bDropped;				///< 'true' if events are ignored until the next SYN_REPORT because the kernel dropped events
+  int			 m_nAbsMinimum[ABS_CNT];	///< Minimum value per absolute axis
+  int			 m_nAbsMaximum[ABS_CNT];	///< Maximum value per absolute axis
+  Axis		*m_pAbsAxes[ABS_CNT];		///< Control per absolute axis, can be a null pointer
+  Axis		*m_pRelAxes[REL_CNT];		///< Control per relative axis, can be a null pointer
+  float		 m_fRelValues[REL_CNT];		///< Relative movement accumulated since the last update()
+  Button		*m_pButtons[KEY_CNT];		///< Control per key code, can be a null pointer
 
 
 };
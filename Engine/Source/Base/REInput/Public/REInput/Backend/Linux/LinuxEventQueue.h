@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "REInput/REInput.h"
+#include <atomic>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace REInput {
+
+
+//[-------------------------------------------------------]
+//[ Structures                                            ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Input event read from a Linux event device, see "input_event" inside "linux/input.h"
+*/
+struct LinuxEvent
+{
+  RECore::uint64 nTimestamp;  ///< Kernel timestamp in microseconds (CLOCK_MONOTONIC for live devices, as recorded for replayed streams)
+  RECore::uint32 nDeviceID;   ///< ID of the device the event belongs to, see "REInput::LinuxEventReader::addDevice()"
+  RECore::uint16 nType;       ///< Event type (e.g. EV_KEY)
+  RECore::uint16 nCode;       ///< Event code (e.g. BTN_LEFT)
+  RECore::int32  nValue;      ///< Event value
+};
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Lock-free single producer single consumer queue for Linux input events
+*
+*  @remarks
+*    Head and tail are monotonically increasing 32 bit positions, the slot index is "position & (CAPACITY - 1)".
+*    Pushed events are not visible to the consumer until "commit()" has been called, this way the producer
+*    publishes a whole batch of events read from a device with a single release store.
+*
+*  @note
+*    - Exactly one producer thread may call "getNumberOfFreeEvents()", "push()" and "commit()"
+*    - Exactly one consumer thread may call "consume()"
+*/
+class LinuxEventQueue
+{
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Capacity in events, must be a power of two
+  *
+  *  @remarks
+  *    An 8 kHz mouse generates up to 24000 events per second (REL_X, REL_Y and SYN_REPORT per report),
+  *    so the queue holds more than half a second of input in case the consumer stalls.
+  */
+  static constexpr RECore::uint32 CAPACITY = 16384;
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Default constructor
+  */
+  inline LinuxEventQueue() :
+    m_lstEvents(CAPACITY),
+    m_nHead(0),
+    m_nReservedHead(0),
+    m_nCachedTail(0),
+    m_nTail(0)
+  {
+    // Nothing here
+  }
+
+  /**
+  *  @brief
+  *    Destructor
+  */
+  inline ~LinuxEventQueue()
+  {
+    // Nothing here
+  }
+
+  //[-------------------------------------------------------]
+  //[ Producer                                              ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Get the number of events which can currently be pushed
+  *
+  *  @return
+  *    The number of free event slots
+  */
+  [[nodiscard]] inline RECore::uint32 getNumberOfFreeEvents()
+  {
+    m_nCachedTail = m_nTail.load(std::memory_order_acquire);
+    return CAPACITY - (m_nReservedHead - m_nCachedTail);
+  }
+
+  /**
+  *  @brief
+  *    Push an event
+  *
+  *  @param[in] sEvent
+  *    Event to push
+  *
+  *  @return
+  *    'true' if all went fine, 'false' if the queue is full and the event was dropped
+  *
+  *  @note
+  *    - The event is not visible to the consumer until "commit()" has been called
+  */
+  inline bool push(const LinuxEvent &sEvent)
+  {
+    if (m_nReservedHead - m_nCachedTail == CAPACITY && getNumberOfFreeEvents() == 0)
+    {
+      // Queue is full
+      return false;
+    }
+    m_lstEvents[m_nReservedHead & (CAPACITY - 1)] = sEvent;
+    ++m_nReservedHead;
+    return true;
+  }
+
+  /**
+  *  @brief
+  *    Publish all pushed events to the consumer
+  */
+  inline void commit()
+  {
+    m_nHead.store(m_nReservedHead, std::memory_order_release);
+  }
+
+  //[-------------------------------------------------------]
+  //[ Consumer                                              ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Consume all committed events
+  *
+  *  @param[in] cFunction
+  *    Function called as "cFunction(const LinuxEvent &sEvent)" for each event in the order the events were pushed
+  *
+  *  @return
+  *    The number of consumed events
+  */
+  template <typename FUNCTION>
+  RECore::uint32 consume(FUNCTION cFunction)
+  {
+    const RECore::uint32 nTail = m_nTail.load(std::memory_order_relaxed);
+    const RECore::uint32 nHead = m_nHead.load(std::memory_order_acquire);
+    for (RECore::uint32 nPosition=nTail; nPosition!=nHead; ++nPosition)
+      cFunction(m_lstEvents[nPosition & (CAPACITY - 1)]);
+
+    // Release the slots in one go
+    m_nTail.store(nHead, std::memory_order_release);
+    return nHead - nTail;
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  LinuxEventQueue(const LinuxEventQueue &cSource) = delete;
+  LinuxEventQueue &operator =(const LinuxEventQueue &cSource) = delete;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  std::vector<LinuxEvent> m_lstEvents;  ///< Event slots, "CAPACITY" entries
+  // Producer side, the tail is cached to avoid touching the consumer cache line for every event
+  alignas(64) std::atomic<RECore::uint32> m_nHead;  ///< Position behind the last committed event
+  RECore::uint32 m_nReservedHead;                   ///< Position behind the last pushed event
+  RECore::uint32 m_nCachedTail;                     ///< Last known consumer position
+  // Consumer side
+  alignas(64) std::atomic<RECore::uint32> m_nTail;  ///< Position of the first not yet consumed event
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // REInput
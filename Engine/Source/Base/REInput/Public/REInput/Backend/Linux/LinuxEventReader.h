@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "REInput/REInput.h"
+#include "REInput/Backend/Linux/LinuxEventQueue.h"
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace REInput {
+class LinuxEventDevice;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Reads all Linux event devices ("/dev/input/event*") inside a single epoll thread
+*
+*  @remarks
+*    The reader thread sleeps inside "epoll_wait()" until one of the devices has new input, reads all pending
+*    events and pushes them together with their kernel timestamp into a lock-free single producer single
+*    consumer queue. The main thread drains the queue once per frame by calling "dispatchEvents()", which
+*    passes the events to the owning event devices. This way high-rate devices like 8 kHz mice neither
+*    wake up the main thread nor overflow the small kernel side event buffer.
+*
+*    Regular files can be added as well, they are expected to contain a recorded stream of raw "input_event"
+*    structures (e.g. captured via "cat /dev/input/event3 > mouse.bin") and are replayed as fast as the queue
+*    allows, keeping the recorded timestamps.
+*
+*    When the queue is full, events of a device are dropped just like the kernel drops events when its own
+*    buffer overflows. The reader then marks the device for resynchronization and, as soon as there's room,
+*    pushes a "SYN_DROPPED" followed by a "SYN_REPORT" in front of any further event of that device. The
+*    event device reacts on this exactly as on a kernel side overflow and re-queries its key and absolute
+*    axis states, so a lost release event can't leave a button stuck.
+*/
+class LinuxEventReader
+{
+
+
+  //[-------------------------------------------------------]
+  //[ Public functions                                      ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Default constructor, starts the reader thread
+  */
+  LinuxEventReader();
+
+  /**
+  *  @brief
+  *    Destructor, stops the reader thread and closes all files
+  */
+  ~LinuxEventReader();
+
+  /**
+  *  @brief
+  *    Add a device
+  *
+  *  @param[in] cDevice
+  *    Event device the read events are dispatched to, must stay valid until "removeDevice()" has been called
+  *  @param[in] nFile
+  *    Non-blocking event device file handle or regular file containing a recorded event stream, the reader takes over the ownership
+  *
+  *  @return
+  *    Device ID
+  */
+  RECore::uint32 addDevice(LinuxEventDevice &cDevice, int nFile);
+
+  /**
+  *  @brief
+  *    Remove a device
+  *
+  *  @param[in] nDeviceID
+  *    ID of the device to remove, events of this device which are still within the queue are discarded
+  *
+  *  @note
+  *    - The file handle is closed by the reader thread
+  */
+  void removeDevice(RECore::uint32 nDeviceID);
+
+  /**
+  *  @brief
+  *    Pass all queued events to their devices
+  *
+  *  @return
+  *    The number of dispatched events
+  *
+  *  @note
+  *    - Must be called from the main thread, usually once per frame by "REInput::InputManager::update()"
+  */
+  RECore::uint32 dispatchEvents();
+
+  /**
+  *  @brief
+  *    Return whether or not recorded event streams are still being replayed
+  *
+  *  @return
+  *    'true' if there are replayed files which have not been read completely, else 'false'
+  */
+  [[nodiscard]] inline bool isReplaying() const
+  {
+    return (m_nNumberOfReplays.load(std::memory_order_acquire) > 0);
+  }
+
+  /**
+  *  @brief
+  *    Get the number of events dropped because the queue was full
+  *
+  *  @return
+  *    The number of dropped events
+  */
+  [[nodiscard]] inline RECore::uint64 getNumberOfDroppedEvents() const
+  {
+    return m_nNumberOfDroppedEvents.load(std::memory_order_relaxed);
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  /**
+  *  @brief
+  *    Command send from the main thread to the reader thread
+  */
+  struct Command
+  {
+    bool		   bAdd;		///< 'true' to add the file, 'false' to remove it
+    int			   nFile;		///< File handle, only used when adding
+    RECore::uint32 nDeviceID;	///< Device ID
+  };
+
+  /**
+  *  @brief
+  *    File read by the reader thread
+  */
+  struct Source
+  {
+    int			   nFile;		///< File handle
+    RECore::uint32 nDeviceID;	///< Device ID
+    bool		   bReplay;		///< 'true' if this is a regular file with a recorded event stream
+    bool		   bActive;		///< 'false' if the device is gone or the end of the recorded stream has been reached
+    bool		   bResynchronize;	///< 'true' if events were dropped and the device has not been told yet
+  };
+
+  typedef std::vector<Command> Commands;
+  typedef std::vector<Source> Sources;
+  typedef std::unordered_map<RECore::uint32, LinuxEventDevice*> DeviceMap;
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  LinuxEventReader(const LinuxEventReader &cSource) = delete;
+  LinuxEventReader &operator =(const LinuxEventReader &cSource) = delete;
+
+  /**
+  *  @brief
+  *    Post a command to the reader thread and wake it up
+  *
+  *  @param[in] sCommand
+  *    Command to post
+  */
+  void postCommand(const Command &sCommand);
+
+  /**
+  *  @brief
+  *    Reader thread function
+  */
+  void threadFunction();
+
+  /**
+  *  @brief
+  *    Execute all posted commands, reader thread only
+  */
+  void executeCommands();
+
+  /**
+  *  @brief
+  *    Read the pending events of a source, reader thread only
+  *
+  *  @param[in, out] sSource
+  *    Source to read from
+  */
+  void readSource(Source &sSource);
+
+  /**
+  *  @brief
+  *    Push the "SYN_DROPPED" and "SYN_REPORT" pair of a source marked for resynchronization, reader thread only
+  *
+  *  @param[in, out] sSource
+  *    Source to resynchronize
+  *
+  *  @return
+  *    'true' if the source is in sync, 'false' if the queue has no room yet
+  *
+  *  @note
+  *    - Doesn't commit the queue
+  */
+  [[nodiscard]] bool pushResynchronize(Source &sSource);
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  // Shared
+  LinuxEventQueue			   m_cQueue;					///< Event queue, reader thread is the producer and the main thread the consumer
+  std::mutex				   m_cCommandMutex;				///< Guards "m_lstCommands"
+  Commands				   m_lstCommands;				///< Posted commands not yet executed by the reader thread
+  std::atomic<bool>		   m_bShutdown;					///< Set to stop the reader thread
+  std::atomic<RECore::uint32> m_nNumberOfReplays;			///< Number of replayed files which have not been read completely
+  std::atomic<RECore::uint64> m_nNumberOfDroppedEvents;	///< Number of events dropped because the queue was full
+  int						   m_nEpoll;					///< epoll file handle
+  int						   m_nWakeUp;					///< eventfd file handle used to wake up the reader thread
+  // Main thread
+  DeviceMap				   m_mapDevices;				///< Device ID to device mapping
+  RECore::uint32			   m_nNextDeviceID;				///< Next free device ID, IDs are never reused so stale queued events can't reach a new device
+  // Reader thread
+  Sources					   m_lstSources;				///< Files read by the reader thread
+  std::thread				   m_cThread;					///< Reader thread
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // REInput
@@ -30,18 +30,14 @@
 //[-------------------------------------------------------]
 #include "REInput/REInput.h"
 #include "REInput/Backend/Provider.h"
-#include "REInput/Backend/Linux/LinuxEventDevice.h"
-#include "REInput/Backend/Linux/LinuxKeyboardDevice.h"
-#include "REInput/Backend/Linux/LinuxMouseDevice.h"
-#include "REInput/Input/Devices/Joystick.h"
-#include <dirent.h>
-#include <fcntl.h>
+#include "REInput/Backend/Linux/LinuxEventReader.h"
 
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
 namespace REInput {
+class Device;
 
 
 //[-------------------------------------------------------]
@@ -50,6 +46,12 @@ namespace REInput {
 /**
 *  @brief
 *    Standard input provider for Linux
+*
+*  @remarks
+*    Keyboard and mouse are read via X11. Mice and joysticks found in "/dev/input/event*" are additionally
+*    exposed as "Mouse<n>" and "Joystick<n>", they are read by a single epoll thread and their events are
+*    passed to the devices once per frame inside "update()". Reading these devices requires the user to be
+*    allowed to open the event device files, usually by being member of the "input" group.
 */
 class LinuxProvider : public Provider
 {
@@ -80,62 +82,107 @@ public:
   */
   virtual ~LinuxProvider() override
   {
-    // Nothing here
+    // Destroy the devices while the event reader is still there
+    clear();
   }
 
   LinuxProvider& operator= (const LinuxProvider& source) = delete;
 
+  /**
+  *  @brief
+  *    Replay a recorded event stream
+  *
+  *  @param[in] sFilename
+  *    Name of a file containing raw "input_event" structures, e.g. captured via "cat /dev/input/event3 > mouse.bin"
+  *  @param[in] sDevice
+  *    Name of the device to create (e.g. "ReplayMouse"), must not exist yet
+  *  @param[in] bMouse
+  *    'true' to create a mouse, 'false' to create a joystick
+  *
+  *  @return
+  *    The created device, a null pointer on error, do not destroy the returned instance!
+  *
+  *  @remarks
+  *    The events are read as fast as the event queue allows and dispatched by "REInput::InputManager::update()"
+  *    like the events of a live device, the device keeps the recorded kernel timestamps. This way input handling
+  *    can be tested deterministically without the physical device. Use "isReplaying()" to check whether or not
+  *    the whole stream has been read.
+  */
+  REINPUT_API Device *replayEventStream(const std::string &sFilename, const std::string &sDevice, bool bMouse);
+
+  /**
+  *  @brief
+  *    Return whether or not recorded event streams are still being replayed
+  *
+  *  @return
+  *    'true' if there are replayed files which have not been read completely, else 'false'
+  *
+  *  @note
+  *    - Events already read might still wait inside the event queue until the next "REInput::InputManager::update()"
+  */
+  [[nodiscard]] inline bool isReplaying() const
+  {
+    return m_cReader.isReplaying();
+  }
+
+  /**
+  *  @brief
+  *    Get the number of events dropped because the main thread didn't drain the event queue in time
+  *
+  *  @return
+  *    The number of dropped events
+  */
+  [[nodiscard]] inline RECore::uint64 getNumberOfDroppedEvents() const
+  {
+    return m_cReader.getNumberOfDroppedEvents();
+  }
+
+
+  //[-------------------------------------------------------]
+  //[ Public virtual Provider functions                     ]
+  //[-------------------------------------------------------]
+public:
+  virtual void update() override;
+
 
   //[-------------------------------------------------------]
   //[ Private virtual Provider functions                    ]
   //[-------------------------------------------------------]
 private:
-  virtual void queryDevices() override
-  {
-    // Create a keyboard device
-    if (!checkDevice("Keyboard")) {
-      // Add device
-      LinuxKeyboardDevice *pImpl = new LinuxKeyboardDevice();
-      addDevice("Keyboard", new Keyboard(this->mInputManager, std::string("Keyboard"), pImpl));
-    }
-
-    // Create a mouse device
-    if (!checkDevice("Mouse")) {
-      LinuxMouseDevice *pImpl = new LinuxMouseDevice();
-      addDevice("Mouse", new Mouse(this->mInputManager, std::string("Mouse"),
-                                   pImpl));
-    }
-
-    // List devices in "/dev/input/event*"
-    DIR *pDir = opendir("/dev/input");
-    if (pDir) {
-      int nDevice = 0;
-
-      // Read first entry
-      dirent *pEntry = readdir(pDir);
-      while (pEntry) {
-        // Check if filename is "eventX"
-        std::string sFilename = pEntry->d_name;
-        if (sFilename.substr(0, 5) == "event") {
-          // Try to open the device
-          int f = open(("/dev/input/" + sFilename).c_str(), O_RDWR | O_NONBLOCK);
-          if (f > 0) {
-            // Create device
-            LinuxEventDevice *pImpl = new LinuxEventDevice(f);
-            std::string sName = std::string("Joystick") + std::to_string(nDevice);
-            addDevice(sName, new Joystick(this->mInputManager, sName, pImpl));
-            nDevice++;
-          }
-        }
-
-        // Read next entry
-        pEntry = readdir(pDir);
-      }
-
-      // Be polite and close the directory after we're done...
-      closedir(pDir);
-    }
-  }
+  virtual void queryDevices() override;
+
+
+  //[-------------------------------------------------------]
+  //[ Private functions                                     ]
+  //[-------------------------------------------------------]
+private:
+  /**
+  *  @brief
+  *    Get the first device name which is not in use
+  *
+  *  @param[in] sPrefix
+  *    Device name prefix (e.g. "Joystick")
+  *
+  *  @return
+  *    Device name "<prefix><n>" with the lowest n which is not in use, other providers use the same naming scheme
+  */
+  [[nodiscard]] std::string getFreeDeviceName(const std::string &sPrefix) const;
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  typedef std::unordered_map<std::string, std::string> EventFileMap;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  LinuxEventReader		 m_cReader;				///< Reads all event devices inside a single thread
+  EventFileMap			 m_mapEventFiles;		///< Event device filename (e.g. "/dev/input/event3") to device name mapping
+  std::vector<std::string> m_lstReplayDevices;	///< Names of the devices replaying recorded event streams
 
 
 };
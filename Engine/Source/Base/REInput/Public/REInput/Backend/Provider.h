@@ -98,6 +98,27 @@ public:
   }
 
 
+  //[-------------------------------------------------------]
+  //[ Public virtual Provider functions                     ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Update provider once per frame
+  *
+  *  @remarks
+  *    Called by "REInput::InputManager::update()" before the devices are updated. Providers which read their
+  *    devices asynchronously use this to pass the collected input to the devices in the main thread.
+  *
+  *  @note
+  *    - The default implementation is empty
+  */
+  inline virtual void update()
+  {
+    // To be implemented in derived classes
+  }
+
+
   //[-------------------------------------------------------]
   //[ Protected functions                                   ]
   //[-------------------------------------------------------]
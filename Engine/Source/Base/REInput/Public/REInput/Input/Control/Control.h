@@ -38,6 +38,7 @@ namespace REInput {
 
 
 class Controller;
+class InputManager;
 
 
 //[-------------------------------------------------------]
@@ -54,6 +55,12 @@ class Control
 {
 
 
+  //[-------------------------------------------------------]
+  //[ Friends                                               ]
+  //[-------------------------------------------------------]
+  friend class InputManager;
+
+
   //[-------------------------------------------------------]
   //[ Public methods                                        ]
   //[-------------------------------------------------------]
@@ -163,6 +170,7 @@ protected:
   ControlType mControlType;	///< Control type
   std::string mName;			///< Control name
   std::string mDescription;	///< Control description
+  bool		  mUpdated;		///< 'true' while the control is within the list of updated controls of the input manager, guarded by the input manager mutex
 
 
 };
@@ -284,7 +284,7 @@ private:
   *
   *  @remarks
   *    This marks the control as being updated recently, which will fire a message
-  *    in the next update()-call.
+  *    in the next update()-call. Marking a control which is already marked is a no-op.
   */
   void updateControl(Control *pControl);
 
@@ -308,7 +308,8 @@ private:
   Devices					 m_lstDevices;			///< List of devices
   DeviceMap				 m_mapDevices;			///< Hash map of devices
   std::mutex				*mMutex;				///< Mutex for reading/writing input messages, always valid
-  Controls				 m_lstUpdatedControls;	///< List of controls that have been updated (message list)
+  Controls				 m_lstUpdatedControls;	///< List of controls that have been updated (message list), a control is within the list if its "mUpdated"-flag is set
+  Controls				 m_lstInformControls;	///< List of updated controls the controllers are currently informed about, only used inside update() and kept to reuse the memory
 
 
 };
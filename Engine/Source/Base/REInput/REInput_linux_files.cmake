@@ -6,6 +6,7 @@ set(FILES
   Private/Backend/Linux/LinuxMouseDevice.cpp
   Private/Backend/Linux/LinuxKeyboardDevice.cpp
   Private/Backend/Linux/LinuxEventDevice.cpp
+  Private/Backend/Linux/LinuxEventReader.cpp
   Private/Backend/Linux/HIDLinux.cpp
   Private/Backend/Linux/HIDDeviceLinux.cpp
   Private/Backend/Linux/BTLinux.cpp
@@ -38,6 +38,7 @@
 #include "RERHI/State/RHIComputePipelineState.h"
 #include "RERHI/State/RHIGraphicsPipelineState.h"
 #include "RERHI/Query/RHIQueryPool.h"
+#include <RECore/Memory/Memory.h>
 
 
 //[-------------------------------------------------------]
@@ -223,9 +224,13 @@ class RHICommandBuffer final
 public:
   /**
   *  @brief
-  *    Default constructor
+  *    Constructor
+  *
+  *  @param[in] allocator
+  *    Allocator for the command packet buffer, must stay valid as long as the command buffer exists; the buffer only grows, so a cleared and re-recorded command buffer doesn't allocate once it has reached its working size
   */
-  inline RHICommandBuffer() :
+  inline explicit RHICommandBuffer(RECore::IAllocator& allocator = RECore::Memory::getAllocator()) :
+    mAllocator(allocator),
     mCommandPacketBufferNumberOfBytes(0),
     mCommandPacketBuffer(nullptr),
     mPreviousCommandPacketByteIndex(~0u),
@@ -241,7 +246,22 @@ public:
   */
   inline ~RHICommandBuffer()
   {
-    delete [] mCommandPacketBuffer;
+    if (nullptr != mCommandPacketBuffer)
+    {
+      mAllocator.reallocate(mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes, 0, 1);
+    }
+  }
+
+  /**
+  *  @brief
+  *    Return the allocator of the command packet buffer
+  *
+  *  @return
+  *    The allocator of the command packet buffer
+  */
+  [[nodiscard]] inline RECore::IAllocator& getAllocator() const
+  {
+    return mAllocator;
   }
 
   /**
@@ -326,18 +346,7 @@ public:
     {
       // Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
       const RECore::uint32 newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-      RECore::uint8* newCommandPacketBuffer = new RECore::uint8[newCommandPacketBufferNumberOfBytes];
-
-      // Copy over current command package buffer content and free it, if required
-      if (nullptr != mCommandPacketBuffer)
-      {
-        memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-        delete [] mCommandPacketBuffer;
-      }
-
-      // Finalize
-      mCommandPacketBuffer = newCommandPacketBuffer;
-      mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+      growCommandPacketBuffer(newCommandPacketBufferNumberOfBytes);
     }
 
     // Get command package for the new command
@@ -413,18 +422,7 @@ public:
     {
       // Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
       const RECore::uint32 newCommandPacketBufferNumberOfBytes = commandBuffer.mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-      RECore::uint8* newCommandPacketBuffer = new RECore::uint8[newCommandPacketBufferNumberOfBytes];
-
-      // Copy over current command package buffer content and free it, if required
-      if (nullptr != commandBuffer.mCommandPacketBuffer)
-      {
-        memcpy(newCommandPacketBuffer, commandBuffer.mCommandPacketBuffer, commandBuffer.mCommandPacketBufferNumberOfBytes);
-        delete [] commandBuffer.mCommandPacketBuffer;
-      }
-
-      // Finalize
-      commandBuffer.mCommandPacketBuffer = newCommandPacketBuffer;
-      commandBuffer.mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+      commandBuffer.growCommandPacketBuffer(newCommandPacketBufferNumberOfBytes);
     }
 
     // Copy over the command buffer in one burst
@@ -472,9 +470,30 @@ public:
 private:
   static constexpr RECore::uint32 NUMBER_OF_BYTES_TO_GROW = 8192;
 
+  // Private methods
+private:
+  explicit RHICommandBuffer(const RHICommandBuffer&) = delete;
+  RHICommandBuffer& operator=(const RHICommandBuffer&) = delete;
+
+  /**
+  *  @brief
+  *    Grow the command packet buffer, the current content is kept
+  *
+  *  @param[in] newCommandPacketBufferNumberOfBytes
+  *    New number of command packet buffer bytes
+  */
+  inline void growCommandPacketBuffer(RECore::uint32 newCommandPacketBufferNumberOfBytes)
+  {
+    RECore::uint8* newCommandPacketBuffer = static_cast<RECore::uint8*>(mAllocator.reallocate(mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes, newCommandPacketBufferNumberOfBytes, 1));
+    ASSERT(nullptr != newCommandPacketBuffer, "Out of memory while growing the command packet buffer")
+    mCommandPacketBuffer = newCommandPacketBuffer;
+    mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
+  }
+
   // Private data
 private:
   // Memory
+  RECore::IAllocator& mAllocator;
   RECore::uint32 mCommandPacketBufferNumberOfBytes;
   RECore::uint8* mCommandPacketBuffer;
   // Current state
@@ -0,0 +1,354 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERHI/RERHI.h"
+#include "RERHI/Buffer/RHICommandBuffer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERHI
+{
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Redundant command filter, used by RHI implementations during command buffer dispatch
+*
+*  @remarks
+*    Command buffers are recorded without knowing which state is currently bound, so e.g. several compositor passes or render queue
+*    flushes in a row set the same pipeline state, resource groups, vertex array, viewport or scissor rectangle again. The filter
+*    shadows the bound state during dispatch and tells the RHI implementation which command packets are redundant and can be
+*    skipped before they reach the RHI implementation dispatch functions.
+*
+*    The filter is intentionally conservative:
+*    - Changing the root signature or the pipeline state forgets about the bound resource groups
+*    - Graphics and compute state changes forget about each other, some RHI implementations (e.g. OpenGL) share a single current program and resource bindings
+*    - Render target changes forget about everything
+*    - Every other command which isn't a draw, a compute dispatch, a query or a debug command forgets about everything
+*
+*  @note
+*    - Call "RERHI::RHIRedundantCommandFilter::reset()" whenever the bound RHI implementation state is unknown, e.g. at the beginning of a top-level command buffer dispatch
+*/
+class RHIRedundantCommandFilter final
+{
+
+  // Public definitions
+public:
+  static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_TRACKED_RESOURCE_GROUPS = 8;	///< Resource groups with a higher root parameter index are never filtered
+
+  // Public methods
+public:
+  inline RHIRedundantCommandFilter() :
+    mEnabled(true)
+  {
+    reset();
+    resetCounters();
+  }
+
+  [[nodiscard]] inline bool isEnabled() const
+  {
+    return mEnabled;
+  }
+
+  inline void setEnabled(bool enabled)
+  {
+    mEnabled = enabled;
+    reset();
+  }
+
+  /**
+  *  @brief
+  *    Forget about the tracked bound state
+  */
+  inline void reset()
+  {
+    mGraphicsState = {};
+    mComputeState = {};
+    mVertexArrayKnown = false;
+    mVertexArray = nullptr;
+    mViewportKnown = false;
+    mViewport = {};
+    mScissorRectangleKnown = false;
+    mScissorRectangle = {};
+  }
+
+  //[-------------------------------------------------------]
+  //[ Counters                                              ]
+  //[-------------------------------------------------------]
+  inline void resetCounters()
+  {
+    mNumberOfProcessedCommands = 0;
+    for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS); ++i)
+    {
+      mNumberOfFilteredCommands[i] = 0;
+    }
+  }
+
+  [[nodiscard]] inline RECore::uint32 getNumberOfProcessedCommands() const
+  {
+    return mNumberOfProcessedCommands;
+  }
+
+  [[nodiscard]] inline RECore::uint32 getNumberOfFilteredCommands(CommandDispatchFunctionIndex commandDispatchFunctionIndex) const
+  {
+    return mNumberOfFilteredCommands[static_cast<RECore::uint32>(commandDispatchFunctionIndex)];
+  }
+
+  [[nodiscard]] inline RECore::uint32 getNumberOfFilteredCommands() const
+  {
+    RECore::uint32 numberOfFilteredCommands = 0;
+    for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS); ++i)
+    {
+      numberOfFilteredCommands += mNumberOfFilteredCommands[i];
+    }
+    return numberOfFilteredCommands;
+  }
+
+  //[-------------------------------------------------------]
+  //[ Filter                                                ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Check whether or not a command packet is redundant and update the tracked bound state
+  *
+  *  @param[in] commandDispatchFunctionIndex
+  *    Command dispatch function index of the command packet
+  *  @param[in] command
+  *    Command of the command packet, see "RERHI::CommandPacketHelper::loadCommand()"
+  *
+  *  @return
+  *    "true" if the command packet is redundant and mustn't be dispatched, else "false"
+  */
+  [[nodiscard]] inline bool isRedundant(CommandDispatchFunctionIndex commandDispatchFunctionIndex, const void* command)
+  {
+    ++mNumberOfProcessedCommands;
+    if (!mEnabled)
+    {
+      return false;
+    }
+
+    bool redundant = false;
+    switch (commandDispatchFunctionIndex)
+    {
+      // Graphics
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_ROOT_SIGNATURE:
+        redundant = setRootSignature(mGraphicsState, mComputeState, static_cast<const Command::SetGraphicsRootSignature*>(command)->rootSignature);
+        break;
+
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE:
+        redundant = setPipelineState(mGraphicsState, mComputeState, static_cast<const Command::SetGraphicsPipelineState*>(command)->graphicsPipelineState);
+        break;
+
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP:
+      {
+        const Command::SetGraphicsResourceGroup* setGraphicsResourceGroup = static_cast<const Command::SetGraphicsResourceGroup*>(command);
+        redundant = setResourceGroup(mGraphicsState, mComputeState, setGraphicsResourceGroup->rootParameterIndex, setGraphicsResourceGroup->resourceGroup);
+        break;
+      }
+
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY:
+      {
+        const RHIVertexArray* vertexArray = static_cast<const Command::SetGraphicsVertexArray*>(command)->vertexArray;
+        redundant = (mVertexArrayKnown && mVertexArray == vertexArray);
+        mVertexArrayKnown = true;
+        mVertexArray = vertexArray;
+        break;
+      }
+
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_VIEWPORTS:
+      {
+        const Command::SetGraphicsViewports* setGraphicsViewports = static_cast<const Command::SetGraphicsViewports*>(command);
+        if (1 == setGraphicsViewports->numberOfViewports)
+        {
+          const Viewport* viewport = (nullptr != setGraphicsViewports->viewports) ? setGraphicsViewports->viewports : reinterpret_cast<const Viewport*>(CommandPacketHelper::getAuxiliaryMemory(setGraphicsViewports));
+          redundant = (mViewportKnown && memcmp(&mViewport, viewport, sizeof(Viewport)) == 0);
+          mViewportKnown = true;
+          mViewport = *viewport;
+        }
+        else
+        {
+          mViewportKnown = false;
+        }
+        break;
+      }
+
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_SCISSOR_RECTANGLES:
+      {
+        const Command::SetGraphicsScissorRectangles* setGraphicsScissorRectangles = static_cast<const Command::SetGraphicsScissorRectangles*>(command);
+        if (1 == setGraphicsScissorRectangles->numberOfScissorRectangles)
+        {
+          const ScissorRectangle* scissorRectangle = (nullptr != setGraphicsScissorRectangles->scissorRectangles) ? setGraphicsScissorRectangles->scissorRectangles : reinterpret_cast<const ScissorRectangle*>(CommandPacketHelper::getAuxiliaryMemory(setGraphicsScissorRectangles));
+          redundant = (mScissorRectangleKnown && memcmp(&mScissorRectangle, scissorRectangle, sizeof(ScissorRectangle)) == 0);
+          mScissorRectangleKnown = true;
+          mScissorRectangle = *scissorRectangle;
+        }
+        else
+        {
+          mScissorRectangleKnown = false;
+        }
+        break;
+      }
+
+      // Compute
+      case CommandDispatchFunctionIndex::SET_COMPUTE_ROOT_SIGNATURE:
+        redundant = setRootSignature(mComputeState, mGraphicsState, static_cast<const Command::SetComputeRootSignature*>(command)->rootSignature);
+        break;
+
+      case CommandDispatchFunctionIndex::SET_COMPUTE_PIPELINE_STATE:
+        redundant = setPipelineState(mComputeState, mGraphicsState, static_cast<const Command::SetComputePipelineState*>(command)->computePipelineState);
+        break;
+
+      case CommandDispatchFunctionIndex::SET_COMPUTE_RESOURCE_GROUP:
+      {
+        const Command::SetComputeResourceGroup* setComputeResourceGroup = static_cast<const Command::SetComputeResourceGroup*>(command);
+        redundant = setResourceGroup(mComputeState, mGraphicsState, setComputeResourceGroup->rootParameterIndex, setComputeResourceGroup->resourceGroup);
+        break;
+      }
+
+      // Commands which don't change the bound state
+      // -> Nested command buffers are dispatched through the same filter, so they keep the tracked state up-to-date
+      case CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+      case CommandDispatchFunctionIndex::DRAW_GRAPHICS:
+      case CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS:
+      case CommandDispatchFunctionIndex::DRAW_MESH_TASKS:
+      case CommandDispatchFunctionIndex::DISPATCH_COMPUTE:
+      case CommandDispatchFunctionIndex::RESET_QUERY_POOL:
+      case CommandDispatchFunctionIndex::BEGIN_QUERY:
+      case CommandDispatchFunctionIndex::END_QUERY:
+      case CommandDispatchFunctionIndex::WRITE_TIMESTAMP_QUERY:
+      case CommandDispatchFunctionIndex::SET_DEBUG_MARKER:
+      case CommandDispatchFunctionIndex::BEGIN_DEBUG_EVENT:
+      case CommandDispatchFunctionIndex::END_DEBUG_EVENT:
+        break;
+
+      // Render target changes and everything else might touch RHI implementation state behind our back
+      case CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET:
+      case CommandDispatchFunctionIndex::CLEAR_GRAPHICS:
+      case CommandDispatchFunctionIndex::SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX:
+      case CommandDispatchFunctionIndex::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+      case CommandDispatchFunctionIndex::COPY_RESOURCE:
+      case CommandDispatchFunctionIndex::GENERATE_MIPMAPS:
+      case CommandDispatchFunctionIndex::COPY_UNIFORM_BUFFER_DATA:
+      case CommandDispatchFunctionIndex::SET_UNIFORM:
+      case CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+        reset();
+        break;
+    }
+    if (redundant)
+    {
+      ++mNumberOfFilteredCommands[static_cast<RECore::uint32>(commandDispatchFunctionIndex)];
+    }
+    return redundant;
+  }
+
+  // Private definitions
+private:
+  struct PipelineState final
+  {
+    bool			  rootSignatureKnown = false;
+    const void*		  rootSignature = nullptr;
+    bool			  pipelineStateKnown = false;
+    const void*		  pipelineState = nullptr;
+    RECore::uint32	  resourceGroupsKnownMask = 0;	///< One bit per root parameter index
+    const RHIResourceGroup* resourceGroups[MAXIMUM_NUMBER_OF_TRACKED_RESOURCE_GROUPS] = {};
+  };
+
+  // Private static methods
+private:
+  [[nodiscard]] static inline bool setRootSignature(PipelineState& pipelineState, PipelineState& otherPipelineState, const void* rootSignature)
+  {
+    if (pipelineState.rootSignatureKnown && pipelineState.rootSignature == rootSignature)
+    {
+      return true;
+    }
+    pipelineState.rootSignatureKnown = true;
+    pipelineState.rootSignature = rootSignature;
+    pipelineState.resourceGroupsKnownMask = 0;
+    otherPipelineState = {};
+    return false;
+  }
+
+  [[nodiscard]] static inline bool setPipelineState(PipelineState& pipelineState, PipelineState& otherPipelineState, const void* pipelineStateObject)
+  {
+    if (pipelineState.pipelineStateKnown && pipelineState.pipelineState == pipelineStateObject)
+    {
+      return true;
+    }
+    pipelineState.pipelineStateKnown = true;
+    pipelineState.pipelineState = pipelineStateObject;
+    pipelineState.resourceGroupsKnownMask = 0;
+    otherPipelineState = {};
+    return false;
+  }
+
+  [[nodiscard]] static inline bool setResourceGroup(PipelineState& pipelineState, PipelineState& otherPipelineState, RECore::uint32 rootParameterIndex, const RHIResourceGroup* resourceGroup)
+  {
+    otherPipelineState = {};
+    if (rootParameterIndex >= MAXIMUM_NUMBER_OF_TRACKED_RESOURCE_GROUPS)
+    {
+      return false;
+    }
+    const RECore::uint32 bit = (1u << rootParameterIndex);
+    if ((pipelineState.resourceGroupsKnownMask & bit) && pipelineState.resourceGroups[rootParameterIndex] == resourceGroup)
+    {
+      return true;
+    }
+    pipelineState.resourceGroupsKnownMask |= bit;
+    pipelineState.resourceGroups[rootParameterIndex] = resourceGroup;
+    return false;
+  }
+
+  // Private data
+private:
+  bool		   mEnabled;
+  // Tracked bound state
+  PipelineState		 mGraphicsState;
+  PipelineState		 mComputeState;
+  bool				 mVertexArrayKnown;
+  const RHIVertexArray* mVertexArray;
+  bool				 mViewportKnown;
+  Viewport			 mViewport;
+  bool				 mScissorRectangleKnown;
+  ScissorRectangle	 mScissorRectangle;
+  // Counters
+  RECore::uint32 mNumberOfProcessedCommands;
+  RECore::uint32 mNumberOfFilteredCommands[static_cast<RECore::uint32>(CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)];
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERHI
@@ -76,6 +76,7 @@ public:
   bool				drawInstanced;									///< Draw instanced supported? (shader model 4 feature, build in shader variable holding the current instance ID)
   bool				baseVertex;										///< Base vertex supported for draw calls?
   bool				nativeMultithreading;							///< Does the RHI support native multithreading? For example Direct3D 11 does meaning we can also create RHI resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
+  bool				threadedSubmission;								///< Can command buffers be dispatched and swap chains be presented by a thread other than the one which created the RHI instance? Accesses still have to be serialized by the caller. For example true for Vulkan, false for OpenGL since its context is bound to the creating thread.
   bool				shaderBytecode;									///< Shader bytecode supported?
   // Graphics
   bool				vertexShader;									///< Is there support for vertex shaders (VS)?
@@ -115,6 +116,7 @@ public:
     drawInstanced(false),
     baseVertex(false),
     nativeMultithreading(false),
+    threadedSubmission(false),
     shaderBytecode(false),
     vertexShader(false),
     maximumNumberOfPatchVertices(0),
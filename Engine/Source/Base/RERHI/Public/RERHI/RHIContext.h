@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHI/RERHI.h"
+#include <RECore/Memory/Memory.h>
 
 
 //[-------------------------------------------------------]
@@ -79,7 +80,8 @@ public:
     mNativeWindowHandle(nativeWindowHandle),
     mUseExternalContext(useExternalContext),
     mContextType(contextType),
-    mRhiApiSharedLibrary(nullptr)
+    mRhiApiSharedLibrary(nullptr),
+    mAllocator(&RECore::Memory::getAllocator())
   {}
 
   /**
@@ -149,6 +151,33 @@ public:
     mRhiApiSharedLibrary = rhiApiSharedLibrary;
   }
 
+  /**
+  *  @brief
+  *    Return the allocator used for RHI objects and RHI internal memory
+  *
+  *  @return
+  *    The allocator, by default the global "RECore::Memory" allocator
+  */
+  [[nodiscard]] inline RECore::IAllocator& getAllocator() const
+  {
+    return *mAllocator;
+  }
+
+  /**
+  *  @brief
+  *    Set the allocator used for RHI objects and RHI internal memory, e.g. a "RECore::TlsfAllocator" so per-frame RHI objects like resource groups don't hit the global heap
+  *
+  *  @param[in] allocator
+  *    Allocator to use, must be multithreading safe and must stay valid as long as the RHI instance exists
+  *
+  *  @note
+  *    - Must be set before the RHI instance is created, all RHI objects are freed through the allocator they were allocated with
+  */
+  inline void setAllocator(RECore::IAllocator& allocator)
+  {
+    mAllocator = &allocator;
+  }
+
   // Private methods
 private:
   explicit RHIContext(const RHIContext&) = delete;
@@ -160,6 +189,7 @@ private:
   bool		mUseExternalContext;
   ContextType	mContextType;
   void*		mRhiApiSharedLibrary;	///< A handle to the RHI API shared library (e.g. obtained via "dlopen()" and co), can be a null pointer
+  RECore::IAllocator* mAllocator;	///< Allocator used for RHI objects and RHI internal memory, always valid, don't destroy the instance
 
 };
 
@@ -61,6 +61,7 @@ class RHIComputePipelineState;
 class RHIComputeShader;
 class RHISamplerState;
 class RHICommandBuffer;
+class RHIRedundantCommandFilter;
 
 
 //[-------------------------------------------------------]
@@ -511,6 +512,87 @@ public:
   */
   virtual void dispatchCommandBuffer(const RHICommandBuffer& commandBuffer) = 0;
 
+  /**
+  *  @brief
+  *    Return the redundant command filter used during command buffer dispatch
+  *
+  *  @return
+  *    The redundant command filter, null pointer if the RHI implementation dispatches every command packet as it is, do not destroy the instance
+  *
+  *  @note
+  *    - Can be used to enable or disable the filter and to read its counters
+  */
+  [[nodiscard]] virtual RHIRedundantCommandFilter* getRedundantCommandFilter()
+  {
+    return nullptr;
+  }
+
+  //[-------------------------------------------------------]
+  //[ Memory statistics                                     ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Get the device memory statistics
+  *
+  *  @param[out] memoryStatistics
+  *    Receives the device memory statistics, zeroed if "false" is returned
+  *
+  *  @return
+  *    "true" if all went fine, else "false" (e.g. the RHI implementation leaves device memory management to the driver)
+  *
+  *  @note
+  *    - Thread-safe, can be called while resources are created or destroyed by other threads
+  */
+  [[nodiscard]] virtual bool getMemoryStatistics(MemoryStatistics& memoryStatistics) const
+  {
+    memoryStatistics = {};
+    return false;
+  }
+
+  //[-------------------------------------------------------]
+  //[ Pipeline cache                                        ]
+  //[-------------------------------------------------------]
+  /**
+  *  @brief
+  *    Get the RHI implementation specific pipeline cache data, e.g. to store it on disk
+  *
+  *  @param[in, out] numberOfDataBytes
+  *    If "data" is a null pointer this receives the number of bytes required, else the number of bytes "data" can hold on input and the number of written bytes on output
+  *  @param[out] data
+  *    Receives the pipeline cache data, can be a null pointer
+  *
+  *  @return
+  *    "true" if all went fine, else "false" (e.g. the RHI implementation has no pipeline cache)
+  *
+  *  @note
+  *    - The data is opaque and only valid for the RHI implementation and device which created it
+  */
+  [[nodiscard]] virtual bool getPipelineCacheData(RECore::uint32& numberOfDataBytes, [[maybe_unused]] RECore::uint8* data)
+  {
+    numberOfDataBytes = 0;
+    return false;
+  }
+
+  /**
+  *  @brief
+  *    Set the RHI implementation specific pipeline cache data, e.g. loaded from disk
+  *
+  *  @param[in] numberOfDataBytes
+  *    Number of data bytes
+  *  @param[in] data
+  *    Pipeline cache data previously received by "Rhi::RHIDynamicRHI::getPipelineCacheData()", must be valid
+  *
+  *  @return
+  *    "true" if all went fine, else "false" (e.g. the data was created by another device or driver version)
+  *
+  *  @note
+  *    - Must be called before the first pipeline state is created, else the pipeline states created so far won't benefit from the data
+  */
+  [[nodiscard]] virtual bool setPipelineCacheData([[maybe_unused]] RECore::uint32 numberOfDataBytes, [[maybe_unused]] const RECore::uint8* data)
+  {
+    return false;
+  }
+
   //[-------------------------------------------------------]
   //[ RHI implementation specific                           ]
   //[-------------------------------------------------------]
@@ -40,6 +40,21 @@ namespace RERHI
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+/**
+*  @brief
+*    Device memory statistics of a RHI instance
+*
+*  @see
+*    - "RERHI::RHIDynamicRHI::getMemoryStatistics()"
+*/
+struct MemoryStatistics final
+{
+  RECore::uint32 numberOfBlocks;					///< Current number of device memory blocks allocations are sub-allocated from
+  RECore::uint32 numberOfDedicatedAllocations;	///< Current number of dedicated device memory allocations
+  RECore::uint32 numberOfAllocations;				///< Current number of allocations, including dedicated allocations
+  RECore::uint64 numberOfAllocatedBytes;			///< Number of bytes allocated from the device, including not yet used block memory
+  RECore::uint64 numberOfUsedBytes;				///< Number of bytes handed out to allocations
+};
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -58,6 +58,7 @@
 #include "RERHI/RHIResource.h"
 #include "RERHI/RHIStatistics.h"
 #include "RERHI/Buffer/RHICommandBuffer.h"
+#include "RERHI/Buffer/RHIRedundantCommandFilter.h"
 #include "RERHI/Buffer/RHIBuffer.h"
 #include "RERHI/Buffer/RHIBufferTypes.h"
 #include "RERHI/Buffer/RHIStructuredBuffer.h"
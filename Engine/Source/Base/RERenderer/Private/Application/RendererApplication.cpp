@@ -24,6 +24,7 @@
 #include "RERenderer/Application/RendererApplication.h"
 #include "RERHI/Linux/X11Context.h"
 #include <RECore/Log/Log.h>
+#include <RECore/Memory/MemoryTracker.h>
 #include <RECore/File/PhysicsFSFileManager.h>
 #include <RECore/Asset/AssetManager.h>
 #include <RECore/Platform/Platform.h>
@@ -199,6 +200,7 @@ void RendererApplication::onCreateRendererContext() {
     typedef RERHI::RHIDynamicRHI *(*RHI_INSTANCER)(const RERHI::RHIContext &);
     RHI_INSTANCER _Creator = reinterpret_cast<RHI_INSTANCER>(pLib->getSymbol("createRhiInstance"));
     if (_Creator) {
+      RE_MEMORY_TAG_SCOPE("Rhi")
       this->mRhi = _Creator(*this->mRhiContext);
 
       if (this->mRhi) {
@@ -219,6 +221,7 @@ void RendererApplication::onCreateRendererContext() {
 
   // Create renderer instance
   {
+    RE_MEMORY_TAG_SCOPE("Renderer")
     mRendererContext = new RERenderer::Context(*mRhi, mcCoreContext);
     mRenderer = new RERenderer::RendererImpl(*mRendererContext);
     RE_LOG(Info,"Created renderer context")
@@ -26,33 +26,6 @@
 #include "RERenderer/Core/Renderer/RenderTargetTextureManager.h"
 #include "RERenderer/IRenderer.h"
 
-#include <algorithm>
-
-
-//[-------------------------------------------------------]
-//[ Anonymous detail namespace                            ]
-//[-------------------------------------------------------]
-namespace
-{
-	namespace detail
-	{
-
-
-		//[-------------------------------------------------------]
-		//[ Global functions                                      ]
-		//[-------------------------------------------------------]
-		[[nodiscard]] inline bool orderFramebufferElementByFramebufferSignatureId(const RERenderer::FramebufferManager::FramebufferElement& left, const RERenderer::FramebufferManager::FramebufferElement& right)
-		{
-			return (left.framebufferSignature.getFramebufferSignatureId() < right.framebufferSignature.getFramebufferSignatureId());
-		}
-
-
-//[-------------------------------------------------------]
-//[ Anonymous detail namespace                            ]
-//[-------------------------------------------------------]
-	} // detail
-}
-
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -67,14 +40,15 @@ namespace RERenderer
 	void FramebufferManager::clear()
 	{
 		clearRhiResources();
-		mSortedFramebufferVector.clear();
+		mFramebufferElements.clear();
 		mCompositorFramebufferIdToFramebufferSignatureId.clear();
 	}
 
 	void FramebufferManager::clearRhiResources()
 	{
-		for (FramebufferElement& framebufferElement : mSortedFramebufferVector)
+		for (auto& framebufferElementPair : mFramebufferElements)
 		{
+			FramebufferElement& framebufferElement = framebufferElementPair.second;
 			if (nullptr != framebufferElement.framebuffer)
 			{
 				framebufferElement.framebuffer->Release();
@@ -85,21 +59,9 @@ namespace RERenderer
 
 	void FramebufferManager::addFramebuffer(CompositorFramebufferId compositorFramebufferId, const FramebufferSignature& framebufferSignature)
 	{
-		FramebufferElement framebufferElement(framebufferSignature);
-		SortedFramebufferVector::iterator iterator = std::lower_bound(mSortedFramebufferVector.begin(), mSortedFramebufferVector.end(), framebufferElement, ::detail::orderFramebufferElementByFramebufferSignatureId);
-		if (iterator == mSortedFramebufferVector.end() || iterator->framebufferSignature.getFramebufferSignatureId() != framebufferElement.framebufferSignature.getFramebufferSignatureId())
-		{
-			// Add new framebuffer
-
-			// Register the new framebuffer element
-			++framebufferElement.numberOfReferences;
-			mSortedFramebufferVector.insert(iterator, framebufferElement);
-		}
-		else
-		{
-			// Just increase the number of references
-			++iterator->numberOfReferences;
-		}
+		// Add new framebuffer or just increase the number of references
+		FramebufferElements::iterator iterator = mFramebufferElements.try_emplace(framebufferSignature.getFramebufferSignatureId(), framebufferSignature).first;
+		++iterator->second.numberOfReferences;
 		mCompositorFramebufferIdToFramebufferSignatureId.emplace(compositorFramebufferId, framebufferSignature.getFramebufferSignatureId());
 	}
 
@@ -111,16 +73,10 @@ namespace RERenderer
 		CompositorFramebufferIdToFramebufferSignatureId::const_iterator iterator = mCompositorFramebufferIdToFramebufferSignatureId.find(compositorFramebufferId);
 		if (mCompositorFramebufferIdToFramebufferSignatureId.cend() != iterator)
 		{
-			// TODO(naetherm) Is there need for a more efficient search?
-			const FramebufferSignatureId framebufferSignatureId = iterator->second;
-			for (const FramebufferElement& framebufferElement : mSortedFramebufferVector)
+			FramebufferElements::const_iterator framebufferElementIterator = mFramebufferElements.find(iterator->second);
+			if (mFramebufferElements.cend() != framebufferElementIterator)
 			{
-				const FramebufferSignature& framebufferSignature = framebufferElement.framebufferSignature;
-				if (framebufferSignature.getFramebufferSignatureId() == framebufferSignatureId)
-				{
-					framebuffer = framebufferElement.framebuffer;
-					break;
-				}
+				framebuffer = framebufferElementIterator->second.framebuffer;
 			}
 			ASSERT(nullptr != framebuffer, "Invalid framebuffer")
 		}
@@ -142,73 +98,70 @@ namespace RERenderer
 		CompositorFramebufferIdToFramebufferSignatureId::const_iterator iterator = mCompositorFramebufferIdToFramebufferSignatureId.find(compositorFramebufferId);
 		if (mCompositorFramebufferIdToFramebufferSignatureId.cend() != iterator)
 		{
-			// TODO(naetherm) Is there need for a more efficient search?
-			const FramebufferSignatureId framebufferSignatureId = iterator->second;
-			for (FramebufferElement& framebufferElement : mSortedFramebufferVector)
+			FramebufferElements::iterator framebufferElementIterator = mFramebufferElements.find(iterator->second);
+			if (mFramebufferElements.end() != framebufferElementIterator)
 			{
+				FramebufferElement& framebufferElement = framebufferElementIterator->second;
 				const FramebufferSignature& framebufferSignature = framebufferElement.framebufferSignature;
-				if (framebufferSignature.getFramebufferSignatureId() == framebufferSignatureId)
+
+				// Do we need to create the RHI framebuffer instance right now?
+				if (nullptr == framebufferElement.framebuffer)
 				{
-					// Do we need to create the RHI framebuffer instance right now?
-					if (nullptr == framebufferElement.framebuffer)
+					// Get the color texture instances
+					RERHI::TextureFormat::Enum colorTextureFormats[8] = { RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN };
+					const RECore::uint8 numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
+					ASSERT(numberOfColorAttachments < 8, "Invalid number of color attachments")
+					RERHI::FramebufferAttachment colorFramebufferAttachments[8];
+					RECore::uint8 usedNumberOfMultisamples = 0;
+					for (RECore::uint8 i = 0; i < numberOfColorAttachments; ++i)
 					{
-						// Get the color texture instances
-						RERHI::TextureFormat::Enum colorTextureFormats[8] = { RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN, RERHI::TextureFormat::Enum::UNKNOWN };
-						const RECore::uint8 numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
-						ASSERT(numberOfColorAttachments < 8, "Invalid number of color attachments")
-						RERHI::FramebufferAttachment colorFramebufferAttachments[8];
-						RECore::uint8 usedNumberOfMultisamples = 0;
-						for (RECore::uint8 i = 0; i < numberOfColorAttachments; ++i)
+						const FramebufferSignatureAttachment& framebufferSignatureAttachment = framebufferSignature.getColorFramebufferSignatureAttachment(i);
+						const AssetId colorTextureAssetId = framebufferSignatureAttachment.textureAssetId;
+						const RenderTargetTextureSignature* colorRenderTargetTextureSignature = nullptr;
+						RERHI::FramebufferAttachment& framebufferAttachment = colorFramebufferAttachments[i];
+						framebufferAttachment.texture = RECore::isValid(colorTextureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(colorTextureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &colorRenderTargetTextureSignature) : nullptr;
+						ASSERT(nullptr != framebufferAttachment.texture, "Invalid framebuffer attachment texture")
+						framebufferAttachment.mipmapIndex = framebufferSignatureAttachment.mipmapIndex;
+						framebufferAttachment.layerIndex = framebufferSignatureAttachment.layerIndex;
+						ASSERT(nullptr != colorRenderTargetTextureSignature, "Invalid color render target texture signature")
+						if (0 == usedNumberOfMultisamples)
 						{
-							const FramebufferSignatureAttachment& framebufferSignatureAttachment = framebufferSignature.getColorFramebufferSignatureAttachment(i);
-							const AssetId colorTextureAssetId = framebufferSignatureAttachment.textureAssetId;
-							const RenderTargetTextureSignature* colorRenderTargetTextureSignature = nullptr;
-							RERHI::FramebufferAttachment& framebufferAttachment = colorFramebufferAttachments[i];
-							framebufferAttachment.texture = RECore::isValid(colorTextureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(colorTextureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &colorRenderTargetTextureSignature) : nullptr;
-							ASSERT(nullptr != framebufferAttachment.texture, "Invalid framebuffer attachment texture")
-							framebufferAttachment.mipmapIndex = framebufferSignatureAttachment.mipmapIndex;
-							framebufferAttachment.layerIndex = framebufferSignatureAttachment.layerIndex;
-							ASSERT(nullptr != colorRenderTargetTextureSignature, "Invalid color render target texture signature")
-							if (0 == usedNumberOfMultisamples)
-							{
-								usedNumberOfMultisamples = ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
-							}
-							else
-							{
-								ASSERT(1 == usedNumberOfMultisamples || ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
-							}
-							colorTextureFormats[i] = colorRenderTargetTextureSignature->getTextureFormat();
+							usedNumberOfMultisamples = ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
 						}
+						else
+						{
+							ASSERT(1 == usedNumberOfMultisamples || ((colorRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
+						}
+						colorTextureFormats[i] = colorRenderTargetTextureSignature->getTextureFormat();
+					}
 
-						// Get the depth stencil texture instances
-						const FramebufferSignatureAttachment& depthStencilFramebufferSignatureAttachment = framebufferSignature.getDepthStencilFramebufferSignatureAttachment();
-						const RenderTargetTextureSignature* depthStencilRenderTargetTextureSignature = nullptr;
-						RERHI::FramebufferAttachment depthStencilFramebufferAttachment(RECore::isValid(depthStencilFramebufferSignatureAttachment.textureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(depthStencilFramebufferSignatureAttachment.textureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &depthStencilRenderTargetTextureSignature) : nullptr, depthStencilFramebufferSignatureAttachment.mipmapIndex, depthStencilFramebufferSignatureAttachment.layerIndex);
-						if (nullptr != depthStencilRenderTargetTextureSignature)
+					// Get the depth stencil texture instances
+					const FramebufferSignatureAttachment& depthStencilFramebufferSignatureAttachment = framebufferSignature.getDepthStencilFramebufferSignatureAttachment();
+					const RenderTargetTextureSignature* depthStencilRenderTargetTextureSignature = nullptr;
+					RERHI::FramebufferAttachment depthStencilFramebufferAttachment(RECore::isValid(depthStencilFramebufferSignatureAttachment.textureAssetId) ? mRenderTargetTextureManager.getTextureByAssetId(depthStencilFramebufferSignatureAttachment.textureAssetId, renderTarget, numberOfMultisamples, resolutionScale, &depthStencilRenderTargetTextureSignature) : nullptr, depthStencilFramebufferSignatureAttachment.mipmapIndex, depthStencilFramebufferSignatureAttachment.layerIndex);
+					if (nullptr != depthStencilRenderTargetTextureSignature)
+					{
+						if (0 == usedNumberOfMultisamples)
 						{
-							if (0 == usedNumberOfMultisamples)
-							{
-								usedNumberOfMultisamples = ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
-							}
-							else
-							{
-								ASSERT(1 == usedNumberOfMultisamples || ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
-							}
+							usedNumberOfMultisamples = ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u;
 						}
-						const RERHI::TextureFormat::Enum depthStencilTextureFormat = (nullptr != depthStencilRenderTargetTextureSignature) ? depthStencilRenderTargetTextureSignature->getTextureFormat() : RERHI::TextureFormat::Enum::UNKNOWN;
+						else
+						{
+							ASSERT(1 == usedNumberOfMultisamples || ((depthStencilRenderTargetTextureSignature->getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0), "Invalid number of multisamples")
+						}
+					}
+					const RERHI::TextureFormat::Enum depthStencilTextureFormat = (nullptr != depthStencilRenderTargetTextureSignature) ? depthStencilRenderTargetTextureSignature->getTextureFormat() : RERHI::TextureFormat::Enum::UNKNOWN;
 
-						// Get or create the managed render pass
-						RERHI::RHIRenderPass* renderPass = mRenderPassManager.getOrCreateRenderPass(numberOfColorAttachments, colorTextureFormats, depthStencilTextureFormat, usedNumberOfMultisamples);
-						ASSERT(nullptr != renderPass, "Invalid render pass")
+					// Get or create the managed render pass
+					RERHI::RHIRenderPass* renderPass = mRenderPassManager.getOrCreateRenderPass(numberOfColorAttachments, colorTextureFormats, depthStencilTextureFormat, usedNumberOfMultisamples);
+					ASSERT(nullptr != renderPass, "Invalid render pass")
 
-						// Create the framebuffer object (FBO) instance
-						// -> The framebuffer automatically adds a reference to the provided textures
-						framebufferElement.framebuffer = mRenderTargetTextureManager.getRenderer().getRhi().createFramebuffer(*renderPass, colorFramebufferAttachments, ((nullptr != depthStencilFramebufferAttachment.texture) ? &depthStencilFramebufferAttachment : nullptr) RHI_RESOURCE_DEBUG_NAME("Framebuffer manager"));
-						framebufferElement.framebuffer->AddReference();
-					}
-					framebuffer = framebufferElement.framebuffer;
-					break;
+					// Create the framebuffer object (FBO) instance
+					// -> The framebuffer automatically adds a reference to the provided textures
+					framebufferElement.framebuffer = mRenderTargetTextureManager.getRenderer().getRhi().createFramebuffer(*renderPass, colorFramebufferAttachments, ((nullptr != depthStencilFramebufferAttachment.texture) ? &depthStencilFramebufferAttachment : nullptr) RHI_RESOURCE_DEBUG_NAME("Framebuffer manager"));
+					framebufferElement.framebuffer->AddReference();
 				}
+				framebuffer = framebufferElement.framebuffer;
 			}
 			ASSERT(nullptr != framebuffer, "Invalid framebuffer")
 		}
@@ -224,22 +177,22 @@ namespace RERenderer
 
 	void FramebufferManager::releaseFramebufferBySignature(const FramebufferSignature& framebufferSignature)
 	{
-		const FramebufferElement framebufferElement(framebufferSignature);
-		SortedFramebufferVector::iterator iterator = std::lower_bound(mSortedFramebufferVector.begin(), mSortedFramebufferVector.end(), framebufferElement, ::detail::orderFramebufferElementByFramebufferSignatureId);
-		if (iterator != mSortedFramebufferVector.end() && iterator->framebufferSignature.getFramebufferSignatureId() == framebufferElement.framebufferSignature.getFramebufferSignatureId())
+		FramebufferElements::iterator iterator = mFramebufferElements.find(framebufferSignature.getFramebufferSignatureId());
+		if (mFramebufferElements.end() != iterator)
 		{
 			// Was this the last reference?
-			if (1 == iterator->numberOfReferences)
+			FramebufferElement& framebufferElement = iterator->second;
+			if (1 == framebufferElement.numberOfReferences)
 			{
-				if (nullptr != iterator->framebuffer)
+				if (nullptr != framebufferElement.framebuffer)
 				{
-					iterator->framebuffer->Release();
+					framebufferElement.framebuffer->Release();
 				}
-				mSortedFramebufferVector.erase(iterator);
+				mFramebufferElements.erase(iterator);
 			}
 			else
 			{
-				--iterator->numberOfReferences;
+				--framebufferElement.numberOfReferences;
 			}
 		}
 		else
@@ -29,31 +29,6 @@
 #include <algorithm>
 
 
-//[-------------------------------------------------------]
-//[ Anonymous detail namespace                            ]
-//[-------------------------------------------------------]
-namespace
-{
-	namespace detail
-	{
-
-
-		//[-------------------------------------------------------]
-		//[ Global functions                                      ]
-		//[-------------------------------------------------------]
-		[[nodiscard]] inline bool orderRenderTargetTextureElementByRenderTargetTextureSignatureId(const RERenderer::RenderTargetTextureManager::RenderTargetTextureElement& left, const RERenderer::RenderTargetTextureManager::RenderTargetTextureElement& right)
-		{
-			return (left.renderTargetTextureSignature.getRenderTargetTextureSignatureId() < right.renderTargetTextureSignature.getRenderTargetTextureSignatureId());
-		}
-
-
-//[-------------------------------------------------------]
-//[ Anonymous detail namespace                            ]
-//[-------------------------------------------------------]
-	} // detail
-}
-
-
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -67,167 +42,150 @@ namespace RERenderer
 	void RenderTargetTextureManager::clear()
 	{
 		clearRhiResources();
-		mSortedRenderTargetTextureVector.clear();
-		mAssetIdToRenderTargetTextureSignatureId.clear();
+		mRenderTargetTextureElements.clear();
 		mAssetIdToIndex.clear();
 	}
 
 	void RenderTargetTextureManager::clearRhiResources()
 	{
-		TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
-		for (RenderTargetTextureElement& renderTargetTextureElement : mSortedRenderTargetTextureVector)
+		for (RenderTargetTextureElement& renderTargetTextureElement : mRenderTargetTextureElements)
 		{
-			{ // Unload texture resource
-				TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(renderTargetTextureElement.assetId);
-				if (nullptr != textureResource)
-				{
-					textureResource->setTexture(nullptr);
-				}
-			}
-
-			// Release RHI texture reference
-			if (nullptr != renderTargetTextureElement.texture)
-			{
-				renderTargetTextureElement.texture->Release();
-				renderTargetTextureElement.texture = nullptr;
-			}
+			releaseTexture(renderTargetTextureElement);
 		}
+		mNumberOfTextureBytes = 0;
+		mNumberOfSavedTextureBytes = 0;
 	}
 
 	void RenderTargetTextureManager::addRenderTargetTexture(AssetId assetId, const RenderTargetTextureSignature& renderTargetTextureSignature)
 	{
-		RenderTargetTextureElement renderTargetTextureElement(assetId, renderTargetTextureSignature);
-
-		// TODO(naetherm) The render target texture and framebuffer handling is still under construction regarding recycling RHI resources etc. - so for now, just add render target textures to have something to start with
-		{ // Add new render target texture
-			// Register the new render target texture element
-			++renderTargetTextureElement.numberOfReferences;
-			mSortedRenderTargetTextureVector.push_back(renderTargetTextureElement);
-			mAssetIdToIndex.emplace(assetId, static_cast<RECore::uint32>(mSortedRenderTargetTextureVector.size() - 1));
-		}
-		/*
-		SortedRenderTargetTextureVector::iterator iterator = std::lower_bound(mSortedRenderTargetTextureVector.begin(), mSortedRenderTargetTextureVector.end(), renderTargetTextureElement, ::detail::orderRenderTargetTextureElementByRenderTargetTextureSignatureId);
-		if (iterator == mSortedRenderTargetTextureVector.end() || iterator->renderTargetTextureSignature.getRenderTargetTextureSignatureId() != renderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId())
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		if (mAssetIdToIndex.cend() == iterator)
 		{
-			// Add new render target texture
-
 			// Register the new render target texture element
+			RenderTargetTextureElement& renderTargetTextureElement = mRenderTargetTextureElements.emplace_back(assetId, renderTargetTextureSignature);
 			++renderTargetTextureElement.numberOfReferences;
-			mSortedRenderTargetTextureVector.insert(iterator, renderTargetTextureElement);
+			mAssetIdToIndex.emplace(assetId, static_cast<RECore::uint32>(mRenderTargetTextureElements.size() - 1));
 		}
 		else
 		{
 			// Just increase the number of references
-			++iterator->numberOfReferences;
+			RenderTargetTextureElement& renderTargetTextureElement = mRenderTargetTextureElements[iterator->second];
+			ASSERT(renderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId() == renderTargetTextureSignature.getRenderTargetTextureSignatureId(), "Render target texture asset ID registered with different signatures")
+			++renderTargetTextureElement.numberOfReferences;
 		}
-		mAssetIdToRenderTargetTextureSignatureId.emplace(assetId, renderTargetTextureSignature.getRenderTargetTextureSignatureId());
-		*/
 	}
 
 	RERHI::RHITexture* RenderTargetTextureManager::getTextureByAssetId(AssetId assetId, const RERHI::RHIRenderTarget& renderTarget, RECore::uint8 numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature)
 	{
 		RERHI::RHITexture* texture = nullptr;
 
-		// Map asset ID to render target texture signature ID
-		// TODO(naetherm) The render target texture and framebuffer handling is still under construction regarding recycling RHI resources etc. - so for now, just add render target textures to have something to start with
-		/*
-		AssetIdToRenderTargetTextureSignatureId::const_iterator iterator = mAssetIdToRenderTargetTextureSignatureId.find(assetId);
-		if (mAssetIdToRenderTargetTextureSignatureId.cend() != iterator)
-		{
-			// TODO(naetherm) Is there need for a more efficient search?
-			const RenderTargetTextureSignatureId renderTargetTextureSignatureId = iterator->second;
-			for (RenderTargetTextureElement& renderTargetTextureElement : mSortedRenderTargetTextureVector)
-			*/
+		// Map asset ID to render target texture element
 		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
 		if (mAssetIdToIndex.cend() != iterator)
 		{
-			RenderTargetTextureElement& renderTargetTextureElement = mSortedRenderTargetTextureVector[iterator->second];
+			RenderTargetTextureElement& renderTargetTextureElement = mRenderTargetTextureElements[iterator->second];
 			const RenderTargetTextureSignature& renderTargetTextureSignature = renderTargetTextureElement.renderTargetTextureSignature;
 			if (nullptr != outRenderTargetTextureSignature)
 			{
 				*outRenderTargetTextureSignature = &renderTargetTextureSignature;
 			}
-			// if (renderTargetTextureSignature.getRenderTargetTextureSignatureId() == renderTargetTextureSignatureId)	// TODO(naetherm) The render target texture and framebuffer handling is still under construction regarding recycling RHI resources etc. - so for now, just add render target textures to have something to start with
+
+			// Do we need to create the RHI texture instance right now?
+			if (nullptr == renderTargetTextureElement.texture)
 			{
-				// Do we need to create the RHI texture instance right now?
-				if (nullptr == renderTargetTextureElement.texture)
+				// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
+				RECore::uint32 width = renderTargetTextureSignature.getWidth();
+				RECore::uint32 height = renderTargetTextureSignature.getHeight();
+				if (RECore::isInvalid(width) || RECore::isInvalid(height))
 				{
-					// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
-					RECore::uint32 width = renderTargetTextureSignature.getWidth();
-					RECore::uint32 height = renderTargetTextureSignature.getHeight();
-					if (RECore::isInvalid(width) || RECore::isInvalid(height))
+					RECore::uint32 renderTargetWidth = 1;
+					RECore::uint32 renderTargetHeight = 1;
+					renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
 					{
-						RECore::uint32 renderTargetWidth = 1;
-						RECore::uint32 renderTargetHeight = 1;
-						renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
-						if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
-						{
-							resolutionScale = 1.0f;
-						}
-						if (RECore::isInvalid(width))
+						resolutionScale = 1.0f;
+					}
+					if (RECore::isInvalid(width))
+					{
+						width = static_cast<RECore::uint32>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
+						if (width < 1)
 						{
-							width = static_cast<RECore::uint32>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
-							if (width < 1)
-							{
-								width = 1;
-							}
+							width = 1;
 						}
-						if (RECore::isInvalid(height))
+					}
+					if (RECore::isInvalid(height))
+					{
+						height = static_cast<RECore::uint32>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
+						if (height < 1)
 						{
-							height = static_cast<RECore::uint32>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
-							if (height < 1)
-							{
-								height = 1;
-							}
+							height = 1;
 						}
 					}
+				}
 
-					// Get texture flags
-					RECore::uint32 textureFlags = 0;
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
-					{
-						textureFlags |= RERHI::TextureFlag::UNORDERED_ACCESS;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
-					{
-						textureFlags |= RERHI::TextureFlag::SHADER_RESOURCE;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
-					{
-						textureFlags |= RERHI::TextureFlag::RENDER_TARGET;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
-					{
-						textureFlags |= RERHI::TextureFlag::GENERATE_MIPMAPS;
-						textureFlags |= RERHI::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
-					}
+				// Get texture flags
+				RECore::uint32 textureFlags = 0;
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
+				{
+					textureFlags |= RERHI::TextureFlag::UNORDERED_ACCESS;
+				}
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
+				{
+					textureFlags |= RERHI::TextureFlag::SHADER_RESOURCE;
+				}
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
+				{
+					textureFlags |= RERHI::TextureFlag::RENDER_TARGET;
+				}
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
+				{
+					textureFlags |= RERHI::TextureFlag::GENERATE_MIPMAPS;
+					textureFlags |= RERHI::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
+				}
 
+				// Estimated number of bytes, multisampling multiplies the memory consumption
+				const RECore::uint32 numberOfTextureBytes = RERHI::TextureFormat::getNumberOfBytesPerSlice(renderTargetTextureSignature.getTextureFormat(), width, height) * (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u);
+
+				// Share the RHI texture of another render target texture or create a new RHI texture
+				const bool aliased = RECore::isValid(renderTargetTextureElement.aliasedIndex);
+				if (aliased)
+				{
+					// The render target texture we're aliased onto has the same signature, so its RHI texture is compatible
+					// -> No element insertion can happen inside the call, so our element reference stays valid
+					renderTargetTextureElement.texture = getTextureByAssetId(mRenderTargetTextureElements[renderTargetTextureElement.aliasedIndex].assetId, renderTarget, numberOfMultisamples, resolutionScale, nullptr);
+					ASSERT(nullptr != renderTargetTextureElement.texture, "Invalid aliased texture")
+					mNumberOfSavedTextureBytes += numberOfTextureBytes;
+				}
+				else
+				{
 					// Create the texture instance, but without providing texture data (we use the texture as render target)
 					// -> Use the "RERHI::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
 					// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
 					// -> Not required for OpenGL and OpenGL ES 3
 					// -> The optimized texture clear value is a Direct3D 12 related option
 					renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, RERHI::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
-					renderTargetTextureElement.texture->AddReference();
+					mNumberOfTextureBytes += numberOfTextureBytes;
+				}
+				renderTargetTextureElement.texture->AddReference();
+				renderTargetTextureElement.numberOfTextureBytes = numberOfTextureBytes;
 
-					{ // Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
-						TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
-						TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(assetId);
-						if (nullptr == textureResource)
-						{
-							// Create texture resource
-							textureResourceManager.createTextureResourceByAssetId(assetId, *renderTargetTextureElement.texture);
-						}
-						else
-						{
-							// Update texture resource
-							textureResource->setTexture(renderTargetTextureElement.texture);
-						}
+				{ // Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
+					// -> The estimated number of bytes is used for the memory statistics, shared RHI textures are only accounted once
+					TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
+					TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(assetId);
+					if (nullptr == textureResource)
+					{
+						// Create texture resource
+						textureResourceManager.createTextureResourceByAssetId(assetId, *renderTargetTextureElement.texture, false, aliased ? 0u : numberOfTextureBytes);
+					}
+					else
+					{
+						// Update texture resource
+						textureResource->setTexture(renderTargetTextureElement.texture, aliased ? 0u : numberOfTextureBytes);
 					}
 				}
-				texture = renderTargetTextureElement.texture;
-				// break;	// TODO(naetherm) The render target texture and framebuffer handling is still under construction regarding recycling RHI resources etc. - so for now, just add render target textures to have something to start with
 			}
+			texture = renderTargetTextureElement.texture;
 			ASSERT(nullptr != texture, "Invalid texture")
 		}
 		else
@@ -244,41 +202,104 @@ namespace RERenderer
 		return texture;
 	}
 
-	void RenderTargetTextureManager::releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature)
+	void RenderTargetTextureManager::aliasRenderTargetTexture(AssetId assetId, AssetId aliasedAssetId)
 	{
-		const RenderTargetTextureElement renderTargetTextureElement(renderTargetTextureSignature);
-		SortedRenderTargetTextureVector::iterator iterator = std::lower_bound(mSortedRenderTargetTextureVector.begin(), mSortedRenderTargetTextureVector.end(), renderTargetTextureElement, ::detail::orderRenderTargetTextureElementByRenderTargetTextureSignatureId);
-		if (iterator != mSortedRenderTargetTextureVector.end() && iterator->renderTargetTextureSignature.getRenderTargetTextureSignatureId() == renderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId())
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		AssetIdToIndex::const_iterator aliasedIterator = mAssetIdToIndex.find(aliasedAssetId);
+		if (mAssetIdToIndex.cend() != iterator && mAssetIdToIndex.cend() != aliasedIterator)
 		{
-			// Was this the last reference?
-			if (1 == iterator->numberOfReferences)
-			{
-				{ // Unload texture resource
-					TextureResource* textureResource = mRenderer.getTextureResourceManager().getTextureResourceByAssetId(renderTargetTextureElement.assetId);
-					if (nullptr != textureResource)
-					{
-						textureResource->setTexture(nullptr);
-					}
-				}
+			const RECore::uint32 index = iterator->second;
+			RenderTargetTextureElement& renderTargetTextureElement = mRenderTargetTextureElements[index];
+			const RenderTargetTextureElement& aliasedRenderTargetTextureElement = mRenderTargetTextureElements[aliasedIterator->second];
+			ASSERT(renderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId() == aliasedRenderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId(), "Aliased render target textures must have the same signature")
 
-				// Release RHI texture reference
-				if (nullptr != iterator->texture)
-				{
-					iterator->texture->Release();
-				}
+			// Only one level of aliasing: Neither the render target texture we're aliased onto may share an RHI texture, nor may the render
+			// target texture itself own an RHI texture which is shared by other render target textures (e.g. due to another compositor workspace instance)
+			RECore::uint32 aliasedIndex = RECore::getInvalid<RECore::uint32>();
+			if (index != aliasedIterator->second && RECore::isInvalid(aliasedRenderTargetTextureElement.aliasedIndex) &&
+				std::none_of(mRenderTargetTextureElements.cbegin(), mRenderTargetTextureElements.cend(), [index](const RenderTargetTextureElement& currentRenderTargetTextureElement) { return (currentRenderTargetTextureElement.aliasedIndex == index); }))
+			{
+				aliasedIndex = aliasedIterator->second;
+			}
 
-				// Destroy render target texture instance
-				mSortedRenderTargetTextureVector.erase(iterator);
+			// The first decision is taken, on a contradicting decision the render target texture owns its RHI texture
+			if (!renderTargetTextureElement.aliasingDecided)
+			{
+				renderTargetTextureElement.aliasingDecided = true;
+				setAliasedIndex(renderTargetTextureElement, aliasedIndex);
 			}
-			else
+			else if (renderTargetTextureElement.aliasedIndex != aliasedIndex)
 			{
-				--iterator->numberOfReferences;
+				setAliasedIndex(renderTargetTextureElement, RECore::getInvalid<RECore::uint32>());
 			}
 		}
 		else
 		{
 			// Error!
-			ASSERT(false, "Render target texture signature isn't registered")
+			ASSERT(false, "Unknown asset ID, this shouldn't have happened")
+		}
+	}
+
+	void RenderTargetTextureManager::releaseRenderTargetTextureByAssetId(AssetId assetId)
+	{
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		if (mAssetIdToIndex.cend() != iterator)
+		{
+			// Was this the last reference?
+			RenderTargetTextureElement& renderTargetTextureElement = mRenderTargetTextureElements[iterator->second];
+			ASSERT(renderTargetTextureElement.numberOfReferences > 0, "Render target texture has already been released")
+			if (1 == renderTargetTextureElement.numberOfReferences)
+			{
+				// Release RHI texture reference, the render target texture element stays registered so element indices stay stable
+				releaseTexture(renderTargetTextureElement);
+			}
+			--renderTargetTextureElement.numberOfReferences;
+		}
+		else
+		{
+			// Error!
+			ASSERT(false, "Unknown asset ID, this shouldn't have happened")
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RenderTargetTextureManager::setAliasedIndex(RenderTargetTextureElement& renderTargetTextureElement, RECore::uint32 aliasedIndex)
+	{
+		if (renderTargetTextureElement.aliasedIndex != aliasedIndex)
+		{
+			// An already created RHI texture no longer fits, it's created again on the next use
+			releaseTexture(renderTargetTextureElement);
+			renderTargetTextureElement.aliasedIndex = aliasedIndex;
+		}
+	}
+
+	void RenderTargetTextureManager::releaseTexture(RenderTargetTextureElement& renderTargetTextureElement)
+	{
+		{ // Unload texture resource
+			TextureResource* textureResource = mRenderer.getTextureResourceManager().getTextureResourceByAssetId(renderTargetTextureElement.assetId);
+			if (nullptr != textureResource)
+			{
+				textureResource->setTexture(nullptr);
+			}
+		}
+
+		// Release RHI texture reference
+		if (nullptr != renderTargetTextureElement.texture)
+		{
+			if (RECore::isValid(renderTargetTextureElement.aliasedIndex))
+			{
+				mNumberOfSavedTextureBytes -= renderTargetTextureElement.numberOfTextureBytes;
+			}
+			else
+			{
+				mNumberOfTextureBytes -= renderTargetTextureElement.numberOfTextureBytes;
+			}
+			renderTargetTextureElement.numberOfTextureBytes = 0;
+			renderTargetTextureElement.texture->Release();
+			renderTargetTextureElement.texture = nullptr;
 		}
 	}
 
@@ -0,0 +1,369 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERenderer/Core/Renderer/RenderThread.h"
+#include "RERenderer/Core/Platform/PlatformManager.h"
+#include "RERenderer/IRenderer.h"
+#include <RECore/Log/Log.h>
+#include <RECore/Time/Stopwatch.h>
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	void RenderThread::setEnabled(bool enabled)
+	{
+		// State change?
+		if (mEnabled != enabled)
+		{
+			if (enabled)
+			{
+				// The submission thread dispatches to the RHI implementation, e.g. OpenGL contexts are bound to a thread
+				if (!mRenderer.getRhi().getCapabilities().threadedSubmission)
+				{
+					RE_LOG(Warning, "The render thread can't be enabled since the RHI implementation doesn't support threaded submission")
+					return;
+				}
+
+				// Create and start the submission thread, there are no frames in flight so the first frame slot is used next
+				mFirstFrameIndex = 0;
+				mRecordingFrameIndex = 0;
+				mShutdownSubmissionThread = false;
+				mSubmissionThread = std::thread(&RenderThread::submissionThreadWorker, this);
+				mEnabled = true;
+			}
+			else
+			{
+				// Ensure everything has been completed so that we can guarantee that everything is synchronous again
+				flush();
+
+				// Submission thread shutdown
+				{
+					std::lock_guard<std::mutex> submissionMutexLock(mSubmissionMutex);
+					mShutdownSubmissionThread = true;
+				}
+				mSubmissionConditionVariable.notify_all();
+				mSubmissionThread.join();
+				mEnabled = false;
+				mFirstFrameIndex = 0;
+				mRecordingFrameIndex = 0;
+			}
+		}
+	}
+
+	void RenderThread::setMaximumNumberOfFramesInFlight(RECore::uint32 maximumNumberOfFramesInFlight)
+	{
+		std::lock_guard<std::mutex> submissionMutexLock(mSubmissionMutex);
+		mMaximumNumberOfFramesInFlight = std::max(1u, std::min(maximumNumberOfFramesInFlight, MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT));
+	}
+
+	RenderThread::RhiLock RenderThread::lockRhi(bool waitForDispatchedFrames)
+	{
+		if (waitForDispatchedFrames && mEnabled)
+		{
+			std::unique_lock<std::mutex> submissionMutexLock(mSubmissionMutex);
+			mCompletionConditionVariable.wait(submissionMutexLock, [this]() { return (0 == mNumberOfUndispatchedFrames); });
+		}
+		return RhiLock(mRhiMutex);
+	}
+
+	void RenderThread::submit(const RERHI::RHICommandBuffer& commandBuffer, RERHI::RHIRenderTarget& renderTarget)
+	{
+		// Synchronous submission
+		if (!mEnabled)
+		{
+			if (!commandBuffer.isEmpty())
+			{
+				commandBuffer.dispatchToRhi(mRenderer.getRhi());
+			}
+			if (renderTarget.getResourceType() == RERHI::ResourceType::SWAP_CHAIN)
+			{
+				static_cast<RERHI::RHISwapChain&>(renderTarget).present();
+			}
+			return;
+		}
+
+		// Wait for a free frame slot, this is where the main thread gets throttled if it's running ahead of the submission thread
+		// -> The frame slot is the one the frame has been recorded for, the per frame copies of dynamic buffers are tied to it
+		const RECore::uint32 frameIndex = mRecordingFrameIndex;
+		float waitMilliseconds = 0.0f;
+		{
+			const RECore::Stopwatch stopwatch(true);
+			std::unique_lock<std::mutex> submissionMutexLock(mSubmissionMutex);
+			mCompletionConditionVariable.wait(submissionMutexLock, [this]() { return (mNumberOfFramesInFlight < mMaximumNumberOfFramesInFlight); });
+			RHI_ASSERT((mFirstFrameIndex + mNumberOfFramesInFlight) % MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT == frameIndex, "Invalid render thread recording frame index")
+			waitMilliseconds = stopwatch.getMilliseconds();
+		}
+		releaseCompletedFrames();
+
+		// Fill the frame slot, it's not visible to the submission thread until the number of frames in flight has been increased
+		Frame& frame = mFrames[frameIndex];
+		frame.commandBuffer.clear();
+		if (!commandBuffer.isEmpty())
+		{
+			commandBuffer.appendToCommandBuffer(frame.commandBuffer);
+		}
+		renderTarget.AddReference();
+		frame.renderTarget = &renderTarget;
+		RHI_ASSERT(frame.requests.empty(), "The requests of a completed frame must have been completed")
+		frame.requests.swap(mRequests);
+
+		// Hand the frame over to the submission thread
+		{
+			std::lock_guard<std::mutex> submissionMutexLock(mSubmissionMutex);
+			++mNumberOfFramesInFlight;
+			++mNumberOfUndispatchedFrames;
+		}
+		mSubmissionConditionVariable.notify_one();
+
+		// The next frame is recorded for the next frame slot, wait until the frame which used this slot before has been completed
+		// -> Only blocks if the maximum number of frames in flight is "RERenderer::RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT"
+		// -> Afterwards the per frame copies of the slot can be mapped without waiting for the submission thread
+		mRecordingFrameIndex = (frameIndex + 1) % MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT;
+		{
+			const RECore::Stopwatch stopwatch(true);
+			std::unique_lock<std::mutex> submissionMutexLock(mSubmissionMutex);
+			mCompletionConditionVariable.wait(submissionMutexLock, [this]() { return (mNumberOfFramesInFlight < MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT); });
+			waitMilliseconds += stopwatch.getMilliseconds();
+		}
+		mMainThreadWaitMilliseconds = waitMilliseconds;
+	}
+
+	void RenderThread::createResource(CreateFunction createFunction, CompletionFunction completionFunction, void* userData)
+	{
+		RHI_ASSERT(nullptr != createFunction && nullptr != completionFunction, "Invalid render thread create request")
+		if (mEnabled)
+		{
+			addRequest({ nullptr, createFunction, completionFunction, userData });
+		}
+		else
+		{
+			RERHI::RHIResource* resource = nullptr;
+			{
+				std::lock_guard<std::recursive_mutex> rhiMutexLock(mRhiMutex);
+				resource = createFunction(mRenderer.getRhi(), userData);
+			}
+			completionFunction(resource, userData);
+		}
+	}
+
+	void RenderThread::releaseResource(RERHI::RHIResource& resource)
+	{
+		if (mEnabled)
+		{
+			addRequest({ &resource, nullptr, nullptr, nullptr });
+		}
+		else
+		{
+			resource.Release();
+		}
+	}
+
+	void RenderThread::flush()
+	{
+		if (mEnabled)
+		{
+			std::unique_lock<std::mutex> submissionMutexLock(mSubmissionMutex);
+			mCompletionConditionVariable.wait(submissionMutexLock, [this]() { return (0 == mNumberOfFramesInFlight); });
+		}
+		releaseCompletedFrames();
+
+		// There are no frames in flight anymore, so the requests since the last submission can be completed as well
+		if (!mRequests.empty())
+		{
+			std::lock_guard<std::recursive_mutex> rhiMutexLock(mRhiMutex);
+			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
+			for (Request& request : mRequests)
+			{
+				if (nullptr != request.createFunction)
+				{
+					request.resource = request.createFunction(rhi, request.userData);
+				}
+			}
+			completeRequests(mRequests);
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	RenderThread::RenderThread(IRenderer& renderer) :
+		mRenderer(renderer),
+		mEnabled(false),
+		mMaximumNumberOfFramesInFlight(2),
+		mRecordingFrameIndex(0),
+		mShutdownSubmissionThread(false),
+		mFirstFrameIndex(0),
+		mNumberOfFramesInFlight(0),
+		mNumberOfUndispatchedFrames(0),
+		mMainThreadWaitMilliseconds(0.0f),
+		mDispatchMilliseconds(0.0f),
+		mPresentMilliseconds(0.0f)
+	{
+		// Reserve the request lists once, they're swapped between the main thread and the frame slots
+		mRequests.reserve(MAXIMUM_NUMBER_OF_REQUESTS);
+		for (Frame& frame : mFrames)
+		{
+			frame.requests.reserve(MAXIMUM_NUMBER_OF_REQUESTS);
+		}
+	}
+
+	RenderThread::~RenderThread()
+	{
+		// Submission thread shutdown
+		setEnabled(false);
+		flush();
+	}
+
+	void RenderThread::addRequest(const Request& request)
+	{
+		// The request lists are bounded, flush the render thread to complete the pending requests if the list is full
+		if (mRequests.size() >= MAXIMUM_NUMBER_OF_REQUESTS)
+		{
+			RE_LOG(Warning, "The render thread request list is full, flushing the render thread")
+			flush();
+		}
+		mRequests.push_back(request);
+	}
+
+	void RenderThread::completeRequests(Requests& requests)
+	{
+		// The caller holds the RHI lock and ensures that the frame the requests belong to has been completed
+		for (const Request& request : requests)
+		{
+			if (nullptr != request.createFunction)
+			{
+				request.completionFunction(request.resource, request.userData);
+			}
+			else
+			{
+				request.resource->Release();
+			}
+		}
+		requests.clear();
+	}
+
+	void RenderThread::releaseCompletedFrames()
+	{
+		// Frame slots outside the range of frames in flight aren't touched by the submission thread
+		RECore::uint32 firstFrameIndex = 0;
+		RECore::uint32 numberOfFramesInFlight = 0;
+		{
+			std::lock_guard<std::mutex> submissionMutexLock(mSubmissionMutex);
+			firstFrameIndex = mFirstFrameIndex;
+			numberOfFramesInFlight = mNumberOfFramesInFlight;
+		}
+		RhiLock rhiMutexLock(mRhiMutex, std::defer_lock);
+		for (RECore::uint32 i = numberOfFramesInFlight; i < MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT; ++i)
+		{
+			Frame& frame = mFrames[(firstFrameIndex + i) % MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];
+			if (nullptr != frame.renderTarget || !frame.requests.empty())
+			{
+				if (!rhiMutexLock.owns_lock())
+				{
+					rhiMutexLock.lock();
+				}
+				if (nullptr != frame.renderTarget)
+				{
+					frame.renderTarget->Release();
+					frame.renderTarget = nullptr;
+				}
+				completeRequests(frame.requests);
+			}
+		}
+	}
+
+	void RenderThread::submissionThreadWorker()
+	{
+		RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("Render", "Renderer: Render thread command buffer submission")
+		std::unique_lock<std::mutex> submissionMutexLock(mSubmissionMutex);
+		while (!mShutdownSubmissionThread)
+		{
+			// Continue as long as there's a submitted frame left, if there's none go to sleep
+			mSubmissionConditionVariable.wait(submissionMutexLock, [this]() { return (mShutdownSubmissionThread || 0 != mNumberOfUndispatchedFrames); });
+			while (0 != mNumberOfUndispatchedFrames)
+			{
+				// Get the oldest frame in flight, the submission thread processes one frame after another
+				Frame& frame = mFrames[mFirstFrameIndex];
+				submissionMutexLock.unlock();
+
+				// Do the work: Execute the create requests and dispatch the command buffer to the RHI implementation
+				{
+					std::lock_guard<std::recursive_mutex> rhiMutexLock(mRhiMutex);
+					for (Request& request : frame.requests)
+					{
+						if (nullptr != request.createFunction)
+						{
+							request.resource = request.createFunction(rhi, request.userData);
+						}
+					}
+					const RECore::Stopwatch stopwatch(true);
+					if (!frame.commandBuffer.isEmpty())
+					{
+						frame.commandBuffer.dispatchToRhi(rhi);
+					}
+					mDispatchMilliseconds = stopwatch.getMilliseconds();
+				}
+				submissionMutexLock.lock();
+				--mNumberOfUndispatchedFrames;
+				submissionMutexLock.unlock();
+				mCompletionConditionVariable.notify_all();
+
+				// In case the render target is a swap chain, present the content of the current back buffer
+				if (frame.renderTarget->getResourceType() == RERHI::ResourceType::SWAP_CHAIN)
+				{
+					std::lock_guard<std::recursive_mutex> rhiMutexLock(mRhiMutex);
+					const RECore::Stopwatch stopwatch(true);
+					static_cast<RERHI::RHISwapChain*>(frame.renderTarget)->present();
+					mPresentMilliseconds = stopwatch.getMilliseconds();
+				}
+				else
+				{
+					mPresentMilliseconds = 0.0f;
+				}
+
+				// The frame has been completed, the main thread takes care of releasing the references
+				submissionMutexLock.lock();
+				mFirstFrameIndex = (mFirstFrameIndex + 1) % MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT;
+				--mNumberOfFramesInFlight;
+				mCompletionConditionVariable.notify_all();
+			}
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
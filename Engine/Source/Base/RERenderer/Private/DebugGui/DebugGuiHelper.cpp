@@ -31,6 +31,7 @@
 #include "RERenderer/Resource/Skeleton/SkeletonResourceManager.h"
 #include "RERenderer/Resource/Skeleton/SkeletonResource.h"
 #include "RERenderer/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <imgui.h>
@@ -386,6 +387,46 @@ namespace RERenderer
 						}
 					}
 				#endif
+
+				// Command function names, used by the emitted and filtered commands metrics
+				static constexpr const char* commandFunction[static_cast<RECore::uint32>(RERHI::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] =
+				{
+					// Command buffer
+					"DispatchCommandBuffer",
+					// Graphics
+					"SetGraphicsRootSignature",
+					"SetGraphicsPipelineState",
+					"SetGraphicsResourceGroup",
+					"SetGraphicsVertexArray",
+					"SetGraphicsViewports",
+					"SetGraphicsScissorRectangles",
+					"SetGraphicsRenderTarget",
+					"ClearGraphics",
+					"DrawGraphics",
+					"DrawIndexedGraphics",
+					"DrawMeshTasks",
+					// Compute
+					"SetComputeRootSignature",
+					"SetComputePipelineState",
+					"SetComputeResourceGroup",
+					"DispatchCompute",
+					// Resource
+					"SetTextureMinimumMaximumMipmapIndex",
+					"ResolveMultisampleFramebuffer",
+					"CopyResource",
+					"GenerateMipmaps",
+					"CopyUniformBufferData",
+					"SetUniform",
+					// Query
+					"ResetQueryPool",
+					"BeginQuery",
+					"EndQuery",
+					"WriteTimestampQuery",
+					// Debug
+					"SetDebugMarker",
+					"BeginDebugEvent",
+					"EndDebugEvent"
+				};
 				if (ImGui::TreeNode("EmittedCommands", "Emitted commands: %s", ::detail::stringFormatCommas(numberOfCommands, temporary)))
 				{
 					// Loop through all commands and count them
@@ -404,44 +445,6 @@ namespace RERenderer
 					}
 
 					// Print the number of emitted command functions
-					static constexpr const char* commandFunction[static_cast<RECore::uint32>(RERHI::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] =
-					{
-						// Command buffer
-						"DispatchCommandBuffer",
-						// Graphics
-						"SetGraphicsRootSignature",
-						"SetGraphicsPipelineState",
-						"SetGraphicsResourceGroup",
-						"SetGraphicsVertexArray",
-						"SetGraphicsViewports",
-						"SetGraphicsScissorRectangles",
-						"SetGraphicsRenderTarget",
-						"ClearGraphics",
-						"DrawGraphics",
-						"DrawIndexedGraphics",
-						"DrawMeshTasks",
-						// Compute
-						"SetComputeRootSignature",
-						"SetComputePipelineState",
-						"SetComputeResourceGroup",
-						"DispatchCompute",
-						// Resource
-						"SetTextureMinimumMaximumMipmapIndex",
-						"ResolveMultisampleFramebuffer",
-						"CopyResource",
-						"GenerateMipmaps",
-						"CopyUniformBufferData",
-						"SetUniform",
-						// Query
-						"ResetQueryPool",
-						"BeginQuery",
-						"EndQuery",
-						"WriteTimestampQuery",
-						// Debug
-						"SetDebugMarker",
-						"BeginDebugEvent",
-						"EndDebugEvent"
-					};
 					for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(RERHI::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS); ++i)
 					{
 						ImGui::Text("%s: %s", commandFunction[i], ::detail::stringFormatCommas(numberOfCommandFunctions[i], temporary));
@@ -449,6 +452,29 @@ namespace RERenderer
 					ImGui::TreePop();
 				}
 
+				{ // Redundant commands filtered by the RHI implementation since the metrics have been shown the last time
+					const IRenderer& renderer = compositorWorkspaceInstance->getRenderer();
+					RERHI::RHIRedundantCommandFilter* redundantCommandFilter = renderer.getRhi().getRedundantCommandFilter();
+					if (nullptr != redundantCommandFilter)
+					{
+						const RenderThread::RhiLock rhiLock = renderer.getRenderThread().lockRhi();
+						if (ImGui::TreeNode("FilteredCommands", "Filtered redundant commands: %s", ::detail::stringFormatCommas(redundantCommandFilter->getNumberOfFilteredCommands(), temporary)))
+						{
+							ImGui::Text("Processed commands: %s", ::detail::stringFormatCommas(redundantCommandFilter->getNumberOfProcessedCommands(), temporary));
+							for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(RERHI::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS); ++i)
+							{
+								const RECore::uint32 numberOfFilteredCommands = redundantCommandFilter->getNumberOfFilteredCommands(static_cast<RERHI::CommandDispatchFunctionIndex>(i));
+								if (0 != numberOfFilteredCommands)
+								{
+									ImGui::Text("%s: %s", commandFunction[i], ::detail::stringFormatCommas(numberOfFilteredCommands, temporary));
+								}
+							}
+							ImGui::TreePop();
+						}
+						redundantCommandFilter->resetCounters();
+					}
+				}
+
 				// RHI and pipeline statistics
 				#ifdef RHI_STATISTICS
 				{ // RHI statistics
@@ -26,6 +26,7 @@
 #include "RERenderer/Resource/Texture/TextureResourceManager.h"
 #include <RECore/File/IFileManager.h>
 #include "RERenderer/Core/IProfiler.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 #include "RERenderer/Context.h"
 
@@ -157,6 +158,8 @@ namespace RERenderer
 
 	const RERHI::RHIVertexArrayPtr& DebugGuiManager::getFillVertexArrayPtr(RERHI::RHICommandBuffer* commandBuffer)
 	{
+		RenderThread& renderThread = mRenderer.getRenderThread();
+		GeometryBuffer& geometryBuffer = mGeometryBuffers[renderThread.getRecordingFrameIndex()];
 		if (GImGui->Initialized)
 		{
 			// Ask ImGui to render into the internal command buffer and then request the resulting draw data
@@ -166,35 +169,38 @@ namespace RERenderer
 			RERHI::RHIBufferManager& bufferManager = mRenderer.getBufferManager();
 
 			{ // Vertex and index buffers
+				// Submitted frames which are still in flight use the vertex and index buffers of their own render thread frame slots
+				const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+
 				// Create and grow vertex/index buffers if needed
-				if (nullptr == mVertexBuffer || mNumberOfAllocatedVertices < static_cast<RECore::uint32>(imDrawData->TotalVtxCount))
+				if (nullptr == geometryBuffer.vertexBuffer || geometryBuffer.numberOfAllocatedVertices < static_cast<RECore::uint32>(imDrawData->TotalVtxCount))
 				{
-					mNumberOfAllocatedVertices = static_cast<RECore::uint32>(imDrawData->TotalVtxCount + 5000);	// Add some reserve to reduce reallocations
-					mVertexBuffer = bufferManager.createVertexBuffer(mNumberOfAllocatedVertices * sizeof(ImDrawVert), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
-					mVertexArray = nullptr;
+					geometryBuffer.numberOfAllocatedVertices = static_cast<RECore::uint32>(imDrawData->TotalVtxCount + 5000);	// Add some reserve to reduce reallocations
+					geometryBuffer.vertexBuffer = bufferManager.createVertexBuffer(geometryBuffer.numberOfAllocatedVertices * sizeof(ImDrawVert), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+					geometryBuffer.vertexArray = nullptr;
 				}
-				if (nullptr == mIndexBuffer || mNumberOfAllocatedIndices < static_cast<RECore::uint32>(imDrawData->TotalIdxCount))
+				if (nullptr == geometryBuffer.indexBuffer || geometryBuffer.numberOfAllocatedIndices < static_cast<RECore::uint32>(imDrawData->TotalIdxCount))
 				{
-					mNumberOfAllocatedIndices = static_cast<RECore::uint32>(imDrawData->TotalIdxCount + 10000);	// Add some reserve to reduce reallocations
-					mIndexBuffer = bufferManager.createIndexBuffer(mNumberOfAllocatedIndices * sizeof(ImDrawIdx), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
-					mVertexArray = nullptr;
+					geometryBuffer.numberOfAllocatedIndices = static_cast<RECore::uint32>(imDrawData->TotalIdxCount + 10000);	// Add some reserve to reduce reallocations
+					geometryBuffer.indexBuffer = bufferManager.createIndexBuffer(geometryBuffer.numberOfAllocatedIndices * sizeof(ImDrawIdx), nullptr, 0, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+					geometryBuffer.vertexArray = nullptr;
 				}
-				if (nullptr == mVertexArray)
+				if (nullptr == geometryBuffer.vertexArray)
 				{
-					RHI_ASSERT(nullptr != mVertexBuffer, "Invalid vertex buffer")
-					RHI_ASSERT(nullptr != mIndexBuffer, "Invalid index buffer")
+					RHI_ASSERT(nullptr != geometryBuffer.vertexBuffer, "Invalid vertex buffer")
+					RHI_ASSERT(nullptr != geometryBuffer.indexBuffer, "Invalid index buffer")
 
 					// Create vertex array object (VAO)
-					const RERHI::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { mVertexBuffer };
-					mVertexArray = bufferManager.createVertexArray(::detail::VertexAttributes, static_cast<RECore::uint32>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, mIndexBuffer RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
+					const RERHI::VertexArrayVertexBuffer vertexArrayVertexBuffers[] = { geometryBuffer.vertexBuffer };
+					geometryBuffer.vertexArray = bufferManager.createVertexArray(::detail::VertexAttributes, static_cast<RECore::uint32>(GLM_COUNTOF(vertexArrayVertexBuffers)), vertexArrayVertexBuffers, geometryBuffer.indexBuffer RHI_RESOURCE_DEBUG_NAME("Debug GUI"));
 				}
 
 				{ // Copy and convert all vertices and indices into a single contiguous buffer
 					RERHI::MappedSubresource vertexBufferMappedSubresource;
-					if (rhi.map(*mVertexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, vertexBufferMappedSubresource))
+					if (rhi.map(*geometryBuffer.vertexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, vertexBufferMappedSubresource))
 					{
 						RERHI::MappedSubresource indexBufferMappedSubresource;
-						if (rhi.map(*mIndexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, indexBufferMappedSubresource))
+						if (rhi.map(*geometryBuffer.indexBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, indexBufferMappedSubresource))
 						{
 							ImDrawVert* imDrawVert = static_cast<ImDrawVert*>(vertexBufferMappedSubresource.data);
 							ImDrawIdx* imDrawIdx = static_cast<ImDrawIdx*>(indexBufferMappedSubresource.data);
@@ -208,18 +214,18 @@ namespace RERenderer
 							}
 
 							// Unmap the index buffer
-							rhi.unmap(*mIndexBuffer, 0);
+							rhi.unmap(*geometryBuffer.indexBuffer, 0);
 						}
 
 						// Unmap the vertex buffer
-						rhi.unmap(*mVertexBuffer, 0);
+						rhi.unmap(*geometryBuffer.vertexBuffer, 0);
 					}
 				}
 			}
 		}
 
 		// Done
-		return mVertexArray;
+		return geometryBuffer.vertexArray;
 	}
 
 	void DebugGuiManager::fillGraphicsCommandBuffer(RERHI::RHICommandBuffer& commandBuffer)
@@ -326,6 +332,7 @@ namespace RERenderer
 			// Create fixed build in RHI configuration resources, if required
 			if (nullptr == mRootSignature)
 			{
+				const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 				createFixedBuildInRhiConfigurationResources(tex);
 			}
 
@@ -432,8 +439,6 @@ namespace RERenderer
 		mImGuiContext(nullptr),
 		mIsRunning(false),
 		mObjectSpaceToClipSpaceMatrixUniformHandle(NULL_HANDLE),
-		mNumberOfAllocatedVertices(0),
-		mNumberOfAllocatedIndices(0),
 		mOpenMetricsWindow(false)
 	{
 		// Set ImGui allocator functions
@@ -26,6 +26,7 @@
 #include <RECore/Asset/AssetManager.h>
 #include <RECore/File/MemoryFile.h>
 #include <RECore/Time/TimeManager.h>
+#include <RECore/Memory/LinearAllocator.h>
 #include <RECore/File/IFileManager.h>
 #include <RECore/Threading/ThreadPool.h>
 #include <RECore/Resource/ResourceStreamer.h>
@@ -47,6 +48,7 @@
 #include "RERenderer/Resource/SkeletonAnimation/SkeletonAnimationResourceManager.h"
 #include "RERenderer/Resource/CompositorNode/CompositorNodeResourceManager.h"
 #include "RERenderer/Resource/CompositorWorkspace/CompositorWorkspaceResourceManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #ifdef RENDERER_IMGUI
 	#ifdef _WIN32
 		#include "RERenderer/DebugGui/Detail/DebugGuiManagerWindows.h"
@@ -69,7 +71,7 @@
 // Export the instance creation function
 RERenderer::IRenderer* createRendererInstance(RERenderer::Context& context)
 {
-	return RHI_NEW(context, RERenderer::RendererImpl)(context);
+	return RHI_NEW(context.getRhi().getContext(), RERenderer::RendererImpl)(context);
 }
 
 
@@ -91,6 +93,14 @@ namespace
 			static constexpr RECore::uint32 FORMAT_VERSION = 1;
 		}
 
+		namespace RhiPipelineCache
+		{
+			static constexpr RECore::uint32 FORMAT_TYPE	 = STRING_ID("RhiPipelineCache");
+			static constexpr RECore::uint32 FORMAT_VERSION = 1;
+		}
+
+		static constexpr size_t FRAME_ALLOCATOR_CAPACITY = 256 * 1024;	///< Frame allocator capacity in bytes, larger frames fall back to the global allocator
+
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
@@ -134,6 +144,56 @@ namespace
 		}
 
 
+		void getRhiPipelineCacheFilename(const RERenderer::IRenderer& renderer, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			virtualDirectoryName = renderer.getFileManager().getLocalDataMountPoint();
+			virtualFilename = virtualDirectoryName + '/' + renderer.getRhi().getName() + ".pipeline_cache";
+		}
+
+		void loadRhiPipelineCacheFile(const RERenderer::IRenderer& renderer)
+		{
+			// The RHI pipeline cache data is opaque and only valid for the device and driver which created it, the RHI implementation rejects incompatible data
+			std::string virtualDirectoryName;
+			std::string virtualFilename;
+			getRhiPipelineCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			const RECore::IFileManager& fileManager = renderer.getFileManager();
+			RECore::MemoryFile memoryFile;
+			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(RhiPipelineCache::FORMAT_TYPE, RhiPipelineCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+			{
+				memoryFile.decompress();
+				const RECore::MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+				if (!byteVector.empty() && !renderer.getRhi().setPipelineCacheData(static_cast<RECore::uint32>(byteVector.size()), byteVector.data()))
+				{
+					RE_LOG(Info, RECore::String("The renderer ignored the outdated RHI pipeline cache ") + virtualFilename.c_str())
+				}
+			}
+		}
+
+		void saveRhiPipelineCacheFile(const RERenderer::IRenderer& renderer)
+		{
+			// Get the RHI pipeline cache data, not all RHI implementations have a pipeline cache
+			RERHI::RHIDynamicRHI& rhi = renderer.getRhi();
+			RECore::uint32 numberOfDataBytes = 0;
+			if (rhi.getPipelineCacheData(numberOfDataBytes, nullptr) && numberOfDataBytes > 0)
+			{
+				RECore::MemoryFile memoryFile(0, numberOfDataBytes);
+				RECore::MemoryFile::ByteVector& byteVector = memoryFile.getByteVector();
+				byteVector.resize(numberOfDataBytes);
+				if (rhi.getPipelineCacheData(numberOfDataBytes, byteVector.data()))
+				{
+					byteVector.resize(numberOfDataBytes);
+					std::string virtualDirectoryName;
+					std::string virtualFilename;
+					getRhiPipelineCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+					RECore::IFileManager& fileManager = renderer.getFileManager();
+					if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(RhiPipelineCache::FORMAT_TYPE, RhiPipelineCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
+					{
+						RE_LOG(Critical, RECore::String("The renderer failed to save the RHI pipeline cache to ") + virtualFilename.c_str())
+					}
+				}
+			}
+		}
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -186,6 +246,7 @@ namespace RERenderer
 		mDefaultThreadPool = new DefaultThreadPool();
 		mAssetManager = &context.getAssetManager();
 		mTimeManager = new  RECore::TimeManager();
+		mFrameAllocator = new RECore::LinearAllocator("RendererFrame", ::detail::FRAME_ALLOCATOR_CAPACITY, RECore::Memory::getAllocator());
 
 		// Create the resource manager instances
 		mRendererResourceManager = new RendererResourceManager(*this);
@@ -220,6 +281,7 @@ namespace RERenderer
 		// Misc
 		mGraphicsPipelineStateCompiler = new GraphicsPipelineStateCompiler(*this);
 		mComputePipelineStateCompiler = new ComputePipelineStateCompiler(*this);
+		mRenderThread = new RenderThread(*this);
 
 		// Create the optional manager instances
 		#ifdef RENDERER_IMGUI
@@ -257,6 +319,7 @@ namespace RERenderer
 		#endif
 
 		// Destroy miscellaneous
+		delete mRenderThread;
 		delete mGraphicsPipelineStateCompiler;
 		delete mComputePipelineStateCompiler;
 
@@ -270,6 +333,7 @@ namespace RERenderer
 		delete mResourceStreamer;
 
 		// Destroy the core manager instances
+		delete mFrameAllocator;
 		delete mTimeManager;
 		delete mAssetManager;
 		delete mDefaultThreadPool;
@@ -302,17 +366,26 @@ namespace RERenderer
 		mResourceStreamer->flushAllQueues();
 		mGraphicsPipelineStateCompiler->flushAllQueues();
 		mComputePipelineStateCompiler->flushAllQueues();
+		mRenderThread->flush();
 	}
 
 	void RendererImpl::update()
 	{
+		RE_MEMORY_TAG_SCOPE("Renderer")
+
 		// Update the time manager
 		mTimeManager->update();
 
+		// Start a new frame, frame allocations of the previous frame are no longer referenced
+		mFrameAllocator->reset();
+
 		{ // Handle resource reloading requests
 			std::unique_lock<std::mutex> assetIdsOfResourcesToReloadMutexLock(mAssetIdsOfResourcesToReloadMutex);
 			if (!mAssetIdsOfResourcesToReload.empty())
 			{
+				// Submitted frames might still reference RHI resources which are about to be reloaded
+				mRenderThread->flush();
+
 				const size_t numberOfResourceManagers = mResourceManagers.size();
 				for (RECore::uint32 assetId : mAssetIdsOfResourcesToReload)
 				{
@@ -326,12 +399,16 @@ namespace RERenderer
 			}
 		}
 
-		// Pipeline state compiler and resource streamer update
-		mGraphicsPipelineStateCompiler->dispatch();
-		mComputePipelineStateCompiler->dispatch();
-		mResourceStreamer->dispatch();
+		{ // Pipeline state compiler and resource streamer update
+			// -> Might create, update or release RHI resources, serialize this with the render thread
+			const RenderThread::RhiLock rhiLock = mRenderThread->lockRhi();
+			mGraphicsPipelineStateCompiler->dispatch();
+			mComputePipelineStateCompiler->dispatch();
+			mResourceStreamer->dispatch();
+		}
 
 		// Inform the individual resource manager instances
+		// -> Not serialized with the render thread, e.g. scene items lock the RHI only while they're updating RHI resources
 		const size_t numberOfResourceManagers = mResourceManagers.size();
 		for (size_t i = 0; i < numberOfResourceManagers; ++i)
 		{
@@ -348,6 +425,12 @@ namespace RERenderer
 
 	void RendererImpl::loadPipelineStateObjectCache()
 	{
+		// Feed the RHI pipeline cache first, it's independent of the shader bytecode support and speeds up the creation of all following pipeline states
+		if (nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			::detail::loadRhiPipelineCacheFile(*this);
+		}
+
 		if (mRhi->getCapabilities().shaderBytecode)
 		{
 			clearPipelineStateObjectCache();
@@ -369,6 +452,12 @@ namespace RERenderer
 
 	void RendererImpl::savePipelineStateObjectCache()
 	{
+		// Do only save the RHI pipeline cache if writing local data is allowed
+		if (nullptr != mFileManager->getLocalDataMountPoint())
+		{
+			::detail::saveRhiPipelineCacheFile(*this);
+		}
+
 		// Do only save the pipeline state object cache if writing local data is allowed
 		// -> We only support saving material blueprint based shader bytecodes, creating shaders without material blueprint is supposed to be only used for debugging and tiny shaders which are compiled at the very beginning of rendering
 		if (mRhi->getCapabilities().shaderBytecode && nullptr != mFileManager->getLocalDataMountPoint() && (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving()))
@@ -381,6 +470,41 @@ namespace RERenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Memory statistics                                     ]
+	//[-------------------------------------------------------]
+	void RendererImpl::getMemorySnapshot(RECore::MemoryTracker::Snapshot& snapshot) const
+	{
+		// Memory tags
+		RECore::MemoryTracker::getSnapshot(snapshot);
+
+		// Resource managers, the tag names must stay valid, hence string literals
+		const std::pair<const char*, const RECore::IResourceManager*> resourceManagers[] =
+		{
+			{ "Resource/VertexAttributesResourceManager",	 mVertexAttributesResourceManager },
+			{ "Resource/TextureResourceManager",			 mTextureResourceManager },
+			{ "Resource/ShaderPieceResourceManager",		 mShaderPieceResourceManager },
+			{ "Resource/ShaderBlueprintResourceManager",	 mShaderBlueprintResourceManager },
+			{ "Resource/MaterialBlueprintResourceManager",	 mMaterialBlueprintResourceManager },
+			{ "Resource/MaterialResourceManager",			 mMaterialResourceManager },
+			{ "Resource/SkeletonResourceManager",			 mSkeletonResourceManager },
+			{ "Resource/SkeletonAnimationResourceManager",	 mSkeletonAnimationResourceManager },
+			{ "Resource/MeshResourceManager",				 mMeshResourceManager },
+			{ "Resource/SceneResourceManager",				 mSceneResourceManager },
+			{ "Resource/CompositorNodeResourceManager",		 mCompositorNodeResourceManager },
+			{ "Resource/CompositorWorkspaceResourceManager", mCompositorWorkspaceResourceManager }
+		};
+		for (const std::pair<const char*, const RECore::IResourceManager*>& resourceManager : resourceManagers)
+		{
+			if (nullptr != resourceManager.second)
+			{
+				const RECore::uint64 numberOfBytes = resourceManager.second->getNumberOfResourceBytes();
+				snapshot.push_back({ resourceManager.first, numberOfBytes, numberOfBytes, resourceManager.second->getNumberOfResources(), 0 });
+			}
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERHI::RefCount methods               ]
 	//[-------------------------------------------------------]
@@ -77,6 +77,18 @@ namespace RERenderer
 		ASSERT(!(RECore::isValid(mMaterialAssetId) && RECore::isValid(mMaterialBlueprintAssetId)), "Invalid material asset")
 	}
 
+	void CompositorResourcePassCompute::getReferencedCompositorResources(AssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const
+	{
+		// Compositor textures are usually fed into compositor materials by using material properties
+		for (const MaterialProperty& materialProperty : mMaterialProperties.getSortedPropertyVector())
+		{
+			if (MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID == materialProperty.getValueType())
+			{
+				textureAssetIds.push_back(materialProperty.getTextureAssetIdValue());
+			}
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -54,10 +54,9 @@ namespace RERenderer
 		RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, compositorResourcePassCopy.getDebugName())
 
 		// Get destination and source texture resources
-		// TODO(naetherm) "RERenderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
 		const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
-		const TextureResource* destinationTextureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassCopy.getDestinationTextureAssetId());
-		const TextureResource* sourceTextureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassCopy.getSourceTextureAssetId());
+		const TextureResource* destinationTextureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassCopy.getDestinationTextureAssetId(), mDestinationTextureResourceId);
+		const TextureResource* sourceTextureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassCopy.getSourceTextureAssetId(), mSourceTextureResourceId);
 		if (nullptr != destinationTextureResource && nullptr != sourceTextureResource)
 		{
 			const RERHI::RHITexturePtr& destinationTexturePtr = destinationTextureResource->getTexturePtr();
@@ -84,7 +83,9 @@ namespace RERenderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	CompositorInstancePassCopy::CompositorInstancePassCopy(const CompositorResourcePassCopy& compositorResourcePassCopy, const CompositorNodeInstance& compositorNodeInstance) :
-		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance)
+		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance),
+		mDestinationTextureResourceId(RECore::getInvalid<TextureResourceId>()),
+		mSourceTextureResourceId(RECore::getInvalid<TextureResourceId>())
 	{
 		// Nothing here
 	}
@@ -26,13 +26,16 @@
 #include "RERenderer/Resource/CompositorNode/Pass/Compute/CompositorInstancePassCompute.h"
 #include "RERenderer/Resource/CompositorNode/Pass/Compute/CompositorResourcePassCompute.h"
 #include "RERenderer/Resource/CompositorNode/CompositorNodeInstance.h"
+#include "RERenderer/Resource/CompositorWorkspace/CompositorWorkspaceResourceManager.h"
 #include "RERenderer/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "RERenderer/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "RERenderer/Resource/Material/MaterialResourceManager.h"
 #include "RERenderer/Resource/Material/MaterialResource.h"
 #include "RERenderer/Resource/Texture/TextureResourceManager.h"
 #include "RERenderer/Resource/Texture/TextureResource.h"
+#include "RERenderer/Core/Renderer/RenderPassManager.h"
 #include "RERenderer/Core/IProfiler.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 
@@ -64,8 +67,7 @@ namespace RERenderer
 
 			{ // Record reusable command buffer, if necessary
 				const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
-				// TODO(naetherm) "RERenderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
-				TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId());
+				TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId(), mTextureResourceId);
 				if (nullptr != textureResource)
 				{
 					RERHI::RHITexture* texture = textureResource->getTexturePtr();
@@ -83,9 +85,10 @@ namespace RERenderer
 						{
 							mRenderTargetWidth = renderTargetWidth;
 							mRenderTargetHeight = renderTargetHeight;
+							const RenderThread::RhiLock rhiLock = renderer.getRenderThread().lockRhi();
 							mFramebuffersPtrs.resize(numberOfMipmaps);
 							RERHI::RHIDynamicRHI& rhi = renderer.getRhi();
-							RERHI::RHIRenderPass* renderPass = rhi.createRenderPass(0, nullptr, RERHI::TextureFormat::D32_FLOAT, 1 RHI_RESOURCE_DEBUG_NAME("Compositor instance pass generate mipmap"));	// TODO(naetherm) Make the texture format flexible, custom mipmap generation also makes sense for color textures
+							RERHI::RHIRenderPass* renderPass = renderer.getCompositorWorkspaceResourceManager().getRenderPassManager().getOrCreateRenderPass(0, nullptr, RERHI::TextureFormat::D32_FLOAT, 1);	// TODO(naetherm) Make the texture format flexible, custom mipmap generation also makes sense for color textures
 							for (RECore::uint32 mipmapIndex = 1; mipmapIndex < numberOfMipmaps; ++mipmapIndex)
 							{
 								const RERHI::FramebufferAttachment depthFramebufferAttachment(texture, mipmapIndex, 0);
@@ -155,8 +158,7 @@ namespace RERenderer
 			RHI_ASSERT(RECore::isInvalid(compositorResourcePassGenerateMipmaps.getTextureMaterialBlueprintProperty()), "Invalid compositor resource pass generate mipmaps texture material blueprint property")
 
 			// Generate mipmaps
-			// TODO(naetherm) "RERenderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
-			TextureResource* textureResource = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager().getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId());
+			TextureResource* textureResource = renderer.getTextureResourceManager().getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId(), mTextureResourceId);
 			if (nullptr != textureResource)
 			{
 				RERHI::RHITexture* texture = textureResource->getTexturePtr();
@@ -174,6 +176,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	CompositorInstancePassGenerateMipmaps::CompositorInstancePassGenerateMipmaps(const CompositorResourcePassGenerateMipmaps& compositorResourcePassGenerateMipmaps, const CompositorNodeInstance& compositorNodeInstance) :
 		ICompositorInstancePass(compositorResourcePassGenerateMipmaps, compositorNodeInstance),
+		mTextureResourceId(RECore::getInvalid<TextureResourceId>()),
 		mCompositorResourcePassCompute(nullptr),
 		mCompositorInstancePassCompute(nullptr),
 		mRenderTargetWidth(RECore::getInvalid<RECore::uint32>()),
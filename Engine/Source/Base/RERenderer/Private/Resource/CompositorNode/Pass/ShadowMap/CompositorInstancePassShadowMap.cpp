@@ -33,6 +33,7 @@
 #include "RERenderer/RenderQueue/RenderableManager.h"
 #include <RECore/Math/Math.h>
 #include "RERenderer/Core/IProfiler.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -126,6 +127,11 @@ namespace RERenderer
 		if (mUsedSettingsGenerationCounter != mSettingsGenerationCounter)
 		{
 			mUsedSettingsGenerationCounter = mSettingsGenerationCounter;
+
+			// Submitted frames might still reference the shadow map render target
+			RenderThread& renderThread = renderer.getRenderThread();
+			renderThread.flush();
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
 			destroyShadowMapRenderTarget();
 			createShadowMapRenderTarget();
 		}
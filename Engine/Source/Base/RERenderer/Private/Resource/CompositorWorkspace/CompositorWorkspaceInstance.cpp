@@ -43,9 +43,11 @@
 #include "RERenderer/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "RERenderer/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "RERenderer/Resource/Scene/Culling/SceneCullingManager.h"
+#include "RERenderer/Resource/LoadAsync.h"
 #include "RERenderer/Core/IProfiler.h"
 #include "RERenderer/Core/Renderer/FramebufferManager.h"
 #include "RERenderer/Core/Renderer/RenderTargetTextureManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #ifdef RENDERER_GRAPHICS_DEBUGGER
 	#include "RERenderer/Core/IGraphicsDebugger.h"
 #endif
@@ -53,8 +55,10 @@
 	#include "RERenderer/Vr/IVrManager.h"
 #endif
 #include "RERenderer/IRenderer.h"
+#include <RECore/Log/Log.h>
 
 #include <algorithm>
+#include <unordered_map>
 
 
 //[-------------------------------------------------------]
@@ -168,7 +172,8 @@ namespace RERenderer
 
 		// Is the compositor workspace resource ready?
 		const CompositorWorkspaceResource* compositorWorkspaceResource = mRenderer.getCompositorWorkspaceResourceManager().tryGetById(mCompositorWorkspaceResourceId);
-		if (nullptr != compositorWorkspaceResource && compositorWorkspaceResource->getLoadingState() == RECore::IResource::LoadingState::LOADED)
+		// -> The compositor node instances are created asynchronously after the compositor workspace resource has been loaded, wait until this is done
+		if (nullptr != compositorWorkspaceResource && compositorWorkspaceResource->getLoadingState() == RECore::IResource::LoadingState::LOADED && nullptr == mCompositorNodeInstancesLoadingToken)
 		{
 			// Tell the global material properties managed by the material blueprint resource manager about the number of multisamples
 			// -> Since there can be multiple compositor workspace instances we can't do this once inside "RERenderer::CompositorWorkspaceInstance::setNumberOfMultisamples()"
@@ -180,6 +185,7 @@ namespace RERenderer
 			mExecutionRenderTarget = &renderTarget;
 
 			// Get the main render target size
+			RenderThread& renderThread = mRenderer.getRenderThread();
 			RECore::uint32 renderTargetWidth  = 1;
 			RECore::uint32 renderTargetHeight = 1;
 			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
@@ -203,13 +209,17 @@ namespace RERenderer
 				}
 				if (destroy)
 				{
+					// Submitted frames might still reference the framebuffers and render target textures
+					renderThread.flush();
 					destroyFramebuffersAndRenderTargetTextures();
 				}
 			}
 
 			// Create framebuffers and render target textures, if required
+			// -> Only the real RHI accesses are serialized with the render thread, culling and recording overlap with the dispatch of the previous frame
 			if (!mFramebufferManagerInitialized)
 			{
+				const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
 				createFramebuffersAndRenderTargetTextures(renderTarget);
 			}
 
@@ -220,6 +230,7 @@ namespace RERenderer
 					IGraphicsDebugger& graphicsDebugger = mRenderer.getContext().getGraphicsDebugger();
 					if (graphicsDebugger.getCaptureNextFrame())
 					{
+						const RenderThread::RhiLock rhiLock = renderThread.lockRhi(true);
 						graphicsDebugger.startFrameCapture((renderTarget.getResourceType() == RERHI::ResourceType::SWAP_CHAIN) ? static_cast<RERHI::RHISwapChain&>(renderTarget).getNativeWindowHandle() : NULL_HANDLE);
 					}
 				#endif
@@ -233,6 +244,9 @@ namespace RERenderer
 				const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
 				if (nullptr != cameraSceneItem)
 				{
+					// Propagate deferred scene node transform changes before anything is culled
+					cameraSceneItem->getSceneResource().updateGlobalTransforms();
+
 					// Gather render queue index ranges renderable managers
 					mExecuteOnRenderingSceneItems.clear();
 					cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges, mExecuteOnRenderingSceneItems);
@@ -263,14 +277,14 @@ namespace RERenderer
 					// The command buffer is about to be dispatched, inform everyone who cares about this
 					materialBlueprintResourceManager.onPreCommandBufferDispatch();
 
-					// Dispatch command buffer to the RHI implementation
+					// Dispatch command buffer to the RHI implementation, the render thread takes care of presenting swap chains
 					#ifdef RHI_STATISTICS
 						if (nullptr != mPipelineStatisticsQueryPoolPtr)
 						{
 							RERHI::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
 						}
 					#endif
-					mCommandBuffer.dispatchToRhi(rhi);
+					renderThread.submit(mCommandBuffer, renderTarget);
 
 					// The command buffer has been dispatched, inform everyone who cares about this
 					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
@@ -294,23 +308,21 @@ namespace RERenderer
 				#ifdef RENDERER_GRAPHICS_DEBUGGER
 					if (graphicsDebugger.getCaptureNextFrame())
 					{
+						// The frame must have been completed before the capture can be ended
+						renderThread.flush();
+						const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
 						graphicsDebugger.endFrameCapture((renderTarget.getResourceType() == RERHI::ResourceType::SWAP_CHAIN) ? static_cast<RERHI::RHISwapChain&>(renderTarget).getNativeWindowHandle() : NULL_HANDLE);
 					}
 				#endif
 			}
 
-			// In case the render target is a swap chain, present the content of the current back buffer
-			if (renderTarget.getResourceType() == RERHI::ResourceType::SWAP_CHAIN)
-			{
-				static_cast<RERHI::RHISwapChain&>(renderTarget).present();
-			}
-
 			// Pipeline statistics query pool
 			#ifdef RHI_STATISTICS
 				if (nullptr != mPipelineStatisticsQueryPoolPtr)
 				{
 					// We explicitly wait if the previous result isn't available yet to avoid
 					// "D3D11 WARNING: ID3D10Query::Begin: Begin is being invoked on a Query, where the previous results have not been obtained with GetData. This is valid; but unusual. The previous results are being abandoned, and new Query results will be generated. [ EXECUTION WARNING #408: QUERY_BEGIN_ABANDONING_PREVIOUS_RESULTS]"
+					const RenderThread::RhiLock rhiLock = renderThread.lockRhi(true);
 					if (RECore::isValid(mPreviousCurrentPipelineStatisticsQueryIndex) && !rhi.getQueryPoolResults(*mPipelineStatisticsQueryPoolPtr, sizeof(RERHI::PipelineStatisticsQueryResult), reinterpret_cast<RECore::uint8*>(&mPipelineStatisticsQueryResult), mPreviousCurrentPipelineStatisticsQueryIndex, 1, 0, RERHI::QueryResultFlags::WAIT))
 					{
 						mPipelineStatisticsQueryResult = {};
@@ -332,13 +344,42 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	void CompositorWorkspaceInstance::onLoadingStateChange(const RECore::IResource& resource)
 	{
-		// Destroy the previous stuff
+		// Destroy the previous stuff, this also cancels a still running asynchronous compositor node instances creation
 		destroySequentialCompositorNodeInstances();
 
 		// Handle loaded state
 		if (resource.getLoadingState() == RECore::IResource::LoadingState::LOADED)
 		{
-			// TODO(naetherm) Just a first test, need to complete and refine the implementation
+			// Don't block until the compositor node resources are loaded, the compositor node instances are created as soon as all of them are ready
+			// -> The compositor node asset IDs are copied since the compositor workspace resource might change while we're waiting
+			mCompositorNodeInstancesLoadingToken = std::make_shared<bool>(true);
+			createSequentialCompositorNodeInstances(static_cast<const CompositorWorkspaceResource&>(resource).getCompositorNodeAssetIds(), mCompositorNodeInstancesLoadingToken).detach();
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	RECore::Task<void> CompositorWorkspaceInstance::createSequentialCompositorNodeInstances(std::vector<AssetId> compositorNodeAssetIds, std::weak_ptr<bool> loadingToken)
+	{
+		// Request all compositor node resources at once so they're loaded in parallel
+		std::vector<RECore::ResourceAwaiter<CompositorNodeResource>> compositorNodeResourceAwaiters;
+		compositorNodeResourceAwaiters.reserve(compositorNodeAssetIds.size());
+		for (AssetId compositorNodeAssetId : compositorNodeAssetIds)
+		{
+			compositorNodeResourceAwaiters.push_back(loadAsync<CompositorNodeResource>(mRenderer, compositorNodeAssetId));
+		}
+		const std::vector<CompositorNodeResource*> compositorNodeResources = co_await RECore::whenAll(std::move(compositorNodeResourceAwaiters));
+
+		// Back on the main thread: Is this compositor node instances creation still wanted? (the compositor workspace instance might be gone or the compositor workspace resource might have been reloaded meanwhile)
+		if (loadingToken.expired())
+		{
+			co_return;
+		}
+		mCompositorNodeInstancesLoadingToken.reset();
+
+		{
 			CompositorNodeResourceManager& compositorNodeResourceManager = mRenderer.getCompositorNodeResourceManager();
 			const ICompositorPassFactory& compositorPassFactory = compositorNodeResourceManager.getCompositorPassFactory();
 			RenderTargetTextureManager& renderTargetTextureManager = mRenderer.getCompositorWorkspaceResourceManager().getRenderTargetTextureManager();
@@ -350,17 +391,15 @@ namespace RERenderer
 			LocalRenderQueueIndexRanges individualRenderQueueIndexRanges;
 
 			// Compositor node resources
-			const CompositorWorkspaceResource::CompositorNodeAssetIds& compositorNodeAssetIds = static_cast<const CompositorWorkspaceResource&>(resource).getCompositorNodeAssetIds();
-			const size_t numberOfCompositorResourceNodes = compositorNodeAssetIds.size();
-			for (size_t nodeIndex = 0; nodeIndex < numberOfCompositorResourceNodes; ++nodeIndex)
+			for (CompositorNodeResource* compositorNodeResourcePointer : compositorNodeResources)
 			{
-				// Get the compositor node resource instance
-				CompositorNodeResourceId compositorNodeResourceId = RECore::getInvalid<CompositorNodeResourceId>();
-				compositorNodeResourceManager.loadCompositorNodeResourceByAssetId(compositorNodeAssetIds[nodeIndex], compositorNodeResourceId);
-				CompositorNodeResource& compositorNodeResource = compositorNodeResourceManager.getById(compositorNodeResourceId);
-
-				// TODO(naetherm) Ensure compositor node resource loading is done. Such blocking waiting is no good thing.
-				compositorNodeResource.enforceFullyLoaded();
+				// Skip compositor node resources which failed to load
+				if (nullptr == compositorNodeResourcePointer)
+				{
+					continue;
+				}
+				CompositorNodeResource& compositorNodeResource = *compositorNodeResourcePointer;
+				const CompositorNodeResourceId compositorNodeResourceId = compositorNodeResource.getId();
 
 				// Add render target textures and framebuffers (doesn't directly allocate RHI resources, just announces them)
 				for (const CompositorRenderTargetTexture& compositorRenderTargetTexture : compositorNodeResource.getRenderTargetTextures())
@@ -449,6 +488,9 @@ namespace RERenderer
 				}
 			}
 
+			// Let transient render target textures with non-overlapping lifetimes share their RHI textures
+			aliasTransientRenderTargetTextures();
+
 			// Tell all compositor node instances that the compositor workspace instance loading has been finished
 			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 			{
@@ -457,10 +499,6 @@ namespace RERenderer
 		}
 	}
 
-
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
 	void CompositorWorkspaceInstance::destroySequentialCompositorNodeInstances()
 	{
 		for (CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
@@ -470,11 +508,156 @@ namespace RERenderer
 		mSequentialCompositorNodeInstances.clear();
 		mRenderQueueIndexRanges.clear();
 		mCompositorInstancePassShadowMap = nullptr;
+		mCompositorNodeInstancesLoadingToken.reset();
 
 		// Destroy framebuffers and render target textures
 		destroyFramebuffersAndRenderTargetTextures(true);
 	}
 
+	void CompositorWorkspaceInstance::aliasTransientRenderTargetTextures()
+	{
+		struct TransientRenderTargetTexture final
+		{
+			AssetId								assetId;
+			RenderTargetTextureSignatureId	renderTargetTextureSignatureId;
+			RECore::uint32						firstPassIndex;	///< Index of the first compositor instance pass using the render target texture, "RECore::getInvalid<RECore::uint32>()" if unused
+			RECore::uint32						lastPassIndex;	///< Index of the last compositor instance pass using the render target texture, "RECore::getInvalid<RECore::uint32>()" if unused
+			bool								persistent;		///< The render target texture content must survive compositor workspace executions, don't alias it
+		};
+		typedef std::unordered_map<RECore::uint32, TransientRenderTargetTexture> TransientRenderTargetTextures;	///< Key = "RERenderer::AssetId"
+		typedef std::unordered_map<RECore::uint32, const FramebufferSignature*> FramebufferSignatures;			///< Key = "RERenderer::CompositorFramebufferId"
+
+		// Gather the transient render target textures as well as the framebuffer signatures of all compositor nodes
+		const CompositorNodeResourceManager& compositorNodeResourceManager = mRenderer.getCompositorNodeResourceManager();
+		TransientRenderTargetTextures transientRenderTargetTextures;
+		FramebufferSignatures framebufferSignatures;
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			const CompositorNodeResource& compositorNodeResource = compositorNodeResourceManager.getById(compositorNodeInstance->getCompositorNodeResourceId());
+			for (const CompositorRenderTargetTexture& compositorRenderTargetTexture : compositorNodeResource.getRenderTargetTextures())
+			{
+				const RenderTargetTextureSignature& renderTargetTextureSignature = compositorRenderTargetTexture.getRenderTargetTextureSignature();
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::TRANSIENT) != 0)
+				{
+					transientRenderTargetTextures.emplace(compositorRenderTargetTexture.getAssetId(), TransientRenderTargetTexture{compositorRenderTargetTexture.getAssetId(), renderTargetTextureSignature.getRenderTargetTextureSignatureId(), RECore::getInvalid<RECore::uint32>(), RECore::getInvalid<RECore::uint32>(), false});
+				}
+			}
+			for (const CompositorFramebuffer& compositorFramebuffer : compositorNodeResource.getFramebuffers())
+			{
+				framebufferSignatures.emplace(compositorFramebuffer.getCompositorFramebufferId(), &compositorFramebuffer.getFramebufferSignature());
+			}
+		}
+		if (transientRenderTargetTextures.empty())
+		{
+			// Nothing to do
+			return;
+		}
+
+		{ // Lifetime analysis: Compute the first and the last compositor instance pass using the transient render target textures
+			AssetIds textureAssetIds;
+			CompositorFramebufferIds compositorFramebufferIds;
+			RECore::uint32 passIndex = 0;
+			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+			{
+				for (const ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
+				{
+					// Gather the compositor resources used by the compositor pass
+					const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
+					textureAssetIds.clear();
+					compositorFramebufferIds.clear();
+					compositorFramebufferIds.push_back(compositorResourcePass.getCompositorTarget().getCompositorFramebufferId());
+					compositorResourcePass.getReferencedCompositorResources(textureAssetIds, compositorFramebufferIds);
+					for (CompositorFramebufferId compositorFramebufferId : compositorFramebufferIds)
+					{
+						FramebufferSignatures::const_iterator iterator = RECore::isValid(compositorFramebufferId) ? framebufferSignatures.find(compositorFramebufferId) : framebufferSignatures.cend();
+						if (framebufferSignatures.cend() != iterator)
+						{
+							const FramebufferSignature& framebufferSignature = *iterator->second;
+							const RECore::uint8 numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
+							for (RECore::uint8 i = 0; i < numberOfColorAttachments; ++i)
+							{
+								textureAssetIds.push_back(framebufferSignature.getColorFramebufferSignatureAttachment(i).textureAssetId);
+							}
+							textureAssetIds.push_back(framebufferSignature.getDepthStencilFramebufferSignatureAttachment().textureAssetId);
+						}
+					}
+
+					// Compositor passes which aren't executed each time rely on texture content surviving compositor workspace executions
+					const bool persistent = (RECore::isValid(compositorResourcePass.getNumberOfExecutions()) || compositorResourcePass.getSkipFirstExecution());
+
+					// Update the lifetimes
+					for (AssetId textureAssetId : textureAssetIds)
+					{
+						TransientRenderTargetTextures::iterator iterator = RECore::isValid(textureAssetId) ? transientRenderTargetTextures.find(textureAssetId) : transientRenderTargetTextures.end();
+						if (transientRenderTargetTextures.end() != iterator)
+						{
+							TransientRenderTargetTexture& transientRenderTargetTexture = iterator->second;
+							if (RECore::isInvalid(transientRenderTargetTexture.firstPassIndex))
+							{
+								transientRenderTargetTexture.firstPassIndex = passIndex;
+							}
+							transientRenderTargetTexture.lastPassIndex = passIndex;
+							transientRenderTargetTexture.persistent |= persistent;
+						}
+					}
+					++passIndex;
+				}
+			}
+		}
+
+		{ // Greedy interval partitioning: Visit the transient render target textures in the order of their first use and reuse the RHI texture of a render target texture with the same signature which is no longer used at this point in time
+			// -> Render target textures are shared by all compositor workspace instances, so the render target texture manager is told about each decision, see "RERenderer::RenderTargetTextureManager::aliasRenderTargetTexture()"
+			RenderTargetTextureManager& renderTargetTextureManager = mRenderer.getCompositorWorkspaceResourceManager().getRenderTargetTextureManager();
+			std::vector<const TransientRenderTargetTexture*> sortedTransientRenderTargetTextures;
+			sortedTransientRenderTargetTextures.reserve(transientRenderTargetTextures.size());
+			for (const auto& pair : transientRenderTargetTextures)
+			{
+				if (RECore::isValid(pair.second.firstPassIndex))
+				{
+					if (pair.second.persistent)
+					{
+						renderTargetTextureManager.aliasRenderTargetTexture(pair.second.assetId, pair.second.assetId);
+					}
+					else
+					{
+						sortedTransientRenderTargetTextures.push_back(&pair.second);
+					}
+				}
+			}
+			std::sort(sortedTransientRenderTargetTextures.begin(), sortedTransientRenderTargetTextures.end(), [](const TransientRenderTargetTexture* left, const TransientRenderTargetTexture* right)
+				{
+					// Asset ID as tiebreaker for a deterministic result
+					return (left->firstPassIndex < right->firstPassIndex || (left->firstPassIndex == right->firstPassIndex && left->assetId < right->assetId));
+				});
+
+			// Each alias slot represents one RHI texture
+			struct AliasSlot final
+			{
+				RenderTargetTextureSignatureId renderTargetTextureSignatureId;
+				AssetId						   assetId;			///< Asset ID of the render target texture owning the RHI texture
+				RECore::uint32				   lastPassIndex;	///< Index of the last compositor instance pass using the RHI texture
+			};
+			std::vector<AliasSlot> aliasSlots;
+			for (const TransientRenderTargetTexture* transientRenderTargetTexture : sortedTransientRenderTargetTextures)
+			{
+				std::vector<AliasSlot>::iterator iterator = std::find_if(aliasSlots.begin(), aliasSlots.end(), [transientRenderTargetTexture](const AliasSlot& aliasSlot)
+					{
+						return (aliasSlot.renderTargetTextureSignatureId == transientRenderTargetTexture->renderTargetTextureSignatureId && aliasSlot.lastPassIndex < transientRenderTargetTexture->firstPassIndex);
+					});
+				if (aliasSlots.end() != iterator)
+				{
+					renderTargetTextureManager.aliasRenderTargetTexture(transientRenderTargetTexture->assetId, iterator->assetId);
+					iterator->lastPassIndex = transientRenderTargetTexture->lastPassIndex;
+				}
+				else
+				{
+					renderTargetTextureManager.aliasRenderTargetTexture(transientRenderTargetTexture->assetId, transientRenderTargetTexture->assetId);
+					aliasSlots.push_back({transientRenderTargetTexture->renderTargetTextureSignatureId, transientRenderTargetTexture->assetId, transientRenderTargetTexture->lastPassIndex});
+				}
+			}
+		}
+	}
+
 	void CompositorWorkspaceInstance::createFramebuffersAndRenderTargetTextures(const RERHI::RHIRenderTarget& mainRenderTarget)
 	{
 		RHI_ASSERT(!mFramebufferManagerInitialized, "Framebuffer manager is already initialized")
@@ -513,6 +696,14 @@ namespace RERenderer
 			}
 		}
 
+		{ // Report the memory saved by aliasing transient render target textures
+			const RenderTargetTextureManager& renderTargetTextureManager = compositorWorkspaceResourceManager.getRenderTargetTextureManager();
+			if (renderTargetTextureManager.getNumberOfSavedTextureBytes() > 0)
+			{
+				RE_LOG(Info, RECore::String("Compositor workspace instance: Render target textures use ") + RECore::to_string(static_cast<unsigned long>(renderTargetTextureManager.getNumberOfTextureBytes())) + " bytes, aliasing transient render target textures saved " + RECore::to_string(static_cast<unsigned long>(renderTargetTextureManager.getNumberOfSavedTextureBytes())) + " bytes")
+			}
+		}
+
 		mFramebufferManagerInitialized = true;
 	}
 
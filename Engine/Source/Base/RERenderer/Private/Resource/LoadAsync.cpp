@@ -0,0 +1,163 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERenderer/Resource/LoadAsync.h"
+#include "RERenderer/Resource/VertexAttributes/VertexAttributesResourceManager.h"
+#include "RERenderer/Resource/Texture/TextureResourceManager.h"
+#include "RERenderer/Resource/ShaderPiece/ShaderPieceResourceManager.h"
+#include "RERenderer/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
+#include "RERenderer/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
+#include "RERenderer/Resource/Material/MaterialResourceManager.h"
+#include "RERenderer/Resource/Skeleton/SkeletonResourceManager.h"
+#include "RERenderer/Resource/SkeletonAnimation/SkeletonAnimationResourceManager.h"
+#include "RERenderer/Resource/Mesh/MeshResourceManager.h"
+#include "RERenderer/Resource/Scene/SceneResourceManager.h"
+#include "RERenderer/Resource/CompositorNode/CompositorNodeResourceManager.h"
+#include "RERenderer/Resource/CompositorWorkspace/CompositorWorkspaceResourceManager.h"
+#include "RERenderer/IRenderer.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global functions                                      ]
+	//[-------------------------------------------------------]
+	template<>
+	RECore::ResourceAwaiter<VertexAttributesResource> loadAsync<VertexAttributesResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		VertexAttributesResourceManager& resourceManager = renderer.getVertexAttributesResourceManager();
+		VertexAttributesResourceId resourceId = RECore::getInvalid<VertexAttributesResourceId>();
+		resourceManager.loadVertexAttributesResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<VertexAttributesResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<TextureResource> loadAsync<TextureResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		TextureResourceManager& resourceManager = renderer.getTextureResourceManager();
+		TextureResourceId resourceId = RECore::getInvalid<TextureResourceId>();
+		resourceManager.loadTextureResourceByAssetId(assetId, RECore::getInvalid<AssetId>(), resourceId);
+		return RECore::ResourceAwaiter<TextureResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<ShaderPieceResource> loadAsync<ShaderPieceResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		ShaderPieceResourceManager& resourceManager = renderer.getShaderPieceResourceManager();
+		ShaderPieceResourceId resourceId = RECore::getInvalid<ShaderPieceResourceId>();
+		resourceManager.loadShaderPieceResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<ShaderPieceResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<ShaderBlueprintResource> loadAsync<ShaderBlueprintResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		ShaderBlueprintResourceManager& resourceManager = renderer.getShaderBlueprintResourceManager();
+		ShaderBlueprintResourceId resourceId = RECore::getInvalid<ShaderBlueprintResourceId>();
+		resourceManager.loadShaderBlueprintResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<ShaderBlueprintResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<MaterialBlueprintResource> loadAsync<MaterialBlueprintResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		MaterialBlueprintResourceManager& resourceManager = renderer.getMaterialBlueprintResourceManager();
+		MaterialBlueprintResourceId resourceId = RECore::getInvalid<MaterialBlueprintResourceId>();
+		resourceManager.loadMaterialBlueprintResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<MaterialBlueprintResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<MaterialResource> loadAsync<MaterialResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		MaterialResourceManager& resourceManager = renderer.getMaterialResourceManager();
+		MaterialResourceId resourceId = RECore::getInvalid<MaterialResourceId>();
+		resourceManager.loadMaterialResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<MaterialResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<SkeletonResource> loadAsync<SkeletonResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		SkeletonResourceManager& resourceManager = renderer.getSkeletonResourceManager();
+		SkeletonResourceId resourceId = RECore::getInvalid<SkeletonResourceId>();
+		resourceManager.loadSkeletonResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<SkeletonResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<SkeletonAnimationResource> loadAsync<SkeletonAnimationResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		SkeletonAnimationResourceManager& resourceManager = renderer.getSkeletonAnimationResourceManager();
+		SkeletonAnimationResourceId resourceId = RECore::getInvalid<SkeletonAnimationResourceId>();
+		resourceManager.loadSkeletonAnimationResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<SkeletonAnimationResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<MeshResource> loadAsync<MeshResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		MeshResourceManager& resourceManager = renderer.getMeshResourceManager();
+		MeshResourceId resourceId = RECore::getInvalid<MeshResourceId>();
+		resourceManager.loadMeshResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<MeshResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<SceneResource> loadAsync<SceneResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		SceneResourceManager& resourceManager = renderer.getSceneResourceManager();
+		SceneResourceId resourceId = RECore::getInvalid<SceneResourceId>();
+		resourceManager.loadSceneResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<SceneResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<CompositorNodeResource> loadAsync<CompositorNodeResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		CompositorNodeResourceManager& resourceManager = renderer.getCompositorNodeResourceManager();
+		CompositorNodeResourceId resourceId = RECore::getInvalid<CompositorNodeResourceId>();
+		resourceManager.loadCompositorNodeResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<CompositorNodeResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+	template<>
+	RECore::ResourceAwaiter<CompositorWorkspaceResource> loadAsync<CompositorWorkspaceResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread)
+	{
+		CompositorWorkspaceResourceManager& resourceManager = renderer.getCompositorWorkspaceResourceManager();
+		CompositorWorkspaceResourceId resourceId = RECore::getInvalid<CompositorWorkspaceResourceId>();
+		resourceManager.loadCompositorWorkspaceResourceByAssetId(assetId, resourceId);
+		return RECore::ResourceAwaiter<CompositorWorkspaceResource>(renderer.getResourceStreamer(), resourceManager, resourceId, resumeThread);
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERenderer
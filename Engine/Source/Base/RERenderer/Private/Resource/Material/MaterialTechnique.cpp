@@ -31,6 +31,7 @@
 #include "RERenderer/Resource/Texture/TextureResource.h"
 #include "RERenderer/Resource/RendererResourceManager.h"
 #include <RECore/Math/Math.h>
+#include <RECore/Memory/LinearAllocator.h>
 #include "RERenderer/IRenderer.h"
 
 
@@ -445,10 +446,13 @@ namespace RERenderer
 				const MaterialBlueprintResource* materialBlueprintResource = getMaterialResourceManager().getRenderer().getMaterialBlueprintResourceManager().tryGetById(mMaterialBlueprintResourceId);
 				RHI_ASSERT(nullptr != materialBlueprintResource, "Invalid material blueprint resource")
 
-				// Create texture resource group
-				std::vector<RERHI::RHIResource*> resources;
-				std::vector<RERHI::RHISamplerState*> samplerStates;
-				RECore::uint32 textureStartIndex = 0;
+				// Create texture resource group, the temporary resource and sampler state arrays are frame allocations
+				const RECore::uint32 textureStartIndex = (nullptr != mStructuredBufferPtr) ? 1u : 0u;
+				const RECore::uint32 numberOfResources = static_cast<RECore::uint32>(numberOfTextures) + textureStartIndex;
+				RECore::LinearAllocator& frameAllocator = renderer.getFrameAllocator();
+				RERHI::RHIResource** resources = static_cast<RERHI::RHIResource**>(frameAllocator.reallocate(nullptr, 0, sizeof(RERHI::RHIResource*) * numberOfResources, alignof(RERHI::RHIResource*)));
+				RERHI::RHISamplerState** samplerStates = static_cast<RERHI::RHISamplerState**>(frameAllocator.reallocate(nullptr, 0, sizeof(RERHI::RHISamplerState*) * numberOfResources, alignof(RERHI::RHISamplerState*)));
+				RHI_ASSERT(nullptr != resources && nullptr != samplerStates, "Out of memory")
 				if (nullptr != mStructuredBufferPtr)
 				{
 					// Sanity check
@@ -456,16 +460,8 @@ namespace RERenderer
 					RHI_ASSERT(mStructuredBufferRootParameterIndex == textures[0].rootParameterIndex, "Invalid structured buffer root parameter index")
 
 					// First entry is the structured buffer
-					resources.resize(numberOfTextures + 1);
-					samplerStates.resize(numberOfTextures + 1);
 					resources[0] = mStructuredBufferPtr;
 					samplerStates[0] = nullptr;
-					textureStartIndex = 1;
-				}
-				else
-				{
-					resources.resize(numberOfTextures);
-					samplerStates.resize(numberOfTextures);
 				}
 				const MaterialBlueprintResource::Textures& materialBlueprintResourceTextures = materialBlueprintResource->getTextures();
 				const MaterialBlueprintResource::SamplerStates& materialBlueprintResourceSamplerStates = materialBlueprintResource->getSamplerStates();
@@ -489,7 +485,7 @@ namespace RERenderer
 					}
 				}
 				// TODO(naetherm) All resources need to be inside the same resource group, this needs to be guaranteed by design
-				mResourceGroup = renderer.getRendererResourceManager().createResourceGroup(*materialBlueprintResource->getRootSignaturePtr(), textures[0].rootParameterIndex, static_cast<RECore::uint32>(resources.size()), resources.data(), samplerStates.data() RHI_RESOURCE_DEBUG_NAME("Material technique"));
+				mResourceGroup = renderer.getRendererResourceManager().createResourceGroup(*materialBlueprintResource->getRootSignaturePtr(), textures[0].rootParameterIndex, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_NAME("Material technique"));
 			}
 
 			// Tell the caller about the resource group
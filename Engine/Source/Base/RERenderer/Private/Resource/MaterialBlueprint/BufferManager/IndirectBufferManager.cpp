@@ -22,6 +22,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <algorithm>
@@ -81,6 +82,13 @@ namespace RERenderer
 		{
 			indirectBuffer.indirectBuffer->Release();
 		}
+		for (IndirectBuffers& indirectBuffers : mInFlightIndirectBuffers)
+		{
+			for (IndirectBuffer& indirectBuffer : indirectBuffers)
+			{
+				indirectBuffer.indirectBuffer->Release();
+			}
+		}
 	}
 
 	IndirectBufferManager::IndirectBuffer* IndirectBufferManager::getIndirectBuffer(RECore::uint32 numberOfBytes)
@@ -105,6 +113,14 @@ namespace RERenderer
 		// Create new indirect buffer, if required
 		if (nullptr == mCurrentIndirectBuffer)
 		{
+			// The frame which previously used the render thread frame slot which is currently recorded is done, so its indirect buffers can be reused
+			RenderThread& renderThread = mRenderer.getRenderThread();
+			IndirectBuffers& inFlightIndirectBuffers = mInFlightIndirectBuffers[renderThread.getRecordingFrameIndex()];
+			mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), inFlightIndirectBuffers.begin(), inFlightIndirectBuffers.end());
+			inFlightIndirectBuffers.clear();
+
+			// Submitted frames only reference the indirect buffers of their own render thread frame slot
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
 			if (mFreeIndirectBuffers.empty())
 			{
 				// Create new indirect buffer instance
@@ -146,8 +162,9 @@ namespace RERenderer
 			unmapCurrentIndirectBuffer();
 		}
 
-		// Free all used indirect buffers
-		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), mUsedIndirectBuffers.begin(), mUsedIndirectBuffers.end());
+		// All used indirect buffers are in flight until the render thread frame slot which is currently recorded gets recorded again
+		IndirectBuffers& inFlightIndirectBuffers = mInFlightIndirectBuffers[mRenderer.getRenderThread().getRecordingFrameIndex()];
+		inFlightIndirectBuffers.insert(inFlightIndirectBuffers.end(), mUsedIndirectBuffers.begin(), mUsedIndirectBuffers.end());
 		mUsedIndirectBuffers.clear();
 	}
 
@@ -162,6 +179,7 @@ namespace RERenderer
 		RHI_ASSERT(nullptr != mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 
 		// Unmap
+		const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 		mRenderer.getRhi().unmap(*mCurrentIndirectBuffer->indirectBuffer, 0);
 		mCurrentIndirectBuffer->indirectBufferOffset = 0;
 		mCurrentIndirectBuffer->mappedData = nullptr;
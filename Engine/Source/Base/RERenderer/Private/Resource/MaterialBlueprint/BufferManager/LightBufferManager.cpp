@@ -29,6 +29,7 @@
 #include "RERenderer/Resource/Scene/SceneResource.h"
 #include "RERenderer/Resource/Scene/Item/Light/LightSceneItem.h"
 #include <RECore/Math/Math.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <algorithm>
@@ -91,30 +92,34 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	LightBufferManager::LightBufferManager(IRenderer& renderer) :
 		mRenderer(renderer),
-		mTextureBuffer(nullptr),
+		mTextureBuffers{},
 		mClusters3DTextureResourceId(RECore::getInvalid<TextureResourceId>()),
 		mLightClustersAabbMinimum(-50.0f, -1.0f, -50.0f),	// TODO(naetherm) Just for the clusters shading kickoff
 		mLightClustersAabbMaximum( 50.0f, 40.0f,  50.0f),	// TODO(naetherm) Just for the clusters shading kickoff
-		mResourceGroup(nullptr)
+		mResourceGroups{}
 	{
-		// Create texture buffer instance
+		// Create texture buffer instance, the texture buffers of the other render thread frame slots are created on first usage
 		mTextureScratchBuffer.resize(std::min(mRenderer.getRhi().getCapabilities().maximumTextureBufferSize, ::detail::LIGHT_DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES));
-		mTextureBuffer = mRenderer.getBufferManager().createTextureBuffer(static_cast<RECore::uint32>(mTextureScratchBuffer.size()), nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-		mTextureBuffer->AddReference();
+		getTextureBuffer(0);
 
 		// Create the clusters 3D texture resource
-		mClusters3DTextureResourceId = mRenderer.getTextureResourceManager().createTextureResourceByAssetId(
-			ASSET_ID("RacoonEngine/Texture/DynamicByCode/LightClustersMap3D"),
-			*mRenderer.getTextureManager().createTexture3D(::detail::CLUSTER_X, ::detail::CLUSTER_Y, ::detail::CLUSTER_Z, RERHI::TextureFormat::R32_UINT, nullptr, RERHI::TextureFlag::SHADER_RESOURCE, RERHI::TextureUsage::DYNAMIC RHI_RESOURCE_DEBUG_NAME("Light clusters")));
+		mClusters3DTextures[0] = mRenderer.getTextureManager().createTexture3D(::detail::CLUSTER_X, ::detail::CLUSTER_Y, ::detail::CLUSTER_Z, RERHI::TextureFormat::R32_UINT, nullptr, RERHI::TextureFlag::SHADER_RESOURCE, RERHI::TextureUsage::DYNAMIC RHI_RESOURCE_DEBUG_NAME("Light clusters"));
+		mClusters3DTextureResourceId = mRenderer.getTextureResourceManager().createTextureResourceByAssetId(ASSET_ID("RacoonEngine/Texture/DynamicByCode/LightClustersMap3D"), *mClusters3DTextures[0].GetPointer());
 	}
 
 	LightBufferManager::~LightBufferManager()
 	{
-		if (nullptr != mResourceGroup)
+		for (RECore::uint32 frameIndex = 0; frameIndex < RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT; ++frameIndex)
 		{
-			mResourceGroup->Release();
+			if (nullptr != mResourceGroups[frameIndex])
+			{
+				mResourceGroups[frameIndex]->Release();
+			}
+			if (nullptr != mTextureBuffers[frameIndex])
+			{
+				mTextureBuffers[frameIndex]->Release();
+			}
 		}
-		mTextureBuffer->Release();
 		mRenderer.getTextureResourceManager().destroyTextureResource(mClusters3DTextureResourceId);
 	}
 
@@ -134,18 +139,22 @@ namespace RERenderer
 		if (nullptr != lightTextureBuffer)
 		{
 			// TODO(naetherm) We probably need to move the light buffer manager into the material blueprint resource
-			// Create resource group instance, if needed
-			if (nullptr == mResourceGroup)
+			// Create resource group instance of the render thread frame slot which is currently recorded, if needed
+			RenderThread& renderThread = mRenderer.getRenderThread();
+			const RECore::uint32 frameIndex = renderThread.getRecordingFrameIndex();
+			RERHI::RHIResourceGroup*& resourceGroup = mResourceGroups[frameIndex];
+			if (nullptr == resourceGroup)
 			{
 				// TODO(naetherm) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
 				// RERHI::RHIResource* resources[2] = { mTextureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
-				RERHI::RHIResource* resources[1] = { mTextureBuffer };
-				mResourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-				mResourceGroup->AddReference();
+				const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+				RERHI::RHIResource* resources[1] = { &getTextureBuffer(frameIndex) };
+				resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+				resourceGroup->AddReference();
 			}
 
 			// Set graphics resource group
-			RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, mResourceGroup);
+			RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, resourceGroup);
 		}
 	}
 
@@ -159,18 +168,22 @@ namespace RERenderer
 		if (nullptr != lightTextureBuffer)
 		{
 			// TODO(naetherm) We probably need to move the light buffer manager into the material blueprint resource
-			// Create resource group instance, if needed
-			if (nullptr == mResourceGroup)
+			// Create resource group instance of the render thread frame slot which is currently recorded, if needed
+			RenderThread& renderThread = mRenderer.getRenderThread();
+			const RECore::uint32 frameIndex = renderThread.getRecordingFrameIndex();
+			RERHI::RHIResourceGroup*& resourceGroup = mResourceGroups[frameIndex];
+			if (nullptr == resourceGroup)
 			{
 				// TODO(naetherm) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
 				// RERHI::RHIResource* resources[2] = { mTextureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
-				RERHI::RHIResource* resources[1] = { mTextureBuffer };
-				mResourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-				mResourceGroup->AddReference();
+				const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+				RERHI::RHIResource* resources[1] = { &getTextureBuffer(frameIndex) };
+				resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+				resourceGroup->AddReference();
 			}
 
 			// Set compute resource group
-			RERHI::Command::SetComputeResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, mResourceGroup);
+			RERHI::Command::SetComputeResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, resourceGroup);
 		}
 	}
 
@@ -188,6 +201,18 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
+	RERHI::RHITextureBuffer& LightBufferManager::getTextureBuffer(RECore::uint32 frameIndex)
+	{
+		RERHI::RHITextureBuffer*& textureBuffer = mTextureBuffers[frameIndex];
+		if (nullptr == textureBuffer)
+		{
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
+			textureBuffer = mRenderer.getBufferManager().createTextureBuffer(static_cast<RECore::uint32>(mTextureScratchBuffer.size()), nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, RERHI::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+			textureBuffer->AddReference();
+		}
+		return *textureBuffer;
+	}
+
 	void LightBufferManager::fillTextureBuffer(const glm::dvec3& worldSpaceCameraPosition, SceneResource& sceneResource)
 	{
 		// TODO(naetherm) This is just a placeholder implementation until "RERenderer::LightBufferManager" is ready (containing e.g. reasonable optimizations)
@@ -223,12 +248,16 @@ namespace RERenderer
 		const RECore::uint32 numberOfBytes = static_cast<RECore::uint32>(scratchBufferPointer - mTextureScratchBuffer.data());
 		if (0 != numberOfBytes)
 		{
+			// Submitted frames use the texture buffers of their own render thread frame slot
+			RenderThread& renderThread = mRenderer.getRenderThread();
+			RERHI::RHITextureBuffer& textureBuffer = getTextureBuffer(renderThread.getRecordingFrameIndex());
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
 			RERHI::MappedSubresource mappedSubresource;
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
-			if (rhi.map(*mTextureBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			if (rhi.map(textureBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
 			{
 				memcpy(mappedSubresource.data, mTextureScratchBuffer.data(), numberOfBytes);
-				rhi.unmap(*mTextureBuffer, 0);
+				rhi.unmap(textureBuffer, 0);
 			}
 		}
 	}
@@ -320,11 +349,23 @@ namespace RERenderer
 			}
 		}
 
-		// Upload the cluster data to a volume texture
-		const RERHI::RHITexturePtr& texturePtr = mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr();
-		RHI_ASSERT(nullptr != texturePtr.getPointer(), "Invalid texture pointer")
-		RHI_ASSERT(RERHI::ResourceType::TEXTURE_3D == texturePtr.getPointer()->getResourceType(), "Invalid texture resource type")
+		// Upload the cluster data to the volume texture of the render thread frame slot which is currently recorded, submitted frames use the volume texture of their own frame slot
+		RenderThread& renderThread = mRenderer.getRenderThread();
+		const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+		RERHI::RHITexturePtr& texturePtr = mClusters3DTextures[renderThread.getRecordingFrameIndex()];
+		if (nullptr == texturePtr)
+		{
+			texturePtr = mRenderer.getTextureManager().createTexture3D(::detail::CLUSTER_X, ::detail::CLUSTER_Y, ::detail::CLUSTER_Z, RERHI::TextureFormat::R32_UINT, nullptr, RERHI::TextureFlag::SHADER_RESOURCE, RERHI::TextureUsage::DYNAMIC RHI_RESOURCE_DEBUG_NAME("Light clusters"));
+		}
+		RHI_ASSERT(RERHI::ResourceType::TEXTURE_3D == texturePtr.GetPointer()->getResourceType(), "Invalid texture resource type")
 		RERHI::RHITexture3D* texture3D = static_cast<RERHI::RHITexture3D*>(texturePtr.GetPointer());
+		{ // Let the texture resource use the volume texture, material techniques referencing the texture resource update their resource groups
+			TextureResource& textureResource = mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId);
+			if (textureResource.getTexturePtr().GetPointer() != texture3D)
+			{
+				textureResource.setTexture(texture3D);
+			}
+		}
 		RERHI::MappedSubresource mappedSubresource;
 		RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 		if (rhi.map(*texture3D, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
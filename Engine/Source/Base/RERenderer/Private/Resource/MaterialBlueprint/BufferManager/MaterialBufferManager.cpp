@@ -28,6 +28,7 @@
 #include "RERenderer/Resource/Material/MaterialTechnique.h"
 #include "RERenderer/Resource/Material/MaterialResource.h"
 #include "RERenderer/Core/SwizzleVectorElementRemove.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <algorithm>
@@ -56,7 +57,6 @@ namespace RERenderer
 
 		// Get the buffer size
 		mBufferSize = std::min<RECore::uint32>(renderer.getRhi().getCapabilities().maximumUniformBufferSize, 64 * 1024);
-		mScratchBuffer.resize(mBufferSize);
 
 		// Calculate the number of slots per pool
 		const RECore::uint32 numberOfBytesPerElement = materialUniformBuffer->uniformBufferNumberOfBytes / materialUniformBuffer->numberOfElements;
@@ -88,7 +88,7 @@ namespace RERenderer
 		}
 		if (iterator == iteratorEnd)
 		{
-			mBufferPools.push_back(new BufferPool(mBufferSize, mSlotsPerPool, mRenderer.getBufferManager(), mMaterialBlueprintResource));
+			mBufferPools.push_back(new BufferPool(mBufferSize, mSlotsPerPool));
 			iterator = mBufferPools.end() - 1;
 		}
 
@@ -152,7 +152,7 @@ namespace RERenderer
 		mLastGraphicsBoundPool = nullptr;
 		if (!mDirtyMaterialBufferSlots.empty())
 		{
-			uploadDirtySlots();
+			updateDirtySlots();
 		}
 	}
 
@@ -161,7 +161,7 @@ namespace RERenderer
 		mLastComputeBoundPool = nullptr;
 		if (!mDirtyMaterialBufferSlots.empty())
 		{
-			uploadDirtySlots();
+			updateDirtySlots();
 		}
 	}
 
@@ -169,13 +169,14 @@ namespace RERenderer
 	{
 		if (mLastGraphicsBoundPool != materialBufferSlot.mAssignedMaterialPool)
 		{
-			mLastGraphicsBoundPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
-			RHI_ASSERT(nullptr != mLastGraphicsBoundPool, "Invalid last graphics bound pool")
+			BufferPool* bufferPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
+			RHI_ASSERT(nullptr != bufferPool, "Invalid last graphics bound pool")
+			mLastGraphicsBoundPool = bufferPool;
 
 			// Set resource group
 			const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 			RHI_ASSERT(nullptr != materialUniformBuffer, "Invalid material uniform buffer")
-			RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, mLastGraphicsBoundPool->resourceGroup);
+			RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, getResourceGroup(*bufferPool));
 		}
 	}
 
@@ -183,13 +184,14 @@ namespace RERenderer
 	{
 		if (mLastComputeBoundPool != materialBufferSlot.mAssignedMaterialPool)
 		{
-			mLastComputeBoundPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
-			RHI_ASSERT(nullptr != mLastComputeBoundPool, "Invalid last compute bound pool")
+			BufferPool* bufferPool = static_cast<BufferPool*>(materialBufferSlot.mAssignedMaterialPool);
+			RHI_ASSERT(nullptr != bufferPool, "Invalid last compute bound pool")
+			mLastComputeBoundPool = bufferPool;
 
 			// Set resource group
 			const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
 			RHI_ASSERT(nullptr != materialUniformBuffer, "Invalid material uniform buffer")
-			RERHI::Command::SetComputeResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, mLastComputeBoundPool->resourceGroup);
+			RERHI::Command::SetComputeResourceGroup::create(commandBuffer, materialUniformBuffer->rootParameterIndex, getResourceGroup(*bufferPool));
 		}
 	}
 
@@ -197,7 +199,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	void MaterialBufferManager::uploadDirtySlots()
+	void MaterialBufferManager::updateDirtySlots()
 	{
 		RHI_ASSERT(!mDirtyMaterialBufferSlots.empty(), "Invalid dirty material buffer slots")
 		const MaterialBlueprintResource::UniformBuffer* materialUniformBuffer = mMaterialBlueprintResource.getMaterialUniformBuffer();
@@ -207,8 +209,7 @@ namespace RERenderer
 		IMaterialBlueprintResourceListener& materialBlueprintResourceListener = materialBlueprintResourceManager.getMaterialBlueprintResourceListener();
 		materialBlueprintResourceListener.beginFillMaterial();
 
-		// Update the scratch buffer
-		RERHI::RHIUniformBuffer* uniformBuffer = nullptr;	// TODO(naetherm) Implement proper uniform buffer handling and only update dirty sections
+		// Update the scratch buffers of the buffer pools, the uniform buffers are updated as soon as the buffer pool is bound
 		{
 			const MaterialBlueprintResource::UniformBufferElementProperties& uniformBufferElementProperties = materialUniformBuffer->uniformBufferElementProperties;
 			const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
@@ -216,10 +217,11 @@ namespace RERenderer
 			for (MaterialBufferSlot* materialBufferSlot : mDirtyMaterialBufferSlots)
 			{
 				const MaterialResource& materialResource = materialBufferSlot->getMaterialResource();
-				RECore::uint8* scratchBufferPointer = mScratchBuffer.data() + numberOfBytesPerElement * materialBufferSlot->mAssignedMaterialSlot;
+				BufferPool* bufferPool = static_cast<BufferPool*>(materialBufferSlot->mAssignedMaterialPool);
+				RECore::uint8* scratchBufferPointer = bufferPool->scratchBuffer.data() + numberOfBytesPerElement * materialBufferSlot->mAssignedMaterialSlot;
 
 				// TODO(naetherm) Implement proper uniform buffer handling and only update dirty sections
-				uniformBuffer = static_cast<BufferPool*>(materialBufferSlot->mAssignedMaterialPool)->uniformBuffer;
+				bufferPool->outdatedUniformBuffers = (1u << RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT) - 1;
 
 				for (size_t i = 0, numberOfPackageBytes = 0; i < numberOfUniformBufferElementProperties; ++i)
 				{
@@ -303,34 +305,56 @@ namespace RERenderer
 			}
 		}
 
-		// Update the uniform buffer by using our scratch buffer
-		if (nullptr != uniformBuffer)
+		// Done
+		mDirtyMaterialBufferSlots.clear();
+	}
+
+	RERHI::RHIResourceGroup* MaterialBufferManager::getResourceGroup(BufferPool& bufferPool)
+	{
+		// Submitted frames use the uniform buffers of their own render thread frame slot
+		RenderThread& renderThread = mRenderer.getRenderThread();
+		const RECore::uint32 frameIndex = renderThread.getRecordingFrameIndex();
+		const RECore::uint32 frameMask = 1u << frameIndex;
+		RERHI::RHIUniformBuffer*& uniformBuffer = bufferPool.uniformBuffers[frameIndex];
+		if (nullptr == uniformBuffer || 0 != (bufferPool.outdatedUniformBuffers & frameMask))
 		{
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+
+			// Create the uniform buffer and resource group of the render thread frame slot, if needed
+			if (nullptr == uniformBuffer)
+			{
+				uniformBuffer = mRenderer.getBufferManager().createUniformBuffer(mBufferSize, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Material buffer manager"));
+				uniformBuffer->AddReference();
+				RERHI::RHIResource* resource = static_cast<RERHI::RHIResource*>(uniformBuffer);
+				RERHI::RHIResourceGroup* resourceGroup = mMaterialBlueprintResource.getRootSignaturePtr()->createResourceGroup(mMaterialBlueprintResource.getMaterialUniformBuffer()->rootParameterIndex, 1, &resource, nullptr RHI_RESOURCE_DEBUG_NAME("Material buffer manager"));
+				resourceGroup->AddReference();
+				bufferPool.resourceGroups[frameIndex] = resourceGroup;
+				bufferPool.outdatedUniformBuffers |= frameMask;
+			}
+
+			// Update the uniform buffer by using the scratch buffer of the buffer pool
 			RERHI::MappedSubresource mappedSubresource;
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 			if (rhi.map(*uniformBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
 			{
-				memcpy(mappedSubresource.data, mScratchBuffer.data(), static_cast<RECore::uint32>(mScratchBuffer.size()));
+				memcpy(mappedSubresource.data, bufferPool.scratchBuffer.data(), static_cast<RECore::uint32>(bufferPool.scratchBuffer.size()));
 				rhi.unmap(*uniformBuffer, 0);
 			}
+			bufferPool.outdatedUniformBuffers &= ~frameMask;
 		}
-
-		// Done
-		mDirtyMaterialBufferSlots.clear();
+		return bufferPool.resourceGroups[frameIndex];
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Public RERenderer::MaterialBufferManager::BufferPool methods ]
 	//[-------------------------------------------------------]
-	MaterialBufferManager::BufferPool::BufferPool(RECore::uint32 bufferSize, RECore::uint32 slotsPerPool, RERHI::RHIBufferManager& bufferManager, const MaterialBlueprintResource& materialBlueprintResource) :
-		uniformBuffer(bufferManager.createUniformBuffer(bufferSize, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Material buffer manager"))),
-		resourceGroup(nullptr)
+	MaterialBufferManager::BufferPool::BufferPool(RECore::uint32 bufferSize, RECore::uint32 slotsPerPool) :
+		scratchBuffer(bufferSize),
+		uniformBuffers{},
+		resourceGroups{},
+		outdatedUniformBuffers(0)
 	{
-		uniformBuffer->AddReference();
-		RERHI::RHIResource* resource = static_cast<RERHI::RHIResource*>(uniformBuffer);
-		resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(materialBlueprintResource.getMaterialUniformBuffer()->rootParameterIndex, 1, &resource, nullptr RHI_RESOURCE_DEBUG_NAME("Material buffer manager"));
-		resourceGroup->AddReference();
 		freeSlots.reserve(slotsPerPool);
 		for (RECore::uint32 i = 0; i < slotsPerPool; ++i)
 		{
@@ -340,8 +364,14 @@ namespace RERenderer
 
 	MaterialBufferManager::BufferPool::~BufferPool()
 	{
-		resourceGroup->Release();
-		uniformBuffer->Release();
+		for (RECore::uint32 frameIndex = 0; frameIndex < RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT; ++frameIndex)
+		{
+			if (nullptr != uniformBuffers[frameIndex])
+			{
+				resourceGroups[frameIndex]->Release();
+				uniformBuffers[frameIndex]->Release();
+			}
+		}
 	}
 
 
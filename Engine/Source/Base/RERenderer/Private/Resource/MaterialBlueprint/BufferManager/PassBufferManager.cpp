@@ -27,6 +27,7 @@
 #include "RERenderer/Resource/MaterialBlueprint/Listener/IMaterialBlueprintResourceListener.h"
 #include "RERenderer/Resource/Material/MaterialResource.h"
 #include <RECore/Math/Math.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 
@@ -67,10 +68,13 @@ namespace RERenderer
 	PassBufferManager::~PassBufferManager()
 	{
 		// Destroy all uniform buffers
-		for (UniformBuffer& uniformBuffer : mUniformBuffers)
+		for (UniformBuffers& uniformBuffers : mUniformBuffers)
 		{
-			uniformBuffer.resourceGroup->Release();
-			uniformBuffer.uniformBuffer->Release();
+			for (UniformBuffer& uniformBuffer : uniformBuffers)
+			{
+				uniformBuffer.resourceGroup->Release();
+				uniformBuffer.uniformBuffer->Release();
+			}
 		}
 	}
 
@@ -179,17 +183,22 @@ namespace RERenderer
 				}
 			}
 
+			// Use the uniform buffers of the frame slot which is currently recorded, submitted frames use the uniform buffers of their own frame slot
+			RenderThread& renderThread = mRenderer.getRenderThread();
+			UniformBuffers& uniformBuffers = mUniformBuffers[renderThread.getRecordingFrameIndex()];
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+
 			// Create new uniform buffer, if necessary
-			if (mCurrentUniformBufferIndex >= static_cast<RECore::uint32>(mUniformBuffers.size()))
+			if (mCurrentUniformBufferIndex >= static_cast<RECore::uint32>(uniformBuffers.size()))
 			{
 				// Don't directly pass along data or the GPU driver might get confused about the usage and might output performance warnings
 				RERHI::RHIResource* uniformBuffer = mBufferManager.createUniformBuffer(passUniformBuffer->uniformBufferNumberOfBytes, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Pass buffer manager"));
 				RERHI::RHIResourceGroup* resourceGroup = mMaterialBlueprintResource.getRootSignaturePtr()->createResourceGroup(passUniformBuffer->rootParameterIndex, 1, &uniformBuffer, nullptr RHI_RESOURCE_DEBUG_NAME("Pass buffer manager"));
-				mUniformBuffers.emplace_back(static_cast<RERHI::RHIUniformBuffer*>(uniformBuffer), resourceGroup);
+				uniformBuffers.emplace_back(static_cast<RERHI::RHIUniformBuffer*>(uniformBuffer), resourceGroup);
 			}
 
 			{ // Update the uniform buffer by using our scratch buffer
-				RERHI::RHIUniformBuffer* uniformBuffer = mUniformBuffers[mCurrentUniformBufferIndex].uniformBuffer;
+				RERHI::RHIUniformBuffer* uniformBuffer = uniformBuffers[mCurrentUniformBufferIndex].uniformBuffer;
 				RERHI::MappedSubresource mappedSubresource;
 				RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 				if (rhi.map(*uniformBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
@@ -205,12 +214,13 @@ namespace RERenderer
 	void PassBufferManager::fillGraphicsCommandBuffer(RERHI::RHICommandBuffer& commandBuffer) const
 	{
 		// Set resource group
-		if (!mUniformBuffers.empty())
+		const UniformBuffers& uniformBuffers = mUniformBuffers[mRenderer.getRenderThread().getRecordingFrameIndex()];
+		if (!uniformBuffers.empty())
 		{
 			const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
 			if (nullptr != passUniformBuffer)
 			{
-				RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
+				RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, uniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
 			}
 		}
 	}
@@ -218,12 +228,13 @@ namespace RERenderer
 	void PassBufferManager::fillComputeCommandBuffer(RERHI::RHICommandBuffer& commandBuffer) const
 	{
 		// Set resource group
-		if (!mUniformBuffers.empty())
+		const UniformBuffers& uniformBuffers = mUniformBuffers[mRenderer.getRenderThread().getRecordingFrameIndex()];
+		if (!uniformBuffers.empty())
 		{
 			const MaterialBlueprintResource::UniformBuffer* passUniformBuffer = mMaterialBlueprintResource.getPassUniformBuffer();
 			if (nullptr != passUniformBuffer)
 			{
-				RERHI::Command::SetComputeResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, mUniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
+				RERHI::Command::SetComputeResourceGroup::create(commandBuffer, passUniformBuffer->rootParameterIndex, uniformBuffers[mCurrentUniformBufferIndex - 1].resourceGroup);
 			}
 		}
 	}
@@ -29,6 +29,7 @@
 #include "RERenderer/Resource/Skeleton/SkeletonResource.h"
 #include "RERenderer/RenderQueue/RenderableManager.h"
 #include <RECore/Math/Transform.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -64,26 +65,35 @@ namespace RERenderer
 		mCurrentTextureBufferPointer(nullptr),
 		mStartInstanceLocation(0)
 	{
-		// There must always be at least one instance buffer instance
+		// There must always be at least one instance buffer instance, the instance buffers of the other render thread frame slots are created on first usage
 		createInstanceBuffer();
 	}
 
 	TextureInstanceBufferManager::~TextureInstanceBufferManager()
 	{
 		// Release uniform and texture buffer instances
-		for (InstanceBuffer& instanceBuffer : mInstanceBuffers)
+		for (InstanceBuffers& instanceBuffers : mInstanceBuffers)
 		{
-			if (nullptr != instanceBuffer.resourceGroup)
+			for (InstanceBuffer& instanceBuffer : instanceBuffers)
 			{
-				instanceBuffer.resourceGroup->Release();
+				if (nullptr != instanceBuffer.resourceGroup)
+				{
+					instanceBuffer.resourceGroup->Release();
+				}
+				instanceBuffer.uniformBuffer->Release();
+				instanceBuffer.textureBuffer->Release();
 			}
-			instanceBuffer.uniformBuffer->Release();
-			instanceBuffer.textureBuffer->Release();
 		}
 	}
 
 	void TextureInstanceBufferManager::startupBufferFilling(const MaterialBlueprintResource& materialBlueprintResource, RERHI::RHICommandBuffer& commandBuffer)
 	{
+		// Start with the first instance buffer of the render thread frame slot which is currently recorded
+		if (nullptr == mCurrentInstanceBuffer)
+		{
+			createInstanceBuffer();
+		}
+
 		// Sanity checks
 		RHI_ASSERT(nullptr != mCurrentInstanceBuffer, "Invalid current instance buffer")
 		RHI_ASSERT(RECore::isInvalid(materialBlueprintResource.getComputeShaderBlueprintResourceId()), "Invalid compute shader blueprint resource ID")
@@ -103,6 +113,7 @@ namespace RERenderer
 			// Create resource group, if needed
 			if (nullptr == mCurrentInstanceBuffer->resourceGroup)
 			{
+				const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 				RERHI::RHIResource* resources[2] = { mCurrentInstanceBuffer->uniformBuffer, mCurrentInstanceBuffer->textureBuffer };
 				mCurrentInstanceBuffer->resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(instanceUniformBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
 				mCurrentInstanceBuffer->resourceGroup->AddReference();
@@ -287,12 +298,12 @@ namespace RERenderer
 
 	void TextureInstanceBufferManager::onPreCommandBufferDispatch()
 	{
-		// Unmap the current instance buffer and reset the current instance buffer to the first instance
+		// Unmap the current instance buffer, the next frame starts with the first instance buffer of its render thread frame slot
 		if (RECore::isValid(mCurrentInstanceBufferIndex))
 		{
 			unmapCurrentInstanceBuffer();
-			mCurrentInstanceBufferIndex = 0;
-			mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+			mCurrentInstanceBufferIndex = RECore::getInvalid<size_t>();
+			mCurrentInstanceBuffer = nullptr;
 		}
 	}
 
@@ -308,9 +319,12 @@ namespace RERenderer
 		unmapCurrentInstanceBuffer();
 
 		// Update current instance buffer
+		InstanceBuffers& instanceBuffers = mInstanceBuffers[mRenderer.getRenderThread().getRecordingFrameIndex()];
 		mCurrentInstanceBufferIndex = RECore::isValid(mCurrentInstanceBufferIndex) ? (mCurrentInstanceBufferIndex + 1) : 0;
-		if (mCurrentInstanceBufferIndex >= mInstanceBuffers.size())
+		if (mCurrentInstanceBufferIndex >= instanceBuffers.size())
 		{
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
+
 			// Create uniform buffer instance
 			RERHI::RHIUniformBuffer* uniformBuffer = bufferManager.createUniformBuffer(mMaximumUniformBufferSize, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
 			uniformBuffer->AddReference();
@@ -320,9 +334,9 @@ namespace RERenderer
 			textureBuffer->AddReference();
 
 			// Create instance buffer instance
-			mInstanceBuffers.emplace_back(*uniformBuffer, *textureBuffer);
+			instanceBuffers.emplace_back(*uniformBuffer, *textureBuffer);
 		}
-		mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+		mCurrentInstanceBuffer = &instanceBuffers[mCurrentInstanceBufferIndex];
 	}
 
 	void TextureInstanceBufferManager::mapCurrentInstanceBuffer()
@@ -336,7 +350,8 @@ namespace RERenderer
 			RHI_ASSERT(nullptr == mCurrentTextureBufferPointer, "Invalid current texture buffer pointer")
 			RHI_ASSERT(0 == mStartInstanceLocation, "Invalid start instance location")
 
-			// Map instance buffer
+			// Map instance buffer, submitted frames use the instance buffers of their own render thread frame slot
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 			RERHI::MappedSubresource mappedSubresource;
 			if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
@@ -365,6 +380,7 @@ namespace RERenderer
 			// RHI_ASSERT(0 == mStartInstanceLocation, "Invalid start instance location")	// Not done by intent
 
 			// Unmap instance buffer
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 			rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
 			rhi.unmap(*mCurrentInstanceBuffer->textureBuffer, 0);
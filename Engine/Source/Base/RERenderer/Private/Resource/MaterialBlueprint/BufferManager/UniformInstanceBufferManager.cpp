@@ -27,6 +27,7 @@
 #include "RERenderer/Resource/Material/MaterialTechnique.h"
 #include "RERenderer/RenderQueue/RenderableManager.h"
 #include <RECore/Math/Transform.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <algorithm>
@@ -52,25 +53,34 @@ namespace RERenderer
 		mCurrentUniformBufferPointer(nullptr),
 		mStartInstanceLocation(0)
 	{
-		// There must always be at least one instance buffer instance
+		// There must always be at least one instance buffer instance, the instance buffers of the other render thread frame slots are created on first usage
 		createInstanceBuffer();
 	}
 
 	UniformInstanceBufferManager::~UniformInstanceBufferManager()
 	{
 		// Release uniform buffer instances
-		for (InstanceBuffer& instanceBuffer : mInstanceBuffers)
+		for (InstanceBuffers& instanceBuffers : mInstanceBuffers)
 		{
-			if (nullptr != instanceBuffer.resourceGroup)
+			for (InstanceBuffer& instanceBuffer : instanceBuffers)
 			{
-				instanceBuffer.resourceGroup->Release();
+				if (nullptr != instanceBuffer.resourceGroup)
+				{
+					instanceBuffer.resourceGroup->Release();
+				}
+				instanceBuffer.uniformBuffer->Release();
 			}
-			instanceBuffer.uniformBuffer->Release();
 		}
 	}
 
 	void UniformInstanceBufferManager::startupBufferFilling(const MaterialBlueprintResource& materialBlueprintResource, RERHI::RHICommandBuffer& commandBuffer)
 	{
+		// Start with the first instance buffer of the render thread frame slot which is currently recorded
+		if (nullptr == mCurrentInstanceBuffer)
+		{
+			createInstanceBuffer();
+		}
+
 		// Sanity checks
 		RHI_ASSERT(nullptr != mCurrentInstanceBuffer, "Invalid current instance buffer")
 		RHI_ASSERT(RECore::isInvalid(materialBlueprintResource.getComputeShaderBlueprintResourceId()), "Invalid compute shader blueprint resource ID")
@@ -85,6 +95,7 @@ namespace RERenderer
 			// Create resource group, if needed
 			if (nullptr == mCurrentInstanceBuffer->resourceGroup)
 			{
+				const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 				RERHI::RHIResource* resources[1] = { mCurrentInstanceBuffer->uniformBuffer };
 				mCurrentInstanceBuffer->resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(instanceUniformBuffer->rootParameterIndex, static_cast<RECore::uint32>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Uniform instance buffer manager"));
 				mCurrentInstanceBuffer->resourceGroup->AddReference();
@@ -224,12 +235,12 @@ namespace RERenderer
 
 	void UniformInstanceBufferManager::onPreCommandBufferDispatch()
 	{
-		// Unmap the current instance buffer and reset the current instance buffer to the first instance
+		// Unmap the current instance buffer, the next frame starts with the first instance buffer of its render thread frame slot
 		if (RECore::isValid(mCurrentInstanceBufferIndex))
 		{
 			unmapCurrentInstanceBuffer();
-			mCurrentInstanceBufferIndex = 0;
-			mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+			mCurrentInstanceBufferIndex = RECore::getInvalid<size_t>();
+			mCurrentInstanceBuffer = nullptr;
 		}
 	}
 
@@ -245,17 +256,20 @@ namespace RERenderer
 		unmapCurrentInstanceBuffer();
 
 		// Update current instance buffer
+		InstanceBuffers& instanceBuffers = mInstanceBuffers[mRenderer.getRenderThread().getRecordingFrameIndex()];
 		mCurrentInstanceBufferIndex = RECore::isValid(mCurrentInstanceBufferIndex) ? (mCurrentInstanceBufferIndex + 1) : 0;
-		if (mCurrentInstanceBufferIndex >= mInstanceBuffers.size())
+		if (mCurrentInstanceBufferIndex >= instanceBuffers.size())
 		{
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
+
 			// Create uniform buffer instance
 			RERHI::RHIUniformBuffer* uniformBuffer = bufferManager.createUniformBuffer(mMaximumUniformBufferSize, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Uniform instance buffer manager"));
 			uniformBuffer->AddReference();
 
 			// Create instance buffer instance
-			mInstanceBuffers.emplace_back(*uniformBuffer);
+			instanceBuffers.emplace_back(*uniformBuffer);
 		}
-		mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+		mCurrentInstanceBuffer = &instanceBuffers[mCurrentInstanceBufferIndex];
 	}
 
 	void UniformInstanceBufferManager::mapCurrentInstanceBuffer()
@@ -267,7 +281,8 @@ namespace RERenderer
 			RHI_ASSERT(nullptr == mCurrentUniformBufferPointer, "Invalid current uniform buffer pointer")
 			RHI_ASSERT(0 == mStartInstanceLocation, "Invalid start instance location")
 
-			// Map instance buffer
+			// Map instance buffer, submitted frames use the instance buffers of their own render thread frame slot
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 			RERHI::MappedSubresource mappedSubresource;
 			if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
@@ -289,6 +304,7 @@ namespace RERenderer
 			// RHI_ASSERT(0 == mStartInstanceLocation, "Invalid start instance location")	// Not done by intent
 
 			// Unmap instance buffer
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 			RERHI::RHIDynamicRHI& rhi = mRenderer.getRhi();
 			rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
 			mCurrentInstanceBuffer->mapped = false;
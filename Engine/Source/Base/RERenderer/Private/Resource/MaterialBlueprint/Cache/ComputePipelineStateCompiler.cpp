@@ -32,6 +32,7 @@
 #include "RERenderer/Resource/VertexAttributes/VertexAttributesResourceManager.h"
 #include "RERenderer/Resource/VertexAttributes/VertexAttributesResource.h"
 #include "RERenderer/Core/Platform/PlatformManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <RECore/Asset/AssetManager.h>
 #include "RERenderer/IRenderer.h"
 #include "RERenderer/Context.h"
@@ -155,6 +156,7 @@ namespace RERenderer
 	void ComputePipelineStateCompiler::instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, ComputePipelineStateCache& computePipelineStateCache)
 	{
 		// Get the compute program cache; synchronous processing
+		const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 		const RERHI::RHIRootSignaturePtr& rootSignaturePtr = materialBlueprintResource.getRootSignaturePtr();
 		if (nullptr != rootSignaturePtr)
 		{
@@ -220,14 +222,9 @@ namespace RERenderer
 						const ShaderCacheId shaderCacheId = computePipelineStateSignature.getShaderCombinationId();
 
 						// Does the shader cache already exist?
-						ShaderCache* shaderCache = nullptr;
-						std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-						ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-						if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
-						{
-							shaderCache = shaderCacheIdIterator->second;
-						}
-						else
+						// -> Looked up without holding a lock during the shader building, "RERenderer::ShaderCacheManager::registerShaderCache()" takes care of concurrent builds of one and the same shader cache
+						ShaderCache* shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+						if (nullptr == shaderCache)
 						{
 							// Try to create the new compute shader cache instance
 							const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
@@ -251,22 +248,11 @@ namespace RERenderer
 									// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 									// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 									const ShaderSourceCodeId shaderSourceCodeId = RECore::Math::calculateFNV1a32(reinterpret_cast<const RECore::uint8*>(sourceCode.c_str()), static_cast<RECore::uint32>(sourceCode.size()));
-									ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-									if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
-									{
-										// Reuse already existing shader instance
-										// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-										shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-										shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-									}
-									else
+									bool isNewMasterShaderCache = false;
+									shaderCache = shaderCacheManager.registerShaderCache(shaderCacheId, shaderSourceCodeId, buildShader.assetIds, buildShader.combinedAssetFileHashes, isNewMasterShaderCache);
+									if (isNewMasterShaderCache)
 									{
-										// Create the new shader cache instance
-										shaderCache = new ShaderCache(shaderCacheId);
-										shaderCache->mAssetIds = buildShader.assetIds;
-										shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-										shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-										shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+										// We're responsible for the shader compilation of the new master shader cache
 										compilerRequest.shaderSourceCode = sourceCode;
 									}
 								}
@@ -33,6 +33,7 @@
 #include "RERenderer/Resource/VertexAttributes/VertexAttributesResourceManager.h"
 #include "RERenderer/Resource/VertexAttributes/VertexAttributesResource.h"
 #include "RERenderer/Core/Platform/PlatformManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <RECore/Asset/AssetManager.h>
 #include "RERenderer/IRenderer.h"
 #include "RERenderer/Context.h"
@@ -69,6 +70,30 @@ namespace RERenderer
 		}
 	}
 
+	void GraphicsPipelineStateCompiler::setNumberOfBuilderThreads(RECore::uint32 numberOfBuilderThreads)
+	{
+		if (mNumberOfBuilderThreads != numberOfBuilderThreads)
+		{
+			// Builder threads shutdown
+			mShutdownBuilderThread = true;
+			mBuilderConditionVariable.notify_all();
+			for (std::thread& thread : mBuilderThreads)
+			{
+				thread.join();
+			}
+
+			// Create the builder threads assembling the shader source code, each builder thread has its own shader builder instance
+			mNumberOfBuilderThreads = numberOfBuilderThreads;
+			mBuilderThreads.clear();
+			mBuilderThreads.reserve(mNumberOfBuilderThreads);
+			mShutdownBuilderThread = false;
+			for (RECore::uint32 i = 0; i < mNumberOfBuilderThreads; ++i)
+			{
+				mBuilderThreads.push_back(std::thread(&GraphicsPipelineStateCompiler::builderThreadWorker, this));
+			}
+		}
+	}
+
 	void GraphicsPipelineStateCompiler::setNumberOfCompilerThreads(RECore::uint32 numberOfCompilerThreads)
 	{
 		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
@@ -121,22 +146,21 @@ namespace RERenderer
 	GraphicsPipelineStateCompiler::GraphicsPipelineStateCompiler(IRenderer& renderer) :
 		mRenderer(renderer),
 		mAsynchronousCompilationEnabled(renderer.getRhi().getCapabilities().nativeMultithreading),
+		mNumberOfBuilderThreads(0),
 		mNumberOfCompilerThreads(0),
 		mNumberOfInFlightCompilerRequests(0),
 		mShutdownBuilderThread(false),
-		mBuilderThread(&GraphicsPipelineStateCompiler::builderThreadWorker, this),
 		mShutdownCompilerThread(false)
 	{
 		// Create and start the threads
+		setNumberOfBuilderThreads(2);
 		setNumberOfCompilerThreads(2);
 	}
 
 	GraphicsPipelineStateCompiler::~GraphicsPipelineStateCompiler()
 	{
-		// Builder thread shutdown
-		mShutdownBuilderThread = true;
-		mBuilderConditionVariable.notify_one();
-		mBuilderThread.join();
+		// Builder threads shutdown
+		setNumberOfBuilderThreads(0);
 
 		// Compiler threads shutdown
 		setNumberOfCompilerThreads(0);
@@ -156,6 +180,7 @@ namespace RERenderer
 	void GraphicsPipelineStateCompiler::instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache)
 	{
 		// Get the graphics program cache; synchronous processing
+		const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 		const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
 		const GraphicsProgramCache* graphicsProgramCache = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager().getGraphicsProgramCacheByGraphicsPipelineStateSignature(graphicsPipelineStateSignature);
 		if (nullptr != graphicsProgramCache)
@@ -222,33 +247,43 @@ namespace RERenderer
 					{
 						graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId = GraphicsProgramCacheManager::generateGraphicsProgramCacheId(graphicsPipelineStateSignature);
 					}
+					const GraphicsProgramCache* graphicsProgramCache = nullptr;
 					{ // In flight graphics program caches handling
+						// -> Checking and marking a graphics program cache as in flight is done atomically since multiple builder threads might process compiler requests resulting in one and the same graphics program cache
+						// -> Lock order: In flight graphics program caches mutex first, graphics program cache manager mutex second
 						std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
 						if (mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId) != mInFlightGraphicsProgramCaches.end())
 						{
 							needToWaitForGraphicsProgramCache = true;
 						}
+						else
+						{
+							std::unique_lock<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
+							const GraphicsProgramCacheManager::GraphicsProgramCacheById::const_iterator iterator = graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId);
+							if (graphicsProgramCacheManager.mGraphicsProgramCacheById.cend() != iterator)
+							{
+								graphicsProgramCache = iterator->second;
+							}
+							else
+							{
+								// Graphics program cache is now in flight
+								mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId);
+							}
+						}
 					}
 					if (!needToWaitForGraphicsProgramCache)
 					{
-						std::unique_lock<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
-						const GraphicsProgramCacheManager::GraphicsProgramCacheById::const_iterator iterator = graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId);
-						if (graphicsProgramCacheManager.mGraphicsProgramCacheById.cend() != iterator)
+						if (nullptr != graphicsProgramCache)
 						{
 							// Shortcut since the graphics program cache entry already exists: Just create the graphics pipeline state and be done with it
 
 							// Create the graphics pipeline state object (PSO)
-							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *iterator->second->getGraphicsProgramPtr());
+							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramCache->getGraphicsProgramPtr());
 							pushToCompilerQueue = false;
 						}
 						else
 						{
 							// Build the shader source code for the required combination
-							graphicsProgramCacheManagerMutexLock.unlock();
-							{ // Graphics program cache is now in flight
-								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-								mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId);
-							}
 							for (RECore::uint8 i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 							{
 								// Get the shader blueprint resource ID
@@ -260,14 +295,9 @@ namespace RERenderer
 									const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
 
 									// Does the shader cache already exist?
-									ShaderCache* shaderCache = nullptr;
-									std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-									ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-									if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
-									{
-										shaderCache = shaderCacheIdIterator->second;
-									}
-									else
+									// -> Looked up without holding a lock during the shader building, "RERenderer::ShaderCacheManager::registerShaderCache()" takes care of concurrent builds of one and the same shader cache
+									ShaderCache* shaderCache = shaderCacheManager.tryGetShaderCacheById(shaderCacheId);
+									if (nullptr == shaderCache)
 									{
 										// Try to create the new graphics shader cache instance
 										const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
@@ -291,22 +321,11 @@ namespace RERenderer
 												// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 												// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 												const ShaderSourceCodeId shaderSourceCodeId = RECore::Math::calculateFNV1a32(reinterpret_cast<const RECore::uint8*>(sourceCode.c_str()), static_cast<RECore::uint32>(sourceCode.size()));
-												ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-												if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
+												bool isNewMasterShaderCache = false;
+												shaderCache = shaderCacheManager.registerShaderCache(shaderCacheId, shaderSourceCodeId, buildShader.assetIds, buildShader.combinedAssetFileHashes, isNewMasterShaderCache);
+												if (isNewMasterShaderCache)
 												{
-													// Reuse already existing shader instance
-													// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-													shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-												}
-												else
-												{
-													// Create the new shader cache instance
-													shaderCache = new ShaderCache(shaderCacheId);
-													shaderCache->mAssetIds = buildShader.assetIds;
-													shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-													shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+													// We're responsible for the shader compilation of the new master shader cache
 													compilerRequest.shaderSourceCode[i] = sourceCode;
 												}
 											}
@@ -453,9 +472,11 @@ namespace RERenderer
 							GraphicsProgramCacheManager& graphicsProgramCacheManager = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager();
 							const GraphicsProgramCacheId graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId;
 							RHI_ASSERT(RECore::isValid(graphicsProgramCacheId), "Invalid graphics program cache ID")
-							std::unique_lock<std::mutex> mutexLock(graphicsProgramCacheManager.mMutex);
-							RHI_ASSERT(graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId) == graphicsProgramCacheManager.mGraphicsProgramCacheById.cend(), "Invalid graphics program cache ID")	// TODO(naetherm) Error handling
-							graphicsProgramCacheManager.mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
+							{ // Register the graphics program cache, the mutex is released before touching the in flight graphics program caches to respect the builder threads lock order
+								std::unique_lock<std::mutex> mutexLock(graphicsProgramCacheManager.mMutex);
+								RHI_ASSERT(graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId) == graphicsProgramCacheManager.mGraphicsProgramCacheById.cend(), "Invalid graphics program cache ID")	// TODO(naetherm) Error handling
+								graphicsProgramCacheManager.mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
+							}
 
 							{ // The graphics program cache is no longer in flight
 								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
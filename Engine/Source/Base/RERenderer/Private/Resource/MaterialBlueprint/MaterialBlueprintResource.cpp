@@ -29,6 +29,7 @@
 #include "RERenderer/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include <RECore/Resource/ResourceStreamer.h>
 #include <RECore/Asset/AssetManager.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 
 #include <chrono>
@@ -268,6 +269,7 @@ namespace RERenderer
 			// Create sampler resource group, if needed
 			if (nullptr == mSamplerStateGroup)
 			{
+				const RenderThread::RhiLock rhiLock = getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getRenderThread().lockRhi();
 				std::vector<RERHI::RHIResource*> resources;
 				const size_t numberOfSamplerStates = mSamplerStates.size();
 				resources.resize(numberOfSamplerStates);
@@ -307,6 +309,7 @@ namespace RERenderer
 			// Create sampler resource group, if needed
 			if (nullptr == mSamplerStateGroup)
 			{
+				const RenderThread::RhiLock rhiLock = getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getRenderThread().lockRhi();
 				std::vector<RERHI::RHIResource*> resources;
 				const size_t numberOfSamplerStates = mSamplerStates.size();
 				resources.resize(numberOfSamplerStates);
@@ -177,6 +177,7 @@ namespace RERenderer
 			createVertexArrays();
 		}
 		mMeshResource->setVertexArray(mVertexArray, mPositionOnlyVertexArray);
+		mMeshResource->setNumberOfBytes(mNumberOfUsedVertexBufferDataBytes + mNumberOfUsedIndexBufferDataBytes + mNumberOfUsedPositionOnlyIndexBufferDataBytes);
 
 		{ // Create sub-meshes
 			MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
@@ -234,6 +235,7 @@ namespace RERenderer
 			skeletonResource->mGlobalBoneMatrices = reinterpret_cast<glm::mat4*>(mSkeletonData);
 			mSkeletonData += sizeof(glm::mat4) * mNumberOfBones;
 			skeletonResource->mBoneSpaceData = mSkeletonData;
+			skeletonResource->updateSkeletonDataRevision();
 			skeletonResource->localToGlobalPose();
 
 			// Skeleton data has been passed on
@@ -25,6 +25,7 @@
 #include "RERenderer/Resource/Mesh/MeshResource.h"
 #include "RERenderer/Resource/Mesh/Loader/MeshResourceLoader.h"
 #include <RECore/Resource/ResourceManagerTemplate.h>
+#include <RECore/Memory/MemoryTracker.h>
 #ifdef RENDERER_OPENVR
 	#include "RERenderer/Vr/OpenVR/Loader/OpenVRMeshResourceLoader.h"
 #endif
@@ -91,6 +92,8 @@ namespace RERenderer
 
 	void MeshResourceManager::loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, RECore::IResourceListener* resourceListener, bool reload, RECore::ResourceLoaderTypeId resourceLoaderTypeId)
 	{
+		RE_MEMORY_TAG_SCOPE("MeshResourceManager")
+
 		// Choose default resource loader type ID, if necessary
 		if (RECore::isInvalid(resourceLoaderTypeId))
 		{
@@ -152,6 +155,17 @@ RECore::IResource* MeshResourceManager::tryGetResourceByResourceId(RECore::Resou
 		// Nothing here
 	}
 
+	RECore::uint64 MeshResourceManager::getNumberOfResourceBytes() const
+	{
+		RECore::uint64 numberOfBytes = 0;
+		const RECore::uint32 numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (RECore::uint32 i = 0; i < numberOfElements; ++i)
+		{
+			numberOfBytes += mInternalResourceManager->getResources().getElementByIndex(i).getNumberOfBytes();
+		}
+		return numberOfBytes;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual RECore::IResourceManager methods    ]
@@ -22,6 +22,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/Resource/RendererResourceManager.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
+#include "RERenderer/IRenderer.h"
 #include <RECore/Math/Math.h>
 
 
@@ -62,6 +64,7 @@ namespace RERenderer
 		else
 		{
 			// Create RHI resource and add the managers reference
+			const RenderThread::RhiLock rhiLock = mRenderer.getRenderThread().lockRhi();
 			RERHI::RHIResourceGroup* resourceGroup = rootSignature.createResourceGroup(rootParameterIndex, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 			resourceGroup->AddReference();
 			mResourceGroups.emplace(hash, resourceGroup);
@@ -80,7 +83,8 @@ namespace RERenderer
 			{
 				if (iterator->second->GetRefCount() == 1)
 				{
-					iterator->second->Release();
+					// Submitted frames might still reference the resource group
+					mRenderer.getRenderThread().releaseResource(*iterator->second);
 					iterator = mResourceGroups.erase(iterator);
 				}
 				else
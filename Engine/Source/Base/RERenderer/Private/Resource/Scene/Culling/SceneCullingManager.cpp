@@ -300,17 +300,25 @@ namespace
 		}
 
 
+		void splatFrustumPlanes(const RECore::Frustum& frustum, SimdPlane planes[6])
+		{
+			// Splat out the planes to be able to do plane-sphere test with SIMD
+			for (int p = 0; p < 6; ++p)
+			{
+				const RECore::Plane& plane = frustum.planes[p];
+				planes[p].normalX = float4(plane.normal.x);
+				planes[p].normalY = float4(plane.normal.y);
+				planes[p].normalZ = float4(plane.normal.z);
+				planes[p].d = float4(plane.d);
+			}
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Global thread functions                               ]
 		//[-------------------------------------------------------]
-		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const RERenderer::SceneItemSet& sceneItemSet, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, RECore::uint32* RESTRICT visibilityFlag)
+		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const float* RESTRICT spherePositionXData, const float* RESTRICT spherePositionYData, const float* RESTRICT spherePositionZData, const float* RESTRICT negativeRadiusData, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, RECore::uint32* RESTRICT visibilityFlag)
 		{
-			// Get pointers to the necessary members of the object set
-			const float* RESTRICT spherePositionXData = sceneItemSet.spherePositionX.data();
-			const float* RESTRICT spherePositionYData = sceneItemSet.spherePositionY.data();
-			const float* RESTRICT spherePositionZData = sceneItemSet.spherePositionZ.data();
-			const float* RESTRICT negativeRadiusData = sceneItemSet.negativeRadius.data();
-
 			// Test each plane of the frustum against each sphere
 			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
 			for (size_t sceneItemIndex = threadSceneItemIndexStart; sceneItemIndex < threadSceneItemIndexEnd; sceneItemIndex += simdSize)
@@ -546,6 +554,24 @@ namespace RERenderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	RECore::uint32 SceneCullingManager::getPaddedNumberOfSpheres(RECore::uint32 numberOfSpheres)
+	{
+		// Take alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
+		return ::detail::alignToSimdLaneCount(numberOfSpheres) + xsimd::simd_type<float>::size;
+	}
+
+	void SceneCullingManager::cullSpheres(const RECore::Frustum& frustum, const glm::vec3& worldSpaceCameraPosition, const float* spherePositionX, const float* spherePositionY, const float* spherePositionZ, const float* negativeRadius, RECore::uint32 numberOfSpheres, RECore::uint32* visibilityFlag)
+	{
+		const ::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPosition.x), ::detail::float4(worldSpaceCameraPosition.y), ::detail::float4(worldSpaceCameraPosition.z) };
+		::detail::SimdPlane planes[6];
+		::detail::splatFrustumPlanes(frustum, planes);
+		::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, spherePositionX, spherePositionY, spherePositionZ, negativeRadius, 0, numberOfSpheres, visibilityFlag);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -621,44 +647,8 @@ namespace RERenderer
 		::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPositionFloat.x), ::detail::float4(worldSpaceCameraPositionFloat.y), ::detail::float4(worldSpaceCameraPositionFloat.z) };
 
 		// Splat out the planes to be able to do plane-sphere test with SIMD
-		const ::detail::SimdPlane planes[6] =
-		{
-			// Left clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_LEFT].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_LEFT].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_LEFT].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_LEFT].d),
-
-			// Right clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_RIGHT].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_RIGHT].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_RIGHT].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_RIGHT].d),
-
-			// Top clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_TOP].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_TOP].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_TOP].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_TOP].d),
-
-			// Bottom clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_BOTTOM].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_BOTTOM].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_BOTTOM].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_BOTTOM].d),
-
-			// Near clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_NEAR].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_NEAR].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_NEAR].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_NEAR].d),
-
-			// Far clipping plane
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_FAR].normal.x),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_FAR].normal.y),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_FAR].normal.z),
-			::detail::float4(frustum.planes[RECore::Frustum::PLANE_FAR].d),
-		};
+		::detail::SimdPlane planes[6];
+		::detail::splatFrustumPlanes(frustum, planes);
 
 		// Make sure to align the size to the SIMD lane count
 		const RECore::uint32 n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
@@ -719,7 +709,7 @@ namespace RERenderer
 			if (1 == threadCount)
 			{
 				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
+				::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, mCullableSceneItemSet->spherePositionX.data(), mCullableSceneItemSet->spherePositionY.data(), mCullableSceneItemSet->spherePositionZ.data(), mCullableSceneItemSet->negativeRadius.data(), 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
 			}
 			else
 			{
@@ -728,7 +718,7 @@ namespace RERenderer
 				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
 				{
 					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
+					defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes, mCullableSceneItemSet->spherePositionX.data(), mCullableSceneItemSet->spherePositionY.data(), mCullableSceneItemSet->spherePositionZ.data(), mCullableSceneItemSet->negativeRadius.data(), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
 					itemCount -= splitCount;
 					threadSceneItemIndexOffset += splitCount;
 				}
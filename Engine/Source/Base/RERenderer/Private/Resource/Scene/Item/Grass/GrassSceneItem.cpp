@@ -24,12 +24,86 @@
 #include "RERenderer/Resource/Scene/Item/Grass/GrassSceneItem.h"
 #include "RERenderer/Resource/Scene/SceneResource.h"
 #include "RERenderer/Resource/Scene/SceneNode.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 #include "RERenderer/Resource/Mesh/MeshResourceManager.h"
 #include "RERenderer/Resource/Material/MaterialTechnique.h"
 #include "RERenderer/Resource/Material/MaterialResourceManager.h"
 #include "RERenderer/Resource/Material/MaterialResource.h"
+#include "RERenderer/Resource/Scene/Culling/SceneCullingManager.h"
+#include "RERenderer/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "RERenderer/Resource/CompositorWorkspace/CompositorContextData.h"
 #include <RECore/Log/Log.h>
+#include <RECore/Math/Frustum.h>
+#include <RECore/Time/TimeManager.h>
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		class Random final
+		{
+		public:
+			inline explicit Random(RECore::uint32 seed) :
+				mState((0 != seed) ? seed : 1)	// Xorshift must not be seeded with zero
+			{
+				// Nothing here
+			}
+
+			[[nodiscard]] inline float getFloat()
+			{
+				// Xorshift32, returns a value inside [0, 1)
+				mState ^= mState << 13;
+				mState ^= mState >> 17;
+				mState ^= mState << 5;
+				return static_cast<float>(mState >> 8) * (1.0f / 16777216.0f);
+			}
+
+		private:
+			RECore::uint32 mState;
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline RECore::uint32 getTileIndex(RECore::int32 tileX, RECore::int32 tileZ)
+		{
+			// Positive modulo, tile coordinates can be negative
+			constexpr RECore::int32 TILE_CACHE_SIZE = static_cast<RECore::int32>(RERenderer::GrassSceneItem::TILE_CACHE_SIZE);
+			const RECore::int32 x = ((tileX % TILE_CACHE_SIZE) + TILE_CACHE_SIZE) % TILE_CACHE_SIZE;
+			const RECore::int32 z = ((tileZ % TILE_CACHE_SIZE) + TILE_CACHE_SIZE) % TILE_CACHE_SIZE;
+			return static_cast<RECore::uint32>(z * TILE_CACHE_SIZE + x);
+		}
+
+		[[nodiscard]] inline RECore::uint32 getTileSeed(RECore::int32 tileX, RECore::int32 tileZ, RECore::uint32 randomSeed)
+		{
+			// Spatial hash, a tile must always look the same no matter when it's generated
+			return (static_cast<RECore::uint32>(tileX) * 73856093u) ^ (static_cast<RECore::uint32>(tileZ) * 19349663u) ^ (randomSeed * 83492791u);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -40,25 +114,99 @@ namespace RERenderer
 
 
 	//[-------------------------------------------------------]
-	//[ Public virtual RERenderer::ISceneItem methods           ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	const RenderableManager* GrassSceneItem::getRenderableManager() const
+	void GrassSceneItem::setSettings(const Settings& settings)
 	{
 		// Sanity checks
-		RHI_ASSERT(RECore::Math::QUAT_IDENTITY == mRenderableManager.getTransform().rotation, "No rotation is supported to keep things simple")
-		RHI_ASSERT(RECore::Math::VEC3_ONE == mRenderableManager.getTransform().scale, "No scale is supported to keep things simple")
+		RHI_ASSERT(settings.tileSize > 0.0f, "Invalid grass tile size")
+		RHI_ASSERT(settings.minimumSize <= settings.maximumSize, "Invalid grass size")
+		RHI_ASSERT(settings.lodStartDistance <= settings.maximumDistance, "Invalid grass LOD distance")
+		RHI_ASSERT(settings.maximumDistance <= static_cast<float>(TILE_CACHE_SIZE / 2 - 1) * settings.tileSize, "The grass maximum distance exceeds the tile ring buffer extent, increase the tile size")
 
-		// Call the base implementation
-		return MaterialSceneItem::getRenderableManager();
+		mSettings = settings;
+		invalidateTiles();
+	}
+
+	void GrassSceneItem::setDensityMap(RECore::uint32 width, RECore::uint32 height, const RECore::uint8* densities, const glm::vec2& objectSpaceMinimum, const glm::vec2& objectSpaceSize)
+	{
+		// Sanity checks
+		RHI_ASSERT(width > 0 && height > 0, "Invalid grass density map size")
+		RHI_ASSERT(nullptr != densities, "Invalid grass density map")
+		RHI_ASSERT(objectSpaceSize.x > 0.0f && objectSpaceSize.y > 0.0f, "Invalid grass density map object space size")
+
+		mDensityMapWidth = width;
+		mDensityMapHeight = height;
+		mDensityMap.assign(densities, densities + width * height);
+		mDensityMapObjectSpaceMinimum = objectSpaceMinimum;
+		mDensityMapObjectSpaceSize = objectSpaceSize;
+		invalidateTiles();
+	}
+
+	void GrassSceneItem::clearDensityMap()
+	{
+		mDensityMapWidth = mDensityMapHeight = 0;
+		mDensityMap.clear();
+		invalidateTiles();
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERenderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	void GrassSceneItem::onExecuteOnRendering([[maybe_unused]] const RERHI::RHIRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] RERHI::RHICommandBuffer& commandBuffer) const
+	void GrassSceneItem::onExecuteOnRendering(const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData, [[maybe_unused]] RERHI::RHICommandBuffer& commandBuffer)
 	{
-		// TODO(naetherm) Implement me
+		// The grass might be rendered by multiple views per frame (e.g. multiple cameras or compositor workspaces), each view has its own grass selection
+		// -> Find the view by camera and render target, recycle the least recently updated view if it's a new one
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		RECore::uint32 viewIndex = 0;
+		for (RECore::uint32 i = 0; i < MAXIMUM_NUMBER_OF_VIEWS; ++i)
+		{
+			const View& view = mViews[i];
+			if (view.renderTarget == &renderTarget && view.cameraSceneItem == cameraSceneItem)
+			{
+				viewIndex = i;
+				break;
+			}
+			if (view.lastUpdateFrameNumber < mViews[viewIndex].lastUpdateFrameNumber)
+			{
+				viewIndex = i;
+			}
+		}
+		View& view = mViews[viewIndex];
+		if (view.renderTarget != &renderTarget || view.cameraSceneItem != cameraSceneItem)
+		{
+			view.cameraSceneItem = cameraSceneItem;
+			view.renderTarget = &renderTarget;
+			view.lastUpdateFrameNumber = RECore::getInvalid<RECore::uint64>();
+		}
+
+		// Update the view only once per frame, further passes of the view during the frame reuse the grass selection
+		const RECore::uint64 numberOfRenderedFrames = getSceneResource().getRenderer().getTimeManager().getNumberOfRenderedFrames();
+		if (view.lastUpdateFrameNumber != numberOfRenderedFrames)
+		{
+			view.lastUpdateFrameNumber = numberOfRenderedFrames;
+			updateGrass(viewIndex, renderTarget, compositorContextData);
+		}
+
+		// Let the material techniques use the structured buffer of the view and the render thread frame slot, the resource groups are cached by the renderer resource manager
+		const IRenderer& renderer = getSceneResource().getRenderer();
+		const RECore::uint32 frameIndex = renderer.getRenderThread().getRecordingFrameIndex();
+		if ((mCurrentViewIndex != viewIndex || mCurrentFrameIndex != frameIndex) && nullptr != view.structuredBufferPtrs[frameIndex])
+		{
+			mCurrentViewIndex = viewIndex;
+			mCurrentFrameIndex = frameIndex;
+			for (MaterialTechnique* materialTechnique : renderer.getMaterialResourceManager().getById(getMaterialResourceId()).getSortedMaterialTechniqueVector())
+			{
+				materialTechnique->setStructuredBufferPtr(2, view.structuredBufferPtrs[frameIndex]);
+			}
+		}
+
+		// Draw one instance per visible grass blade of the view
+		for (Renderable& renderable : mRenderableManager.getRenderables())
+		{
+			renderable.setInstanceCount(view.numberOfVisibleGrass);
+		}
 	}
 
 
@@ -84,13 +232,13 @@ namespace RERenderer
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
 		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, RECore::getInvalid<SkeletonResourceId>(), false, mIndirectBufferPtr, 0, 1 RHI_RESOURCE_DEBUG_NAME(debugName));
+		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, RECore::getInvalid<SkeletonResourceId>(), false, 0, 12, 0 RHI_RESOURCE_DEBUG_NAME(debugName));	// Twelve vertices per grass (two quads), grass index = instance index, the instance count is updated during rendering
 		mRenderableManager.updateCachedRenderablesData();
 
 		// Tell the used material resource about our structured buffer
 		for (MaterialTechnique* materialTechnique : materialResourceManager.getById(materialResourceId).getSortedMaterialTechniqueVector())
 		{
-			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
+			materialTechnique->setStructuredBufferPtr(2, mViews[mCurrentViewIndex].structuredBufferPtrs[mCurrentFrameIndex]);
 		}
 
 		// We need "RERenderer::ISceneItem::onExecuteOnRendering()" calls during runtime
@@ -99,55 +247,241 @@ namespace RERenderer
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	GrassSceneItem::GrassSceneItem(SceneResource& sceneResource) :
-		MaterialSceneItem(sceneResource, false),	// TODO(naetherm) Set bounding box
-		mMaximumNumberOfGrass(3)	// TODO(naetherm) Make this dynamic
+		MaterialSceneItem(sceneResource, false),	// Not cullable by intent, the individual grass tiles are culled during rendering
+		mMaximumNumberOfGrass(DEFAULT_MAXIMUM_NUMBER_OF_GRASS),
+		mCurrentViewIndex(0),
+		mCurrentFrameIndex(0),
+		mDensityMapWidth(0),
+		mDensityMapHeight(0),
+		mDensityMapObjectSpaceMinimum(0.0f, 0.0f),
+		mDensityMapObjectSpaceSize(0.0f, 0.0f)
 	{
+		invalidateTiles();
+		for (View& view : mViews)
+		{
+			view.cameraSceneItem = nullptr;
+			view.renderTarget = nullptr;
+			view.lastUpdateFrameNumber = 0;
+			view.numberOfVisibleGrass = 0;
+		}
+
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
+		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize >= sizeof(GrassDataStruct) * mMaximumNumberOfGrass)
+		{
+			// Create the structured buffer of the first view, it's filled with the visible grass during rendering and the material techniques need a structured buffer right from the start
+			mViews[0].structuredBufferPtrs[0] = renderer.getBufferManager().createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfGrass, nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+		}
+		else
+		{
+			mMaximumNumberOfGrass = 0;
+      RE_LOG(Warning, "The renderer grass scene item needs a RHI implementation with structured buffer support")
+		}
+	}
+
+	void GrassSceneItem::invalidateTiles()
+	{
+		for (Tile& tile : mTiles)
+		{
+			tile.tileX = tile.tileZ = RECore::getInvalid<RECore::int32>();
+			tile.generated = false;
+		}
+	}
+
+	float GrassSceneItem::getDensity(float objectSpaceX, float objectSpaceZ) const
+	{
+		if (mDensityMap.empty())
+		{
+			// No density map means maximum density everywhere
+			return 1.0f;
+		}
+
+		// Nearest density map texel, no grass outside the density map
+		const float u = (objectSpaceX - mDensityMapObjectSpaceMinimum.x) / mDensityMapObjectSpaceSize.x;
+		const float v = (objectSpaceZ - mDensityMapObjectSpaceMinimum.y) / mDensityMapObjectSpaceSize.y;
+		if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f)
+		{
+			return 0.0f;
+		}
+		const RECore::uint32 x = std::min(static_cast<RECore::uint32>(u * static_cast<float>(mDensityMapWidth)), mDensityMapWidth - 1);
+		const RECore::uint32 y = std::min(static_cast<RECore::uint32>(v * static_cast<float>(mDensityMapHeight)), mDensityMapHeight - 1);
+		return static_cast<float>(mDensityMap[y * mDensityMapWidth + x]) * (1.0f / 255.0f);
+	}
+
+	void GrassSceneItem::generateTile(RECore::int32 tileX, RECore::int32 tileZ)
+	{
+		Tile& tile = mTiles[::detail::getTileIndex(tileX, tileZ)];
+		tile.tileX = tileX;
+		tile.tileZ = tileZ;
+		tile.generated = true;
+		tile.grassData.clear();
+
+		// Candidate blades are rejected by the density map, the resulting order is random so each prefix is an uniform subset
+		::detail::Random random(::detail::getTileSeed(tileX, tileZ, mSettings.randomSeed));
+		const float tileSize = mSettings.tileSize;
+		const float tileMinimumX = static_cast<float>(tileX) * tileSize;
+		const float tileMinimumZ = static_cast<float>(tileZ) * tileSize;
+		const float sizeRange = mSettings.maximumSize - mSettings.minimumSize;
+		const RECore::uint32 maximumNumberOfBlades = static_cast<RECore::uint32>(mSettings.maximumDensity * tileSize * tileSize);
+		tile.grassData.reserve(maximumNumberOfBlades);
+		for (RECore::uint32 i = 0; i < maximumNumberOfBlades; ++i)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(naetherm) Make this dynamic
-			const GrassDataStruct grassData[3] =
+			const float x = tileMinimumX + random.getFloat() * tileSize;
+			const float z = tileMinimumZ + random.getFloat() * tileSize;
+			if (random.getFloat() < getDensity(x, z))
 			{
+				const float brightness = 1.0f - mSettings.colorVariation * random.getFloat();
+				GrassDataStruct& grassData = tile.grassData.emplace_back();
+				grassData.PositionSize[0] = x;
+				grassData.PositionSize[1] = 0.0f;
+				grassData.PositionSize[2] = z;
+				grassData.PositionSize[3] = mSettings.minimumSize + random.getFloat() * sizeRange;
+				grassData.ColorRotation[0] = mSettings.color.r * brightness;
+				grassData.ColorRotation[1] = mSettings.color.g * brightness;
+				grassData.ColorRotation[2] = mSettings.color.b * brightness;
+				grassData.ColorRotation[3] = random.getFloat() * glm::two_pi<float>();
+			}
+		}
+	}
+
+	void GrassSceneItem::updateGrass(RECore::uint32 viewIndex, const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData)
+	{
+		View& view = mViews[viewIndex];
+		view.numberOfVisibleGrass = 0;
+		const CameraSceneItem* cameraSceneItem = compositorContextData.getCameraSceneItem();
+		if (nullptr != cameraSceneItem && mMaximumNumberOfGrass > 0 && mRenderableManager.isVisible())
+		{
+			// Camera relative world space position of the object space origin as well as the rotation and scale of the global transform
+			// -> The shader adds the camera relative world space position of the renderable manager, rotation and scale are applied here
+			const RECore::Transform& transform = mRenderableManager.getTransform();
+			const glm::vec3 cameraRelativeOrigin = glm::vec3(transform.position - cameraSceneItem->getWorldSpaceCameraPosition());
+			glm::mat3 rotationScale = glm::mat3_cast(transform.rotation);
+			rotationScale[0] *= transform.scale.x;
+			rotationScale[1] *= transform.scale.y;
+			rotationScale[2] *= transform.scale.z;
+			const float sizeScale = std::max(std::abs(transform.scale.x), std::max(std::abs(transform.scale.y), std::abs(transform.scale.z)));
+			const bool identityRotationScale = (RECore::Math::QUAT_IDENTITY == transform.rotation && RECore::Math::VEC3_ONE == transform.scale);
+			const glm::vec3 objectSpaceCameraPosition = glm::inverse(rotationScale) * -cameraRelativeOrigin;
+			const float objectSpaceCameraX = objectSpaceCameraPosition.x;
+			const float objectSpaceCameraZ = objectSpaceCameraPosition.z;
+
+			{ // Gather the tiles inside the tile ring buffer window around the camera which are within the maximum distance
+				const float tileSize = mSettings.tileSize;
+				const float halfTileSize = tileSize * 0.5f;
+				const float tileRadius = (halfTileSize * glm::root_two<float>() + mSettings.maximumSize) * sizeScale;
+				const float objectSpaceTileCenterY = mSettings.maximumSize * 0.5f;
+				constexpr RECore::int32 HALF_TILE_CACHE_SIZE = static_cast<RECore::int32>(TILE_CACHE_SIZE / 2);
+				const RECore::int32 cameraTileX = static_cast<RECore::int32>(std::floor(objectSpaceCameraX / tileSize));
+				const RECore::int32 cameraTileZ = static_cast<RECore::int32>(std::floor(objectSpaceCameraZ / tileSize));
+				mTileCandidates.clear();
+				for (RECore::int32 tileZ = cameraTileZ - HALF_TILE_CACHE_SIZE; tileZ < cameraTileZ + HALF_TILE_CACHE_SIZE; ++tileZ)
 				{
-					3.0f, -1.781f, 20.0f, 0.5f,
-					1.0f,  1.0f,   1.0f, 0.4f
-				},
+					for (RECore::int32 tileX = cameraTileX - HALF_TILE_CACHE_SIZE; tileX < cameraTileX + HALF_TILE_CACHE_SIZE; ++tileX)
+					{
+						// Camera relative world space tile center
+						const glm::vec3 tileCenter = cameraRelativeOrigin + rotationScale * glm::vec3(static_cast<float>(tileX) * tileSize + halfTileSize, objectSpaceTileCenterY, static_cast<float>(tileZ) * tileSize + halfTileSize);
+						const float distance = glm::length(tileCenter);
+						if (distance - tileRadius < mSettings.maximumDistance)
+						{
+							mTileCandidates.push_back({ tileX, tileZ, distance, tileCenter });
+						}
+					}
+				}
+
+				// Front to back, in case the grass budget is exhausted the nearby grass wins
+				std::sort(mTileCandidates.begin(), mTileCandidates.end(), [](const TileCandidate& left, const TileCandidate& right) { return left.distance < right.distance; });
+
+				// Fill the tile bounding spheres, padded as required by the SIMD culling
+				const RECore::uint32 numberOfTileCandidates = static_cast<RECore::uint32>(mTileCandidates.size());
+				const RECore::uint32 paddedNumberOfTileCandidates = SceneCullingManager::getPaddedNumberOfSpheres(numberOfTileCandidates);
+				if (mTileVisibilityFlag.size() < paddedNumberOfTileCandidates)
 				{
-					5.0f, -1.781f, 19.0f, 1.0f,
-					1.0f,  1.0f,   1.0f, 0.8f
-				},
+					mTileSpherePositionX.resize(paddedNumberOfTileCandidates);
+					mTileSpherePositionY.resize(paddedNumberOfTileCandidates);
+					mTileSpherePositionZ.resize(paddedNumberOfTileCandidates);
+					mTileNegativeRadius.resize(paddedNumberOfTileCandidates);
+					mTileVisibilityFlag.resize(paddedNumberOfTileCandidates);
+				}
+				for (RECore::uint32 i = 0; i < numberOfTileCandidates; ++i)
 				{
-					4.0f, -1.781f, 21.0f, 1.5f,
-					1.0f,  1.0f,   1.0f, 1.2f
+					const TileCandidate& tileCandidate = mTileCandidates[i];
+					mTileSpherePositionX[i] = tileCandidate.center.x;
+					mTileSpherePositionY[i] = tileCandidate.center.y;
+					mTileSpherePositionZ[i] = tileCandidate.center.z;
+					mTileNegativeRadius[i] = -tileRadius;
 				}
-			};
-			RERHI::RHIBufferManager& bufferManager = renderer.getBufferManager();
 
-			// Create the structured buffer
-			mStructuredBufferPtr = bufferManager.createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfGrass, grassData, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::STATIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+				// Frustum-sphere culling using a camera relative world space frustum
+				RECore::uint32 renderTargetWidth = 0;
+				RECore::uint32 renderTargetHeight = 0;
+				renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+				const glm::mat4& viewSpaceToClipSpaceMatrix = cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight));
+				const RECore::Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+				SceneCullingManager::cullSpheres(frustum, glm::vec3(0.0f, 0.0f, 0.0f), mTileSpherePositionX.data(), mTileSpherePositionY.data(), mTileSpherePositionZ.data(), mTileNegativeRadius.data(), numberOfTileCandidates, mTileVisibilityFlag.data());
+			}
 
-			{ // Create the indirect buffer: Twelve vertices per grass (two quads), grass index = instance index
-				const RERHI::DrawArguments drawArguments =
+			// Write the density LOD prefix of the visible tiles into the structured buffer, tiles are generated on demand
+			// -> Submitted frames which are still in flight use the structured buffers of their own render thread frame slots
+			const IRenderer& renderer = getSceneResource().getRenderer();
+			RenderThread& renderThread = renderer.getRenderThread();
+			RERHI::RHIStructuredBufferPtr& structuredBufferPtr = view.structuredBufferPtrs[renderThread.getRecordingFrameIndex()];
+			const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+			if (nullptr == structuredBufferPtr)
+			{
+				structuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(GrassDataStruct) * mMaximumNumberOfGrass, nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, sizeof(GrassDataStruct) RHI_RESOURCE_DEBUG_NAME("Grass"));
+			}
+			RERHI::RHIDynamicRHI& rhi = renderer.getRhi();
+			RERHI::MappedSubresource mappedSubresource;
+			if (rhi.map(*structuredBufferPtr, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			{
+				GrassDataStruct* grassData = static_cast<GrassDataStruct*>(mappedSubresource.data);
+				const float lodDistanceRange = std::max(mSettings.maximumDistance - mSettings.lodStartDistance, std::numeric_limits<float>::epsilon());
+				const RECore::uint32 numberOfTileCandidates = static_cast<RECore::uint32>(mTileCandidates.size());
+				for (RECore::uint32 i = 0; i < numberOfTileCandidates && view.numberOfVisibleGrass < mMaximumNumberOfGrass; ++i)
 				{
-					12,						// vertexCountPerInstance (RECore::uint32)
-					mMaximumNumberOfGrass,	// instanceCount (RECore::uint32)
-					0,						// startVertexLocation (RECore::uint32)
-					0						// startInstanceLocation (RECore::uint32)
-				};
-				mIndirectBufferPtr = bufferManager.createIndirectBuffer(sizeof(RERHI::DrawArguments), &drawArguments, RERHI::IndirectBufferFlag::UNORDERED_ACCESS | RERHI::IndirectBufferFlag::DRAW_ARGUMENTS, RERHI::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME("Grass"));
+					if (0 == mTileVisibilityFlag[i])
+					{
+						continue;
+					}
+					const TileCandidate& tileCandidate = mTileCandidates[i];
+					const float density = 1.0f - std::clamp((tileCandidate.distance - mSettings.lodStartDistance) / lodDistanceRange, 0.0f, 1.0f);
+					if (density <= 0.0f)
+					{
+						continue;
+					}
+					const Tile& tile = mTiles[::detail::getTileIndex(tileCandidate.tileX, tileCandidate.tileZ)];
+					if (!tile.generated || tile.tileX != tileCandidate.tileX || tile.tileZ != tileCandidate.tileZ)
+					{
+						generateTile(tileCandidate.tileX, tileCandidate.tileZ);
+					}
+					const RECore::uint32 numberOfGrass = std::min(static_cast<RECore::uint32>(std::ceil(static_cast<float>(tile.grassData.size()) * density)), mMaximumNumberOfGrass - view.numberOfVisibleGrass);
+					if (identityRotationScale)
+					{
+						memcpy(grassData + view.numberOfVisibleGrass, tile.grassData.data(), sizeof(GrassDataStruct) * numberOfGrass);
+					}
+					else
+					{
+						// The grass blades stay upright in world space, only the position and the size are transformed
+						for (RECore::uint32 blade = 0; blade < numberOfGrass; ++blade)
+						{
+							const GrassDataStruct& objectSpaceGrassData = tile.grassData[blade];
+							GrassDataStruct& currentGrassData = grassData[view.numberOfVisibleGrass + blade];
+							const glm::vec3 position = rotationScale * glm::vec3(objectSpaceGrassData.PositionSize[0], objectSpaceGrassData.PositionSize[1], objectSpaceGrassData.PositionSize[2]);
+							currentGrassData.PositionSize[0] = position.x;
+							currentGrassData.PositionSize[1] = position.y;
+							currentGrassData.PositionSize[2] = position.z;
+							currentGrassData.PositionSize[3] = objectSpaceGrassData.PositionSize[3] * sizeScale;
+							memcpy(currentGrassData.ColorRotation, objectSpaceGrassData.ColorRotation, sizeof(float) * 4);
+						}
+					}
+					view.numberOfVisibleGrass += numberOfGrass;
+				}
+				rhi.unmap(*structuredBufferPtr, 0);
 			}
 		}
-		else
-		{
-			mMaximumNumberOfGrass = 0;
-      RE_LOG(Warning, "The renderer grass scene item needs a RHI implementation with structured buffer support")
-		}
 	}
 
 
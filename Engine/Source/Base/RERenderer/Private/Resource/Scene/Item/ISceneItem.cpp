@@ -52,7 +52,8 @@ namespace RERenderer
 		mParentSceneNode(nullptr),
 		mSceneItemSet(nullptr),
 		mSceneItemSetIndex(RECore::getInvalid<RECore::uint32>()),
-		mCallExecuteOnRendering(false)
+		mCallExecuteOnRendering(false),
+		mCallUpdate(false)
 	{
 		// TODO(naetherm) The following is just for culling kickoff and won't stay this way
 		if (cullable)
@@ -88,6 +88,7 @@ namespace RERenderer
 				{
 					RHI_ASSERT(nullptr == mSkeletonAnimationController, "Invalid skeleton animation controller")
 					mSkeletonAnimationController = new SkeletonAnimationController(getSceneResource().getRenderer(), static_cast<const MeshResource&>(resource).getSkeletonResourceId());
+					mSkeletonAnimationController->setRenderableManager(getRenderableManager());
 					mSkeletonAnimationController->startSkeletonAnimationByAssetId(mSkeletonAnimationAssetId);
 				}
 			}
@@ -0,0 +1,261 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERenderer/Resource/Scene/Item/Particles/ParticleEmitter.h"
+#include <RECore/Math/Math.h>
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef xsimd::simd_type<float> float4;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] RECore::uint32 alignToSimdLaneCount(RECore::uint32 value)
+		{
+			return RECore::Math::makeMultipleOf(value, static_cast<RECore::uint32>(float4::size));
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	ParticleEmitter::ParticleEmitter(RECore::uint32 maximumNumberOfParticles, RECore::uint32 randomSeed) :
+		mMaximumNumberOfParticles(maximumNumberOfParticles),
+		mNumberOfParticles(0),
+		mRandomState((0 != randomSeed) ? randomSeed : 1),	// Xorshift must not be seeded with zero
+		mEmissionAccumulator(0.0f),
+		mEmitting(true)
+	{
+		// Pad the arrays to the SIMD lane count so the integration never has to deal with a scalar remainder
+		const size_t numberOfElements = ::detail::alignToSimdLaneCount(mMaximumNumberOfParticles);
+		mPositionX.resize(numberOfElements);
+		mPositionY.resize(numberOfElements);
+		mPositionZ.resize(numberOfElements);
+		mVelocityX.resize(numberOfElements);
+		mVelocityY.resize(numberOfElements);
+		mVelocityZ.resize(numberOfElements);
+		mAge.resize(numberOfElements);
+		mInverseLifetime.resize(numberOfElements);
+	}
+
+	void ParticleEmitter::clear()
+	{
+		mNumberOfParticles = 0;
+		mEmissionAccumulator = 0.0f;
+	}
+
+	void ParticleEmitter::update(float pastSeconds)
+	{
+		if (pastSeconds <= 0.0f)
+		{
+			// Nothing to do in here
+			return;
+		}
+
+		{ // Age the particles
+			const ::detail::float4 pastSeconds4(pastSeconds);
+			float* RESTRICT age = mAge.data();
+			const RECore::uint32 numberOfElements = ::detail::alignToSimdLaneCount(mNumberOfParticles);
+			for (RECore::uint32 i = 0; i < numberOfElements; i += ::detail::float4::size)
+			{
+				xsimd::store_aligned(&age[i], xsimd::load_aligned(&age[i]) + pastSeconds4);
+			}
+		}
+		removeDeadParticles();
+		integrateParticles(pastSeconds);
+		emitParticles(pastSeconds);
+	}
+
+	void ParticleEmitter::fillParticleData(ParticleDataStruct* particleData, const glm::mat3& rotationScale) const
+	{
+		const float* RESTRICT positionX = mPositionX.data();
+		const float* RESTRICT positionY = mPositionY.data();
+		const float* RESTRICT positionZ = mPositionZ.data();
+		const float* RESTRICT age = mAge.data();
+		const float* RESTRICT inverseLifetime = mInverseLifetime.data();
+		const float sizeScale = std::max(glm::length(rotationScale[0]), std::max(glm::length(rotationScale[1]), glm::length(rotationScale[2])));
+		const float startSize = mSettings.startSize * sizeScale;
+		const float deltaSize = mSettings.endSize * sizeScale - startSize;
+		const glm::vec4 startColor = mSettings.startColor;
+		const glm::vec4 deltaColor = mSettings.endColor - startColor;
+		for (RECore::uint32 i = 0; i < mNumberOfParticles; ++i)
+		{
+			// Normalized age is inside [0, 1) since dead particles have already been removed
+			const float normalizedAge = age[i] * inverseLifetime[i];
+			ParticleDataStruct& currentParticleData = particleData[i];
+			const glm::vec3 position = rotationScale * glm::vec3(positionX[i], positionY[i], positionZ[i]);
+			currentParticleData.PositionSize[0] = position.x;
+			currentParticleData.PositionSize[1] = position.y;
+			currentParticleData.PositionSize[2] = position.z;
+			currentParticleData.PositionSize[3] = startSize + deltaSize * normalizedAge;
+			currentParticleData.Color[0] = startColor.r + deltaColor.r * normalizedAge;
+			currentParticleData.Color[1] = startColor.g + deltaColor.g * normalizedAge;
+			currentParticleData.Color[2] = startColor.b + deltaColor.b * normalizedAge;
+			currentParticleData.Color[3] = startColor.a + deltaColor.a * normalizedAge;
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void ParticleEmitter::removeDeadParticles()
+	{
+		// Move the last alive particle into the slot of the dead particle, the order of the particles doesn't matter
+		float* RESTRICT positionX = mPositionX.data();
+		float* RESTRICT positionY = mPositionY.data();
+		float* RESTRICT positionZ = mPositionZ.data();
+		float* RESTRICT velocityX = mVelocityX.data();
+		float* RESTRICT velocityY = mVelocityY.data();
+		float* RESTRICT velocityZ = mVelocityZ.data();
+		float* RESTRICT age = mAge.data();
+		float* RESTRICT inverseLifetime = mInverseLifetime.data();
+		RECore::uint32 numberOfParticles = mNumberOfParticles;
+		RECore::uint32 i = 0;
+		while (i < numberOfParticles)
+		{
+			if (age[i] * inverseLifetime[i] >= 1.0f)
+			{
+				--numberOfParticles;
+				positionX[i] = positionX[numberOfParticles];
+				positionY[i] = positionY[numberOfParticles];
+				positionZ[i] = positionZ[numberOfParticles];
+				velocityX[i] = velocityX[numberOfParticles];
+				velocityY[i] = velocityY[numberOfParticles];
+				velocityZ[i] = velocityZ[numberOfParticles];
+				age[i] = age[numberOfParticles];
+				inverseLifetime[i] = inverseLifetime[numberOfParticles];
+
+				// Don't increment the index, the moved particle might be dead as well
+			}
+			else
+			{
+				++i;
+			}
+		}
+		mNumberOfParticles = numberOfParticles;
+	}
+
+	void ParticleEmitter::integrateParticles(float pastSeconds)
+	{
+		// Semi-implicit Euler integration, the padding at the end of the arrays is integrated as well but never read
+		const ::detail::float4 pastSeconds4(pastSeconds);
+		const ::detail::float4 accelerationX(mSettings.acceleration.x * pastSeconds);
+		const ::detail::float4 accelerationY(mSettings.acceleration.y * pastSeconds);
+		const ::detail::float4 accelerationZ(mSettings.acceleration.z * pastSeconds);
+		const ::detail::float4 damping(std::max(0.0f, 1.0f - mSettings.drag * pastSeconds));
+		float* RESTRICT positionX = mPositionX.data();
+		float* RESTRICT positionY = mPositionY.data();
+		float* RESTRICT positionZ = mPositionZ.data();
+		float* RESTRICT velocityX = mVelocityX.data();
+		float* RESTRICT velocityY = mVelocityY.data();
+		float* RESTRICT velocityZ = mVelocityZ.data();
+		const RECore::uint32 numberOfElements = ::detail::alignToSimdLaneCount(mNumberOfParticles);
+		for (RECore::uint32 i = 0; i < numberOfElements; i += ::detail::float4::size)
+		{
+			const ::detail::float4 currentVelocityX = (xsimd::load_aligned(&velocityX[i]) + accelerationX) * damping;
+			const ::detail::float4 currentVelocityY = (xsimd::load_aligned(&velocityY[i]) + accelerationY) * damping;
+			const ::detail::float4 currentVelocityZ = (xsimd::load_aligned(&velocityZ[i]) + accelerationZ) * damping;
+			xsimd::store_aligned(&velocityX[i], currentVelocityX);
+			xsimd::store_aligned(&velocityY[i], currentVelocityY);
+			xsimd::store_aligned(&velocityZ[i], currentVelocityZ);
+			xsimd::store_aligned(&positionX[i], xsimd::fma(currentVelocityX, pastSeconds4, xsimd::load_aligned(&positionX[i])));
+			xsimd::store_aligned(&positionY[i], xsimd::fma(currentVelocityY, pastSeconds4, xsimd::load_aligned(&positionY[i])));
+			xsimd::store_aligned(&positionZ[i], xsimd::fma(currentVelocityZ, pastSeconds4, xsimd::load_aligned(&positionZ[i])));
+		}
+	}
+
+	void ParticleEmitter::emitParticles(float pastSeconds)
+	{
+		if (!mEmitting || mSettings.emissionRate <= 0.0f)
+		{
+			mEmissionAccumulator = 0.0f;
+			return;
+		}
+
+		// Get the number of particles to emit, clamped to the remaining free space
+		mEmissionAccumulator += mSettings.emissionRate * pastSeconds;
+		const RECore::uint32 numberOfFreeParticles = mMaximumNumberOfParticles - mNumberOfParticles;
+		RECore::uint32 numberOfParticlesToEmit = static_cast<RECore::uint32>(mEmissionAccumulator);
+		mEmissionAccumulator -= static_cast<float>(numberOfParticlesToEmit);
+		if (numberOfParticlesToEmit > numberOfFreeParticles)
+		{
+			// Particle budget exhausted, don't accumulate the particles we were unable to emit
+			numberOfParticlesToEmit = numberOfFreeParticles;
+			mEmissionAccumulator = 0.0f;
+		}
+
+		// Emit the particles
+		RHI_ASSERT(mSettings.minimumLifetime > 0.0f && mSettings.minimumLifetime <= mSettings.maximumLifetime, "Invalid particle lifetime")
+		const float lifetimeRange = mSettings.maximumLifetime - mSettings.minimumLifetime;
+		const float emissionDiameter = mSettings.emissionRadius * 2.0f;
+		const glm::vec3 velocitySpreadDiameter = mSettings.velocitySpread * 2.0f;
+		const RECore::uint32 endIndex = mNumberOfParticles + numberOfParticlesToEmit;
+		for (RECore::uint32 i = mNumberOfParticles; i < endIndex; ++i)
+		{
+			mPositionX[i] = mSettings.position.x + (getRandomFloat() - 0.5f) * emissionDiameter;
+			mPositionY[i] = mSettings.position.y + (getRandomFloat() - 0.5f) * emissionDiameter;
+			mPositionZ[i] = mSettings.position.z + (getRandomFloat() - 0.5f) * emissionDiameter;
+			mVelocityX[i] = mSettings.velocity.x + (getRandomFloat() - 0.5f) * velocitySpreadDiameter.x;
+			mVelocityY[i] = mSettings.velocity.y + (getRandomFloat() - 0.5f) * velocitySpreadDiameter.y;
+			mVelocityZ[i] = mSettings.velocity.z + (getRandomFloat() - 0.5f) * velocitySpreadDiameter.z;
+			mAge[i] = 0.0f;
+			mInverseLifetime[i] = 1.0f / (mSettings.minimumLifetime + getRandomFloat() * lifetimeRange);
+		}
+		mNumberOfParticles = endIndex;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERenderer
@@ -28,8 +28,32 @@
 #include "RERenderer/Resource/Material/MaterialTechnique.h"
 #include "RERenderer/Resource/Material/MaterialResourceManager.h"
 #include "RERenderer/Resource/Material/MaterialResource.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include "RERenderer/IRenderer.h"
 #include <RECore/Log/Log.h>
+#include <RECore/Threading/ThreadPool.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t PARTICLE_EMITTERS_SPLIT_COUNT = 1;	///< Package size for each thread to work on, a single particle emitter usually has thousands of particles
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -40,25 +64,107 @@ namespace RERenderer
 
 
 	//[-------------------------------------------------------]
-	//[ Public virtual RERenderer::ISceneItem methods           ]
+	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
-	const RenderableManager* ParticlesSceneItem::getRenderableManager() const
+	RECore::uint32 ParticlesSceneItem::addParticleEmitter(RECore::uint32 maximumNumberOfParticles)
 	{
-		// Sanity checks
-		RHI_ASSERT(RECore::Math::QUAT_IDENTITY == mRenderableManager.getTransform().rotation, "No rotation is supported to keep things simple")
-		RHI_ASSERT(RECore::Math::VEC3_ONE == mRenderableManager.getTransform().scale, "No scale is supported to keep things simple")
+		// The particle emitters share the structured buffer, reject particle emitters exceeding the remaining particle budget
+		RECore::uint32 remainingNumberOfParticles = mMaximumNumberOfParticles;
+		for (const ParticleEmitter& particleEmitter : mParticleEmitters)
+		{
+			remainingNumberOfParticles -= particleEmitter.getMaximumNumberOfParticles();
+		}
+		if (maximumNumberOfParticles > remainingNumberOfParticles)
+		{
+			RE_LOG(Warning, RECore::String("The particle emitter with ") + maximumNumberOfParticles + " particles exceeds the remaining budget of " + remainingNumberOfParticles + " particles of the particles scene item")
+			return RECore::getInvalid<RECore::uint32>();
+		}
 
-		// Call the base implementation
-		return MaterialSceneItem::getRenderableManager();
+		// Each particle emitter gets its own random seed so particle emitters with identical settings don't look the same
+		const RECore::uint32 index = static_cast<RECore::uint32>(mParticleEmitters.size());
+		mParticleEmitters.emplace_back(maximumNumberOfParticles, index + 1);
+		return index;
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERenderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
-	void ParticlesSceneItem::onExecuteOnRendering([[maybe_unused]] const RERHI::RHIRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] RERHI::RHICommandBuffer& commandBuffer) const
+	void ParticlesSceneItem::onUpdate(float pastSecondsSinceLastFrame)
 	{
-		// TODO(naetherm) Implement me
+		{ // Simulate the particle emitters
+			DefaultThreadPool& defaultThreadPool = getSceneResource().getRenderer().getDefaultThreadPool();
+			size_t itemCount = mParticleEmitters.size();
+			size_t splitCount = ::detail::PARTICLE_EMITTERS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (threadCount <= 1)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				updateParticleEmittersRange(0, itemCount, pastSecondsSinceLastFrame);
+			}
+			else
+			{
+				// Multi-threaded
+				size_t startIndex = 0;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					defaultThreadPool.queueTask(std::bind(&ParticlesSceneItem::updateParticleEmittersRange, this, startIndex, startIndex + numberOfItemsToProcess, pastSecondsSinceLastFrame));
+					itemCount -= splitCount;
+					startIndex += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+
+		// Write the alive particles of all particle emitters tightly packed into the structured buffer of the render thread frame slot which is currently recorded
+		// -> The shader adds the camera relative world space position of the renderable manager, the rotation and scale of the global transform are applied here
+		// -> Submitted frames which are still in flight use the structured buffers of their own render thread frame slots
+		RECore::uint32 numberOfParticles = 0;
+		if (mMaximumNumberOfParticles > 0)
+		{
+			const RECore::Transform& transform = mRenderableManager.getTransform();
+			glm::mat3 rotationScale = glm::mat3_cast(transform.rotation);
+			rotationScale[0] *= transform.scale.x;
+			rotationScale[1] *= transform.scale.y;
+			rotationScale[2] *= transform.scale.z;
+			const IRenderer& renderer = getSceneResource().getRenderer();
+			RenderThread& renderThread = renderer.getRenderThread();
+			RERHI::RHIStructuredBufferPtr& structuredBufferPtr = mStructuredBufferPtrs[renderThread.getRecordingFrameIndex()];
+			{
+				const RenderThread::RhiLock rhiLock = renderThread.lockRhi();
+				if (nullptr == structuredBufferPtr)
+				{
+					structuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+				}
+				RERHI::RHIDynamicRHI& rhi = renderer.getRhi();
+				RERHI::MappedSubresource mappedSubresource;
+				if (rhi.map(*structuredBufferPtr, 0, RERHI::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				{
+					ParticleDataStruct* particleData = static_cast<ParticleDataStruct*>(mappedSubresource.data);
+					for (const ParticleEmitter& particleEmitter : mParticleEmitters)
+					{
+						particleEmitter.fillParticleData(particleData + numberOfParticles, rotationScale);
+						numberOfParticles += particleEmitter.getNumberOfParticles();
+					}
+					rhi.unmap(*structuredBufferPtr, 0);
+				}
+			}
+
+			// Let the material techniques use the structured buffer of the render thread frame slot, the resource groups are cached by the renderer resource manager
+			for (MaterialTechnique* materialTechnique : renderer.getMaterialResourceManager().getById(getMaterialResourceId()).getSortedMaterialTechniqueVector())
+			{
+				materialTechnique->setStructuredBufferPtr(2, structuredBufferPtr);
+			}
+		}
+
+		// Draw one instance per alive particle
+		for (Renderable& renderable : mRenderableManager.getRenderables())
+		{
+			renderable.setInstanceCount(numberOfParticles);
+		}
 	}
 
 
@@ -84,72 +190,36 @@ namespace RERenderer
 		const IRenderer& renderer = getSceneResource().getRenderer();
 		const MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
 		const MaterialResourceId materialResourceId = getMaterialResourceId();
-		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, RECore::getInvalid<SkeletonResourceId>(), false, 0, 6, mMaximumNumberOfParticles RHI_RESOURCE_DEBUG_NAME(debugName));
+		mRenderableManager.getRenderables().emplace_back(mRenderableManager, renderer.getMeshResourceManager().getDrawIdVertexArrayPtr(), materialResourceManager, materialResourceId, RECore::getInvalid<SkeletonResourceId>(), false, 0, 6, 0 RHI_RESOURCE_DEBUG_NAME(debugName));	// The instance count is updated after each particles simulation
 		mRenderableManager.updateCachedRenderablesData();
 
 		// Tell the used material resource about our structured buffer
 		for (MaterialTechnique* materialTechnique : materialResourceManager.getById(materialResourceId).getSortedMaterialTechniqueVector())
 		{
-			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtr);
+			materialTechnique->setStructuredBufferPtr(2, mStructuredBufferPtrs[0]);
 		}
 
-		// We need "RERenderer::ISceneItem::onExecuteOnRendering()" calls during runtime
-		setCallExecuteOnRendering(true);
+		// We need "RERenderer::ISceneItem::onUpdate()" calls during runtime
+		setCallUpdate(true);
 	}
 
 
 	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
+	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	ParticlesSceneItem::ParticlesSceneItem(SceneResource& sceneResource) :
 		MaterialSceneItem(sceneResource, false),	// TODO(naetherm) Set bounding box
-		mMaximumNumberOfParticles(8)				// TODO(naetherm) Make this dynamic
+		mMaximumNumberOfParticles(DEFAULT_MAXIMUM_NUMBER_OF_PARTICLES)
 	{
 		// The RHI implementation must support structured buffers
 		const IRenderer& renderer = getSceneResource().getRenderer();
-		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize > 0)
+		if (renderer.getRhi().getCapabilities().maximumStructuredBufferSize >= sizeof(ParticleDataStruct) * mMaximumNumberOfParticles)
 		{
-			// Create vertex array object (VAO)
-			// Create the vertex buffer object (VBO)
-			// TODO(naetherm) Make this dynamic
-			const ParticleDataStruct particlesData[8] =
-			{
-				{
-					4.88f,  1.4f, -1.44f, 0.5f,
-					 1.0f,  1.0f,   1.0f, 0.3f
-				},
-				{
-					-6.2f,  1.4f, -1.44f, 0.5f,
-					 1.0f,  1.0f,   1.0f, 0.3f
-				},
-				{
-					4.88f,  1.4f,   2.2f, 0.5f,
-					 1.0f,  1.0f,   1.0f, 0.3f
-				},
-				{
-					-6.2f,  1.4f,   2.2f, 0.5f,
-					 1.0f,  1.0f,   1.0f, 0.3f
-				},
-				{
-					-12.0f, 1.39f,  -4.0f, 1.0f,
-					  1.0f,  0.0f,   0.0f, 1.0f
-				},
-				{
-					11.2f, 1.39f,  -4.0f, 1.0f,
-					 0.0f,  1.0f,   0.0f, 1.0f
-				},
-				{
-					-12.0f, 1.39f,   4.5f, 1.0f,
-					  0.0f,  0.0f,   1.0f, 1.0f
-				},
-				{
-					11.2f, 1.39f,   4.5f, 1.0f,
-					 1.0f,  1.0f,   1.0f, 1.0f
-				}
-			};
+			// Create the structured buffer of the first render thread frame slot, it's filled after each particles simulation and the material techniques need a structured buffer right from the start
+			mStructuredBufferPtrs[0] = renderer.getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, nullptr, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::DYNAMIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
 
-			// Create the structured buffer
-			mStructuredBufferPtr = renderer.getBufferManager().createStructuredBuffer(sizeof(ParticleDataStruct) * mMaximumNumberOfParticles, particlesData, RERHI::BufferFlag::SHADER_RESOURCE, RERHI::BufferUsage::STATIC_DRAW, sizeof(ParticleDataStruct) RHI_RESOURCE_DEBUG_NAME("Particles"));
+			// Default particle emitter using the whole particle budget
+			addParticleEmitter(mMaximumNumberOfParticles);
 		}
 		else
 		{
@@ -158,6 +228,14 @@ namespace RERenderer
 		}
 	}
 
+	void ParticlesSceneItem::updateParticleEmittersRange(size_t startIndex, size_t endIndex, float pastSeconds)
+	{
+		for (size_t i = startIndex; i < endIndex; ++i)
+		{
+			mParticleEmitters[i].update(pastSeconds);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
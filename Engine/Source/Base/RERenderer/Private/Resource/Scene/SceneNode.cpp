@@ -52,8 +52,8 @@ namespace RERenderer
 		// TODO(naetherm) Need to guarantee that one scene node is only attached to one scene node at the same time
 		mAttachedSceneNodes.push_back(&sceneNode);
 		sceneNode.mParentSceneNode = this;
-		sceneNode.updateGlobalTransformRecursive();
-		mPreviousGlobalTransform = mGlobalTransform;	// Teleport since we don't have a decent incremental previous global transform
+		sceneNode.markGlobalTransformDirty(true);	// Teleport since we don't have a decent incremental previous global transform
+		mSceneResource.mTransformHierarchyDirty = true;
 	}
 
 	void SceneNode::detachAllSceneNodes()
@@ -61,10 +61,13 @@ namespace RERenderer
 		for (SceneNode* sceneNode : mAttachedSceneNodes)
 		{
 			sceneNode->mParentSceneNode = nullptr;
-			sceneNode->updateGlobalTransformRecursive();
-			mPreviousGlobalTransform = mGlobalTransform;	// Teleport since we don't have a decent incremental previous global transform
+			sceneNode->markGlobalTransformDirty(true);	// Teleport since we don't have a decent incremental previous global transform
+		}
+		if (!mAttachedSceneNodes.empty())
+		{
+			mAttachedSceneNodes.clear();
+			mSceneResource.mTransformHierarchyDirty = true;
 		}
-		mAttachedSceneNodes.clear();
 	}
 
 	void SceneNode::setVisible(bool visible)
@@ -105,12 +108,22 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	void SceneNode::updateGlobalTransformRecursive()
+	void SceneNode::markGlobalTransformDirty(bool teleport)
+	{
+		mGlobalTransformDirty = true;
+		if (teleport)
+		{
+			mTeleportGlobalTransform = true;
+		}
+		mSceneResource.mGlobalTransformsDirty = true;
+	}
+
+	void SceneNode::updateGlobalTransform(bool teleport)
 	{
 		// Backup the previous global transform
 		mPreviousGlobalTransform = mGlobalTransform;
 
-		// Update this node
+		// Update this node, the depth sorted propagation ensures that the parent global transform is already up-to-date
 		if (nullptr != mParentSceneNode)
 		{
 			mGlobalTransform = mParentSceneNode->mGlobalTransform;
@@ -120,25 +133,21 @@ namespace RERenderer
 		{
 			mGlobalTransform = mTransform;
 		}
+		if (teleport)
+		{
+			mPreviousGlobalTransform = mGlobalTransform;
+		}
 
 		// Update scene items
 		for (ISceneItem* sceneItem : mAttachedSceneItems)
 		{
 			updateSceneItemTransform(*sceneItem);
 		}
-
-		// Update attached scene nodes
-		for (SceneNode* sceneNode : mAttachedSceneNodes)
-		{
-			sceneNode->mGlobalTransform = mGlobalTransform;
-			sceneNode->mGlobalTransform += sceneNode->mTransform;
-			sceneNode->updateGlobalTransformRecursive();
-		}
 	}
 
 	void SceneNode::updateSceneItemTransform(ISceneItem& sceneItem)
 	{
-		// TODO(naetherm) The following is just for culling kickoff and won't stay this way
+		// Write straight into the scene item set culling arrays, called concurrently for different scene items during the global transform propagation
 		SceneItemSet* sceneItemSet = sceneItem.mSceneItemSet;
 		if (nullptr != sceneItemSet)
 		{
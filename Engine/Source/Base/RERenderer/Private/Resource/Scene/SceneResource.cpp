@@ -28,9 +28,34 @@
 #include "RERenderer/Resource/Scene/Factory/ISceneFactory.h"
 #include "RERenderer/Resource/Scene/Culling/SceneCullingManager.h"
 #include "RERenderer/IRenderer.h"
+#include <RECore/Threading/ThreadPool.h>
 #include <algorithm>
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t  SCENE_NODES_SPLIT_COUNT = 512;	///< Number of scene nodes of a depth level a thread should process at least, not worth the additional threading effort below
+		static constexpr RECore::uint8 DIRTY_FLAG	   = 1 << 0;	///< The global transform needs to be updated
+		static constexpr RECore::uint8 TELEPORT_FLAG   = 1 << 1;	///< The previous global transform needs to be set to the new global transform
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -62,8 +87,9 @@ namespace RERenderer
 
 	SceneNode* SceneResource::createSceneNode(const RECore::Transform& transform)
 	{
-		SceneNode* sceneNode = new SceneNode(transform);
+		SceneNode* sceneNode = new SceneNode(*this, transform);
 		mSceneNodes.push_back(sceneNode);
+		mTransformHierarchyDirty = true;
 		return sceneNode;
 	}
 
@@ -72,8 +98,16 @@ namespace RERenderer
 		SceneNodes::iterator iterator = std::find(mSceneNodes.begin(), mSceneNodes.end(), &sceneNode);
 		if (iterator != mSceneNodes.end())
 		{
+			// Detach the scene node from its parent scene node, the attached scene nodes are detached by the scene node destructor
+			SceneNode* parentSceneNode = sceneNode.mParentSceneNode;
+			if (nullptr != parentSceneNode)
+			{
+				SceneNode::AttachedSceneNodes& attachedSceneNodes = parentSceneNode->mAttachedSceneNodes;
+				attachedSceneNodes.erase(std::find(attachedSceneNodes.begin(), attachedSceneNodes.end(), &sceneNode));
+			}
 			mSceneNodes.erase(iterator);
 			delete &sceneNode;
+			mTransformHierarchyDirty = true;
 		}
 		else
 		{
@@ -83,12 +117,69 @@ namespace RERenderer
 
 	void SceneResource::destroyAllSceneNodes()
 	{
+		// Break up the hierarchy first so that no scene node destructor touches an already destroyed scene node
 		const size_t numberOfSceneNodes = mSceneNodes.size();
 		for (size_t i = 0; i < numberOfSceneNodes; ++i)
+		{
+			mSceneNodes[i]->mParentSceneNode = nullptr;
+			mSceneNodes[i]->mAttachedSceneNodes.clear();
+		}
+		for (size_t i = 0; i < numberOfSceneNodes; ++i)
 		{
 			delete mSceneNodes[i];
 		}
 		mSceneNodes.clear();
+		mSortedSceneNodes.clear();
+		mSortedParentIndices.clear();
+		mSortedDirtyFlags.clear();
+		mDepthLevelOffsets.clear();
+		mTransformHierarchyDirty = false;
+		mGlobalTransformsDirty = false;
+	}
+
+	void SceneResource::updateGlobalTransforms()
+	{
+		if (!mGlobalTransformsDirty)
+		{
+			// Nothing to do in here
+			return;
+		}
+		if (mTransformHierarchyDirty)
+		{
+			rebuildTransformHierarchy();
+		}
+
+		// Process depth level by depth level, the scene nodes of one depth level only depend on scene nodes of previous depth levels
+		DefaultThreadPool& defaultThreadPool = getRenderer().getDefaultThreadPool();
+		const size_t numberOfDepthLevels = mDepthLevelOffsets.size() - 1;
+		for (size_t depthLevel = 0; depthLevel < numberOfDepthLevels; ++depthLevel)
+		{
+			const size_t depthLevelStartIndex = mDepthLevelOffsets[depthLevel];
+			size_t itemCount = mDepthLevelOffsets[depthLevel + 1] - depthLevelStartIndex;
+			size_t splitCount = ::detail::SCENE_NODES_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
+			if (1 == threadCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				updateGlobalTransformsRange(depthLevelStartIndex, depthLevelStartIndex + itemCount);
+			}
+			else
+			{
+				// Multi-threaded
+				size_t threadSceneNodeIndexOffset = depthLevelStartIndex;
+				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				{
+					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
+					defaultThreadPool.queueTask(std::bind(&SceneResource::updateGlobalTransformsRange, this, threadSceneNodeIndexOffset, threadSceneNodeIndexOffset + numberOfItemsToProcess));
+					itemCount -= splitCount;
+					threadSceneNodeIndexOffset += splitCount;
+				}
+
+				// Wait that all worker threads have done their part of the calculation
+				defaultThreadPool.process();
+			}
+		}
+		mGlobalTransformsDirty = false;
 	}
 
 	ISceneItem* SceneResource::createSceneItem(SceneItemTypeId sceneItemTypeId, SceneNode& sceneNode)
@@ -154,6 +245,80 @@ namespace RERenderer
 		IResource::initializeElement(sceneResourceId);
 	}
 
+	void SceneResource::rebuildTransformHierarchy()
+	{
+		mSortedSceneNodes.clear();
+		mSortedParentIndices.clear();
+		mDepthLevelOffsets.clear();
+
+		// Root scene nodes form the first depth level
+		for (SceneNode* sceneNode : mSceneNodes)
+		{
+			if (nullptr == sceneNode->mParentSceneNode)
+			{
+				mSortedSceneNodes.push_back(sceneNode);
+				mSortedParentIndices.push_back(RECore::getInvalid<RECore::uint32>());
+			}
+		}
+
+		// Breadth-first traversal, each iteration appends the next depth level
+		size_t depthLevelStartIndex = 0;
+		while (depthLevelStartIndex < mSortedSceneNodes.size())
+		{
+			const size_t depthLevelEndIndex = mSortedSceneNodes.size();
+			mDepthLevelOffsets.push_back(static_cast<RECore::uint32>(depthLevelStartIndex));
+			for (size_t i = depthLevelStartIndex; i < depthLevelEndIndex; ++i)
+			{
+				for (SceneNode* attachedSceneNode : mSortedSceneNodes[i]->mAttachedSceneNodes)
+				{
+					mSortedSceneNodes.push_back(attachedSceneNode);
+					mSortedParentIndices.push_back(static_cast<RECore::uint32>(i));
+				}
+			}
+			depthLevelStartIndex = depthLevelEndIndex;
+		}
+		mDepthLevelOffsets.push_back(static_cast<RECore::uint32>(mSortedSceneNodes.size()));
+		mSortedDirtyFlags.resize(mSortedSceneNodes.size());
+		mTransformHierarchyDirty = false;
+	}
+
+	void SceneResource::updateGlobalTransformsRange(size_t startIndex, size_t endIndex)
+	{
+		SceneNode** sortedSceneNodes = mSortedSceneNodes.data();
+		const RECore::uint32* sortedParentIndices = mSortedParentIndices.data();
+		RECore::uint8* sortedDirtyFlags = mSortedDirtyFlags.data();
+		for (size_t i = startIndex; i < endIndex; ++i)
+		{
+			// A scene node is dirty if it was changed itself or if its parent scene node was dirty, the parent dirty flags were written by the previous depth level
+			SceneNode& sceneNode = *sortedSceneNodes[i];
+			RECore::uint8 dirtyFlags = static_cast<RECore::uint8>((sceneNode.mGlobalTransformDirty ? ::detail::DIRTY_FLAG : 0) | (sceneNode.mTeleportGlobalTransform ? ::detail::TELEPORT_FLAG : 0));
+			const RECore::uint32 parentIndex = sortedParentIndices[i];
+			if (RECore::isValid(parentIndex))
+			{
+				dirtyFlags |= sortedDirtyFlags[parentIndex];
+			}
+			sortedDirtyFlags[i] = dirtyFlags;
+			if (0 != (dirtyFlags & ::detail::DIRTY_FLAG))
+			{
+				sceneNode.updateGlobalTransform(0 != (dirtyFlags & ::detail::TELEPORT_FLAG));
+				sceneNode.mGlobalTransformDirty = false;
+				sceneNode.mTeleportGlobalTransform = false;
+			}
+		}
+	}
+
+	void SceneResource::updateSceneItems(float pastSecondsSinceLastFrame)
+	{
+		// Scene items are updated sequentially, scene items with expensive updates are responsible for distributing their work over the default thread pool themselves
+		for (ISceneItem* sceneItem : mSceneItems)
+		{
+			if (sceneItem->getCallUpdate())
+			{
+				sceneItem->onUpdate(pastSecondsSinceLastFrame);
+			}
+		}
+	}
+
 	void SceneResource::deinitializeElement()
 	{
 		// Reset everything
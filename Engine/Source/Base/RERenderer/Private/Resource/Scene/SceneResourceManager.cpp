@@ -27,6 +27,7 @@
 #include "RERenderer/Resource/Scene/Loader/SceneResourceLoader.h"
 #include <RECore/Resource/ResourceManagerTemplate.h>
 #include "RERenderer/IRenderer.h"
+#include <RECore/Time/TimeManager.h>
 
 
 //[-------------------------------------------------------]
@@ -140,6 +141,20 @@ RECore::IResource* SceneResourceManager::tryGetResourceByResourceId(RECore::Reso
 	}
 
 
+	void SceneResourceManager::update()
+	{
+		// Propagate deferred scene node transform changes once per frame, followed by the scene item updates which might depend on the global transforms
+		const float pastSecondsSinceLastFrame = mRenderer.getTimeManager().getPastSecondsSinceLastFrame();
+		const RECore::uint32 numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (RECore::uint32 i = 0; i < numberOfElements; ++i)
+		{
+			SceneResource& sceneResource = mInternalResourceManager->getResources().getElementByIndex(i);
+			sceneResource.updateGlobalTransforms();
+			sceneResource.updateSceneItems(pastSecondsSinceLastFrame);
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private virtual RECore::IResourceManager methods    ]
 	//[-------------------------------------------------------]
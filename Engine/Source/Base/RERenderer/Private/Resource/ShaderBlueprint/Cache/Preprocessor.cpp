@@ -22,26 +22,1045 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
-#define MOJOSHADER_NO_VERSION_INCLUDE
-#include "RERenderer/IRenderer.h"
-#include "RERenderer/Context.h"
 #include <RECore/Log/Log.h>
 
-#include <src/mojoshader.h>
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <deque>
+	#include <vector>
+	#include <algorithm>
+	#include <string_view>
+	#include <unordered_map>
+PRAGMA_WARNING_POP
 
-#include <cstring>	// For "strlen()"
 
-std::size_t replace_all(std::string& inout, std::string_view what, std::string_view with)
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
 {
-    std::size_t count{};
-    for (std::string::size_type pos{};
-         inout.npos != (pos = inout.find(what.data(), pos, what.length()));
-         pos += with.length(), ++count) {
-        inout.replace(pos, what.length(), with.data(), with.length());
-    }
-    return count;
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t MAXIMUM_MACRO_EXPANSION_DEPTH = 64;	///< Guard against endless recursive macro expansions
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isIdentifierStart(char character)
+		{
+			return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || '_' == character;
+		}
+
+		[[nodiscard]] inline bool isDigit(char character)
+		{
+			return (character >= '0' && character <= '9');
+		}
+
+		[[nodiscard]] inline bool isIdentifierCharacter(char character)
+		{
+			return isIdentifierStart(character) || isDigit(character);
+		}
+
+		[[nodiscard]] inline bool isWhitespace(char character)
+		{
+			return (' ' == character || '\t' == character || '\r' == character || '\f' == character || '\v' == character);
+		}
+
+		[[nodiscard]] inline size_t skipWhitespace(std::string_view text, size_t position)
+		{
+			while (position < text.size() && isWhitespace(text[position]))
+			{
+				++position;
+			}
+			return position;
+		}
+
+		[[nodiscard]] inline std::string_view trim(std::string_view text)
+		{
+			const size_t start = skipWhitespace(text, 0);
+			size_t end = text.size();
+			while (end > start && isWhitespace(text[end - 1]))
+			{
+				--end;
+			}
+			return text.substr(start, end - start);
+		}
+
+		[[nodiscard]] inline size_t findIdentifierEnd(std::string_view text, size_t position)
+		{
+			while (position < text.size() && isIdentifierCharacter(text[position]))
+			{
+				++position;
+			}
+			return position;
+		}
+
+		[[nodiscard]] size_t findNumberEnd(std::string_view text, size_t position)
+		{
+			// Preprocessing number: Copied as a whole so e.g. the "f" in "1.0f" or the "e" in "1e-5" isn't mistaken for an identifier
+			++position;
+			while (position < text.size())
+			{
+				const char character = text[position];
+				if (isIdentifierCharacter(character) || '.' == character)
+				{
+					++position;
+				}
+				else if (('+' == character || '-' == character) && ('e' == text[position - 1] || 'E' == text[position - 1]))
+				{
+					++position;
+				}
+				else
+				{
+					break;
+				}
+			}
+			return position;
+		}
+
+		[[nodiscard]] size_t findStringLiteralEnd(std::string_view text, size_t position)
+		{
+			const char quote = text[position];
+			++position;
+			while (position < text.size() && quote != text[position])
+			{
+				position += ('\\' == text[position]) ? 2 : 1;
+			}
+			return std::min(position + 1, text.size());
+		}
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Integer expression evaluation of "#if" and "#elif", the macros must already have been expanded
+		*
+		*  @note
+		*    - Remaining identifiers are evaluated as 0, just like a C-preprocessor does
+		*/
+		class ExpressionEvaluator final
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline explicit ExpressionEvaluator(std::string_view expression) :
+				mExpression(expression),
+				mPosition(0),
+				mError(false)
+			{
+				// Nothing here
+			}
+
+			[[nodiscard]] bool evaluate(RECore::int64& value)
+			{
+				value = parseConditional();
+				mPosition = skipWhitespace(mExpression, mPosition);
+				return (!mError && mPosition == mExpression.size());
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private definitions                                   ]
+		//[-------------------------------------------------------]
+		private:
+			static constexpr int NUMBER_OF_BINARY_PRECEDENCE_LEVELS = 10;
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			[[nodiscard]] bool consume(char character)
+			{
+				mPosition = skipWhitespace(mExpression, mPosition);
+				if (mPosition < mExpression.size() && mExpression[mPosition] == character)
+				{
+					++mPosition;
+					return true;
+				}
+				return false;
+			}
+
+			[[nodiscard]] std::string_view peekBinaryOperator()
+			{
+				mPosition = skipWhitespace(mExpression, mPosition);
+				if (mPosition + 1 < mExpression.size())
+				{
+					const std::string_view twoCharacters = mExpression.substr(mPosition, 2);
+					if ("||" == twoCharacters || "&&" == twoCharacters || "==" == twoCharacters || "!=" == twoCharacters || "<=" == twoCharacters || ">=" == twoCharacters || "<<" == twoCharacters || ">>" == twoCharacters)
+					{
+						return twoCharacters;
+					}
+				}
+				if (mPosition < mExpression.size())
+				{
+					switch (mExpression[mPosition])
+					{
+						case '|':
+						case '^':
+						case '&':
+						case '<':
+						case '>':
+						case '+':
+						case '-':
+						case '*':
+						case '/':
+						case '%':
+							return mExpression.substr(mPosition, 1);
+					}
+				}
+				return std::string_view();
+			}
+
+			[[nodiscard]] static int getBinaryOperatorPrecedenceLevel(std::string_view binaryOperator)
+			{
+				if ("||" == binaryOperator) return 0;
+				if ("&&" == binaryOperator) return 1;
+				if ("|" == binaryOperator) return 2;
+				if ("^" == binaryOperator) return 3;
+				if ("&" == binaryOperator) return 4;
+				if ("==" == binaryOperator || "!=" == binaryOperator) return 5;
+				if ("<" == binaryOperator || ">" == binaryOperator || "<=" == binaryOperator || ">=" == binaryOperator) return 6;
+				if ("<<" == binaryOperator || ">>" == binaryOperator) return 7;
+				if ("+" == binaryOperator || "-" == binaryOperator) return 8;
+				if ("*" == binaryOperator || "/" == binaryOperator || "%" == binaryOperator) return 9;
+				return -1;
+			}
+
+			[[nodiscard]] RECore::int64 applyBinaryOperator(std::string_view binaryOperator, RECore::int64 left, RECore::int64 right)
+			{
+				switch (binaryOperator[0])
+				{
+					case '|':
+						return (binaryOperator.size() > 1) ? (left || right) : (left | right);
+
+					case '&':
+						return (binaryOperator.size() > 1) ? (left && right) : (left & right);
+
+					case '^':
+						return left ^ right;
+
+					case '=':
+						return left == right;
+
+					case '!':
+						return left != right;
+
+					case '<':
+						return ("<<" == binaryOperator) ? (left << right) : (("<=" == binaryOperator) ? (left <= right) : (left < right));
+
+					case '>':
+						return (">>" == binaryOperator) ? (left >> right) : ((">=" == binaryOperator) ? (left >= right) : (left > right));
+
+					case '+':
+						return left + right;
+
+					case '-':
+						return left - right;
+
+					case '*':
+						return left * right;
+
+					case '/':
+					case '%':
+						if (0 == right)
+						{
+							mError = true;
+							return 0;
+						}
+						return ('/' == binaryOperator[0]) ? (left / right) : (left % right);
+				}
+				mError = true;
+				return 0;
+			}
+
+			[[nodiscard]] RECore::int64 parseConditional()
+			{
+				const RECore::int64 condition = parseBinary(0);
+				if (consume('?'))
+				{
+					const RECore::int64 trueValue = parseConditional();
+					if (!consume(':'))
+					{
+						mError = true;
+						return 0;
+					}
+					const RECore::int64 falseValue = parseConditional();
+					return condition ? trueValue : falseValue;
+				}
+				return condition;
+			}
+
+			[[nodiscard]] RECore::int64 parseBinary(int precedenceLevel)
+			{
+				if (NUMBER_OF_BINARY_PRECEDENCE_LEVELS == precedenceLevel)
+				{
+					return parseUnary();
+				}
+				RECore::int64 value = parseBinary(precedenceLevel + 1);
+				while (!mError)
+				{
+					const std::string_view binaryOperator = peekBinaryOperator();
+					if (binaryOperator.empty() || getBinaryOperatorPrecedenceLevel(binaryOperator) != precedenceLevel)
+					{
+						break;
+					}
+					mPosition += binaryOperator.size();
+					value = applyBinaryOperator(binaryOperator, value, parseBinary(precedenceLevel + 1));
+				}
+				return value;
+			}
+
+			[[nodiscard]] RECore::int64 parseUnary()
+			{
+				mPosition = skipWhitespace(mExpression, mPosition);
+				if (mPosition >= mExpression.size())
+				{
+					mError = true;
+					return 0;
+				}
+				const char character = mExpression[mPosition];
+				switch (character)
+				{
+					case '(':
+					{
+						++mPosition;
+						const RECore::int64 value = parseConditional();
+						if (!consume(')'))
+						{
+							mError = true;
+						}
+						return value;
+					}
+
+					case '!':
+						++mPosition;
+						return !parseUnary();
+
+					case '~':
+						++mPosition;
+						return ~parseUnary();
+
+					case '-':
+						++mPosition;
+						return -parseUnary();
+
+					case '+':
+						++mPosition;
+						return parseUnary();
+				}
+				if (isDigit(character))
+				{
+					// Decimal, hexadecimal or octal integer literal, suffixes are ignored
+					const size_t end = findNumberEnd(mExpression, mPosition);
+					RECore::int64 value = 0;
+					int base = 10;
+					size_t position = mPosition;
+					if ('0' == character && position + 1 < end && ('x' == mExpression[position + 1] || 'X' == mExpression[position + 1]))
+					{
+						base = 16;
+						position += 2;
+					}
+					else if ('0' == character)
+					{
+						base = 8;
+					}
+					for (; position < end; ++position)
+					{
+						const char digitCharacter = mExpression[position];
+						int digit = 0;
+						if (isDigit(digitCharacter))
+						{
+							digit = digitCharacter - '0';
+						}
+						else if (16 == base && digitCharacter >= 'a' && digitCharacter <= 'f')
+						{
+							digit = digitCharacter - 'a' + 10;
+						}
+						else if (16 == base && digitCharacter >= 'A' && digitCharacter <= 'F')
+						{
+							digit = digitCharacter - 'A' + 10;
+						}
+						else if ('u' == digitCharacter || 'U' == digitCharacter || 'l' == digitCharacter || 'L' == digitCharacter)
+						{
+							continue;
+						}
+						else
+						{
+							mError = true;
+							break;
+						}
+						if (digit >= base)
+						{
+							mError = true;
+							break;
+						}
+						value = value * base + digit;
+					}
+					mPosition = end;
+					return value;
+				}
+				if (isIdentifierStart(character))
+				{
+					mPosition = findIdentifierEnd(mExpression, mPosition);
+					return 0;
+				}
+				mError = true;
+				return 0;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			std::string_view mExpression;
+			size_t			 mPosition;
+			bool			 mError;
+
+
+		};
+
+		/**
+		*  @brief
+		*    Single pass shader preprocessor
+		*
+		*  @remarks
+		*    The source is processed line by line. Logical lines, macro names, macro parameters and macro bodies are views into the source,
+		*    only lines containing block comments or line continuations are copied into an internal storage. Supported are
+		*    "#define" (object and function like macros including "#" and "##"), "#undef", "#if", "#ifdef", "#ifndef", "#elif", "#else",
+		*    "#endif" and "#error". "#version", "#extension", "#pragma" and "#line" are passed through. Comments are removed, the number
+		*    of lines is preserved so shader compiler error line numbers still match the build shader source code.
+		*
+		*  @note
+		*    - A function like macro invocation must not span multiple lines
+		*    - "#include" isn't supported, the shader builder resolves shader pieces before preprocessing
+		*/
+		class ShaderPreprocessor final
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline explicit ShaderPreprocessor(std::string& result) :
+				mResult(result),
+				mLineNumber(0),
+				mError(false)
+			{
+				// Nothing here
+			}
+
+			[[nodiscard]] bool process(std::string_view source)
+			{
+				mResult.clear();
+				mResult.reserve(source.size());
+				size_t position = 0;
+				while (position < source.size() && !mError)
+				{
+					// Gather the next logical line: Comments are replaced by a single space and line continuations are spliced
+					size_t segmentStart = position;
+					std::string* lineStorage = nullptr;
+					RECore::uint32 numberOfPhysicalLines = 1;
+					size_t lineContentEnd = 0;
+					bool lineComment = false;
+					while (position < source.size() && '\n' != source[position])
+					{
+						const char character = source[position];
+						if (lineComment)
+						{
+							++position;
+						}
+						else if ('"' == character)
+						{
+							position = findStringLiteralEnd(source, position);
+						}
+						else if ('/' == character && position + 1 < source.size() && '/' == source[position + 1])
+						{
+							// The rest of the physical line is a comment, no need to copy if it's a simple line
+							if (nullptr != lineStorage)
+							{
+								lineStorage->append(source.substr(segmentStart, position - segmentStart));
+							}
+							lineContentEnd = position;
+							lineComment = true;
+							position += 2;
+						}
+						else if ('/' == character && position + 1 < source.size() && '*' == source[position + 1])
+						{
+							lineStorage = appendSegment(lineStorage, source.substr(segmentStart, position - segmentStart));
+							*lineStorage += ' ';
+							const size_t commentEnd = source.find("*/", position + 2);
+							const size_t end = (std::string_view::npos == commentEnd) ? source.size() : commentEnd + 2;
+							numberOfPhysicalLines += static_cast<RECore::uint32>(std::count(source.begin() + static_cast<std::ptrdiff_t>(position), source.begin() + static_cast<std::ptrdiff_t>(end), '\n'));
+							position = segmentStart = end;
+						}
+						else if ('\\' == character && position + 1 < source.size() && ('\n' == source[position + 1] || ('\r' == source[position + 1] && position + 2 < source.size() && '\n' == source[position + 2])))
+						{
+							lineStorage = appendSegment(lineStorage, source.substr(segmentStart, position - segmentStart));
+							position += ('\r' == source[position + 1]) ? 3 : 2;
+							segmentStart = position;
+							++numberOfPhysicalLines;
+						}
+						else
+						{
+							++position;
+						}
+					}
+					if (!lineComment)
+					{
+						lineContentEnd = position;
+					}
+					std::string_view line;
+					if (nullptr != lineStorage)
+					{
+						if (!lineComment)
+						{
+							lineStorage->append(source.substr(segmentStart, lineContentEnd - segmentStart));
+						}
+						line = *lineStorage;
+					}
+					else
+					{
+						line = source.substr(segmentStart, lineContentEnd - segmentStart);
+					}
+					if (position < source.size())
+					{
+						// Skip the line feed
+						++position;
+					}
+
+					// Process the logical line, emit the same number of lines as consumed
+					mLineNumber += numberOfPhysicalLines;
+					processLine(line);
+					mResult.append(numberOfPhysicalLines, '\n');
+				}
+				if (!mError && !mConditionals.empty())
+				{
+					reportError("Missing #endif");
+				}
+				return !mError;
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private definitions                                   ]
+		//[-------------------------------------------------------]
+		private:
+			struct Macro final
+			{
+				std::string_view			  body;
+				std::vector<std::string_view> parameters;
+				bool						  functionLike = false;
+			};
+			typedef std::unordered_map<std::string_view, Macro> Macros;
+
+			struct Conditional final
+			{
+				bool active;		///< Are the lines of the current branch emitted?
+				bool parentActive;	///< Are the lines of the surrounding branch emitted?
+				bool branchTaken;	///< Has one of the branches already been taken?
+				bool elseSeen;
+			};
+			typedef std::vector<Conditional> Conditionals;
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			explicit ShaderPreprocessor(const ShaderPreprocessor&) = delete;
+			ShaderPreprocessor& operator=(const ShaderPreprocessor&) = delete;
+
+			std::string* appendSegment(std::string* lineStorage, std::string_view segment)
+			{
+				// The storage must be stable since macros keep views into it
+				if (nullptr == lineStorage)
+				{
+					lineStorage = &mLineStorages.emplace_back();
+				}
+				lineStorage->append(segment);
+				return lineStorage;
+			}
+
+			void reportError(const std::string& message)
+			{
+				RE_LOG(Critical, RECore::String("Renderer shader preprocessor: Error at line ") + RECore::to_string(static_cast<unsigned long>(mLineNumber)) + ": " + message.c_str())
+				mError = true;
+			}
+
+			[[nodiscard]] inline bool isActive() const
+			{
+				return (mConditionals.empty() || mConditionals.back().active);
+			}
+
+			void processLine(std::string_view line)
+			{
+				const size_t start = skipWhitespace(line, 0);
+				if (start < line.size() && '#' == line[start])
+				{
+					processDirective(line.substr(start));
+				}
+				else if (isActive())
+				{
+					expandText(line, mResult);
+				}
+			}
+
+			void processDirective(std::string_view line)
+			{
+				const size_t directiveStart = skipWhitespace(line, 1);
+				const size_t directiveEnd = findIdentifierEnd(line, directiveStart);
+				const std::string_view directive = line.substr(directiveStart, directiveEnd - directiveStart);
+				const std::string_view arguments = trim(line.substr(directiveEnd));
+
+				// Conditionals need to be tracked inside inactive branches as well
+				if ("if" == directive || "ifdef" == directive || "ifndef" == directive)
+				{
+					const bool parentActive = isActive();
+					bool condition = false;
+					if (parentActive)
+					{
+						condition = ("if" == directive) ? evaluateCondition(arguments) : ((mMacros.find(arguments.substr(0, findIdentifierEnd(arguments, 0))) != mMacros.cend()) == ("ifdef" == directive));
+					}
+					mConditionals.push_back({ parentActive && condition, parentActive, condition, false });
+				}
+				else if ("elif" == directive)
+				{
+					if (mConditionals.empty() || mConditionals.back().elseSeen)
+					{
+						reportError("#elif without matching #if");
+					}
+					else
+					{
+						Conditional& conditional = mConditionals.back();
+						conditional.active = (conditional.parentActive && !conditional.branchTaken && evaluateCondition(arguments));
+						conditional.branchTaken |= conditional.active;
+					}
+				}
+				else if ("else" == directive)
+				{
+					if (mConditionals.empty() || mConditionals.back().elseSeen)
+					{
+						reportError("#else without matching #if");
+					}
+					else
+					{
+						Conditional& conditional = mConditionals.back();
+						conditional.active = (conditional.parentActive && !conditional.branchTaken);
+						conditional.branchTaken = true;
+						conditional.elseSeen = true;
+					}
+				}
+				else if ("endif" == directive)
+				{
+					if (mConditionals.empty())
+					{
+						reportError("#endif without matching #if");
+					}
+					else
+					{
+						mConditionals.pop_back();
+					}
+				}
+				else if (!isActive() || directive.empty())
+				{
+					// Ignore directives inside inactive branches as well as null directives
+				}
+				else if ("define" == directive)
+				{
+					defineMacro(arguments);
+				}
+				else if ("undef" == directive)
+				{
+					mMacros.erase(arguments.substr(0, findIdentifierEnd(arguments, 0)));
+				}
+				else if ("version" == directive || "extension" == directive || "pragma" == directive || "line" == directive)
+				{
+					// Directives for the shader compiler
+					mResult.append(line);
+				}
+				else if ("error" == directive)
+				{
+					reportError("#error " + std::string(arguments));
+				}
+				else if ("include" == directive)
+				{
+					reportError("#include isn't supported, use shader pieces instead");
+				}
+				else
+				{
+					reportError("Unknown preprocessor directive #" + std::string(directive));
+				}
+			}
+
+			void defineMacro(std::string_view arguments)
+			{
+				const size_t nameEnd = findIdentifierEnd(arguments, 0);
+				if (0 == nameEnd || !isIdentifierStart(arguments[0]))
+				{
+					reportError("#define expects a macro name");
+					return;
+				}
+				const std::string_view name = arguments.substr(0, nameEnd);
+				Macro macro;
+				size_t position = nameEnd;
+
+				// It's only a function like macro if the opening parenthesis directly follows the macro name
+				if (position < arguments.size() && '(' == arguments[position])
+				{
+					macro.functionLike = true;
+					++position;
+					for (;;)
+					{
+						position = skipWhitespace(arguments, position);
+						if (position < arguments.size() && ')' == arguments[position] && macro.parameters.empty())
+						{
+							++position;
+							break;
+						}
+						const size_t parameterEnd = findIdentifierEnd(arguments, position);
+						if (parameterEnd == position || !isIdentifierStart(arguments[position]))
+						{
+							reportError("Invalid parameter list of macro " + std::string(name));
+							return;
+						}
+						macro.parameters.push_back(arguments.substr(position, parameterEnd - position));
+						position = skipWhitespace(arguments, parameterEnd);
+						if (position < arguments.size() && ',' == arguments[position])
+						{
+							++position;
+						}
+						else if (position < arguments.size() && ')' == arguments[position])
+						{
+							++position;
+							break;
+						}
+						else
+						{
+							reportError("Invalid parameter list of macro " + std::string(name));
+							return;
+						}
+					}
+				}
+				macro.body = trim(arguments.substr(position));
+				mMacros[name] = std::move(macro);
+			}
+
+			[[nodiscard]] bool evaluateCondition(std::string_view expression)
+			{
+				// Resolve "defined X" and "defined(X)" before the macro expansion
+				std::string resolvedExpression;
+				size_t position = 0;
+				while (position < expression.size())
+				{
+					if (isIdentifierStart(expression[position]))
+					{
+						const size_t identifierEnd = findIdentifierEnd(expression, position);
+						const std::string_view identifier = expression.substr(position, identifierEnd - position);
+						position = identifierEnd;
+						if ("defined" == identifier)
+						{
+							position = skipWhitespace(expression, position);
+							const bool parenthesis = (position < expression.size() && '(' == expression[position]);
+							if (parenthesis)
+							{
+								position = skipWhitespace(expression, position + 1);
+							}
+							const size_t macroNameEnd = findIdentifierEnd(expression, position);
+							const bool defined = (mMacros.find(expression.substr(position, macroNameEnd - position)) != mMacros.cend());
+							position = skipWhitespace(expression, macroNameEnd);
+							if (parenthesis)
+							{
+								if (position >= expression.size() || ')' != expression[position])
+								{
+									reportError("Missing closing parenthesis after defined");
+									return false;
+								}
+								++position;
+							}
+							resolvedExpression += defined ? " 1 " : " 0 ";
+						}
+						else
+						{
+							resolvedExpression.append(identifier);
+						}
+					}
+					else if (isDigit(expression[position]))
+					{
+						const size_t numberEnd = findNumberEnd(expression, position);
+						resolvedExpression.append(expression.substr(position, numberEnd - position));
+						position = numberEnd;
+					}
+					else
+					{
+						resolvedExpression += expression[position];
+						++position;
+					}
+				}
+
+				// Expand the macros and evaluate the integer expression
+				std::string expandedExpression;
+				expandText(resolvedExpression, expandedExpression);
+				RECore::int64 value = 0;
+				if (!mError && !ExpressionEvaluator(expandedExpression).evaluate(value))
+				{
+					reportError("Invalid preprocessor expression \"" + std::string(expression) + '"');
+				}
+				return (!mError && 0 != value);
+			}
+
+			[[nodiscard]] bool isExpanding(std::string_view macroName) const
+			{
+				return (std::find(mExpandingMacros.cbegin(), mExpandingMacros.cend(), macroName) != mExpandingMacros.cend());
+			}
+
+			void expandText(std::string_view text, std::string& output)
+			{
+				if (mExpandingMacros.size() >= MAXIMUM_MACRO_EXPANSION_DEPTH)
+				{
+					reportError("Maximum macro expansion depth exceeded");
+					return;
+				}
+				size_t position = 0;
+				while (position < text.size() && !mError)
+				{
+					const char character = text[position];
+					if (isIdentifierStart(character))
+					{
+						const size_t identifierEnd = findIdentifierEnd(text, position);
+						const std::string_view identifier = text.substr(position, identifierEnd - position);
+						position = identifierEnd;
+						const Macros::const_iterator iterator = mMacros.find(identifier);
+						if (mMacros.cend() == iterator || isExpanding(identifier))
+						{
+							output.append(identifier);
+						}
+						else if (!iterator->second.functionLike)
+						{
+							mExpandingMacros.push_back(identifier);
+							expandText(iterator->second.body, output);
+							mExpandingMacros.pop_back();
+						}
+						else
+						{
+							// Function like macros are only invoked if followed by an opening parenthesis
+							const size_t argumentsStart = skipWhitespace(text, position);
+							if (argumentsStart >= text.size() || '(' != text[argumentsStart])
+							{
+								output.append(identifier);
+								continue;
+							}
+							std::vector<std::string_view> arguments;
+							position = collectArguments(text, argumentsStart, arguments);
+							if (std::string_view::npos == position)
+							{
+								reportError("Unterminated invocation of macro " + std::string(identifier));
+								return;
+							}
+							const Macro& macro = iterator->second;
+							if (arguments.size() != macro.parameters.size() && !(macro.parameters.empty() && 1 == arguments.size() && trim(arguments[0]).empty()))
+							{
+								reportError("Wrong number of arguments for macro " + std::string(identifier));
+								return;
+							}
+							std::string substitutedBody;
+							substituteArguments(macro, arguments, substitutedBody);
+							mExpandingMacros.push_back(identifier);
+							expandText(substitutedBody, output);
+							mExpandingMacros.pop_back();
+						}
+					}
+					else if (isDigit(character) || ('.' == character && position + 1 < text.size() && isDigit(text[position + 1])))
+					{
+						const size_t numberEnd = findNumberEnd(text, position);
+						output.append(text.substr(position, numberEnd - position));
+						position = numberEnd;
+					}
+					else if ('"' == character)
+					{
+						const size_t literalEnd = findStringLiteralEnd(text, position);
+						output.append(text.substr(position, literalEnd - position));
+						position = literalEnd;
+					}
+					else
+					{
+						output += character;
+						++position;
+					}
+				}
+			}
+
+			[[nodiscard]] size_t collectArguments(std::string_view text, size_t position, std::vector<std::string_view>& arguments) const
+			{
+				// "position" points to the opening parenthesis, returns the position after the closing parenthesis or "std::string_view::npos"
+				RECore::uint32 nesting = 0;
+				size_t argumentStart = position + 1;
+				for (++position; position < text.size(); ++position)
+				{
+					const char character = text[position];
+					if ('(' == character)
+					{
+						++nesting;
+					}
+					else if (')' == character)
+					{
+						if (0 == nesting)
+						{
+							arguments.push_back(text.substr(argumentStart, position - argumentStart));
+							return position + 1;
+						}
+						--nesting;
+					}
+					else if (',' == character && 0 == nesting)
+					{
+						arguments.push_back(text.substr(argumentStart, position - argumentStart));
+						argumentStart = position + 1;
+					}
+					else if ('"' == character)
+					{
+						position = findStringLiteralEnd(text, position) - 1;
+					}
+				}
+				return std::string_view::npos;
+			}
+
+			void substituteArguments(const Macro& macro, const std::vector<std::string_view>& arguments, std::string& output)
+			{
+				const std::string_view body = macro.body;
+				const auto findParameter = [&macro](std::string_view identifier) -> size_t
+				{
+					const std::vector<std::string_view>::const_iterator iterator = std::find(macro.parameters.cbegin(), macro.parameters.cend(), identifier);
+					return (macro.parameters.cend() == iterator) ? std::string_view::npos : static_cast<size_t>(iterator - macro.parameters.cbegin());
+				};
+				size_t position = 0;
+				while (position < body.size() && !mError)
+				{
+					const char character = body[position];
+					if ('#' == character && position + 1 < body.size() && '#' == body[position + 1])
+					{
+						// Token pasting: Drop the whitespace around "##", a parameter operand is inserted unexpanded
+						while (!output.empty() && isWhitespace(output.back()))
+						{
+							output.pop_back();
+						}
+						position = skipWhitespace(body, position + 2);
+						const size_t identifierEnd = findIdentifierEnd(body, position);
+						if (identifierEnd > position)
+						{
+							const std::string_view identifier = body.substr(position, identifierEnd - position);
+							const size_t parameterIndex = findParameter(identifier);
+							output.append((std::string_view::npos == parameterIndex) ? identifier : trim(arguments[parameterIndex]));
+							position = identifierEnd;
+						}
+					}
+					else if ('#' == character)
+					{
+						// Stringizing
+						const size_t identifierStart = skipWhitespace(body, position + 1);
+						const size_t identifierEnd = findIdentifierEnd(body, identifierStart);
+						const size_t parameterIndex = findParameter(body.substr(identifierStart, identifierEnd - identifierStart));
+						if (identifierEnd > identifierStart && std::string_view::npos != parameterIndex)
+						{
+							output += '"';
+							for (char argumentCharacter : trim(arguments[parameterIndex]))
+							{
+								if ('"' == argumentCharacter || '\\' == argumentCharacter)
+								{
+									output += '\\';
+								}
+								output += argumentCharacter;
+							}
+							output += '"';
+							position = identifierEnd;
+						}
+						else
+						{
+							output += character;
+							++position;
+						}
+					}
+					else if (isIdentifierStart(character))
+					{
+						const size_t identifierEnd = findIdentifierEnd(body, position);
+						const std::string_view identifier = body.substr(position, identifierEnd - position);
+						const size_t parameterIndex = findParameter(identifier);
+						if (std::string_view::npos == parameterIndex)
+						{
+							output.append(identifier);
+						}
+						else
+						{
+							// Arguments are fully macro expanded before substitution, except when being an operand of "##"
+							const size_t next = skipWhitespace(body, identifierEnd);
+							if (next + 1 < body.size() && '#' == body[next] && '#' == body[next + 1])
+							{
+								output.append(trim(arguments[parameterIndex]));
+							}
+							else
+							{
+								expandText(trim(arguments[parameterIndex]), output);
+							}
+						}
+						position = identifierEnd;
+					}
+					else if (isDigit(character))
+					{
+						const size_t numberEnd = findNumberEnd(body, position);
+						output.append(body.substr(position, numberEnd - position));
+						position = numberEnd;
+					}
+					else
+					{
+						output += character;
+						++position;
+					}
+				}
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			std::string&				  mResult;
+			RECore::uint32				  mLineNumber;
+			bool						  mError;
+			Macros						  mMacros;
+			Conditionals				  mConditionals;
+			std::vector<std::string_view> mExpandingMacros;	///< Names of the macros currently being expanded, a macro isn't expanded recursively
+			std::deque<std::string>		  mLineStorages;	///< Logical lines which had to be copied due to comments or line continuations
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
 }
 
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -52,32 +1071,13 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
-	void Preprocessor::preprocess(const IRenderer& renderer, std::string& source, std::string& result)
+	void Preprocessor::preprocess(const IRenderer&, std::string& source, std::string& result)
 	{
-		// TODO(naetherm) The usage of MojoShader just as preprocessor is overkill. Find a simpler but still efficient solution. Switch to "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ ) ?
-
-		// Disable warnings in external headers, we can't fix them
-		PRAGMA_WARNING_PUSH
-			PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: 'MOJOSHADER_preprocess': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
-
-			// Preprocess
-			const MOJOSHADER_preprocessData* preprocessData = MOJOSHADER_preprocess(nullptr, source.c_str(), static_cast<unsigned int>(source.length()), 0, 0, 0, 0, 0, 0, 0);
-		PRAGMA_WARNING_POP
-
-		// Evaluate the result
-		if (preprocessData->error_count > 0)
-		{
-			for (int i = 0; i < preprocessData->error_count; ++i)
-			{
-        RE_LOG(Critical, RECore::String("Renderer shader preprocessor ") + (preprocessData->errors[i].filename ? preprocessData->errors[i].filename : "???") + ":" + RECore::String(preprocessData->errors[i].error_position)+": Error: " + preprocessData->errors[i].error)
-			}
-		}
-		else
+		if (!::detail::ShaderPreprocessor(result).process(source))
 		{
-			result.assign(preprocessData->output, static_cast<size_t>(preprocessData->output_len));
-			replace_all(result, "# version 430 core", "#version 430 core\n");
+			// Error, the shader builder interprets empty source code as error
+			result.clear();
 		}
-		MOJOSHADER_freePreprocessData(preprocessData);
 	}
 
 
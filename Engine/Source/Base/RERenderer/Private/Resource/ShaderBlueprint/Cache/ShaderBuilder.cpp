@@ -901,16 +901,63 @@ namespace RERenderer
 					buildShader.assetIds.push_back(shaderPieceResource->getAssetId());
 					combinedAssetFileHashes = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(&assetManager.getAssetByAssetId(shaderPieceResource->getAssetId()).fileHash), sizeof(RECore::uint64), combinedAssetFileHashes);
 
-					// Initialize
-					mInString = shaderPieceResource->getShaderSourceCode();
-					mOutString.clear();
-
-					// Process
-					parseMath(mInString, mOutString);
-					parseForEach(mOutString, mInString);
-					parseProperties(mInString, mOutString);
-					collectPieces(mOutString, mInString);
-					parseCounter(mInString, mOutString);
+					// The processed source code of included shader pieces is discarded, only the collected pieces and the modified
+					// shader properties are relevant, so the expansion result can be reused as long as the input is identical
+					const ShaderPieceResourceId shaderPieceResourceId = includeShaderPieceResourceIds[i];
+					const RECore::uint64 assetFileHash = assetManager.getAssetByAssetId(shaderPieceResource->getAssetId()).fileHash;
+					const ShaderProperties::SortedPropertyVector& sortedPropertyVector = mShaderProperties.getSortedPropertyVector();
+					RECore::uint64 expandedShaderPieceKey = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(&shaderPieceResourceId), sizeof(ShaderPieceResourceId), RECore::Math::FNV1a_INITIAL_HASH_64);
+					expandedShaderPieceKey = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(&assetFileHash), sizeof(RECore::uint64), expandedShaderPieceKey);
+					if (!sortedPropertyVector.empty())
+					{
+						expandedShaderPieceKey = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(sortedPropertyVector.data()), sizeof(ShaderProperties::Property) * sortedPropertyVector.size(), expandedShaderPieceKey);
+					}
+					ExpandedShaderPieces::iterator iterator = mExpandedShaderPieces.find(expandedShaderPieceKey);
+					if (mExpandedShaderPieces.end() != iterator && iterator->second.shaderPieceResourceId == shaderPieceResourceId && iterator->second.assetFileHash == assetFileHash && iterator->second.inputShaderProperties == sortedPropertyVector)
+					{
+						mShaderProperties.getSortedPropertyVector() = iterator->second.shaderProperties;
+					}
+					else
+					{
+						// Initialize, the shader piece is expanded in isolation so the result doesn't depend on previously included shader pieces
+						ShaderProperties::SortedPropertyVector inputShaderProperties = sortedPropertyVector;
+						DynamicShaderPieces dynamicShaderPieces;
+						std::swap(dynamicShaderPieces, mDynamicShaderPieces);
+						mInString = shaderPieceResource->getShaderSourceCode();
+						mOutString.clear();
+
+						// Process
+						parseMath(mInString, mOutString);
+						parseForEach(mOutString, mInString);
+						parseProperties(mInString, mOutString);
+						collectPieces(mOutString, mInString);
+						parseCounter(mInString, mOutString);
+
+						// Memoize, on a hash collision the entry is taken over by the latest input
+						std::swap(dynamicShaderPieces, mDynamicShaderPieces);
+						ExpandedShaderPiece expandedShaderPiece{shaderPieceResourceId, assetFileHash, std::move(inputShaderProperties), std::move(dynamicShaderPieces), mShaderProperties.getSortedPropertyVector()};
+						if (mExpandedShaderPieces.end() != iterator)
+						{
+							iterator->second = std::move(expandedShaderPiece);
+						}
+						else
+						{
+							if (mExpandedShaderPieces.size() >= MAXIMUM_NUMBER_OF_EXPANDED_SHADER_PIECES)
+							{
+								mExpandedShaderPieces.clear();
+							}
+							iterator = mExpandedShaderPieces.emplace(expandedShaderPieceKey, std::move(expandedShaderPiece)).first;
+						}
+					}
+
+					// Merge the collected pieces
+					for (const auto& pair : iterator->second.dynamicShaderPieces)
+					{
+						if (!mDynamicShaderPieces.emplace(pair).second)
+						{
+							RE_LOG(Critical, RECore::String("Renderer shader builder: @piece with ID ") + RECore::to_string(static_cast<unsigned long>(pair.first)) + " already defined")
+						}
+					}
 				}
 				else
 				{
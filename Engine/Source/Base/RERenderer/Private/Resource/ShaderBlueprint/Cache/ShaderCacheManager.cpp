@@ -58,11 +58,9 @@ namespace RERenderer
 			const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
 
 			// Does the shader cache already exist?
-			std::unique_lock<std::mutex> mutexLock(mMutex);
-			ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
-			if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+			shaderCache = tryGetShaderCacheById(shaderCacheId);
+			if (nullptr != shaderCache)
 			{
-				shaderCache = shaderCacheIdIterator->second;
 				if (nullptr != shaderCache->getMasterShaderCache())
 				{
 					shaderCache = shaderCache->getMasterShaderCache();
@@ -129,22 +127,12 @@ namespace RERenderer
 						// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 						// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 						const ShaderSourceCodeId shaderSourceCodeId = RECore::Math::calculateFNV1a32(reinterpret_cast<const RECore::uint8*>(sourceCode.c_str()), static_cast<RECore::uint32>(sourceCode.size()));
-						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-						if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend())
-						{
-							// Reuse already existing shader instance
-							// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-							shaderCache = new ShaderCache(shaderCacheId, mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-							mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-							mCacheNeedsSaving = true;
-						}
-						else
+						bool isNewMasterShaderCache = false;
+						shaderCache = registerShaderCache(shaderCacheId, shaderSourceCodeId, buildShader.assetIds, buildShader.combinedAssetFileHashes, isNewMasterShaderCache);
+						if (isNewMasterShaderCache)
 						{
 							// Create the RHI shader instance
 							RERHI::RHIShader* shader = nullptr;
-							shaderCache = new ShaderCache(shaderCacheId);
-							shaderCache->mAssetIds = buildShader.assetIds;
-							shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
 							switch (graphicsShaderType)
 							{
 								case GraphicsShaderType::Vertex:
@@ -171,19 +159,16 @@ namespace RERenderer
 									break;
 							}
 
-							// Create the new shader cache instance
+							// Finalize the new master shader cache instance
 							if (nullptr != shader)
 							{
 								ASSERT(!shaderLanguage.getRhi().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "Invalid shader bytecode received from RHI implementation")
 								shaderCache->mShaderPtr = shader;
-								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
-								mCacheNeedsSaving = true;
 							}
 							else
 							{
 								// TODO(naetherm) Error handling
-								delete shaderCache;
+								unregisterMasterShaderCache(shaderCacheId, shaderSourceCodeId);
 								shaderCache = nullptr;
 								ASSERT(false, "Invalid shader")
 							}
@@ -214,11 +199,9 @@ namespace RERenderer
 			const ShaderCacheId shaderCacheId = computePipelineStateSignature.getShaderCombinationId();
 
 			// Does the shader cache already exist?
-			std::unique_lock<std::mutex> mutexLock(mMutex);
-			ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = mShaderCacheByShaderCacheId.find(shaderCacheId);
-			if (shaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+			shaderCache = tryGetShaderCacheById(shaderCacheId);
+			if (nullptr != shaderCache)
 			{
-				shaderCache = shaderCacheIdIterator->second;
 				if (nullptr != shaderCache->getMasterShaderCache())
 				{
 					shaderCache = shaderCache->getMasterShaderCache();
@@ -258,36 +241,23 @@ namespace RERenderer
 						// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
 						// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
 						const ShaderSourceCodeId shaderSourceCodeId = RECore::Math::calculateFNV1a32(reinterpret_cast<const RECore::uint8*>(sourceCode.c_str()), static_cast<RECore::uint32>(sourceCode.size()));
-						ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-						if (shaderSourceCodeIdIterator != mShaderCacheByShaderSourceCodeId.cend())
-						{
-							// Reuse already existing shader instance
-							// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-							shaderCache = new ShaderCache(shaderCacheId, mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-							mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-							mCacheNeedsSaving = true;
-						}
-						else
+						bool isNewMasterShaderCache = false;
+						shaderCache = registerShaderCache(shaderCacheId, shaderSourceCodeId, buildShader.assetIds, buildShader.combinedAssetFileHashes, isNewMasterShaderCache);
+						if (isNewMasterShaderCache)
 						{
 							// Create the RHI shader instance
-							shaderCache = new ShaderCache(shaderCacheId);
-							shaderCache->mAssetIds = buildShader.assetIds;
-							shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
 							RERHI::RHIShader* shader = shaderLanguage.createComputeShaderFromSourceCode(sourceCode.c_str(), &shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME(shaderBlueprintAsset.virtualFilename));
 
-							// Create the new shader cache instance
+							// Finalize the new master shader cache instance
 							if (nullptr != shader)
 							{
 								ASSERT(!shaderLanguage.getRhi().getCapabilities().shaderBytecode || 0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "Invalid shader bytecode received from RHI implementation")
 								shaderCache->mShaderPtr = shader;
-								mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-								mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
-								mCacheNeedsSaving = true;
 							}
 							else
 							{
 								// TODO(naetherm) Error handling
-								delete shaderCache;
+								unregisterMasterShaderCache(shaderCacheId, shaderSourceCodeId);
 								shaderCache = nullptr;
 								ASSERT(false, "Invalid shader")
 							}
@@ -308,16 +278,19 @@ namespace RERenderer
 
 	void ShaderCacheManager::clearCache()
 	{
-		std::unique_lock<std::mutex> mutexLock(mMutex);
-		if (!mShaderCacheByShaderCacheId.empty() || !mShaderCacheByShaderSourceCodeId.empty())
+		for (Shard& shard : mShards)
 		{
-			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+			std::unique_lock<std::mutex> mutexLock(shard.mutex);
+			if (!shard.shaderCacheByShaderCacheId.empty() || !shard.shaderCacheByShaderSourceCodeId.empty())
 			{
-				delete shaderCacheElement.second;
+				for (auto& shaderCacheElement : shard.shaderCacheByShaderCacheId)
+				{
+					delete shaderCacheElement.second;
+				}
+				shard.shaderCacheByShaderCacheId.clear();
+				shard.shaderCacheByShaderSourceCodeId.clear();
+				mCacheNeedsSaving = true;
 			}
-			mShaderCacheByShaderCacheId.clear();
-			mShaderCacheByShaderSourceCodeId.clear();
-			mCacheNeedsSaving = true;
 		}
 	}
 
@@ -331,7 +304,10 @@ namespace RERenderer
 		{ // Load shader caches
 			RECore::uint32 numberOfShaderCaches = RECore::getInvalid<RECore::uint32>();
 			file.read(&numberOfShaderCaches, sizeof(RECore::uint32));
-			mShaderCacheByShaderCacheId.reserve(numberOfShaderCaches);
+			for (Shard& shard : mShards)
+			{
+				shard.shaderCacheByShaderCacheId.reserve(numberOfShaderCaches / NUMBER_OF_SHARDS);
+			}
 			std::vector<RECore::uint8> bytecode;
 			AssetIds assetIds;
 			for (RECore::uint32 i = 0; i < numberOfShaderCaches; ++i)
@@ -398,8 +374,9 @@ namespace RERenderer
 					if (outOfDateShaderCacheIds.find(masterShaderCacheId) == outOfDateShaderCacheIds.cend())
 					{
 						// Shader cache is still valid
-						ShaderCacheByShaderCacheId::const_iterator masterShaderCacheIdIterator = mShaderCacheByShaderCacheId.find(masterShaderCacheId);
-						if (masterShaderCacheIdIterator != mShaderCacheByShaderCacheId.cend())
+						const ShaderCacheByShaderCacheId& masterShaderCacheByShaderCacheId = getShardByShaderCacheId(masterShaderCacheId).shaderCacheByShaderCacheId;
+						ShaderCacheByShaderCacheId::const_iterator masterShaderCacheIdIterator = masterShaderCacheByShaderCacheId.find(masterShaderCacheId);
+						if (masterShaderCacheIdIterator != masterShaderCacheByShaderCacheId.cend())
 						{
 							// Create shader cache instance
 							shaderCache = new ShaderCache(shaderCacheId);
@@ -421,7 +398,7 @@ namespace RERenderer
 				// Register shader cache
 				if (nullptr != shaderCache)
 				{
-					mShaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
+					getShardByShaderCacheId(shaderCache->mShaderCacheId).shaderCacheByShaderCacheId.emplace(shaderCache->mShaderCacheId, shaderCache);
 				}
 			}
 		}
@@ -429,7 +406,10 @@ namespace RERenderer
 		{ // Load shader source code ID to shader cache ID mapping
 			RECore::uint32 numberOfElements = RECore::getInvalid<RECore::uint32>();
 			file.read(&numberOfElements, sizeof(RECore::uint32));
-			mShaderCacheByShaderSourceCodeId.reserve(numberOfElements);
+			for (Shard& shard : mShards)
+			{
+				shard.shaderCacheByShaderSourceCodeId.reserve(numberOfElements / NUMBER_OF_SHARDS);
+			}
 			for (RECore::uint32 i = 0; i < numberOfElements; ++i)
 			{
 				ShaderSourceCodeId shaderSourceCodeId = RECore::getInvalid<ShaderSourceCodeId>();
@@ -439,7 +419,7 @@ namespace RERenderer
 				if (outOfDateShaderCacheIds.find(shaderCacheId) == outOfDateShaderCacheIds.cend())
 				{
 					// Shader cache is still valid
-					mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+					getShardByShaderSourceCodeId(shaderSourceCodeId).shaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
 				}
 			}
 		}
@@ -452,38 +432,45 @@ namespace RERenderer
 	{
 		{ // Save shader caches
 		  // -> Shader caches with a master shader cache must come last to ensure the master is already loaded
-			const RECore::uint32 numberOfShaderCaches = static_cast<RECore::uint32>(mShaderCacheByShaderCacheId.size());
+			RECore::uint32 numberOfShaderCaches = 0;
+			for (const Shard& shard : mShards)
+			{
+				numberOfShaderCaches += static_cast<RECore::uint32>(shard.shaderCacheByShaderCacheId.size());
+			}
 			file.write(&numberOfShaderCaches, sizeof(RECore::uint32));
 			std::vector<const ShaderCache*> shaderCachesWithMaster;
-			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
+			for (const Shard& shard : mShards)
 			{
-				const ShaderCache* shaderCache = shaderCacheElement.second;
-				if (nullptr == shaderCache->getMasterShaderCache())
+				for (auto& shaderCacheElement : shard.shaderCacheByShaderCacheId)
 				{
-					// Master shader cache
-					const RERHI::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
-					const RECore::uint32 numberOfBytes = shaderBytecode.getNumberOfBytes();
-					ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-					file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
-					file.write(&numberOfBytes, sizeof(RECore::uint32));
-
-					// Write list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
-					const RECore::uint32 numberOfAssetIds = static_cast<RECore::uint32>(shaderCache->mAssetIds.size());
-					ASSERT(0 != numberOfAssetIds, "Invalid number of asset IDs")
-					file.write(&numberOfAssetIds, sizeof(RECore::uint32));
-					file.write(shaderCache->mAssetIds.data(), sizeof(RECore::uint32) * numberOfAssetIds);
-					file.write(&shaderCache->mCombinedAssetFileHashes, sizeof(RECore::uint64));
+					const ShaderCache* shaderCache = shaderCacheElement.second;
+					if (nullptr == shaderCache->getMasterShaderCache())
+					{
+						// Master shader cache
+						const RERHI::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
+						const RECore::uint32 numberOfBytes = shaderBytecode.getNumberOfBytes();
+						ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
+						file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
+						file.write(&numberOfBytes, sizeof(RECore::uint32));
+
+						// Write list of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
+						const RECore::uint32 numberOfAssetIds = static_cast<RECore::uint32>(shaderCache->mAssetIds.size());
+						ASSERT(0 != numberOfAssetIds, "Invalid number of asset IDs")
+						file.write(&numberOfAssetIds, sizeof(RECore::uint32));
+						file.write(shaderCache->mAssetIds.data(), sizeof(RECore::uint32) * numberOfAssetIds);
+						file.write(&shaderCache->mCombinedAssetFileHashes, sizeof(RECore::uint64));
 
-					// Write shader bytecode
-					if (0 != numberOfBytes)
+						// Write shader bytecode
+						if (0 != numberOfBytes)
+						{
+							file.write(shaderBytecode.getBytecode(), numberOfBytes);
+						}
+					}
+					else
 					{
-						file.write(shaderBytecode.getBytecode(), numberOfBytes);
+						shaderCachesWithMaster.push_back(shaderCache);
 					}
 				}
-				else
-				{
-					shaderCachesWithMaster.push_back(shaderCache);
-				}
 			}
 			for (const ShaderCache* shaderCache : shaderCachesWithMaster)
 			{
@@ -497,12 +484,19 @@ namespace RERenderer
 		}
 
 		{ // Save shader source code ID to shader cache ID mapping
-			const RECore::uint32 numberOfElements = static_cast<RECore::uint32>(mShaderCacheByShaderSourceCodeId.size());
+			RECore::uint32 numberOfElements = 0;
+			for (const Shard& shard : mShards)
+			{
+				numberOfElements += static_cast<RECore::uint32>(shard.shaderCacheByShaderSourceCodeId.size());
+			}
 			file.write(&numberOfElements, sizeof(RECore::uint32));
-			for (auto& element : mShaderCacheByShaderSourceCodeId)
+			for (const Shard& shard : mShards)
 			{
-				file.write(&element.first, sizeof(ShaderSourceCodeId));
-				file.write(&element.second, sizeof(ShaderCacheId));
+				for (auto& element : shard.shaderCacheByShaderSourceCodeId)
+				{
+					file.write(&element.first, sizeof(ShaderSourceCodeId));
+					file.write(&element.second, sizeof(ShaderCacheId));
+				}
 			}
 		}
 
@@ -511,6 +505,105 @@ namespace RERenderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	ShaderCache* ShaderCacheManager::tryGetShaderCacheById(ShaderCacheId shaderCacheId)
+	{
+		Shard& shard = getShardByShaderCacheId(shaderCacheId);
+		std::lock_guard<std::mutex> mutexLock(shard.mutex);
+		ShaderCacheByShaderCacheId::const_iterator iterator = shard.shaderCacheByShaderCacheId.find(shaderCacheId);
+		return (iterator != shard.shaderCacheByShaderCacheId.cend()) ? iterator->second : nullptr;
+	}
+
+	ShaderCache* ShaderCacheManager::registerShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId, const std::vector<RECore::StringId>& assetIds, RECore::uint64 combinedAssetFileHashes, bool& isNewMasterShaderCache)
+	{
+		isNewMasterShaderCache = false;
+
+		// The shader source code ID shard lock is held during the whole registration
+		// -> A shader cache ID always results in one and the same shader source code, so this lock serializes all threads interested in the same shader cache
+		// -> Shader cache ID shards are locked one after another while holding this lock, never two of them at once, so there can't be a deadlock
+		Shard& shaderSourceCodeIdShard = getShardByShaderSourceCodeId(shaderSourceCodeId);
+		std::unique_lock<std::mutex> shaderSourceCodeIdMutexLock(shaderSourceCodeIdShard.mutex);
+		const auto lockShard = [&shaderSourceCodeIdShard](Shard& shard)
+		{
+			// The mutex isn't recursive, don't lock the shader source code ID shard twice
+			return (&shard == &shaderSourceCodeIdShard) ? std::unique_lock<std::mutex>() : std::unique_lock<std::mutex>(shard.mutex);
+		};
+
+		{ // Another thread might have registered the shader cache meanwhile
+			Shard& shard = getShardByShaderCacheId(shaderCacheId);
+			const std::unique_lock<std::mutex> mutexLock = lockShard(shard);
+			ShaderCacheByShaderCacheId::const_iterator iterator = shard.shaderCacheByShaderCacheId.find(shaderCacheId);
+			if (iterator != shard.shaderCacheByShaderCacheId.cend())
+			{
+				return iterator->second;
+			}
+		}
+
+		// Is there already a master shader cache with the same shader source code?
+		ShaderCache* masterShaderCache = nullptr;
+		ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderSourceCodeIdShard.shaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
+		if (shaderSourceCodeIdIterator != shaderSourceCodeIdShard.shaderCacheByShaderSourceCodeId.cend())
+		{
+			const ShaderCacheId masterShaderCacheId = shaderSourceCodeIdIterator->second;
+			Shard& shard = getShardByShaderCacheId(masterShaderCacheId);
+			const std::unique_lock<std::mutex> mutexLock = lockShard(shard);
+			ShaderCacheByShaderCacheId::const_iterator iterator = shard.shaderCacheByShaderCacheId.find(masterShaderCacheId);
+			ASSERT(iterator != shard.shaderCacheByShaderCacheId.cend(), "Invalid master shader cache ID")
+			masterShaderCache = iterator->second;
+		}
+
+		// Create the new shader cache instance
+		ShaderCache* shaderCache = nullptr;
+		if (nullptr != masterShaderCache)
+		{
+			// Reuse already existing shader instance
+			// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+			shaderCache = new ShaderCache(shaderCacheId, masterShaderCache);
+		}
+		else
+		{
+			// New master shader cache, the caller is responsible for the shader compilation
+			shaderCache = new ShaderCache(shaderCacheId);
+			shaderCache->mAssetIds = assetIds;
+			shaderCache->mCombinedAssetFileHashes = combinedAssetFileHashes;
+			shaderSourceCodeIdShard.shaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+			isNewMasterShaderCache = true;
+		}
+		{ // Register the new shader cache instance
+			Shard& shard = getShardByShaderCacheId(shaderCacheId);
+			const std::unique_lock<std::mutex> mutexLock = lockShard(shard);
+			shard.shaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+		}
+		mCacheNeedsSaving = true;
+
+		// Done
+		return shaderCache;
+	}
+
+	void ShaderCacheManager::unregisterMasterShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId)
+	{
+		// Same lock order as inside "RERenderer::ShaderCacheManager::registerShaderCache()"
+		Shard& shaderSourceCodeIdShard = getShardByShaderSourceCodeId(shaderSourceCodeId);
+		std::unique_lock<std::mutex> shaderSourceCodeIdMutexLock(shaderSourceCodeIdShard.mutex);
+		shaderSourceCodeIdShard.shaderCacheByShaderSourceCodeId.erase(shaderSourceCodeId);
+		Shard& shard = getShardByShaderCacheId(shaderCacheId);
+		std::unique_lock<std::mutex> mutexLock;
+		if (&shard != &shaderSourceCodeIdShard)
+		{
+			mutexLock = std::unique_lock<std::mutex>(shard.mutex);
+		}
+		ShaderCacheByShaderCacheId::iterator iterator = shard.shaderCacheByShaderCacheId.find(shaderCacheId);
+		if (iterator != shard.shaderCacheByShaderCacheId.end())
+		{
+			ASSERT(nullptr == iterator->second->getMasterShaderCache(), "Only master shader caches can be unregistered")
+			delete iterator->second;
+			shard.shaderCacheByShaderCacheId.erase(iterator);
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -32,6 +32,54 @@ PRAGMA_WARNING_PUSH
 	#include <glm/gtx/dual_quaternion.hpp>
 PRAGMA_WARNING_POP
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4061)	// warning C4061: enumerator 'rtm::mix4::b' in switch of enum 'rtm::mix4' is not explicitly handled by a case label
+	#include <rtm/matrix4x4f.h>
+PRAGMA_WARNING_POP
+
+#include <atomic>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		std::atomic<RECore::uint32> NextSkeletonDataRevision = 1;	///< Zero is the revision of default constructed skeleton resources
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		// GLM matrices are column-major, each loaded column becomes a RTM axis so "glm: a * b" becomes "rtm: b * a"
+		[[nodiscard]] FORCEINLINE rtm::matrix4x4f RTM_SIMD_CALL loadMatrix(const glm::mat4& matrix)
+		{
+			return rtm::matrix_set(rtm::vector_load(&matrix[0][0]), rtm::vector_load(&matrix[1][0]), rtm::vector_load(&matrix[2][0]), rtm::vector_load(&matrix[3][0]));
+		}
+
+		FORCEINLINE void RTM_SIMD_CALL storeMatrix(rtm::matrix4x4f_arg0 input, glm::mat4& matrix)
+		{
+			rtm::vector_store(input.x_axis, &matrix[0][0]);
+			rtm::vector_store(input.y_axis, &matrix[1][0]);
+			rtm::vector_store(input.z_axis, &matrix[2][0]);
+			rtm::vector_store(input.w_axis, &matrix[3][0]);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -56,16 +104,25 @@ namespace RERenderer
 		return RECore::getInvalid<RECore::uint32>();
 	}
 
+	void SkeletonResource::updateSkeletonDataRevision()
+	{
+		// Skip the invalid value on wrap-around, so cache owners can use it as "not built yet" marker
+		mSkeletonDataRevision = ::detail::NextSkeletonDataRevision.fetch_add(1);
+		if (RECore::isInvalid(mSkeletonDataRevision))
+		{
+			mSkeletonDataRevision = ::detail::NextSkeletonDataRevision.fetch_add(1);
+		}
+	}
+
 	void SkeletonResource::localToGlobalPose()
 	{
 		// The root has no parent
 		mGlobalBoneMatrices[0] = mLocalBoneMatrices[0];
 
 		// Due to cache friendly depth-first rolled up bone hierarchy, the global parent bone pose is already up-to-date
-		// TODO(naetherm) Ensure that in the end SIMD intrinsics in GLM are used in here
 		for (RECore::uint8 i = 1; i < mNumberOfBones; ++i)
 		{
-			mGlobalBoneMatrices[i] = mGlobalBoneMatrices[mBoneParentIndices[i]] * mLocalBoneMatrices[i];
+			::detail::storeMatrix(rtm::matrix_mul(::detail::loadMatrix(mLocalBoneMatrices[i]), ::detail::loadMatrix(mGlobalBoneMatrices[mBoneParentIndices[i]])), mGlobalBoneMatrices[i]);
 		}
 
 		/*
@@ -80,9 +137,10 @@ namespace RERenderer
 
 		{ // The dual quaternion skinning (DQS) implementation is basing on https://gamedev.stackexchange.com/questions/164423/help-with-dual-quaternion-skinning
 			glm::dualquat* boneSpaceDualQuaternions = reinterpret_cast<glm::dualquat*>(mBoneSpaceData);
+			glm::mat4 boneSpaceMatrix;
 			for (RECore::uint8 i = 0; i < mNumberOfBones; ++i)
 			{
-				const glm::mat4 boneSpaceMatrix = mGlobalBoneMatrices[i] * mBoneOffsetMatrices[i];
+				::detail::storeMatrix(rtm::matrix_mul(::detail::loadMatrix(mBoneOffsetMatrices[i]), ::detail::loadMatrix(mGlobalBoneMatrices[i])), boneSpaceMatrix);
 				const glm::quat rotationQuaternion = glm::quat_cast(boneSpaceMatrix);
 				const glm::vec4& translation = boneSpaceMatrix[3];
 				glm::dualquat& boneSpaceDualQuaternion = boneSpaceDualQuaternions[i];
@@ -26,6 +26,7 @@
 #include "RERenderer/Resource/SkeletonAnimation/SkeletonAnimationResourceManager.h"
 #include "RERenderer/Resource/Skeleton/SkeletonResourceManager.h"
 #include "RERenderer/Resource/Skeleton/SkeletonResource.h"
+#include "RERenderer/RenderQueue/RenderableManager.h"
 #include "RERenderer/IRenderer.h"
 #include <algorithm>
 
@@ -95,6 +96,7 @@ namespace RERenderer
 
 		// Register skeleton animation controller
 		skeletonAnimationResourceManager.mSkeletonAnimationControllers.push_back(this);
+		skeletonAnimationResourceManager.mSkeletonAnimationControllersSorted = false;
 	}
 
 	void SkeletonAnimationController::destroySkeletonAnimationEvaluator()
@@ -111,27 +113,72 @@ namespace RERenderer
 			// Destroy skeleton animation evaluator
 			delete mSkeletonAnimationEvaluator;
 			mSkeletonAnimationEvaluator = nullptr;
+			mBoneIndices.clear();
+			RECore::setInvalid(mBoneIndicesSkeletonDataRevision);
+			mNumberOfSkippedFrames = 0;
 		}
 	}
 
-	void SkeletonAnimationController::update(float pastSecondsSinceLastFrame)
+	void SkeletonAnimationController::updateBoneIndices(const SkeletonResource& skeletonResource)
+	{
+		// Resolve the bone IDs of the skeleton animation evaluator channels once instead of searching the skeleton each frame
+		const SkeletonAnimationEvaluator::BoneIds& boneIds = mSkeletonAnimationEvaluator->getBoneIds();
+		const size_t numberOfBoneIds = boneIds.size();
+		mBoneIndices.resize(numberOfBoneIds);
+		for (size_t i = 0; i < numberOfBoneIds; ++i)
+		{
+			mBoneIndices[i] = skeletonResource.getBoneIndexByBoneId(boneIds[i]);
+		}
+
+		// A skeleton without bones isn't loaded yet, try again next time instead of caching unknown bones forever
+		// -> Hot-reloading or reusing the skeleton resource changes the skeleton data revision and hence invalidates the cache as well
+		if (skeletonResource.getNumberOfBones() > 0)
+		{
+			mBoneIndicesSkeletonDataRevision = skeletonResource.getSkeletonDataRevision();
+		}
+		else
+		{
+			RECore::setInvalid(mBoneIndicesSkeletonDataRevision);
+		}
+	}
+
+	void SkeletonAnimationController::update(float pastSecondsSinceLastFrame, float updateRateLodDistance, RECore::uint8 maximumNumberOfSkippedFrames)
 	{
 		// Sanity check
 		RHI_ASSERT(pastSecondsSinceLastFrame > 0.0f, "No negative time, please")
 		RHI_ASSERT(nullptr != mSkeletonAnimationEvaluator, "No useless update calls, please")
 
-		// Advance time and evaluate state
+		// Advance time, the time always advances even if the evaluation is skipped
 		mTimeInSeconds += pastSecondsSinceLastFrame;
+
+		// Update rate LOD: The further away from the camera, the more frames are skipped between two evaluations
+		// -> The cached distance to camera is updated during the culling phase, items which were never rendered have an invalid (= maximum) distance
+		if (updateRateLodDistance > 0.0f && nullptr != mRenderableManager)
+		{
+			const float numberOfFramesToSkip = mRenderableManager->getCachedDistanceToCamera() / updateRateLodDistance;
+			if (mNumberOfSkippedFrames < maximumNumberOfSkippedFrames && static_cast<float>(mNumberOfSkippedFrames + 1) <= numberOfFramesToSkip)
+			{
+				++mNumberOfSkippedFrames;
+				return;
+			}
+		}
+		mNumberOfSkippedFrames = 0;
+
+		// Evaluate state
 		mSkeletonAnimationEvaluator->evaluate(mTimeInSeconds);
 
 		{ // Tell the controlled skeleton resource about the new state
 			SkeletonResource& skeletonResource = mRenderer.getSkeletonResourceManager().getById(mSkeletonResourceId);
-			const SkeletonAnimationEvaluator::BoneIds& boneIds = mSkeletonAnimationEvaluator->getBoneIds();
 			const SkeletonAnimationEvaluator::TransformMatrices& transformMatrices = mSkeletonAnimationEvaluator->getTransformMatrices();
+			if (mBoneIndicesSkeletonDataRevision != skeletonResource.getSkeletonDataRevision())
+			{
+				updateBoneIndices(skeletonResource);
+			}
 			glm::mat4* localBoneMatrices = skeletonResource.getLocalBoneMatrices();
-			for (size_t i = 0; i < boneIds.size(); ++i)
+			const size_t numberOfBoneIndices = mBoneIndices.size();
+			for (size_t i = 0; i < numberOfBoneIndices; ++i)
 			{
-				const RECore::uint32 boneIndex = skeletonResource.getBoneIndexByBoneId(boneIds[i]);
+				const RECore::uint32 boneIndex = mBoneIndices[i];
 				if (RECore::isValid(boneIndex))
 				{
 					localBoneMatrices[boneIndex] = transformMatrices[i];
@@ -28,6 +28,37 @@
 #include <RECore/Resource/ResourceManagerTemplate.h>
 #include "RERenderer/IRenderer.h"
 #include <RECore/Time/TimeManager.h>
+#include <RECore/Threading/ThreadPool.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <algorithm>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr size_t SKELETON_ANIMATION_CONTROLLERS_SPLIT_COUNT = 32;	///< Number of skeleton animation controllers a thread should process at least, not worth the additional threading effort below
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -98,11 +129,49 @@ RECore::IResource* SkeletonAnimationResourceManager::tryGetResourceByResourceId(
 
 	void SkeletonAnimationResourceManager::update()
 	{
+		if (mSkeletonAnimationControllers.empty())
+		{
+			// Nothing to do in here
+			return;
+		}
+
+		// Controllers of one and the same skeleton resource write into the same local and global bone matrices, keep them
+		// adjacent so that each range processed by a thread covers all controllers of a skeleton resource
+		if (!mSkeletonAnimationControllersSorted)
+		{
+			std::stable_sort(mSkeletonAnimationControllers.begin(), mSkeletonAnimationControllers.end(), [](const SkeletonAnimationController* left, const SkeletonAnimationController* right) { return (left->getSkeletonResourceId() < right->getSkeletonResourceId()); });
+			mSkeletonAnimationControllersSorted = true;
+		}
+
 		// Update skeleton animation controllers
 		const float pastSecondsSinceLastFrame = mRenderer.getTimeManager().getPastSecondsSinceLastFrame();
-		for (SkeletonAnimationController* skeletonAnimationController : mSkeletonAnimationControllers)
+		const size_t numberOfSkeletonAnimationControllers = mSkeletonAnimationControllers.size();
+		DefaultThreadPool& defaultThreadPool = mRenderer.getDefaultThreadPool();
+		size_t splitCount = ::detail::SKELETON_ANIMATION_CONTROLLERS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
+		const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(numberOfSkeletonAnimationControllers, splitCount);
+		if (1 == threadCount)
 		{
-			skeletonAnimationController->update(pastSecondsSinceLastFrame);
+			// Just execute it directly inside the current thread, not worth the additional threading effort
+			updateSkeletonAnimationControllers(0, numberOfSkeletonAnimationControllers, pastSecondsSinceLastFrame);
+		}
+		else
+		{
+			// Multi-threaded
+			size_t startIndex = 0;
+			for (size_t threadIndex = 0; threadIndex < threadCount && startIndex < numberOfSkeletonAnimationControllers; ++threadIndex)
+			{
+				// The last thread has to do all the rest of the remaining work, never split the controllers of a skeleton resource
+				size_t endIndex = (threadIndex >= threadCount - 1) ? numberOfSkeletonAnimationControllers : std::min(startIndex + splitCount, numberOfSkeletonAnimationControllers);
+				while (endIndex < numberOfSkeletonAnimationControllers && mSkeletonAnimationControllers[endIndex]->getSkeletonResourceId() == mSkeletonAnimationControllers[endIndex - 1]->getSkeletonResourceId())
+				{
+					++endIndex;
+				}
+				defaultThreadPool.queueTask(std::bind(&SkeletonAnimationResourceManager::updateSkeletonAnimationControllers, this, startIndex, endIndex, pastSecondsSinceLastFrame));
+				startIndex = endIndex;
+			}
+
+			// Wait that all worker threads have done their part of the calculation
+			defaultThreadPool.process();
 		}
 	}
 
@@ -126,7 +195,10 @@ RECore::IResource* SkeletonAnimationResourceManager::tryGetResourceByResourceId(
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	SkeletonAnimationResourceManager::SkeletonAnimationResourceManager(IRenderer& renderer)
-  : mRenderer(renderer)
+  : mRenderer(renderer),
+		mSkeletonAnimationControllersSorted(true),
+		mUpdateRateLodDistance(0.0f),
+		mMaximumNumberOfSkippedFrames(3)
 	{
 		mInternalResourceManager = new RECore::ResourceManagerTemplate<SkeletonAnimationResource, SkeletonAnimationResourceLoader, SkeletonAnimationResourceId, 2048>(renderer.getAssetManager(), renderer.getResourceStreamer(), *this);
 	}
@@ -136,6 +208,14 @@ RECore::IResource* SkeletonAnimationResourceManager::tryGetResourceByResourceId(
 		delete mInternalResourceManager;
 	}
 
+	void SkeletonAnimationResourceManager::updateSkeletonAnimationControllers(size_t startIndex, size_t endIndex, float pastSecondsSinceLastFrame)
+	{
+		for (size_t i = startIndex; i < endIndex; ++i)
+		{
+			mSkeletonAnimationControllers[i]->update(pastSecondsSinceLastFrame, mUpdateRateLodDistance, mMaximumNumberOfSkippedFrames);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -240,6 +240,7 @@ namespace RERenderer
 			}
 			mNumberOfUsedImageDataBytes *= numberOfFaces * mNumberOfSlices;
 
+			mNumberOfTextureBytes = mNumberOfUsedImageDataBytes;
 			if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 			{
 				mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
@@ -228,6 +228,7 @@ namespace RERenderer
 			}
 			mNumberOfUsedImageDataBytes *= crnTextureInfo.m_faces;
 
+			mNumberOfTextureBytes = mNumberOfUsedImageDataBytes;
 			if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 			{
 				mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
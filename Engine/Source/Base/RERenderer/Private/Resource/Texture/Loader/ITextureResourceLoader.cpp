@@ -40,12 +40,14 @@ namespace RERenderer
 	{
 		IResourceLoader::initialize(asset, reload);
 		mTextureResource = static_cast<TextureResource*>(&resource);
+		mNumberOfTextureBytes = 0;
 	}
 
 	bool ITextureResourceLoader::onDispatch()
 	{
 		// Create the RHI texture instance
 		mTextureResource->mTexture = (mRenderer.getRhi().getCapabilities().nativeMultithreading ? mTexture : createRhiTexture());
+		mTextureResource->mNumberOfBytes = (nullptr != mTextureResource->mTexture) ? mNumberOfTextureBytes : 0;
 
 		// Fully loaded
 		return true;
@@ -325,6 +325,7 @@ namespace RERenderer
 				height = RERHI::RHITexture::getHalfSize(height);
 			}
 		}
+		mNumberOfTextureBytes = mNumberOfUsedImageDataBytes;
 		if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 		{
 			mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
@@ -536,6 +536,7 @@ namespace RERenderer
 				}
 				mNumberOfUsedImageDataBytes += RERHI::TextureFormat::getNumberOfBytesPerSlice(static_cast<RERHI::TextureFormat::Enum>(mTextureFormat), width, height) * depth * mNumberOfSlices;
 
+				mNumberOfTextureBytes = mNumberOfUsedImageDataBytes;
 				if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 				{
 					mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
@@ -28,6 +28,7 @@
 #include "RERenderer/Resource/Texture/Loader/Lz4DdsTextureResourceLoader.h"
 #include "RERenderer/Resource/Texture/Loader/KtxTextureResourceLoader.h"
 #include <RECore/Resource/ResourceManagerTemplate.h>
+#include <RECore/Memory/MemoryTracker.h>
 #ifdef RENDERER_OPENVR
 	#include "RERenderer/Vr/OpenVR/Loader/OpenVRTextureResourceLoader.h"
 #endif
@@ -198,17 +199,32 @@ namespace RERenderer
 
 	TextureResource* TextureResourceManager::getTextureResourceByAssetId(AssetId assetId) const
 	{
-		return mInternalResourceManager->getResourceByAssetId(assetId);
+		AssetIdToTextureResourceId::const_iterator iterator = mAssetIdToTextureResourceId.find(assetId);
+		return (mAssetIdToTextureResourceId.cend() != iterator) ? &mInternalResourceManager->getResources().getElementById(iterator->second) : nullptr;
 	}
 
 	TextureResourceId TextureResourceManager::getTextureResourceIdByAssetId(AssetId assetId) const
 	{
-		const TextureResource* textureResource = getTextureResourceByAssetId(assetId);
-		return (nullptr != textureResource) ? textureResource->getId() : RECore::getInvalid<TextureResourceId>();
+		AssetIdToTextureResourceId::const_iterator iterator = mAssetIdToTextureResourceId.find(assetId);
+		return (mAssetIdToTextureResourceId.cend() != iterator) ? iterator->second : RECore::getInvalid<TextureResourceId>();
+	}
+
+	TextureResource* TextureResourceManager::getTextureResourceByAssetId(AssetId assetId, TextureResourceId& textureResourceId) const
+	{
+		// The texture resource ID stays the same during hot-reloading, it only changes if the texture resource was destroyed and created again
+		TextureResource* textureResource = mInternalResourceManager->getResources().tryGetElementById(textureResourceId);
+		if (nullptr == textureResource || textureResource->getAssetId() != assetId)
+		{
+			textureResourceId = getTextureResourceIdByAssetId(assetId);
+			textureResource = mInternalResourceManager->getResources().tryGetElementById(textureResourceId);
+		}
+		return textureResource;
 	}
 
 	void TextureResourceManager::loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, RECore::IResourceListener* resourceListener, bool rgbHardwareGammaCorrection, bool reload, RECore::ResourceLoaderTypeId resourceLoaderTypeId)
 	{
+		RE_MEMORY_TAG_SCOPE("TextureResourceManager")
+
 		// Check whether or not the texture resource already exists
 		TextureResource* textureResource = getTextureResourceByAssetId(assetId);
 
@@ -226,6 +242,7 @@ namespace RERenderer
 			textureResource->setAssetId(assetId);
 			textureResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			textureResource->mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;
+			mAssetIdToTextureResourceId.emplace(assetId, textureResource->getId());
 			load = true;
 		}
 
@@ -299,7 +316,7 @@ namespace RERenderer
 		}
 	}
 
-	TextureResourceId TextureResourceManager::createTextureResourceByAssetId(AssetId assetId, RERHI::RHITexture& texture, bool rgbHardwareGammaCorrection)
+	TextureResourceId TextureResourceManager::createTextureResourceByAssetId(AssetId assetId, RERHI::RHITexture& texture, bool rgbHardwareGammaCorrection, RECore::uint32 numberOfBytes)
 	{
 		// Sanity check
 		RHI_ASSERT(mRenderer.getContext(), nullptr == getTextureResourceByAssetId(assetId), "The texture resource isn't allowed to exist, yet")
@@ -310,6 +327,8 @@ namespace RERenderer
 		textureResource.setAssetId(assetId);
 		textureResource.mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;	// TODO(naetherm) We might need to extend "RERHI::RHITexture" so we can readback the texture format
 		textureResource.mTexture = &texture;
+		textureResource.mNumberOfBytes = numberOfBytes;
+		mAssetIdToTextureResourceId.emplace(assetId, textureResource.getId());
 
 		// Done
 		setResourceLoadingState(textureResource, RECore::IResource::LoadingState::LOADED);
@@ -318,6 +337,15 @@ namespace RERenderer
 
 	void TextureResourceManager::destroyTextureResource(TextureResourceId textureResourceId)
 	{
+		const TextureResource* textureResource = mInternalResourceManager->getResources().tryGetElementById(textureResourceId);
+		if (nullptr != textureResource)
+		{
+			AssetIdToTextureResourceId::const_iterator iterator = mAssetIdToTextureResourceId.find(textureResource->getAssetId());
+			if (mAssetIdToTextureResourceId.cend() != iterator && iterator->second == textureResourceId)
+			{
+				mAssetIdToTextureResourceId.erase(iterator);
+			}
+		}
 		mInternalResourceManager->getResources().removeElement(textureResourceId);
 	}
 
@@ -358,17 +386,23 @@ RECore::IResource* TextureResourceManager::tryGetResourceByResourceId(RECore::Re
 	void TextureResourceManager::reloadResourceByAssetId(AssetId assetId)
 	{
 		// TODO(naetherm) Experimental implementation (take care of resource cleanup etc.)
+		const TextureResource* textureResource = getTextureResourceByAssetId(assetId);
+		if (nullptr != textureResource)
+		{
+			TextureResourceId textureResourceId = RECore::getInvalid<TextureResourceId>();
+			loadTextureResourceByAssetId(assetId, RECore::getInvalid<AssetId>(), textureResourceId, nullptr, textureResource->isRgbHardwareGammaCorrection(), true, textureResource->getResourceLoaderTypeId());
+		}
+	}
+
+	RECore::uint64 TextureResourceManager::getNumberOfResourceBytes() const
+	{
+		RECore::uint64 numberOfBytes = 0;
 		const RECore::uint32 numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
 		for (RECore::uint32 i = 0; i < numberOfElements; ++i)
 		{
-			const TextureResource& textureResource = mInternalResourceManager->getResources().getElementByIndex(i);
-			if (textureResource.getAssetId() == assetId)
-			{
-				TextureResourceId textureResourceId = RECore::getInvalid<TextureResourceId>();
-				loadTextureResourceByAssetId(assetId, RECore::getInvalid<AssetId>(), textureResourceId, nullptr, textureResource.isRgbHardwareGammaCorrection(), true, textureResource.getResourceLoaderTypeId());
-				break;
-			}
+			numberOfBytes += mInternalResourceManager->getResources().getElementByIndex(i).getNumberOfBytes();
 		}
+		return numberOfBytes;
 	}
 
 
@@ -351,6 +351,7 @@ namespace RERenderer
 
 		// Create vertex array object (VAO)
 		mMeshResource->setVertexArray(mRenderer.getRhi().getCapabilities().nativeMultithreading ? mVertexArray : createVertexArray());
+		mMeshResource->setNumberOfBytes(static_cast<RECore::uint32>(mVertexBufferData.size() + mIndexBufferData.size() * sizeof(RECore::uint16)));
 
 		{ // Create sub-meshes
 			// Load the render model texture and setup the material asset
@@ -77,6 +77,10 @@ namespace RERenderer
 			}
 		}
 
+		// RGBA8 texture with generated mipmaps, the mipmap chain adds roughly one third
+		mNumberOfTextureBytes = mVrRenderModelTextureMap->unWidth * mVrRenderModelTextureMap->unHeight * 4;
+		mNumberOfTextureBytes += mNumberOfTextureBytes / 3;
+
 		// Can we create the RHI resource asynchronous as well?
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
 		{
@@ -30,13 +30,6 @@
 #include <RECore/Core/Manager.h>
 #include "RERenderer/Core/Renderer/FramebufferSignature.h"
 
-// Disable warnings in external headers, we can't fix them
-PRAGMA_WARNING_PUSH
-	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
-	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
-	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
-	#include <vector>
-PRAGMA_WARNING_POP
 #include <unordered_map>
 
 
@@ -135,7 +128,7 @@ namespace RERenderer
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::vector<FramebufferElement> SortedFramebufferVector;
+		typedef std::unordered_map<RECore::uint32, FramebufferElement> FramebufferElements;									///< Key = "RERenderer::FramebufferSignatureId"
 		typedef std::unordered_map<RECore::uint32, FramebufferSignatureId> CompositorFramebufferIdToFramebufferSignatureId;	///< Key = "RERenderer::CompositorFramebufferId"
 
 
@@ -145,7 +138,7 @@ namespace RERenderer
 	private:
 		RenderTargetTextureManager&						mRenderTargetTextureManager;	///< Render target texture manager, just shared so don't destroy the instance
 		RenderPassManager&								mRenderPassManager;				///< Render pass manager, just shared so don't destroy the instance
-		SortedFramebufferVector							mSortedFramebufferVector;
+		FramebufferElements								mFramebufferElements;
 		CompositorFramebufferIdToFramebufferSignatureId	mCompositorFramebufferIdToFramebufferSignatureId;
 
 
@@ -80,11 +80,17 @@ namespace RERenderer
 			RenderTargetTextureSignature renderTargetTextureSignature;
 			RERHI::RHITexture*				 texture;				///< Can be a null pointer, no "RERHI::RHITexturePtr" to not have overhead when internally reallocating
 			RECore::uint32					 numberOfReferences;	///< Number of texture references (don't misuse the RHI texture reference counter for this)
+			RECore::uint32					 aliasedIndex;			///< Index of the render target texture element this render target texture shares the RHI texture with, "RECore::getInvalid<RECore::uint32>()" if the render target texture owns its RHI texture
+			RECore::uint32					 numberOfTextureBytes;	///< Estimated number of bytes of the RHI texture, 0 if there's no RHI texture
+			bool							 aliasingDecided;		///< Has a compositor workspace instance already decided whether or not the render target texture shares an RHI texture?
 
 			inline RenderTargetTextureElement() :
 				assetId(RECore::getInvalid<AssetId>()),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(RECore::getInvalid<RECore::uint32>()),
+				numberOfTextureBytes(0),
+				aliasingDecided(false)
 			{
 				// Nothing here
 			}
@@ -93,7 +99,10 @@ namespace RERenderer
 				assetId(RECore::getInvalid<AssetId>()),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(RECore::getInvalid<RECore::uint32>()),
+				numberOfTextureBytes(0),
+				aliasingDecided(false)
 			{
 				// Nothing here
 			}
@@ -102,7 +111,10 @@ namespace RERenderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(RECore::getInvalid<RECore::uint32>()),
+				numberOfTextureBytes(0),
+				aliasingDecided(false)
 			{
 				// Nothing here
 			}
@@ -111,7 +123,10 @@ namespace RERenderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(&_texture),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(RECore::getInvalid<RECore::uint32>()),
+				numberOfTextureBytes(0),
+				aliasingDecided(false)
 			{
 				// Nothing here
 			}
@@ -123,7 +138,9 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	public:
 		inline explicit RenderTargetTextureManager(IRenderer& renderer) :
-			mRenderer(renderer)
+			mRenderer(renderer),
+			mNumberOfTextureBytes(0),
+			mNumberOfSavedTextureBytes(0)
 		{
 			// Nothing here
 		}
@@ -145,26 +162,65 @@ namespace RERenderer
 		void clearRhiResources();
 		void addRenderTargetTexture(AssetId assetId, const RenderTargetTextureSignature& renderTargetTextureSignature);
 		[[nodiscard]] RERHI::RHITexture* getTextureByAssetId(AssetId assetId, const RERHI::RHIRenderTarget& renderTarget, RECore::uint8 numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature);
-		void releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature);
+		void releaseRenderTargetTextureByAssetId(AssetId assetId);	// On the last reference the RHI texture is released, the render target texture element itself stays registered until "RERenderer::RenderTargetTextureManager::clear()" so element indices stay stable
+
+		/**
+		*  @brief
+		*    Let a render target texture share the RHI texture of another render target texture
+		*
+		*  @param[in] assetId
+		*    Asset ID of the render target texture which should share the RHI texture
+		*  @param[in] aliasedAssetId
+		*    Asset ID of the render target texture owning the RHI texture, must have the same render target texture signature; "assetId" if the render target texture must own its RHI texture
+		*
+		*  @remarks
+		*    Render target textures are shared by all compositor workspace instances, but each instance only knows the lifetimes inside its own
+		*    compositor passes. The first decision is taken, repeating it (e.g. a second instance of the same compositor workspace) changes nothing.
+		*    A contradicting decision of another compositor workspace instance lets the render target texture own its RHI texture, which is safe
+		*    for all of them. An already created RHI texture is released in this case and created again on the next use.
+		*
+		*  @note
+		*    - Only valid for transient render target textures which are never used at the same time, the caller is responsible to ensure this
+		*    - Compositor workspace instances should report the decision for each of their transient render target textures, including the ones owning their RHI texture
+		*/
+		void aliasRenderTargetTexture(AssetId assetId, AssetId aliasedAssetId);
+
+		[[nodiscard]] inline RECore::uint64 getNumberOfTextureBytes() const	// Estimated number of bytes of the currently created RHI textures
+		{
+			return mNumberOfTextureBytes;
+		}
+
+		[[nodiscard]] inline RECore::uint64 getNumberOfSavedTextureBytes() const	// Estimated number of bytes saved by sharing RHI textures between render target textures
+		{
+			return mNumberOfSavedTextureBytes;
+		}
 
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		typedef std::vector<RenderTargetTextureElement>						 SortedRenderTargetTextureVector;
-		typedef std::unordered_map<RECore::uint32, RenderTargetTextureSignatureId> AssetIdToRenderTargetTextureSignatureId;	///< Key = "RECore::AssetId"
-		typedef std::unordered_map<RECore::uint32, RECore::uint32>						 AssetIdToIndex;							///< Key = "RECore::AssetId"
+		typedef std::vector<RenderTargetTextureElement>			   RenderTargetTextureElements;	///< Indices are stable until "RERenderer::RenderTargetTextureManager::clear()" is called
+		typedef std::unordered_map<RECore::uint32, RECore::uint32> AssetIdToIndex;				///< Key = "RECore::AssetId", value = index inside the render target texture elements
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void setAliasedIndex(RenderTargetTextureElement& renderTargetTextureElement, RECore::uint32 aliasedIndex);
+		void releaseTexture(RenderTargetTextureElement& renderTargetTextureElement);
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		IRenderer&								mRenderer;
-		SortedRenderTargetTextureVector			mSortedRenderTargetTextureVector;
-		AssetIdToRenderTargetTextureSignatureId	mAssetIdToRenderTargetTextureSignatureId;
-		AssetIdToIndex							mAssetIdToIndex;
+		IRenderer&					mRenderer;
+		RenderTargetTextureElements	mRenderTargetTextureElements;
+		AssetIdToIndex				mAssetIdToIndex;
+		RECore::uint64				mNumberOfTextureBytes;
+		RECore::uint64				mNumberOfSavedTextureBytes;
 
 
 	};
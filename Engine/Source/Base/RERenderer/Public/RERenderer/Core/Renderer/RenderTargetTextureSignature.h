@@ -68,7 +68,8 @@ namespace RERenderer
 				RENDER_TARGET          = 1u << 2u,	///< This texture can be used as framebuffer object (FBO) attachment render target
 				ALLOW_MULTISAMPLE      = 1u << 3u,	///< Allow multisample
 				GENERATE_MIPMAPS       = 1u << 4u,	///< Generate mipmaps
-				ALLOW_RESOLUTION_SCALE = 1u << 5u	///< Allow resolution scale
+				ALLOW_RESOLUTION_SCALE = 1u << 5u,	///< Allow resolution scale
+				TRANSIENT              = 1u << 6u	///< The texture content is only needed between its first and last use by compositor passes during a compositor workspace execution, the texture memory can be shared with other transient render target textures
 			};
 		};
 
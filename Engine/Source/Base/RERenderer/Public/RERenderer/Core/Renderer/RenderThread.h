@@ -0,0 +1,301 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <RERHI/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <vector>
+	#include <atomic>	// For "std::atomic<>"
+	#include <mutex>
+	#include <thread>
+	#include <condition_variable>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+	class IRenderer;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Render thread class
+	*
+	*  @remarks
+	*    When enabled, recorded RHI command buffers are handed over to a dedicated submission thread which dispatches them to the
+	*    RHI implementation and presents swap chains. This way the driver submission cost of frame n overlaps with the simulation,
+	*    update and culling of frame n + 1 on the main thread. The main thread only blocks if it's more than the maximum number of
+	*    frames in flight ahead of the submission thread (double buffered by default).
+	*
+	*    The renderer itself is not thread-safe, so every RHI access is serialized by a single RHI mutex:
+	*    - The submission thread holds it while dispatching and presenting
+	*    - The main thread must hold it via "RERenderer::RenderThread::lockRhi()" only while talking to the RHI directly, e.g. when creating
+	*      or mapping RHI resources. Culling and command buffer recording don't need the lock, so they overlap with the dispatch of the
+	*      previous frame.
+	*    - The RHI mutex is recursive, RHI resources can be created while e.g. "RERenderer::IRenderer::update()" already holds it
+	*    - RHI resources which might still be referenced by submitted frames must be released via "RERenderer::RenderThread::releaseResource()"
+	*      or after a "RERenderer::RenderThread::flush()"
+	*
+	*    Dynamic buffers which are written every frame keep one copy per frame slot and use the copy of
+	*    "RERenderer::RenderThread::getRecordingFrameIndex()". The frame which used the same slot before has always been
+	*    dispatched at this point, so the copy can be mapped without waiting for the submission thread.
+	*
+	*    Create and release requests are handed over to the submission thread together with the next submitted frame. The request
+	*    lists are bounded and double buffered: The main thread fills one list while the frame slots own the lists of the frames in
+	*    flight, no memory is allocated after startup. The submission thread never touches reference counters, render targets,
+	*    released resources and created resources are handled by the main thread as soon as the frame referencing them has been completed.
+	*
+	*  @note
+	*    - Disabled by default, can only be enabled if the RHI implementation supports threaded submission (see "RERHI::Capabilities::threadedSubmission") since e.g. OpenGL contexts are bound to a thread
+	*    - All public methods must be called by the main thread
+	*    - Don't call "RERenderer::RenderThread::flush()" or "RERenderer::RenderThread::submit()" while holding the RHI lock, the same
+	*      is true for "RERenderer::RenderThread::lockRhi()" with waiting for dispatched frames and for create or release requests
+	*      since they flush if the request list is full
+	*/
+	class RenderThread final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class RendererImpl;
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT = 4;
+		static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_REQUESTS = 1024;	///< Maximum number of create and release requests per submitted frame, further requests flush the render thread
+		typedef std::unique_lock<std::recursive_mutex> RhiLock;
+		typedef RERHI::RHIResource* (*CreateFunction)(RERHI::RHIDynamicRHI& rhi, void* userData);		///< Called by the submission thread while holding the RHI lock, must not touch reference counters or renderer state
+		typedef void (*CompletionFunction)(RERHI::RHIResource* resource, void* userData);				///< Called by the main thread, the resource is the one returned by the create function
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline bool isEnabled() const
+		{
+			return mEnabled;
+		}
+
+		void setEnabled(bool enabled);	// Ignored if the RHI implementation doesn't support threaded submission
+
+		[[nodiscard]] inline RECore::uint32 getMaximumNumberOfFramesInFlight() const
+		{
+			return mMaximumNumberOfFramesInFlight;
+		}
+
+		void setMaximumNumberOfFramesInFlight(RECore::uint32 maximumNumberOfFramesInFlight);	// Clamped to [1, "RERenderer::RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT"], default is 2 (double buffered)
+
+		[[nodiscard]] inline RECore::uint32 getRecordingFrameIndex() const	// Frame slot of the frame which is currently recorded, index of the per frame copy of dynamic buffers to use, always 0 when disabled
+		{
+			return mRecordingFrameIndex;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Timings                                               ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline float getMainThreadWaitMilliseconds() const	// Time the main thread was blocked inside the last "RERenderer::RenderThread::submit()" call
+		{
+			return mMainThreadWaitMilliseconds;
+		}
+
+		[[nodiscard]] inline float getDispatchMilliseconds() const	// Time the submission thread needed to dispatch the last frame to the RHI implementation
+		{
+			return mDispatchMilliseconds;
+		}
+
+		[[nodiscard]] inline float getPresentMilliseconds() const	// Time the submission thread needed to present the last frame
+		{
+			return mPresentMilliseconds;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Submission                                            ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Lock the RHI for exclusive main thread access
+		*
+		*  @param[in] waitForDispatchedFrames
+		*    Wait until all submitted frames have been dispatched to the RHI implementation, only required for RHI accesses which depend on the previous frames like queries or frame captures
+		*
+		*  @return
+		*    The owning RHI lock, keep it as long as the RHI is accessed
+		*/
+		[[nodiscard]] RhiLock lockRhi(bool waitForDispatchedFrames = false);
+
+		/**
+		*  @brief
+		*    Submit a recorded command buffer
+		*
+		*  @param[in] commandBuffer
+		*    Command buffer to dispatch, the content is copied so the caller can keep and clear the command buffer as usual
+		*  @param[in] renderTarget
+		*    Render target the command buffer renders into, if it's a swap chain it's presented after the dispatch
+		*
+		*  @note
+		*    - When disabled, the command buffer is dispatched and presented at once
+		*    - When enabled, blocks as long as the maximum number of frames are in flight and until the frame slot of the next recorded frame is no longer in flight
+		*/
+		void submit(const RERHI::RHICommandBuffer& commandBuffer, RERHI::RHIRenderTarget& renderTarget);
+
+		/**
+		*  @brief
+		*    Let the submission thread create a RHI resource right before it dispatches the next submitted frame
+		*
+		*  @param[in] createFunction
+		*    Function creating the RHI resource, called by the submission thread
+		*  @param[in] completionFunction
+		*    Function receiving the created RHI resource, called by the main thread as soon as the frame has been completed, the receiver is responsible for the resource reference
+		*  @param[in] userData
+		*    User data passed to both functions, must stay valid until the completion function has been called
+		*
+		*  @note
+		*    - When disabled, both functions are called at once
+		*    - Meant for RHI resources which aren't required to record the current frame, the main thread doesn't have to wait for the RHI lock while the submission thread dispatches
+		*/
+		void createResource(CreateFunction createFunction, CompletionFunction completionFunction, void* userData);
+
+		/**
+		*  @brief
+		*    Release a RHI resource as soon as all currently submitted frames and the next submitted frame have been completed
+		*
+		*  @param[in] resource
+		*    RHI resource to release, the reference of the caller is taken over
+		*
+		*  @note
+		*    - When disabled, the resource is released at once
+		*/
+		void releaseResource(RERHI::RHIResource& resource);
+
+		/**
+		*  @brief
+		*    Wait until all submitted frames have been completed and release all deferred resources
+		*/
+		void flush();
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Request final
+		{
+			RERHI::RHIResource* resource;			///< Resource to release, or the resource returned by the create function
+			CreateFunction		createFunction;		///< Null pointer for release requests
+			CompletionFunction	completionFunction;
+			void*				userData;
+		};
+		typedef std::vector<Request> Requests;	///< The capacity is reserved once to "RERenderer::RenderThread::MAXIMUM_NUMBER_OF_REQUESTS"
+
+		struct Frame final
+		{
+			RERHI::RHICommandBuffer commandBuffer;
+			RERHI::RHIRenderTarget* renderTarget = nullptr;	///< We keep a reference to the render target, released by the main thread
+			Requests				requests;				///< Create requests are executed before the command buffer is dispatched, all requests are completed as soon as this frame has been completed
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit RenderThread(IRenderer& renderer);
+		explicit RenderThread(const RenderThread&) = delete;
+		~RenderThread();
+		RenderThread& operator=(const RenderThread&) = delete;
+		void addRequest(const Request& request);
+		void completeRequests(Requests& requests);
+		void releaseCompletedFrames();
+		void submissionThreadWorker();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		IRenderer&			 mRenderer;	///< Renderer instance, do not destroy the instance
+		bool				 mEnabled;
+		RECore::uint32		 mMaximumNumberOfFramesInFlight;
+		RECore::uint32		 mRecordingFrameIndex;	///< Frame slot the next submitted frame is going to use
+		std::recursive_mutex mRhiMutex;				///< Serializes all RHI accesses of the main thread and the submission thread, recursive so RHI accesses can be nested
+		Requests			 mRequests;				///< Requests since the last submission, swapped with the empty requests of the next submitted frame
+
+		// Asynchronous submission
+		std::atomic<bool>		mShutdownSubmissionThread;
+		std::mutex				mSubmissionMutex;
+		std::condition_variable	mSubmissionConditionVariable;	///< Wakes up the submission thread
+		std::condition_variable	mCompletionConditionVariable;	///< Wakes up the main thread waiting for dispatched or completed frames
+		Frame					mFrames[MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];
+		RECore::uint32			mFirstFrameIndex;				///< Index of the oldest frame in flight
+		RECore::uint32			mNumberOfFramesInFlight;		///< Submitted frames which haven't been completed yet
+		RECore::uint32			mNumberOfUndispatchedFrames;	///< Submitted frames which haven't been dispatched to the RHI implementation yet
+		std::thread				mSubmissionThread;
+
+		// Timings
+		std::atomic<float> mMainThreadWaitMilliseconds;
+		std::atomic<float> mDispatchMilliseconds;
+		std::atomic<float> mPresentMilliseconds;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RECore
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/RERenderer.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <RECore/Core/Manager.h>
 #include <RECore/String/StringId.h>
 
@@ -178,6 +179,24 @@ namespace RERenderer
 
     void embraceTheDarkness();
 
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct GeometryBuffer final
+		{
+			RERHI::RHIVertexBufferPtr vertexBuffer;
+			RECore::uint32			  numberOfAllocatedVertices;
+			RERHI::RHIIndexBufferPtr  indexBuffer;
+			RECore::uint32			  numberOfAllocatedIndices;
+			RERHI::RHIVertexArrayPtr  vertexArray;
+			GeometryBuffer() :
+				numberOfAllocatedVertices(0),
+				numberOfAllocatedIndices(0)
+			{}
+		};
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -197,11 +216,7 @@ namespace RERenderer
 		RERHI::RHIResourceGroupPtr			mResourceGroup;		///< Resource group, can be a null pointer
 		RERHI::RHIResourceGroupPtr			mSamplerStateGroup;	///< Sampler state resource group, can be a null pointer
 		// Vertex and index buffer
-		RERHI::RHIVertexBufferPtr mVertexBuffer;
-		RECore::uint32			  mNumberOfAllocatedVertices;
-		RERHI::RHIIndexBufferPtr  mIndexBuffer;
-		RECore::uint32			  mNumberOfAllocatedIndices;
-		RERHI::RHIVertexArrayPtr  mVertexArray;
+		GeometryBuffer mGeometryBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Vertex and index buffers per render thread frame slot, so they can be filled while previous frames are still in flight
 		// Helper
 		bool mOpenMetricsWindow;
 
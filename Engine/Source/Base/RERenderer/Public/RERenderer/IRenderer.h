@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <RECore/String/StringId.h>
+#include <RECore/Memory/MemoryTracker.h>
 
 #include <RERHI/Rhi.h>
 
@@ -52,6 +53,7 @@ namespace RECore {
 class AssetManager;
 class IFileManager;
 class TimeManager;
+class LinearAllocator;
 class ResourceStreamer;
 class IResourceManager;
 template <typename ReturnType> class ThreadPool;
@@ -65,6 +67,7 @@ namespace RERenderer
 	class TextureResourceManager;
 	class MaterialResourceManager;
 	class SkeletonResourceManager;
+	class RenderThread;
 	class RendererResourceManager;
 	class ShaderPieceResourceManager;
 	class ComputePipelineStateCompiler;
@@ -228,6 +231,22 @@ namespace RERenderer
 			return *mTimeManager;
 		}
 
+		/**
+		*  @brief
+		*    Return the frame allocator instance
+		*
+		*  @return
+		*    The frame allocator instance, do not release the returned instance
+		*
+		*  @note
+		*    - For scratch memory which is only needed until the end of the current frame, all frame allocations are released by "RERenderer::IRenderer::update()"
+		*    - Freeing frame allocations is optional and does nothing
+		*/
+		[[nodiscard]] inline RECore::LinearAllocator& getFrameAllocator() const
+		{
+			return *mFrameAllocator;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -438,6 +457,18 @@ namespace RERenderer
 			return *mComputePipelineStateCompiler;
 		}
 
+		/**
+		*  @brief
+		*    Return the render thread instance
+		*
+		*  @return
+		*    The render thread instance, do not release the returned instance
+		*/
+		[[nodiscard]] inline RenderThread& getRenderThread() const
+		{
+			return *mRenderThread;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Optional                                              ]
 		//[-------------------------------------------------------]
@@ -508,6 +539,22 @@ namespace RERenderer
 		virtual void loadPipelineStateObjectCache() = 0;
 		virtual void savePipelineStateObjectCache() = 0;
 
+		//[-------------------------------------------------------]
+		//[ Memory statistics                                     ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Append a memory snapshot to the given snapshot
+		*
+		*  @param[out] snapshot
+		*    Receives the memory tag entries of "RECore::MemoryTracker" as well as one "Resource/<resource manager>" entry per resource manager
+		*
+		*  @note
+		*    - Use "RECore::MemoryTracker::writeSnapshot()" to write the snapshot into a file
+		*    - Resource manager entries report the estimated resource bytes as live and peak bytes and the number of resources as number of allocations
+		*/
+		virtual void getMemorySnapshot(RECore::MemoryTracker::Snapshot& snapshot) const = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -530,6 +577,7 @@ namespace RERenderer
 			mDefaultThreadPool(nullptr),
 			mAssetManager(nullptr),
 			mTimeManager(nullptr),
+			mFrameAllocator(nullptr),
 			// Resource
 			mRendererResourceManager(nullptr),
 			mResourceStreamer(nullptr),
@@ -547,7 +595,8 @@ namespace RERenderer
 			mCompositorWorkspaceResourceManager(nullptr),
 			// Misc
 			mGraphicsPipelineStateCompiler(nullptr),
-			mComputePipelineStateCompiler(nullptr)
+			mComputePipelineStateCompiler(nullptr),
+			mRenderThread(nullptr)
 			// Optional
 			#ifdef RENDERER_IMGUI
 				, mDebugGuiManager(nullptr)
@@ -576,6 +625,7 @@ namespace RERenderer
 		DefaultThreadPool*	  mDefaultThreadPool;
 		RECore::AssetManager*		  mAssetManager;
 		 RECore::TimeManager*		  mTimeManager;
+		RECore::LinearAllocator*	  mFrameAllocator;
 		// Resource
 		RendererResourceManager*			mRendererResourceManager;
     RECore::ResourceStreamer*					mResourceStreamer;
@@ -595,6 +645,7 @@ namespace RERenderer
 		// Misc
 		GraphicsPipelineStateCompiler* mGraphicsPipelineStateCompiler;
 		ComputePipelineStateCompiler*  mComputePipelineStateCompiler;
+		RenderThread*				   mRenderThread;
 		// Optional
 		#ifdef RENDERER_IMGUI
 			DebugGuiManager* mDebugGuiManager;
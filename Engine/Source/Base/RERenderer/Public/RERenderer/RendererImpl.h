@@ -118,6 +118,11 @@ namespace RERenderer
 		virtual void loadPipelineStateObjectCache() override;
 		virtual void savePipelineStateObjectCache() override;
 
+		//[-------------------------------------------------------]
+		//[ Memory statistics                                     ]
+		//[-------------------------------------------------------]
+		virtual void getMemorySnapshot(RECore::MemoryTracker::Snapshot& snapshot) const override;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERHI::RefCount methods               ]
@@ -37,8 +37,8 @@
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace RECore {
-template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
-class PackedElementManager;
+template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
+class PagedPackedElementManager;
 
 template<class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
 class ResourceManagerTemplate;
@@ -72,7 +72,7 @@ namespace RERenderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class CompositorNodeResourceLoader;
-		friend RECore::PackedElementManager<CompositorNodeResource, CompositorNodeResourceId, 32>;									// Type definition of template class
+		friend RECore::PagedPackedElementManager<CompositorNodeResource, CompositorNodeResourceId, 32>;									// Type definition of template class
 		friend RECore::ResourceManagerTemplate<CompositorNodeResource, CompositorNodeResourceLoader, CompositorNodeResourceId, 32>;	// Type definition of template class
 
 
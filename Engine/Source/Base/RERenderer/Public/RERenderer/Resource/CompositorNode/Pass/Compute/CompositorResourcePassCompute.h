@@ -122,6 +122,7 @@ namespace RERenderer
 		}
 
 		virtual void deserialize(RECore::uint32 numberOfBytes, const RECore::uint8* data) override;
+		virtual void getReferencedCompositorResources(AssetIds& textureAssetIds, CompositorFramebufferIds& compositorFramebufferIds) const override;
 
 
 	//[-------------------------------------------------------]
@@ -46,6 +46,12 @@ namespace RERenderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef RECore::uint32 TextureResourceId;	///< POD texture resource identifier
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -81,6 +87,14 @@ namespace RERenderer
 		CompositorInstancePassCopy& operator=(const CompositorInstancePassCopy&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		TextureResourceId mDestinationTextureResourceId;	///< Texture resource ID cache, resolved on first use
+		TextureResourceId mSourceTextureResourceId;			///< Texture resource ID cache, resolved on first use
+
+
 	};
 
 
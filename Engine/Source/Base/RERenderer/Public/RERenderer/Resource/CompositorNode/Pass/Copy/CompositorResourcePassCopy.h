@@ -89,6 +89,12 @@ namespace RERenderer
 
 		virtual void deserialize(RECore::uint32 numberOfBytes, const RECore::uint8* data) override;
 
+		inline virtual void getReferencedCompositorResources(AssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			textureAssetIds.push_back(mDestinationTextureAssetId);
+			textureAssetIds.push_back(mSourceTextureAssetId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -85,12 +85,14 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
 		typedef std::vector<RERHI::RHIFramebufferPtr> FramebufferPtrs;
+		typedef RECore::uint32 TextureResourceId;	///< POD texture resource identifier
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
+		TextureResourceId mTextureResourceId;	///< Texture resource ID cache, resolved on first use
 		// For texture mipmap generation via custom material blueprint
 		RERHI::RHICommandBuffer			   mCommandBuffer;
 		CompositorResourcePassCompute* mCompositorResourcePassCompute;
@@ -95,6 +95,11 @@ namespace RERenderer
 
 		virtual void deserialize(RECore::uint32 numberOfBytes, const RECore::uint8* data) override;
 
+		inline virtual void getReferencedCompositorResources(AssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			textureAssetIds.push_back(mTextureAssetId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -30,6 +30,14 @@
 #include <RECore/String/StringId.h>
 #include <RECore/Utility/GetInvalid.h>
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -50,7 +58,11 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
-	typedef RECore::StringId CompositorPassTypeId;	///< Compositor pass type identifier, internally just a POD "RECore::uint32"
+	typedef RECore::StringId CompositorPassTypeId;		///< Compositor pass type identifier, internally just a POD "RECore::uint32"
+	typedef RECore::StringId AssetId;					///< Asset identifier, internally just a POD "RECore::uint32", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef RECore::StringId CompositorFramebufferId;	///< Compositor framebuffer identifier, internally just a POD "RECore::uint32"
+	typedef std::vector<AssetId>				 AssetIds;
+	typedef std::vector<CompositorFramebufferId> CompositorFramebufferIds;
 
 
 	//[-------------------------------------------------------]
@@ -182,6 +194,23 @@ namespace RERenderer
 			return false;
 		}
 
+		/**
+		*  @brief
+		*    Gather the compositor resources this compositor resource pass is using beside the framebuffer of its compositor target
+		*
+		*  @param[out] textureAssetIds
+		*    Receives the IDs of the textures the compositor resource pass is reading from or writing into, the list isn't cleared
+		*  @param[out] compositorFramebufferIds
+		*    Receives the IDs of the compositor framebuffers the compositor resource pass is reading from or writing into, the list isn't cleared
+		*
+		*  @note
+		*    - Used by the compositor workspace instance to compute the lifetime of transient render target textures (see "RERenderer::RenderTargetTextureSignature::Flag::TRANSIENT")
+		*/
+		inline virtual void getReferencedCompositorResources([[maybe_unused]] AssetIds& textureAssetIds, [[maybe_unused]] CompositorFramebufferIds& compositorFramebufferIds) const
+		{
+			// This compositor resource pass doesn't use further compositor resources
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -84,6 +84,11 @@ namespace RERenderer
 
 		virtual void deserialize(RECore::uint32 numberOfBytes, const RECore::uint8* data) override;
 
+		inline virtual void getReferencedCompositorResources([[maybe_unused]] AssetIds& textureAssetIds, CompositorFramebufferIds& compositorFramebufferIds) const override
+		{
+			compositorFramebufferIds.push_back(mSourceMultisampleCompositorFramebufferId);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -29,8 +29,11 @@
 //[-------------------------------------------------------]
 #include <RECore/String/StringId.h>
 #include <RECore/Resource/IResourceListener.h>
+#include <RECore/Threading/Task.h>
 #include <RERHI/Rhi.h>
 
+#include <memory>
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -180,7 +183,9 @@ namespace RERenderer
 		CompositorWorkspaceInstance() = delete;
 		explicit CompositorWorkspaceInstance(const CompositorWorkspaceInstance&) = delete;
 		CompositorWorkspaceInstance& operator=(const CompositorWorkspaceInstance&) = delete;
+		[[nodiscard]] RECore::Task<void> createSequentialCompositorNodeInstances(std::vector<AssetId> compositorNodeAssetIds, std::weak_ptr<bool> loadingToken);
 		void destroySequentialCompositorNodeInstances();
+		void aliasTransientRenderTargetTextures();
 		void createFramebuffersAndRenderTargetTextures(const RERHI::RHIRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures(bool clearManagers = false);
 		void clearRenderQueueIndexRangesRenderableManagers();
@@ -198,6 +203,7 @@ namespace RERenderer
 		RECore::uint32						 mRenderTargetHeight;
 		CompositorWorkspaceResourceId	 mCompositorWorkspaceResourceId;
 		CompositorNodeInstances			 mSequentialCompositorNodeInstances;	///< We're responsible to destroy the compositor node instances if we no longer need them
+		std::shared_ptr<bool>			 mCompositorNodeInstancesLoadingToken;	///< Only set while the compositor node instances are created asynchronously, resetting it cancels the creation
 		bool							 mFramebufferManagerInitialized;
 		RenderQueueIndexRanges			 mRenderQueueIndexRanges;				///< The render queue index ranges layout is fixed during runtime
 
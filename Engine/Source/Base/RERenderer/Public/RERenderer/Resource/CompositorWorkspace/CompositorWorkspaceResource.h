@@ -42,8 +42,8 @@ PRAGMA_WARNING_POP
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace RECore {
-template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
-class PackedElementManager;
+template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
+class PagedPackedElementManager;
 
 template<class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
 class ResourceManagerTemplate;
@@ -77,7 +77,7 @@ namespace RERenderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class CompositorWorkspaceResourceLoader;
-		friend RECore::PackedElementManager<CompositorWorkspaceResource, CompositorWorkspaceResourceId, 32>;										// Type definition of template class
+		friend RECore::PagedPackedElementManager<CompositorWorkspaceResource, CompositorWorkspaceResourceId, 32>;										// Type definition of template class
 		friend RECore::ResourceManagerTemplate<CompositorWorkspaceResource, CompositorWorkspaceResourceLoader, CompositorWorkspaceResourceId, 32>;	// Type definition of template class
 
 
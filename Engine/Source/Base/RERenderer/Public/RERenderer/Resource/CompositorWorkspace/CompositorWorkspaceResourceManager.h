@@ -146,7 +146,7 @@ namespace RERenderer
 		FramebufferManager*			mFramebufferManager;			///< Framebuffer manager, always valid, we're responsible for destroying it if we no longer need it
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<CompositorWorkspaceResource, CompositorWorkspaceResourceLoader, CompositorWorkspaceResourceId, 32>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<CompositorWorkspaceResource, CompositorWorkspaceResourceLoader, CompositorWorkspaceResourceId, 32>* mInternalResourceManager;	///< Resources are allocated in pages of 32 resources, not a capacity limit
 
 
 	};
@@ -0,0 +1,125 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERenderer/RERenderer.h"
+#include <RECore/Resource/ResourceAwaiter.h>
+#include <RECore/Threading/Task.h>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+	class IRenderer;
+	class MeshResource;
+	class SceneResource;
+	class TextureResource;
+	class SkeletonResource;
+	class MaterialResource;
+	class ShaderPieceResource;
+	class CompositorNodeResource;
+	class ShaderBlueprintResource;
+	class VertexAttributesResource;
+	class MaterialBlueprintResource;
+	class SkeletonAnimationResource;
+	class CompositorWorkspaceResource;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef RECore::StringId AssetId;	///< Asset identifier, internally just a POD "RECore::uint32", string ID scheme is "<project name>/<asset directory>/<asset name>"
+
+
+	//[-------------------------------------------------------]
+	//[ Global functions                                      ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Asynchronously load a resource by using the responsible resource manager
+	*
+	*  @param[in] renderer
+	*    Renderer instance to use
+	*  @param[in] assetId
+	*    ID of the asset to load
+	*  @param[in] resumeThread
+	*    Thread the awaiting coroutine is resumed on
+	*
+	*  @return
+	*    Awaitable returning the resource, or a null pointer if loading failed
+	*
+	*  @remarks
+	*    Coroutine alternative to the "load<x>ResourceByAssetId()"-methods of the resource managers in combination with
+	*    "RECore::IResourceListener". The load request is committed at once, "co_await" just waits for it. Use
+	*    "RECore::whenAll()" to wait for multiple resources which are loaded in parallel:
+	*    @code
+	*    RECore::Task<void> loadLevel(RERenderer::IRenderer& renderer)
+	*    {
+	*        auto [materialResource, meshResource] = co_await RECore::whenAll(RERenderer::loadAsync<RERenderer::MaterialResource>(renderer, materialAssetId),
+	*                                                                          RERenderer::loadAsync<RERenderer::MeshResource>(renderer, meshAssetId));
+	*        ...
+	*    }
+	*    @endcode
+	*
+	*  @note
+	*    - Must be called from the main thread
+	*    - Specialized for all resource types of the renderer, texture resources are loaded without fallback texture and
+	*      without RGB hardware gamma correction, use "RERenderer::TextureResourceManager" directly if required
+	*/
+	template<typename TYPE>
+	[[nodiscard]] RECore::ResourceAwaiter<TYPE> loadAsync(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread = RECore::ResourceStreamer::ResumeThread::DISPATCH);
+
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<VertexAttributesResource> loadAsync<VertexAttributesResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<TextureResource> loadAsync<TextureResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<ShaderPieceResource> loadAsync<ShaderPieceResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<ShaderBlueprintResource> loadAsync<ShaderBlueprintResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<MaterialBlueprintResource> loadAsync<MaterialBlueprintResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<MaterialResource> loadAsync<MaterialResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<SkeletonResource> loadAsync<SkeletonResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<SkeletonAnimationResource> loadAsync<SkeletonAnimationResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<MeshResource> loadAsync<MeshResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<SceneResource> loadAsync<SceneResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<CompositorNodeResource> loadAsync<CompositorNodeResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+	template<> [[nodiscard]] RERENDERER_API RECore::ResourceAwaiter<CompositorWorkspaceResource> loadAsync<CompositorWorkspaceResource>(IRenderer& renderer, AssetId assetId, RECore::ResourceStreamer::ResumeThread resumeThread);
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERenderer
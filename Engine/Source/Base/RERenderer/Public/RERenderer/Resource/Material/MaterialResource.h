@@ -43,7 +43,7 @@ class MaterialTechnique;
 class MaterialResourceLoader;
 }
 namespace RECore {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -81,7 +81,7 @@ namespace RERenderer
 		friend class MaterialResourceManager;
 		friend class MaterialBlueprintResourceManager;
 		friend RECore::ResourceManagerTemplate<MaterialResource, MaterialResourceLoader, MaterialResourceId, 4096>;	// Type definition of template class
-		friend RECore::PackedElementManager<MaterialResource, MaterialResourceId, 4096>;							// Type definition of template class
+		friend RECore::PagedPackedElementManager<MaterialResource, MaterialResourceId, 4096>;							// Type definition of template class
 
 
 	//[-------------------------------------------------------]
@@ -137,7 +137,7 @@ namespace RERenderer
 		IRenderer& mRenderer;	///< Renderer instance, do not destroy the instance
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<MaterialResource, MaterialResourceLoader, MaterialResourceId, 4096>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<MaterialResource, MaterialResourceLoader, MaterialResourceId, 4096>* mInternalResourceManager;	///< Resources are allocated in pages of 4096 resources, not a capacity limit
 
 
 	};
@@ -138,11 +138,18 @@ namespace RERenderer
 		*    Structured buffer root parameter index
 		*  @param[in] structuredBufferPtr
 		*    RHI structured buffer pointer
+		*
+		*  @note
+		*    - Changing the structured buffer results in a resource group rebuild
 		*/
 		inline void setStructuredBufferPtr(RECore::uint32 structuredBufferRootParameterIndex, RERHI::RHIStructuredBufferPtr& structuredBufferPtr)
 		{
-			mStructuredBufferRootParameterIndex = structuredBufferRootParameterIndex;
-			mStructuredBufferPtr = structuredBufferPtr;
+			if (mStructuredBufferRootParameterIndex != structuredBufferRootParameterIndex || mStructuredBufferPtr != structuredBufferPtr)
+			{
+				mStructuredBufferRootParameterIndex = structuredBufferRootParameterIndex;
+				mStructuredBufferPtr = structuredBufferPtr;
+				makeResourceGroupDirty();
+			}
 		}
 
 		/**
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include <RERHI/Rhi.h>
 #include <RECore/Core/Manager.h>
+#include "RERenderer/Core/Renderer/RenderThread.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -161,6 +162,7 @@ namespace RERenderer
 		RECore::uint32		 mMaximumIndirectBufferSize;	///< Maximum indirect buffer size in bytes
 		IndirectBuffers	 mFreeIndirectBuffers;
 		IndirectBuffers	 mUsedIndirectBuffers;
+		IndirectBuffers	 mInFlightIndirectBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Indirect buffers referenced by submitted frames per render thread frame slot, they're free again as soon as the frame slot gets recorded again
 		IndirectBuffer*	 mCurrentIndirectBuffer;		///< Currently filled indirect buffer, can be a null pointer, don't destroy the instance since it's just a reference
 		RECore::uint32		 mPreviouslyRequestedNumberOfBytes;
 
@@ -30,6 +30,7 @@
 #include <RECore/Core/Manager.h>
 #include <RECore/String/StringId.h>
 #include "RERenderer/Core/Platform/PlatformTypes.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -183,6 +184,7 @@ namespace RERenderer
 	private:
 		explicit LightBufferManager(const LightBufferManager&) = delete;
 		LightBufferManager& operator=(const LightBufferManager&) = delete;
+		[[nodiscard]] RERHI::RHITextureBuffer& getTextureBuffer(RECore::uint32 frameIndex);	// Created on first usage
 		void fillTextureBuffer(const glm::dvec3& worldSpaceCameraPosition, SceneResource& sceneResource);	// 64 bit world space position of the camera
 		void fillClusters3DTexture(SceneResource& sceneResource, RERHI::RHICommandBuffer& commandBuffer);
 
@@ -199,12 +201,13 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
 		IRenderer&			 mRenderer;			///< Renderer instance to use
-		RERHI::RHITextureBuffer* mTextureBuffer;	///< RHI texture buffer instance, always valid
+		RERHI::RHITextureBuffer* mTextureBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< RHI texture buffer instance per render thread frame slot, can be a null pointer
 		ScratchBuffer		 mTextureScratchBuffer;
-		TextureResourceId	 mClusters3DTextureResourceId;
+		TextureResourceId	 mClusters3DTextureResourceId;	///< Texture resource using the clusters 3D texture of the frame slot which is currently recorded
+		RERHI::RHITexturePtr mClusters3DTextures[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< RHI clusters 3D texture per render thread frame slot, can be a null pointer
 		glm::vec3			 mLightClustersAabbMinimum;
 		glm::vec3			 mLightClustersAabbMaximum;
-		RERHI::RHIResourceGroup* mResourceGroup;	///< RHI resource group instance, always valid
+		RERHI::RHIResourceGroup* mResourceGroups[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< RHI resource group instance per render thread frame slot, can be a null pointer
 
 
 	};
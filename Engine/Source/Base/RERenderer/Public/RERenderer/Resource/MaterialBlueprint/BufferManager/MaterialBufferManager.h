@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <RECore/Core/Manager.h>
 
 // Disable warnings in external headers, we can't fix them
@@ -45,7 +46,6 @@ namespace RERHI
 {
 	class RHICommandBuffer;
 	class RHIUniformBuffer;
-	class RHIBufferManager;
 	class RHIResourceGroup;
 }
 namespace RERenderer
@@ -152,32 +152,36 @@ namespace RERenderer
 		void fillComputeCommandBuffer(MaterialBufferSlot& materialBufferSlot, RERHI::RHICommandBuffer& commandBuffer);
 
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit MaterialBufferManager(const MaterialBufferManager&) = delete;
-		MaterialBufferManager& operator=(const MaterialBufferManager&) = delete;
-		void uploadDirtySlots();
-
-
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
+		typedef std::vector<RECore::uint8> ScratchBuffer;
+
 		struct BufferPool final
 		{
 			std::vector<RECore::uint32> freeSlots;
-			RERHI::RHIUniformBuffer*  uniformBuffer;	///< Memory is managed by this buffer pool instance
-			RERHI::RHIResourceGroup*  resourceGroup;	///< Memory is managed by this buffer pool instance
+			ScratchBuffer			  scratchBuffer;	///< Content of the buffer pool, uploaded into the uniform buffer of a render thread frame slot as soon as it's bound
+			RERHI::RHIUniformBuffer*  uniformBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Per render thread frame slot, created on first usage, memory is managed by this buffer pool instance
+			RERHI::RHIResourceGroup*  resourceGroups[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Per render thread frame slot, created on first usage, memory is managed by this buffer pool instance
+			RECore::uint32			  outdatedUniformBuffers;	///< Bit mask of the render thread frame slots whose uniform buffer doesn't contain the current scratch buffer content
 
-			BufferPool(RECore::uint32 bufferSize, RECore::uint32 slotsPerPool, RERHI::RHIBufferManager& bufferManager, const MaterialBlueprintResource& materialBlueprintResource);
+			BufferPool(RECore::uint32 bufferSize, RECore::uint32 slotsPerPool);
 			~BufferPool();
 		};
 
 		typedef std::vector<BufferPool*>		 BufferPools;
 		typedef std::vector<MaterialBufferSlot*> MaterialBufferSlots;
-		typedef std::vector<RECore::uint8>			 ScratchBuffer;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit MaterialBufferManager(const MaterialBufferManager&) = delete;
+		MaterialBufferManager& operator=(const MaterialBufferManager&) = delete;
+		void updateDirtySlots();
+		[[nodiscard]] RERHI::RHIResourceGroup* getResourceGroup(BufferPool& bufferPool);	// Resource group of the render thread frame slot which is currently recorded, uploads the buffer pool content if required
 
 
 	//[-------------------------------------------------------]
@@ -193,7 +197,6 @@ namespace RERenderer
 		MaterialBufferSlots				 mMaterialBufferSlots;
 		const BufferPool*				 mLastGraphicsBoundPool;
 		const BufferPool*				 mLastComputeBoundPool;
-		ScratchBuffer					 mScratchBuffer;
 
 
 	};
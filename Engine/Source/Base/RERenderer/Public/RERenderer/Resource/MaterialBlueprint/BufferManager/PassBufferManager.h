@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <RECore/Core/Manager.h>
 
 #include <RERHI/Rhi.h>
@@ -217,7 +218,7 @@ namespace RERenderer
 		const MaterialBlueprintResource&		mMaterialBlueprintResource;
 		const MaterialBlueprintResourceManager&	mMaterialBlueprintResourceManager;
 		PassData								mPassData;
-		UniformBuffers							mUniformBuffers;
+		UniformBuffers							mUniformBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< One set of uniform buffers per render thread frame slot, so they can be mapped while previous frames are still in flight
 		RECore::uint32								mCurrentUniformBufferIndex;
 		ScratchBuffer							mScratchBuffer;
 
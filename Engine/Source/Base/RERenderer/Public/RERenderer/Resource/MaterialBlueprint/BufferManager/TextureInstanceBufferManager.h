@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include <RECore/Core/Manager.h>
 #include "RERenderer/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 #include <glm/glm.hpp>
 
 
@@ -169,9 +170,9 @@ namespace RERenderer
 		IRenderer&		mRenderer;						///< Renderer instance to use
 		const RECore::uint32	mMaximumUniformBufferSize;		///< Maximum uniform buffer size in bytes
 		const RECore::uint32	mMaximumTextureBufferSize;		///< Maximum texture buffer size in bytes
-		InstanceBuffers	mInstanceBuffers;				///< Instance buffers
+		InstanceBuffers	mInstanceBuffers[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Instance buffers per render thread frame slot, so they can be mapped while previous frames are still in flight
 		// Current instance buffer related data
-		size_t			mCurrentInstanceBufferIndex;	///< Current instance buffer index, can be invalid if there's currently no current instance buffer
+		size_t			mCurrentInstanceBufferIndex;	///< Current instance buffer index inside the instance buffers of the render thread frame slot which is currently recorded, can be invalid if there's currently no current instance buffer
 		InstanceBuffer* mCurrentInstanceBuffer;			///< Current instance buffer, can be a null pointer, don't destroy the instance since this is just a reference
 		RECore::uint8*		mStartUniformBufferPointer;
 		RECore::uint8*		mCurrentUniformBufferPointer;
@@ -92,7 +92,7 @@ namespace RERenderer
 	*
 	*  @remarks
 	*    A graphics pipeline state must master the following stages in order to archive the inner wisdom:
-	*    1. Asynchronous shader building
+	*    1. Asynchronous shader building, multiple builder threads each using its own shader builder instance
 	*    2. Asynchronous shader compilation
 	*    3. Synchronous RHI implementation dispatch TODO(naetherm) Asynchronous RHI implementation dispatch if supported by the RHI implementation
 	*
@@ -121,6 +121,13 @@ namespace RERenderer
 
 		void setAsynchronousCompilationEnabled(bool enabled);
 
+		[[nodiscard]] inline RECore::uint32 getNumberOfBuilderThreads() const
+		{
+			return mNumberOfBuilderThreads;
+		}
+
+		void setNumberOfBuilderThreads(RECore::uint32 numberOfBuilderThreads);
+
 		[[nodiscard]] inline RECore::uint32 getNumberOfCompilerThreads() const
 		{
 			return mNumberOfCompilerThreads;
@@ -190,6 +197,7 @@ namespace RERenderer
 			CompilerRequest& operator=(const CompilerRequest&) = delete;
 		};
 
+		typedef std::vector<std::thread> BuilderThreads;
 		typedef std::vector<std::thread> CompilerThreads;
 		typedef std::deque<CompilerRequest> CompilerRequests;
 		typedef std::unordered_set<GraphicsProgramCacheId> InFlightGraphicsProgramCaches;
@@ -217,6 +225,7 @@ namespace RERenderer
 	private:
 		IRenderer&					  mRenderer;	///< Renderer instance, do not destroy the instance
 		bool						  mAsynchronousCompilationEnabled;
+		RECore::uint32					  mNumberOfBuilderThreads;
 		RECore::uint32					  mNumberOfCompilerThreads;
 		std::atomic<RECore::uint32>		  mNumberOfInFlightCompilerRequests;
 		std::mutex					  mInFlightGraphicsProgramCachesMutex;
@@ -227,7 +236,7 @@ namespace RERenderer
 		std::mutex				mBuilderMutex;
 		std::condition_variable	mBuilderConditionVariable;
 		CompilerRequests		mBuilderQueue;
-		std::thread				mBuilderThread;
+		BuilderThreads			mBuilderThreads;
 
 		// Asynchronous compilation (nuts cost)
 		std::atomic<bool>		mShutdownCompilerThread;
@@ -49,7 +49,7 @@ class MaterialBufferManager;
 class MaterialBlueprintResourceLoader;
 }
 namespace RECore {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -109,7 +109,7 @@ namespace RERenderer
 		friend class MaterialResourceLoader;	// TODO(naetherm) Decent material resource list management inside the material blueprint resource (link, unlink etc.) - remove this
 		friend class MaterialResourceManager;	// TODO(naetherm) Remove
 		friend class MaterialBufferManager;		// TODO(naetherm) Remove. Decent material technique list management inside the material blueprint resource (link, unlink etc.)
-		friend RECore::PackedElementManager<MaterialBlueprintResource, MaterialBlueprintResourceId, 64>;										// Type definition of template class
+		friend RECore::PagedPackedElementManager<MaterialBlueprintResource, MaterialBlueprintResourceId, 64>;										// Type definition of template class
 		friend RECore::ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>;	// Type definition of template class
 
 
@@ -274,7 +274,7 @@ namespace RERenderer
 		LightBufferManager*					mLightBufferManager;						///< Light buffer manager, always valid in a sane none-legacy environment
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>* mInternalResourceManager;	///< Resources are allocated in pages of 64 resources, not a capacity limit
 
 
 	};
@@ -53,8 +53,8 @@ PRAGMA_WARNING_POP
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace RECore {
-template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
-class PackedElementManager;
+template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
+class PagedPackedElementManager;
 
 template<class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
 class ResourceManagerTemplate;
@@ -93,7 +93,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
-		friend RECore::PackedElementManager<MeshResource, MeshResourceId, 4096>;							// Type definition of template class
+		friend RECore::PagedPackedElementManager<MeshResource, MeshResourceId, 4096>;							// Type definition of template class
 		friend RECore::ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>;	// Type definition of template class
 
 
@@ -167,6 +167,16 @@ namespace RERenderer
 			mNumberOfIndices = numberOfIndices;
 		}
 
+		[[nodiscard]] inline RECore::uint32 getNumberOfBytes() const
+		{
+			return mNumberOfBytes;
+		}
+
+		inline void setNumberOfBytes(RECore::uint32 numberOfBytes)
+		{
+			mNumberOfBytes = numberOfBytes;
+		}
+
 		[[nodiscard]] inline const RERHI::RHIVertexArrayPtr& getVertexArrayPtr() const
 		{
 			return mVertexArray;
@@ -233,6 +243,7 @@ namespace RERenderer
 			// Vertex and index data
 			mNumberOfVertices(0),
 			mNumberOfIndices(0),
+			mNumberOfBytes(0),
 			// Sub-meshes and LODs
 			mNumberOfLods(0),
 			// Optional skeleton
@@ -295,6 +306,7 @@ namespace RERenderer
 			RECore::setInvalid(mBoundingSphereRadius);
 			mNumberOfVertices = 0;
 			mNumberOfIndices = 0;
+			mNumberOfBytes = 0;
 			mVertexArray = nullptr;
 			mPositionOnlyVertexArray = nullptr;
 			mSubMeshes.clear();
@@ -318,6 +330,7 @@ namespace RERenderer
 		// Vertex and index data
 		RECore::uint32			 mNumberOfVertices;			///< Number of vertices
 		RECore::uint32			 mNumberOfIndices;			///< Number of indices
+		RECore::uint32			 mNumberOfBytes;			///< Number of vertex and index buffer bytes, 0 if unknown
 		RERHI::RHIVertexArrayPtr mVertexArray;				///< Vertex array object (VAO), can be a null pointer, directly containing also the index data of all LODs
 		RERHI::RHIVertexArrayPtr mPositionOnlyVertexArray;	///< Optional position-only vertex array object (VAO) which can reduce the number of processed vertices up to half, can be a null pointer, can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original vertex array object (VAO) uses, directly containing also the index data of all LODs
 		// Sub-meshes and LODs
@@ -119,6 +119,7 @@ namespace RERenderer
 		[[nodiscard]] virtual RECore::IResource* tryGetResourceByResourceId(RECore::ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(RECore::AssetId assetId) override;
 		virtual void update() override;
+		[[nodiscard]] virtual RECore::uint64 getNumberOfResourceBytes() const override;
 
 
 	//[-------------------------------------------------------]
@@ -144,7 +145,7 @@ namespace RERenderer
 	private:
     IRenderer& mRenderer;
 		RECore::uint8				  mNumberOfTopMeshLodsToRemove;	///< The number of top mesh LODs to remove, only has an impact while rendering and not on loading (amount of needed memory is not influenced)
-    RECore::ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>* mInternalResourceManager;	///< Resources are allocated in pages of 4096 resources, not a capacity limit
 		RERHI::RHIVertexBufferPtr mDrawIdVertexBufferPtr;		///< Draw ID vertex buffer, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
 		RERHI::RHIVertexArrayPtr  mDrawIdVertexArrayPtr;		///< Draw ID vertex array, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
 
@@ -38,6 +38,10 @@ namespace RERHI
 {
 	class IRenderTarget;
 }
+namespace RECore
+{
+	class Frustum;
+}
 namespace RERenderer
 {
 	class ISceneItem;
@@ -74,6 +78,46 @@ namespace RERenderer
 		typedef std::vector<ISceneItem*> SceneItems;	// TODO(naetherm) No raw-pointers (but no smart pointers either, use handles)
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return the number of elements a bounding sphere or visibility flag array must have for "RERenderer::SceneCullingManager::cullSpheres()"
+		*
+		*  @param[in] numberOfSpheres
+		*    Number of bounding spheres
+		*
+		*  @return
+		*    Number of spheres aligned to the SIMD lane count plus one additional SIMD lane which is touched by prefetching
+		*/
+		[[nodiscard]] static RECore::uint32 getPaddedNumberOfSpheres(RECore::uint32 numberOfSpheres);
+
+		/**
+		*  @brief
+		*    Frustum-sphere culling of SoA bounding spheres using the same SIMD kernel as the scene item culling
+		*
+		*  @param[in] frustum
+		*    Camera relative world space frustum
+		*  @param[in] worldSpaceCameraPosition
+		*    World space camera position which is subtracted from the sphere positions
+		*  @param[in] spherePositionX
+		*    World space x-positions of the bounding sphere centers, the same applies to y and z
+		*  @param[in] negativeRadius
+		*    Negative world space radius of the bounding spheres
+		*  @param[in] numberOfSpheres
+		*    Number of bounding spheres to cull
+		*  @param[out] visibilityFlag
+		*    Receives 0 for culled spheres, everything else means visible
+		*
+		*  @note
+		*    - All arrays must be aligned to "XSIMD_DEFAULT_ALIGNMENT" and must have at least "RERenderer::SceneCullingManager::getPaddedNumberOfSpheres()" elements
+		*    - Executed inside the calling thread, meant for small sets like terrain or grass tiles
+		*/
+		static void cullSpheres(const RECore::Frustum& frustum, const glm::vec3& worldSpaceCameraPosition, const float* spherePositionX, const float* spherePositionY, const float* spherePositionZ, const float* negativeRadius, RECore::uint32 numberOfSpheres, RECore::uint32* visibilityFlag);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
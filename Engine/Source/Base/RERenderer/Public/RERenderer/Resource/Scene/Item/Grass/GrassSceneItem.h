@@ -28,6 +28,26 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/Resource/Scene/Item/MaterialSceneItem.h"
+#include "RERenderer/Resource/Scene/Culling/SceneItemSet.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+	class CameraSceneItem;
+}
 
 
 //[-------------------------------------------------------]
@@ -44,8 +64,19 @@ namespace RERenderer
 	*  @brief
 	*    Grass scene item
 	*
-	*  @todo
-	*    - TODO(naetherm) Work-in-progress
+	*  @remarks
+	*    The grass blades are generated procedurally per tile on the object space xz-plane of the scene node. The tiles around the
+	*    camera are cached inside a toroidal ring buffer, moving the camera only regenerates the tiles which entered the window.
+	*    Once per frame, the tiles are culled using the SIMD frustum-sphere culling of the scene culling manager. The blades of a
+	*    tile are generated in random order, so the distance based density LOD is just a prefix of the cached tile blades which is
+	*    transformed by the scene node global transform and copied into the structured buffer consumed by the grass material.
+	*
+	*    The grass selection is view dependent, so each view identified by camera and render target gets its own structured buffer
+	*    and visible grass count. A view is updated once per frame, further passes of the same view during the frame reuse the
+	*    selection. Up to "MAXIMUM_NUMBER_OF_VIEWS" views are tracked, beyond that the least recently updated view is recycled.
+	*
+	*    The grass is placed on the object space xz-plane of the scene node, there's no CPU side terrain height query the
+	*    grass could use. On non-flat terrain, place the grass scene item on flat areas only.
 	*/
 	class GrassSceneItem final : public MaterialSceneItem
 	{
@@ -64,9 +95,69 @@ namespace RERenderer
 		static constexpr RECore::uint32 TYPE_ID = STRING_ID("GrassSceneItem");
 		struct GrassDataStruct final
 		{
-			float PositionSize[4];	// Object space grass xyz-position, w = grass size
+			float PositionSize[4];	// Rotated and scaled object space grass xyz-position relative to the owner world space position, w = grass size
 			float ColorRotation[4];	// Linear RGB grass color and rotation in radians
 		};
+		static constexpr RECore::uint32 DEFAULT_MAXIMUM_NUMBER_OF_GRASS = 65536;
+		static constexpr RECore::uint32 TILE_CACHE_SIZE = 16;	///< Number of tiles per axis of the tile ring buffer around the camera, must be even
+		static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_VIEWS = 4;	///< Maximum number of views (camera and render target) with an own grass selection
+		struct Settings final
+		{
+			float		   tileSize			   = 8.0f;							///< Object space tile edge length
+			float		   maximumDensity	   = 16.0f;							///< Number of grass blades per square unit at density map value 255
+			float		   lodStartDistance	   = 20.0f;							///< Up to this camera distance the full density is used
+			float		   maximumDistance	   = 56.0f;							///< Beyond this camera distance no grass is rendered, must not exceed the tile ring buffer extent "(TILE_CACHE_SIZE / 2 - 1) * tileSize"
+			float		   minimumSize		   = 0.5f;							///< Minimum grass blade size
+			float		   maximumSize		   = 1.0f;							///< Maximum grass blade size
+			glm::vec3	   color			   = glm::vec3(1.0f, 1.0f, 1.0f);	///< Linear RGB grass color
+			float		   colorVariation	   = 0.2f;							///< Random darkening of the grass color inside [0, 1]
+			RECore::uint32 randomSeed		   = 1;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline RECore::uint32 getMaximumNumberOfGrass() const
+		{
+			return mMaximumNumberOfGrass;
+		}
+
+		[[nodiscard]] inline RECore::uint32 getNumberOfVisibleGrass() const	// Number of grass blades selected for the last rendered view
+		{
+			return mViews[mCurrentViewIndex].numberOfVisibleGrass;
+		}
+
+		[[nodiscard]] inline const Settings& getSettings() const
+		{
+			return mSettings;
+		}
+
+		void setSettings(const Settings& settings);
+
+		/**
+		*  @brief
+		*    Set the grass density map
+		*
+		*  @param[in] width
+		*    Density map width
+		*  @param[in] height
+		*    Density map height
+		*  @param[in] densities
+		*    "width" * "height" densities, 0 = no grass, 255 = maximum density, row major with x = object space x-axis and y = object space z-axis, data is copied
+		*  @param[in] objectSpaceMinimum
+		*    Object space xz-position the density map starts at
+		*  @param[in] objectSpaceSize
+		*    Object space xz-extent covered by the density map, outside the density map there's no grass
+		*/
+		void setDensityMap(RECore::uint32 width, RECore::uint32 height, const RECore::uint8* densities, const glm::vec2& objectSpaceMinimum, const glm::vec2& objectSpaceSize);
+
+		/**
+		*  @brief
+		*    Remove the grass density map, results in maximum density everywhere
+		*/
+		void clearDensityMap();
 
 
 	//[-------------------------------------------------------]
@@ -78,14 +169,12 @@ namespace RERenderer
 			return TYPE_ID;
 		}
 
-		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
-
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERenderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
 	protected:
-		virtual void onExecuteOnRendering(const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData, RERHI::RHICommandBuffer& commandBuffer) const override;
+		virtual void onExecuteOnRendering(const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData, RERHI::RHICommandBuffer& commandBuffer) override;
 
 
 	//[-------------------------------------------------------]
@@ -109,6 +198,38 @@ namespace RERenderer
 
 		explicit GrassSceneItem(const GrassSceneItem&) = delete;
 		GrassSceneItem& operator=(const GrassSceneItem&) = delete;
+		void invalidateTiles();
+		[[nodiscard]] float getDensity(float objectSpaceX, float objectSpaceZ) const;
+		void generateTile(RECore::int32 tileX, RECore::int32 tileZ);
+		void updateGrass(RECore::uint32 viewIndex, const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Tile final
+		{
+			RECore::int32				 tileX;
+			RECore::int32				 tileZ;
+			bool						 generated;	///< If "false", the grass data is invalid and the tile must be generated before usage
+			std::vector<GrassDataStruct> grassData;	///< Grass blades of the tile in random order, meaning each prefix is an uniform subset
+		};
+		struct TileCandidate final
+		{
+			RECore::int32 tileX;
+			RECore::int32 tileZ;
+			float		  distance;	///< Distance between the camera and the tile center
+			glm::vec3	  center;	///< Camera relative world space tile center
+		};
+		struct View final
+		{
+			const CameraSceneItem*		  cameraSceneItem;			///< Camera of the view, only used as key, can be a null pointer
+			const RERHI::RHIRenderTarget* renderTarget;				///< Render target of the view, only used as key, null pointer for an unused view
+			RECore::uint64				  lastUpdateFrameNumber;	///< Number of the rendered frame the view was updated the last time
+			RECore::uint32				  numberOfVisibleGrass;		///< Number of grass blades written into the structured buffer of the view
+			RERHI::RHIStructuredBufferPtr structuredBufferPtrs[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Structured buffers the data of the individual grass ("RERenderer::GrassSceneItem::GrassDataStruct") per render thread frame slot, created on first usage
+		};
 
 
 	//[-------------------------------------------------------]
@@ -116,8 +237,25 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
 		RECore::uint32				  mMaximumNumberOfGrass;	///< Maximum number of grass
-		RERHI::RHIStructuredBufferPtr mStructuredBufferPtr;		///< Structured buffer the data of the individual grass ("RERenderer::GrassSceneItem::GrassDataStruct")
-		RERHI::RHIIndirectBufferPtr   mIndirectBufferPtr;		///< Indirect buffer holding data related to the current grass "RERHI::DrawArguments" draw call
+		View						  mViews[MAXIMUM_NUMBER_OF_VIEWS];
+		RECore::uint32				  mCurrentViewIndex;		///< Index of the view whose structured buffer the material techniques currently use
+		RECore::uint32				  mCurrentFrameIndex;		///< Index of the render thread frame slot whose structured buffer the material techniques currently use
+		Settings					  mSettings;
+		// Density map
+		RECore::uint32				mDensityMapWidth;
+		RECore::uint32				mDensityMapHeight;
+		std::vector<RECore::uint8>	mDensityMap;	///< Empty if there's no density map
+		glm::vec2					mDensityMapObjectSpaceMinimum;
+		glm::vec2					mDensityMapObjectSpaceSize;
+		// Tile ring buffer
+		Tile						mTiles[TILE_CACHE_SIZE * TILE_CACHE_SIZE];	///< Tile (x, z) is stored at index "(z mod TILE_CACHE_SIZE) * TILE_CACHE_SIZE + (x mod TILE_CACHE_SIZE)"
+		// Per rendering tile culling, SoA to be able to use the SIMD culling
+		std::vector<TileCandidate>	mTileCandidates;
+		SceneItemSet::FloatVector	mTileSpherePositionX;	///< Camera relative world space tile bounding sphere center
+		SceneItemSet::FloatVector	mTileSpherePositionY;
+		SceneItemSet::FloatVector	mTileSpherePositionZ;
+		SceneItemSet::FloatVector	mTileNegativeRadius;
+		SceneItemSet::IntegerVector	mTileVisibilityFlag;
 
 
 	};
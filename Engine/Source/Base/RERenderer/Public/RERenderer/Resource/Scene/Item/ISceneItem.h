@@ -70,7 +70,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 		friend class SceneNode;						// TODO(naetherm) Remove this
 		friend class MeshSceneItem;					// TODO(naetherm) Remove this
-		friend class SceneResource;					// Needs to be able to destroy scene items
+		friend class SceneResource;					// Needs to be able to destroy scene items and to call "RERenderer::ISceneItem::onUpdate()"
 		friend class CompositorWorkspaceInstance;	// Needs to be able to call "RERenderer::ISceneItem::onExecuteOnRendering()"
 
 
@@ -117,6 +117,11 @@ namespace RERenderer
 			return mCallExecuteOnRendering;
 		}
 
+		[[nodiscard]] inline bool getCallUpdate() const
+		{
+			return mCallUpdate;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RERenderer::ISceneItem methods           ]
@@ -152,12 +157,18 @@ namespace RERenderer
 	//[ Protected virtual RERenderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
 	protected:
-		// Only called if "RERenderer::ISceneItem::getCallExecuteOnRendering()" returns "true", the default implementation is empty and shouldn't be called
-		inline virtual void onExecuteOnRendering([[maybe_unused]] const RERHI::RHIRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] RERHI::RHICommandBuffer& commandBuffer) const
+		// Only called if "RERenderer::ISceneItem::getCallExecuteOnRendering()" returns "true", called once per compositor workspace execution in which the scene item is visible, the default implementation is empty and shouldn't be called
+		inline virtual void onExecuteOnRendering([[maybe_unused]] const RERHI::RHIRenderTarget& renderTarget, [[maybe_unused]] const CompositorContextData& compositorContextData, [[maybe_unused]] RERHI::RHICommandBuffer& commandBuffer)
 		{
 			ASSERT(true, "Don't call the base implementation of \"RERenderer::ISceneItem::getCallExecuteOnRendering()\"")
 		}
 
+		// Only called if "RERenderer::ISceneItem::getCallUpdate()" returns "true", called once per frame after the global transforms have been updated, the default implementation is empty and shouldn't be called
+		inline virtual void onUpdate([[maybe_unused]] float pastSecondsSinceLastFrame)
+		{
+			ASSERT(true, "Don't call the base implementation of \"RERenderer::ISceneItem::onUpdate()\"")
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -173,6 +184,11 @@ namespace RERenderer
 			mCallExecuteOnRendering = callExecuteOnRendering;
 		}
 
+		inline void setCallUpdate(bool callUpdate)
+		{
+			mCallUpdate = callUpdate;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -183,6 +199,7 @@ namespace RERenderer
 		SceneItemSet*  mSceneItemSet;			///< Scene item set, always valid, don't destroy the instance
 		RECore::uint32	   mSceneItemSetIndex;		///< Index inside the scene item set
 		bool		   mCallExecuteOnRendering;	///< Call execute on rendering? ("RERenderer::ISceneItem::onExecuteOnRendering()") Keep this disabled if not needed not waste performance.
+		bool		   mCallUpdate;				///< Call update once per frame? ("RERenderer::ISceneItem::onUpdate()") Keep this disabled if not needed not waste performance.
 
 
 	};
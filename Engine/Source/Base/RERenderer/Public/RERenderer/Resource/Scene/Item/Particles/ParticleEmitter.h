@@ -0,0 +1,252 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERenderer/RERenderer.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4100)	// warning C4100: 'address': unreferenced formal parameter
+	PRAGMA_WARNING_DISABLE_MSVC(4242)	// warning C4242: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4244)	// warning C4244: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'RECore::uint32' to 'RECore::int32', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	PRAGMA_WARNING_DISABLE_MSVC(4530)	// warning C4530: C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// TODO(naetherm) How to use xsimd correctly to get rid of errors like "error C2440: 'initializing': cannot convert from 'xsimd::simd_batch_traits<xsimd::batch<float,8>>::batch_bool_type' to 'xsimd::batch_bool<float,4>'" when using "Advanced Vector Extensions 2 (/arch:AVX2)"?
+	#include <xsimd/xsimd.hpp>
+PRAGMA_WARNING_POP
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERenderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    CPU particle emitter
+	*
+	*  @remarks
+	*    The particles are stored as structure of arrays (SoA) so the integration can be done via SIMD. Dead particles are
+	*    removed by moving the last alive particle into their slot, meaning the alive particles are always tightly packed
+	*    inside the range [0, "RERenderer::ParticleEmitter::getNumberOfParticles()"). Positions are in object space.
+	*
+	*    The particle emitter has no dependencies to the RHI or the renderer instance and can be simulated headless.
+	*    Different particle emitter instances can be updated concurrently.
+	*/
+	class RERENDERER_API ParticleEmitter final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		struct ParticleDataStruct final
+		{
+			float PositionSize[4];	// Rotated and scaled object space particle xyz-position relative to the owner world space position, w = particle size
+			float Color[4];			// Linear space RGB particle color and opacity
+		};
+		struct Settings final
+		{
+			float	  emissionRate		= 64.0f;							///< Number of emitted particles per second
+			float	  minimumLifetime	= 1.0f;								///< Minimum particle lifetime in seconds, must be >0
+			float	  maximumLifetime	= 2.0f;								///< Maximum particle lifetime in seconds, must be >= minimum lifetime
+			glm::vec3 position			= glm::vec3(0.0f, 0.0f, 0.0f);		///< Object space emitter position
+			float	  emissionRadius	= 0.0f;								///< Particles are emitted inside a box of this half size around the emitter position
+			glm::vec3 velocity			= glm::vec3(0.0f, 2.0f, 0.0f);		///< Initial particle velocity
+			glm::vec3 velocitySpread	= glm::vec3(0.5f, 0.5f, 0.5f);		///< Random per axis offset in [-spread, spread] added to the initial particle velocity
+			glm::vec3 acceleration		= glm::vec3(0.0f, -9.81f, 0.0f);	///< Constant acceleration, usually gravity
+			float	  drag				= 0.0f;								///< Linear velocity damping per second, 0 = no drag
+			float	  startSize			= 0.1f;								///< Particle size at the beginning of its lifetime
+			float	  endSize			= 0.1f;								///< Particle size at the end of its lifetime
+			glm::vec4 startColor		= glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);	///< Linear space RGBA particle color at the beginning of its lifetime
+			glm::vec4 endColor			= glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);	///< Linear space RGBA particle color at the end of its lifetime
+		};
+		typedef std::vector<float, xsimd::aligned_allocator<float, XSIMD_DEFAULT_ALIGNMENT>> FloatVector;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		explicit ParticleEmitter(RECore::uint32 maximumNumberOfParticles, RECore::uint32 randomSeed = 1);
+
+		inline ~ParticleEmitter()
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline const Settings& getSettings() const
+		{
+			return mSettings;
+		}
+
+		inline void setSettings(const Settings& settings)
+		{
+			mSettings = settings;
+		}
+
+		[[nodiscard]] inline RECore::uint32 getMaximumNumberOfParticles() const
+		{
+			return mMaximumNumberOfParticles;
+		}
+
+		[[nodiscard]] inline RECore::uint32 getNumberOfParticles() const
+		{
+			return mNumberOfParticles;
+		}
+
+		[[nodiscard]] inline bool isEmitting() const
+		{
+			return mEmitting;
+		}
+
+		inline void setEmitting(bool emitting)
+		{
+			mEmitting = emitting;
+		}
+
+		/**
+		*  @brief
+		*    Kill all particles
+		*/
+		void clear();
+
+		/**
+		*  @brief
+		*    Simulate the particles
+		*
+		*  @param[in] pastSeconds
+		*    Past seconds since the last update
+		*
+		*  @note
+		*    - Ages the particles, removes dead particles, integrates velocity and position and finally emits new particles
+		*/
+		void update(float pastSeconds);
+
+		/**
+		*  @brief
+		*    Write the alive particles into the given destination
+		*
+		*  @param[out] particleData
+		*    Destination receiving "RERenderer::ParticleEmitter::getNumberOfParticles()" particles, usually a mapped structured buffer
+		*  @param[in] rotationScale
+		*    Rotation and scale applied to the object space particle positions, usually the rotation and scale of the owning scene node global transform
+		*
+		*  @note
+		*    - Evaluates the size and color over lifetime curves
+		*    - The translation isn't applied since the shader adds the camera relative world position of the owner, the particle size is scaled by the largest scale axis
+		*/
+		void fillParticleData(ParticleDataStruct* particleData, const glm::mat3& rotationScale = glm::mat3(1.0f)) const;
+
+		// SoA data access, the arrays are padded to the SIMD lane count
+		[[nodiscard]] inline const float* getPositionX() const
+		{
+			return mPositionX.data();
+		}
+
+		[[nodiscard]] inline const float* getPositionY() const
+		{
+			return mPositionY.data();
+		}
+
+		[[nodiscard]] inline const float* getPositionZ() const
+		{
+			return mPositionZ.data();
+		}
+
+		[[nodiscard]] inline const float* getAge() const
+		{
+			return mAge.data();
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] inline float getRandomFloat()
+		{
+			// Xorshift32, returns a value inside [0, 1)
+			mRandomState ^= mRandomState << 13;
+			mRandomState ^= mRandomState >> 17;
+			mRandomState ^= mRandomState << 5;
+			return static_cast<float>(mRandomState >> 8) * (1.0f / 16777216.0f);
+		}
+
+		void removeDeadParticles();
+		void integrateParticles(float pastSeconds);
+		void emitParticles(float pastSeconds);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Settings	   mSettings;
+		RECore::uint32 mMaximumNumberOfParticles;
+		RECore::uint32 mNumberOfParticles;
+		RECore::uint32 mRandomState;
+		float		   mEmissionAccumulator;	///< Fractional number of particles to emit, carried over to the next update
+		bool		   mEmitting;
+		// Particles SoA
+		FloatVector mPositionX;
+		FloatVector mPositionY;
+		FloatVector mPositionZ;
+		FloatVector mVelocityX;
+		FloatVector mVelocityY;
+		FloatVector mVelocityZ;
+		FloatVector mAge;				///< Age in seconds
+		FloatVector mInverseLifetime;	///< 1 / lifetime in seconds, a particle is dead as soon as "age * inverse lifetime >= 1"
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERenderer
@@ -28,6 +28,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERenderer/Resource/Scene/Item/MaterialSceneItem.h"
+#include "RERenderer/Resource/Scene/Item/Particles/ParticleEmitter.h"
+#include "RERenderer/Core/Renderer/RenderThread.h"
 
 
 //[-------------------------------------------------------]
@@ -44,8 +46,14 @@ namespace RERenderer
 	*  @brief
 	*    Particles scene item
 	*
+	*  @remarks
+	*    The particles are simulated on the CPU by the particle emitters of the scene item, see "RERenderer::ParticleEmitter".
+	*    Multiple particle emitters are updated in parallel using the default thread pool once per frame inside the scene item
+	*    update, the result is written directly into the structured buffer consumed by the particles material. The object space
+	*    particle positions are rotated and scaled by the scene node global transform.
+	*
 	*  @todo
-	*    - TODO(naetherm) Particles rendering part is implemented, implement GPU based particles simulation as well
+	*    - TODO(naetherm) Implement GPU based particles simulation as well
 	*/
 	class ParticlesSceneItem final : public MaterialSceneItem
 	{
@@ -62,11 +70,62 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	public:
 		static constexpr RECore::uint32 TYPE_ID = STRING_ID("ParticlesSceneItem");
-		struct ParticleDataStruct final
+		static constexpr RECore::uint32 DEFAULT_MAXIMUM_NUMBER_OF_PARTICLES = 16384;
+		typedef ParticleEmitter::ParticleDataStruct ParticleDataStruct;
+		typedef std::vector<ParticleEmitter> ParticleEmitters;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline RECore::uint32 getMaximumNumberOfParticles() const
 		{
-			float PositionSize[4];	// Object space particle xyz-position, w = particle size
-			float Color[4];			// Linear space RGB particle color and opacity
-		};
+			return mMaximumNumberOfParticles;
+		}
+
+		[[nodiscard]] inline const ParticleEmitters& getParticleEmitters() const
+		{
+			return mParticleEmitters;
+		}
+
+		[[nodiscard]] inline RECore::uint32 getNumberOfParticleEmitters() const
+		{
+			return static_cast<RECore::uint32>(mParticleEmitters.size());
+		}
+
+		[[nodiscard]] inline const ParticleEmitter& getParticleEmitter(RECore::uint32 index) const
+		{
+			ASSERT(index < mParticleEmitters.size(), "Invalid particle emitter index")
+			return mParticleEmitters[index];
+		}
+
+		[[nodiscard]] inline ParticleEmitter& getParticleEmitter(RECore::uint32 index)	// Don't keep the reference, it's invalidated as soon as a particle emitter is added
+		{
+			ASSERT(index < mParticleEmitters.size(), "Invalid particle emitter index")
+			return mParticleEmitters[index];
+		}
+
+		/**
+		*  @brief
+		*    Add a particle emitter
+		*
+		*  @param[in] maximumNumberOfParticles
+		*    Maximum number of particles of the particle emitter, the sum over all particle emitters must not exceed "RERenderer::ParticlesSceneItem::getMaximumNumberOfParticles()"
+		*
+		*  @return
+		*    Index of the created particle emitter, use "RERenderer::ParticlesSceneItem::getParticleEmitter()" to access it, stays valid until "RERenderer::ParticlesSceneItem::removeAllParticleEmitters()" is called;
+		*    "RECore::getInvalid<RECore::uint32>()" if the particle emitter exceeds the remaining particle budget
+		*
+		*  @note
+		*    - The default particle emitter uses the whole particle budget, call "RERenderer::ParticlesSceneItem::removeAllParticleEmitters()" before adding own particle emitters
+		*/
+		RECore::uint32 addParticleEmitter(RECore::uint32 maximumNumberOfParticles);
+
+		inline void removeAllParticleEmitters()
+		{
+			mParticleEmitters.clear();
+		}
 
 
 	//[-------------------------------------------------------]
@@ -78,14 +137,12 @@ namespace RERenderer
 			return TYPE_ID;
 		}
 
-		[[nodiscard]] virtual const RenderableManager* getRenderableManager() const override;
-
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RERenderer::ISceneItem methods        ]
 	//[-------------------------------------------------------]
 	protected:
-		virtual void onExecuteOnRendering(const RERHI::RHIRenderTarget& renderTarget, const CompositorContextData& compositorContextData, RERHI::RHICommandBuffer& commandBuffer) const override;
+		virtual void onUpdate(float pastSecondsSinceLastFrame) override;
 
 
 	//[-------------------------------------------------------]
@@ -109,14 +166,16 @@ namespace RERenderer
 
 		explicit ParticlesSceneItem(const ParticlesSceneItem&) = delete;
 		ParticlesSceneItem& operator=(const ParticlesSceneItem&) = delete;
+		void updateParticleEmittersRange(size_t startIndex, size_t endIndex, float pastSeconds);
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		RECore::uint32				  mMaximumNumberOfParticles;	///< Maximum number of particles
-		RERHI::RHIStructuredBufferPtr mStructuredBufferPtr;			///< Structured buffer the data of the individual particles ("RERenderer::ParticlesSceneItem::ParticleDataStruct")
+		RECore::uint32				  mMaximumNumberOfParticles;	///< Maximum number of particles over all particle emitters
+		RERHI::RHIStructuredBufferPtr mStructuredBufferPtrs[RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< Structured buffers the data of the individual particles ("RERenderer::ParticlesSceneItem::ParticleDataStruct") per render thread frame slot, created on first usage
+		ParticleEmitters			  mParticleEmitters;
 
 
 	};
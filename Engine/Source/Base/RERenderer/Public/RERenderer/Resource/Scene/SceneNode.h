@@ -45,6 +45,7 @@ PRAGMA_WARNING_POP
 namespace RERenderer
 {
 	class ISceneItem;
+	class SceneResource;
 }
 
 
@@ -58,6 +59,13 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Scene node
+	*
+	*  @note
+	*    - Local transform changes are deferred, the derived global transforms are propagated once per frame by "RERenderer::SceneResource::updateGlobalTransforms()"
+	*/
 	class SceneNode final
 	{
 
@@ -92,42 +100,42 @@ namespace RERenderer
 		inline void setTransform(const RECore::Transform& transform)
 		{
 			mTransform = transform;
-			updateGlobalTransformRecursive();
+			markGlobalTransformDirty(false);
 		}
 
 		// For instant transform updates
 		inline void teleportTransform(const RECore::Transform& transform)
 		{
-			setTransform(transform);
-			mPreviousGlobalTransform = mGlobalTransform;
+			mTransform = transform;
+			markGlobalTransformDirty(true);
 		}
 
 		// For incremental position updates, 64 bit world space position
 		inline void setPosition(const glm::dvec3& position)
 		{
 			mTransform.position = position;
-			updateGlobalTransformRecursive();
+			markGlobalTransformDirty(false);
 		}
 
 		// For instant position updates, 64 bit world space position
 		inline void teleportPosition(const glm::dvec3& position)
 		{
-			setPosition(position);
-			mPreviousGlobalTransform = mGlobalTransform;
+			mTransform.position = position;
+			markGlobalTransformDirty(true);
 		}
 
 		// For incremental rotation updates
 		inline void setRotation(const glm::quat& rotation)
 		{
 			mTransform.rotation = rotation;
-			updateGlobalTransformRecursive();
+			markGlobalTransformDirty(false);
 		}
 
 		// For instant rotation updates
 		inline void teleportRotation(const glm::quat& rotation)
 		{
-			setRotation(rotation);
-			mPreviousGlobalTransform = mGlobalTransform;
+			mTransform.rotation = rotation;
+			markGlobalTransformDirty(true);
 		}
 
 		// For incremental position and rotation updates, 64 bit world space position
@@ -135,33 +143,35 @@ namespace RERenderer
 		{
 			mTransform.position = position;
 			mTransform.rotation = rotation;
-			updateGlobalTransformRecursive();
+			markGlobalTransformDirty(false);
 		}
 
 		// For instant position and rotation updates, 64 bit world space position
 		inline void teleportPositionRotation(const glm::dvec3& position, const glm::quat& rotation)
 		{
-			setPositionRotation(position, rotation);
-			mPreviousGlobalTransform = mGlobalTransform;
+			mTransform.position = position;
+			mTransform.rotation = rotation;
+			markGlobalTransformDirty(true);
 		}
 
 		// For incremental scale updates
 		inline void setScale(const glm::vec3& scale)
 		{
 			mTransform.scale = scale;
-			updateGlobalTransformRecursive();
+			markGlobalTransformDirty(false);
 		}
 
 		// For instant scale updates
 		inline void teleportScale(const glm::vec3& scale)
 		{
-			setScale(scale);
-			mPreviousGlobalTransform = mGlobalTransform;
+			mTransform.scale = scale;
+			markGlobalTransformDirty(true);
 		}
 
 		//[-------------------------------------------------------]
 		//[ Derived global transform                              ]
 		//[-------------------------------------------------------]
+		// Local transform changes are visible in here after the next "RERenderer::SceneResource::updateGlobalTransforms()" call
 		[[nodiscard]] inline const RECore::Transform& getGlobalTransform() const
 		{
 			return mGlobalTransform;
@@ -203,11 +213,14 @@ namespace RERenderer
 	//[ Protected methods                                     ]
 	//[-------------------------------------------------------]
 	protected:
-		inline explicit SceneNode(const RECore::Transform& transform) :
+		inline SceneNode(SceneResource& sceneResource, const RECore::Transform& transform) :
+			mSceneResource(sceneResource),
 			mParentSceneNode(nullptr),
 			mTransform(transform),
 			mGlobalTransform(transform),
-			mPreviousGlobalTransform(transform)
+			mPreviousGlobalTransform(transform),
+			mGlobalTransformDirty(false),
+			mTeleportGlobalTransform(false)
 		{
 			// Nothing here
 		}
@@ -226,7 +239,8 @@ namespace RERenderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
-		void updateGlobalTransformRecursive();
+		void markGlobalTransformDirty(bool teleport);
+		void updateGlobalTransform(bool teleport);
 		void updateSceneItemTransform(ISceneItem& sceneItem);
 
 
@@ -234,12 +248,15 @@ namespace RERenderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
+		SceneResource&	   mSceneResource;				///< Owner scene resource
 		SceneNode*		   mParentSceneNode;			///< Parent scene node the scene node is attached to, can be a null pointer, don't destroy the instance
 		RECore::Transform		   mTransform;					///< Local transform
-		RECore::Transform		   mGlobalTransform;			///< Derived global transform - TODO(naetherm) Will of course later on be handled in another way to be cache efficient and more efficient to calculate and incrementally update. But lets start simple.
+		RECore::Transform		   mGlobalTransform;			///< Derived global transform, updated by the depth sorted transform propagation of the owner scene resource
 		RECore::Transform		   mPreviousGlobalTransform;	///< Previous derived global transform
 		AttachedSceneNodes mAttachedSceneNodes;
 		AttachedSceneItems mAttachedSceneItems;
+		bool			   mGlobalTransformDirty;		///< "true" if the local transform was changed since the last global transform propagation, else "false"
+		bool			   mTeleportGlobalTransform;	///< "true" if the previous global transform should be set to the new global transform during the next global transform propagation, else "false"
 
 
 	};
@@ -59,7 +59,7 @@ class SceneCullingManager;
 class SceneResourceLoader;
 }
 namespace RECore {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -88,8 +88,9 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
+		friend class SceneNode;																		// Marks the global transforms and the transform hierarchy as dirty
 		friend class SceneResourceManager;															// Needs to be able to update the scene factory instance
-		friend RECore::PackedElementManager<SceneResource, SceneResourceId, 16>;							// Type definition of template class
+		friend RECore::PagedPackedElementManager<SceneResource, SceneResourceId, 16>;							// Type definition of template class
 		friend RECore::ResourceManagerTemplate<SceneResource, SceneResourceLoader, SceneResourceId, 16>;	// Type definition of template class
 
 
@@ -128,6 +129,17 @@ namespace RERenderer
 			return mSceneNodes;
 		}
 
+		/**
+		*  @brief
+		*    Propagate the deferred local transform changes of the scene nodes into the derived global transforms and the scene item set culling arrays
+		*
+		*  @note
+		*    - Scene nodes are processed depth level by depth level using a depth sorted structure-of-arrays (SoA) hierarchy, the scene nodes of a depth level are processed in parallel
+		*    - Automatically called once per frame before culling, only call it manually if up-to-date global transforms are needed earlier
+		*    - Cheap if no scene node was changed since the last call
+		*/
+		void updateGlobalTransforms();
+
 		//[-------------------------------------------------------]
 		//[ Item                                                  ]
 		//[-------------------------------------------------------]
@@ -154,7 +166,9 @@ namespace RERenderer
 	private:
 		inline SceneResource() :
 			mSceneFactory(nullptr),
-			mSceneCullingManager(nullptr)
+			mSceneCullingManager(nullptr),
+			mTransformHierarchyDirty(false),
+			mGlobalTransformsDirty(false)
 		{
 			// Nothing here
 		}
@@ -181,6 +195,12 @@ namespace RERenderer
 			std::swap(mSceneCullingManager, sceneResource.mSceneCullingManager);
 			std::swap(mSceneNodes, sceneResource.mSceneNodes);
 			std::swap(mSceneItems, sceneResource.mSceneItems);
+			std::swap(mTransformHierarchyDirty, sceneResource.mTransformHierarchyDirty);
+			std::swap(mGlobalTransformsDirty, sceneResource.mGlobalTransformsDirty);
+			std::swap(mSortedSceneNodes, sceneResource.mSortedSceneNodes);
+			std::swap(mSortedParentIndices, sceneResource.mSortedParentIndices);
+			std::swap(mSortedDirtyFlags, sceneResource.mSortedDirtyFlags);
+			std::swap(mDepthLevelOffsets, sceneResource.mDepthLevelOffsets);
 
 			// Done
 			return *this;
@@ -192,6 +212,17 @@ namespace RERenderer
 		void initializeElement(SceneResourceId sceneResourceId);
 		void deinitializeElement();
 
+		//[-------------------------------------------------------]
+		//[ Global transform propagation                          ]
+		//[-------------------------------------------------------]
+		void rebuildTransformHierarchy();
+		void updateGlobalTransformsRange(size_t startIndex, size_t endIndex);
+
+		//[-------------------------------------------------------]
+		//[ Item update                                           ]
+		//[-------------------------------------------------------]
+		void updateSceneItems(float pastSecondsSinceLastFrame);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -201,6 +232,13 @@ namespace RERenderer
 		SceneCullingManager* mSceneCullingManager;	///< Scene culling manager, always valid, destroy the instance if you no longer need it
 		SceneNodes			 mSceneNodes;
 		SceneItems			 mSceneItems;
+		bool				 mTransformHierarchyDirty;	///< "true" if scene nodes were created, destroyed, attached or detached since the last transform hierarchy rebuild, else "false"
+		bool				 mGlobalTransformsDirty;	///< "true" if at least one scene node has a dirty global transform, else "false"
+		// Depth sorted structure-of-arrays (SoA) transform hierarchy, parents are always in front of their children
+		SceneNodes					mSortedSceneNodes;		///< Scene nodes sorted by depth level, don't destroy the instances
+		std::vector<RECore::uint32> mSortedParentIndices;	///< Index of the parent scene node inside "mSortedSceneNodes", invalid index for root scene nodes
+		std::vector<RECore::uint8>	mSortedDirtyFlags;		///< Dirty flags of the current global transform propagation, see "RERenderer::SceneResource::updateGlobalTransformsRange()"
+		std::vector<RECore::uint32> mDepthLevelOffsets;		///< Start index of each depth level inside "mSortedSceneNodes", the last entry is the total number of sorted scene nodes
 
 
 	};
@@ -108,10 +108,7 @@ namespace RERenderer
 		[[nodiscard]] virtual RECore::IResource* tryGetResourceByResourceId(RECore::ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(RECore::AssetId assetId) override;
 
-		inline virtual void update() override
-		{
-			// Nothing here
-		}
+		virtual void update() override;
 
 
 	//[-------------------------------------------------------]
@@ -139,7 +136,7 @@ namespace RERenderer
 		const ISceneFactory* mSceneFactory;	///< Scene factory, always valid, do not destroy the instance
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<SceneResource, SceneResourceLoader, SceneResourceId, 16>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<SceneResource, SceneResourceLoader, SceneResourceId, 16>* mInternalResourceManager;	///< Resources are allocated in pages of 16 resources, not a capacity limit
 
 
 	};
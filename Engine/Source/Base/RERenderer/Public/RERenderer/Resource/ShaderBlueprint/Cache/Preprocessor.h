@@ -67,12 +67,12 @@ namespace RERenderer
 	*    A simple interface for the shader preprocessor
 	*
 	*  @note
-	*    - Internally MojoShader ( https://icculus.org/mojoshader/ ) is used
-	*    - Possible alternatives to MojoShader if we later on want to get rid of it:
-	*      - "fcpp" "Frexx C preprocessor" ( https://github.com/bagder/fcpp )
-	*      - "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ )
-	*      - https://github.com/lpsantil/ucpp
-	*      - https://github.com/danmar/simplecpp
+	*    - Lightweight single pass preprocessor working directly on the source string, there's no external library involved
+	*    - Supported directives: "#define" (object-like and function-like including "#" and "##"), "#undef", "#if", "#ifdef",
+	*      "#ifndef", "#elif", "#else", "#endif" and "#error"
+	*    - "#version", "#extension", "#pragma" and "#line" are passed through unchanged since the shader compiler needs them
+	*    - "#include" isn't supported, shader pieces are included via the shader builder "@includepiece" instruction
+	*    - Comments are stripped while the number of lines is preserved so shader compiler error line numbers stay valid
 	*/
 	class Preprocessor final
 	{
@@ -91,7 +91,7 @@ namespace RERenderer
 		*  @param[in] source
 		*    Source string
 		*  @param[out] result
-		*    Receives the processed code
+		*    Receives the processed code, empty on error
 		*/
 		static void preprocess(const IRenderer& renderer, std::string& source, std::string& result);
 
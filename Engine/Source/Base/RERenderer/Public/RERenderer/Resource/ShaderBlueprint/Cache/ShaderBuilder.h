@@ -42,6 +42,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#include <map>
 	#include <string>
+	#include <unordered_map>
 PRAGMA_WARNING_POP
 
 
@@ -71,6 +72,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	typedef RECore::StringId						AssetId;				///< Asset identifier, internally just a POD "RECore::uint32", string ID scheme is "<project name>/<asset directory>/<asset name>"
 	typedef std::vector<AssetId>			AssetIds;
+	typedef RECore::uint32					ShaderPieceResourceId;	///< POD shader piece resource identifier
 	typedef std::map<RECore::uint32, std::string> DynamicShaderPieces;	///< Key is "RERenderer::StringId"	// TODO(naetherm) Visual Studio 2017: "std::unordered_map" appears to have an inefficient assignment operator which does memory handling even if containers are empty all the time, "std::map" isn't the most effective structure either but currently still better
 
 
@@ -139,6 +141,34 @@ namespace RERenderer
 		void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_EXPANDED_SHADER_PIECES = 1024;	///< When reached, the expanded shader pieces are flushed to keep the memory consumption of long living shader builder instances bounded
+
+		/**
+		*  @brief
+		*    Result of expanding an included shader piece
+		*
+		*  @note
+		*    - Shader pieces are included by many shader blueprints, so the expansion is memoized per shader builder instance
+		*    - The expansion might modify shader properties (e.g. "@set"), so the resulting shader properties are memoized as well
+		*    - The full input is stored as well and compared on a hit, a hash collision must not hand out the expansion of another input
+		*/
+		struct ExpandedShaderPiece final
+		{
+			// Input
+			ShaderPieceResourceId				 shaderPieceResourceId;
+			RECore::uint64						 assetFileHash;
+			ShaderProperties::SortedPropertyVector inputShaderProperties;
+			// Output
+			DynamicShaderPieces					 dynamicShaderPieces;
+			ShaderProperties::SortedPropertyVector shaderProperties;
+		};
+		typedef std::unordered_map<RECore::uint64, ExpandedShaderPiece> ExpandedShaderPieces;	///< Key is the FNV1a hash of shader piece resource ID, asset file hash and shader properties before the expansion
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -161,6 +191,7 @@ namespace RERenderer
 		const RERHI::RHIContext& mContext;
 		ShaderProperties	mShaderProperties;
 		DynamicShaderPieces	mDynamicShaderPieces;
+		ExpandedShaderPieces mExpandedShaderPieces;
 		std::string			mInString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 		std::string			mOutString;	///< Could be a local variable, but when making it to a member we reduce memory allocations
 
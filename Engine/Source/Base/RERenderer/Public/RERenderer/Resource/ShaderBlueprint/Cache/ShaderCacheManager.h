@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include <RECore/Core/Manager.h>
+#include <RECore/String/StringId.h>
 #include "RERenderer/Resource/ShaderBlueprint/GraphicsShaderType.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -38,6 +39,8 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
 	#include <mutex>
+	#include <atomic>	// For "std::atomic<>"
+	#include <vector>
 	#include <unordered_map>
 PRAGMA_WARNING_POP
 
@@ -188,16 +191,96 @@ namespace RERenderer
 		typedef std::unordered_map<ShaderCacheId, ShaderCache*>		  ShaderCacheByShaderCacheId;
 		typedef std::unordered_map<ShaderSourceCodeId, ShaderCacheId> ShaderCacheByShaderSourceCodeId;
 
+		/**
+		*  @brief
+		*    Shard of the shader cache maps
+		*
+		*  @remarks
+		*    Shader cache ID entries are stored inside the shard "shader cache ID % NUMBER_OF_SHARDS", shader source code ID entries inside the
+		*    shard "shader source code ID % NUMBER_OF_SHARDS". This way multiple pipeline state compiler builder threads don't serialize on one mutex.
+		*    When both a shader source code ID shard and a shader cache ID shard need to be locked, the shader source code ID shard is always locked first.
+		*/
+		struct Shard final
+		{
+			std::mutex						mutex;
+			ShaderCacheByShaderCacheId		shaderCacheByShaderCacheId;			///< Manages the shader cache instances
+			ShaderCacheByShaderSourceCodeId	shaderCacheByShaderSourceCodeId;	///< Shader source code ID to shader cache ID mapping
+		};
+		static constexpr RECore::uint32 NUMBER_OF_SHARDS = 16;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] inline Shard& getShardByShaderCacheId(ShaderCacheId shaderCacheId)
+		{
+			return mShards[shaderCacheId % NUMBER_OF_SHARDS];
+		}
+
+		[[nodiscard]] inline Shard& getShardByShaderSourceCodeId(ShaderSourceCodeId shaderSourceCodeId)
+		{
+			return mShards[shaderSourceCodeId % NUMBER_OF_SHARDS];
+		}
+
+		/**
+		*  @brief
+		*    Return a shader cache by its ID; thread-safe
+		*
+		*  @param[in] shaderCacheId
+		*    Shader cache ID
+		*
+		*  @return
+		*    The shader cache, null pointer if there's no such shader cache, don't destroy the instance
+		*/
+		[[nodiscard]] ShaderCache* tryGetShaderCacheById(ShaderCacheId shaderCacheId);
+
+		/**
+		*  @brief
+		*    Register a shader cache for a build shader source code; thread-safe
+		*
+		*  @param[in] shaderCacheId
+		*    Shader cache ID
+		*  @param[in] shaderSourceCodeId
+		*    Shader source code ID, result of hashing the build shader source code
+		*  @param[in] assetIds
+		*    IDs of the assets (shader blueprint, shader piece) which took part in the shader building
+		*  @param[in] combinedAssetFileHashes
+		*    Combination of the file hash of all assets which took part in the shader building
+		*  @param[out] isNewMasterShaderCache
+		*    Receives "true" if a new master shader cache has been created which the caller is responsible to fill with the compiled shader, else "false"
+		*
+		*  @return
+		*    The shader cache, don't destroy the instance
+		*
+		*  @remarks
+		*    Looking up and registering is done atomically, in case another thread registered the shader cache ID or the shader source code ID
+		*    meanwhile the existing instances are reused so there's never more than one master shader cache per shader source code.
+		*/
+		[[nodiscard]] ShaderCache* registerShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId, const std::vector<RECore::StringId>& assetIds, RECore::uint64 combinedAssetFileHashes, bool& isNewMasterShaderCache);
+
+		/**
+		*  @brief
+		*    Unregister and destroy a master shader cache which couldn't be compiled; thread-safe
+		*
+		*  @param[in] shaderCacheId
+		*    Shader cache ID
+		*  @param[in] shaderSourceCodeId
+		*    Shader source code ID
+		*
+		*  @note
+		*    - Only for synchronous processing, shader caches referencing the master shader cache must not exist
+		*/
+		void unregisterMasterShaderCache(ShaderCacheId shaderCacheId, ShaderSourceCodeId shaderSourceCodeId);
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
 		ShaderBlueprintResourceManager& mShaderBlueprintResourceManager;	///< Owner shader blueprint resource manager
-		ShaderCacheByShaderCacheId		mShaderCacheByShaderCacheId;		///< Manages the shader cache instances
-		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	///< Shader source code ID to shader cache ID mapping
-		bool							mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
-		std::mutex						mMutex;								///< Mutex due to "RERenderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
+		Shard							mShards[NUMBER_OF_SHARDS];			///< Shader cache maps, sharded due to "RERenderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction
+		std::atomic<bool>				mCacheNeedsSaving;					///< "true" if a cache needs saving due to changes during runtime, else "false"
 
 
 	};
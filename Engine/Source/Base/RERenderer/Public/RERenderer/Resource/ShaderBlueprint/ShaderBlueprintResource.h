@@ -49,7 +49,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace RECore
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -83,7 +83,7 @@ namespace RERenderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class ShaderBlueprintResourceLoader;
-		friend RECore::PackedElementManager<ShaderBlueprintResource, ShaderBlueprintResourceId, 128>;									// Type definition of template class
+		friend RECore::PagedPackedElementManager<ShaderBlueprintResource, ShaderBlueprintResourceId, 128>;									// Type definition of template class
 		friend RECore::ResourceManagerTemplate<ShaderBlueprintResource, ShaderBlueprintResourceLoader, ShaderBlueprintResourceId, 128>;	// Type definition of template class
 
 
@@ -186,7 +186,7 @@ namespace RERenderer
 		ShaderCacheManager mShaderCacheManager;
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<ShaderBlueprintResource, ShaderBlueprintResourceLoader, ShaderBlueprintResourceId, 128>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<ShaderBlueprintResource, ShaderBlueprintResourceLoader, ShaderBlueprintResourceId, 128>* mInternalResourceManager;	///< Resources are allocated in pages of 128 resources, not a capacity limit
 
 
 	};
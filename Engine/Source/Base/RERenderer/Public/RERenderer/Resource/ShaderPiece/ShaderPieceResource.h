@@ -48,7 +48,7 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace RECore
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
 }
 
@@ -81,7 +81,7 @@ namespace RERenderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class ShaderPieceResourceLoader;
-		friend RECore::PackedElementManager<ShaderPieceResource, ShaderPieceResourceId, 64>;								// Type definition of template class
+		friend RECore::PagedPackedElementManager<ShaderPieceResource, ShaderPieceResourceId, 64>;								// Type definition of template class
 		friend RECore::ResourceManagerTemplate<ShaderPieceResource, ShaderPieceResourceLoader, ShaderPieceResourceId, 64>;	// Type definition of template class
 
 
@@ -122,7 +122,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
 		IRenderer&																							mRenderer;
-    RECore::ResourceManagerTemplate<ShaderPieceResource, ShaderPieceResourceLoader, ShaderPieceResourceId, 64>*	mInternalResourceManager;
+    RECore::ResourceManagerTemplate<ShaderPieceResource, ShaderPieceResourceLoader, ShaderPieceResourceId, 64>*	mInternalResourceManager;	///< Resources are allocated in pages of 64 resources, not a capacity limit
 
 
 	};
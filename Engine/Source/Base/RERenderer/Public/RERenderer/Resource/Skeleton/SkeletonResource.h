@@ -40,8 +40,8 @@ PRAGMA_WARNING_POP
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace RECore {
-template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
-class PackedElementManager;
+template<class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE>
+class PagedPackedElementManager;
 
 template<class TYPE, class LOADER_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS>
 class ResourceManagerTemplate;
@@ -85,7 +85,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 		friend class MeshResourceLoader;
 		friend class SkeletonResourceLoader;
-		friend RECore::PackedElementManager<SkeletonResource, SkeletonResourceId, 2048>;							// Type definition of template class
+		friend RECore::PagedPackedElementManager<SkeletonResource, SkeletonResourceId, 2048>;							// Type definition of template class
 		friend RECore::ResourceManagerTemplate<SkeletonResource, SkeletonResourceLoader, SkeletonResourceId, 2048>;	// Type definition of template class
 
 
@@ -147,6 +147,11 @@ namespace RERenderer
 			return mBoneSpaceData;
 		}
 
+		[[nodiscard]] inline RECore::uint32 getSkeletonDataRevision() const	// Changes each time the skeleton data is set or cleared (e.g. loading, hot-reloading or resource reuse), unique across all skeleton resources, "RECore::getInvalid<RECore::uint32>()" is never used
+		{
+			return mSkeletonDataRevision;
+		}
+
 		[[nodiscard]] RECore::uint32 getBoneIndexByBoneId(RECore::uint32 boneId) const;	// Bone IDs = "RERenderer::StringId" on bone name, "RECore::getInvalid<RECore::uint32>()" if unknown bone ID
 		void localToGlobalPose();
 
@@ -162,7 +167,8 @@ namespace RERenderer
 			mLocalBoneMatrices(nullptr),
 			mBoneOffsetMatrices(nullptr),
 			mGlobalBoneMatrices(nullptr),
-			mBoneSpaceData(nullptr)
+			mBoneSpaceData(nullptr),
+			mSkeletonDataRevision(0)
 		{
 			// Nothing here
 		}
@@ -197,8 +203,11 @@ namespace RERenderer
 			mGlobalBoneMatrices = nullptr;
 			// delete [] mBoneSpaceData;		// The complete skeleton data is sequential in memory, so, deleting "mBoneParentIndices" is does it all
 			mBoneSpaceData = nullptr;
+			updateSkeletonDataRevision();
 		}
 
+		void updateSkeletonDataRevision();	// Must be called each time the skeleton data changes, invalidates caches based on the skeleton data (e.g. bone index remaps)
+
 		//[-------------------------------------------------------]
 		//[ "RERenderer::PackedElementManager" management           ]
 		//[-------------------------------------------------------]
@@ -239,6 +248,7 @@ namespace RERenderer
 		glm::mat4* mBoneOffsetMatrices;	///< Cache friendly depth-first rolled up bone offset matrices (object space to bone space), null pointer only in case of horrible error, don't free the memory because it's owned by "mBoneParentIndices"
 		glm::mat4* mGlobalBoneMatrices;	///< Cache friendly depth-first rolled up global bone matrices, null pointer only in case of horrible error, don't free the memory because it's owned by "mBoneParentIndices"
 		RECore::uint8*   mBoneSpaceData;		///< Cache friendly depth-first rolled up bone space data, null pointer only in case of horrible error, don't free the memory because it's owned by "mBoneParentIndices"
+		RECore::uint32   mSkeletonDataRevision;	///< Skeleton data revision, see "RERenderer::SkeletonResource::getSkeletonDataRevision()"
 
 
 	};
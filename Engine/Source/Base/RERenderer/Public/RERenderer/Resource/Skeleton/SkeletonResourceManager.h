@@ -119,7 +119,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
     IRenderer& mRenderer;
-    RECore::ResourceManagerTemplate<SkeletonResource, SkeletonResourceLoader, SkeletonResourceId, 2048>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<SkeletonResource, SkeletonResourceLoader, SkeletonResourceId, 2048>* mInternalResourceManager;	///< Resources are allocated in pages of 2048 resources, not a capacity limit
 
 
 	};
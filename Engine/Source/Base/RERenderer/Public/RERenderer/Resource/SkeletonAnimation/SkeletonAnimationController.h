@@ -31,6 +31,14 @@
 #include <RECore/Utility/GetInvalid.h>
 #include <RECore/Resource/IResourceListener.h>
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -38,6 +46,8 @@
 namespace RERenderer
 {
 	class IRenderer;
+	class SkeletonResource;
+	class RenderableManager;
 	class SkeletonAnimationEvaluator;
 }
 
@@ -68,8 +78,6 @@ namespace RERenderer
 	*    - TODO(naetherm) Right now only a single skeleton animation at one and the same time is supported to have something to start with.
 	*               This isn't practical, of course, and in reality one has multiple animation sources at one and the same time which
 	*               are blended together. But well, as mentioned, one has to start somewhere.
-	*    - TODO(naetherm) Currently "Renderer::SkeletonAnimationEvaluator" is directly used, probably it makes sense to manage those
-	*               and then update all of them in parallel using multithreading
 	*    - TODO(naetherm) It might make sense to let the skeleton animation resource manager manage skeleton animation controller instances as well
 	*/
 	class SkeletonAnimationController final : public RECore::IResourceListener
@@ -100,7 +108,10 @@ namespace RERenderer
 			mSkeletonResourceId(skeletonResourceId),
 			mSkeletonAnimationResourceId(RECore::getInvalid<SkeletonAnimationResourceId>()),
 			mSkeletonAnimationEvaluator(nullptr),
-			mTimeInSeconds(0.0f)
+			mTimeInSeconds(0.0f),
+			mBoneIndicesSkeletonDataRevision(RECore::getInvalid<RECore::uint32>()),
+			mRenderableManager(nullptr),
+			mNumberOfSkippedFrames(0)
 		{
 			// Nothing here
 		}
@@ -138,6 +149,33 @@ namespace RERenderer
 		*/
 		void clear();
 
+		/**
+		*  @brief
+		*    Return the ID of the controlled skeleton resource
+		*
+		*  @return
+		*    The ID of the controlled skeleton resource
+		*/
+		[[nodiscard]] inline SkeletonResourceId getSkeletonResourceId() const
+		{
+			return mSkeletonResourceId;
+		}
+
+		/**
+		*  @brief
+		*    Set the renderable manager whose cached distance to camera is used for the update rate LOD
+		*
+		*  @param[in] renderableManager
+		*    Renderable manager to use, can be a null pointer (= always update at full rate), must stay valid as long as it's set
+		*
+		*  @see
+		*    - "RERenderer::SkeletonAnimationResourceManager::setUpdateRateLodDistance()"
+		*/
+		inline void setRenderableManager(const RenderableManager* renderableManager)
+		{
+			mRenderableManager = renderableManager;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RECore::IResourceListener methods ]
@@ -154,6 +192,7 @@ namespace RERenderer
 		SkeletonAnimationController& operator=(const SkeletonAnimationController&) = delete;
 		void createSkeletonAnimationEvaluator();
 		void destroySkeletonAnimationEvaluator();
+		void updateBoneIndices(const SkeletonResource& skeletonResource);
 
 		/**
 		*  @brief
@@ -161,8 +200,15 @@ namespace RERenderer
 		*
 		*  @param[in] pastSecondsSinceLastFrame
 		*    Past seconds since last frame
+		*  @param[in] updateRateLodDistance
+		*    World space distance to camera after which one additional frame is skipped between two evaluations, zero to disable the update rate LOD
+		*  @param[in] maximumNumberOfSkippedFrames
+		*    Maximum number of frames to skip between two evaluations
+		*
+		*  @note
+		*    - Called concurrently by the skeleton animation resource manager, controllers of one and the same skeleton resource are always updated by the same thread
 		*/
-		void update(float pastSecondsSinceLastFrame);
+		void update(float pastSecondsSinceLastFrame, float updateRateLodDistance, RECore::uint8 maximumNumberOfSkippedFrames);
 
 
 	//[-------------------------------------------------------]
@@ -174,6 +220,10 @@ namespace RERenderer
 		SkeletonAnimationResourceId mSkeletonAnimationResourceId;	///< Skeleton animation resource ID, can be set to invalid value
 		SkeletonAnimationEvaluator* mSkeletonAnimationEvaluator;	///< Skeleton animation evaluator instance, can be a null pointer, destroy the instance if you no longer need it
 		float						mTimeInSeconds;					///< Time in seconds
+		std::vector<RECore::uint32> mBoneIndices;					///< Skeleton bone index per skeleton animation evaluator channel, built once per skeleton animation evaluator and skeleton data revision, invalid index for unknown bones
+		RECore::uint32				mBoneIndicesSkeletonDataRevision;	///< Skeleton data revision the bone indices were built for, "RECore::getInvalid<RECore::uint32>()" if they need to be built
+		const RenderableManager*	mRenderableManager;				///< Renderable manager providing the cached distance to camera for the update rate LOD, can be a null pointer, don't destroy the instance
+		RECore::uint8				mNumberOfSkippedFrames;			///< Number of frames skipped since the last evaluation due to the update rate LOD
 
 
 	};
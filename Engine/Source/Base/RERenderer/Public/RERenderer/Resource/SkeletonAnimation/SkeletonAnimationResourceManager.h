@@ -87,6 +87,31 @@ namespace RERenderer
 		[[nodiscard]] SkeletonAnimationResourceId createSkeletonAnimationResourceByAssetId(RECore::AssetId assetId);	// Skeleton animation resource is not allowed to exist, yet
 		void setInvalidResourceId(SkeletonAnimationResourceId& skeletonAnimationResourceId, RECore::IResourceListener& resourceListener) const;
 
+		/**
+		*  @brief
+		*    Set the update rate LOD for skeleton animation controllers with a renderable manager
+		*
+		*  @param[in] distance
+		*    World space distance to camera after which one additional frame is skipped between two evaluations, zero to disable the update rate LOD (default)
+		*  @param[in] maximumNumberOfSkippedFrames
+		*    Maximum number of frames to skip between two evaluations
+		*/
+		inline void setUpdateRateLodDistance(float distance, RECore::uint8 maximumNumberOfSkippedFrames = 3)
+		{
+			mUpdateRateLodDistance = distance;
+			mMaximumNumberOfSkippedFrames = maximumNumberOfSkippedFrames;
+		}
+
+		[[nodiscard]] inline float getUpdateRateLodDistance() const
+		{
+			return mUpdateRateLodDistance;
+		}
+
+		[[nodiscard]] inline RECore::uint8 getMaximumNumberOfSkippedFrames() const
+		{
+			return mMaximumNumberOfSkippedFrames;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RECore::IResourceManager methods     ]
@@ -115,6 +140,7 @@ namespace RERenderer
 		virtual ~SkeletonAnimationResourceManager() override;
 		explicit SkeletonAnimationResourceManager(const SkeletonAnimationResourceManager&) = delete;
 		SkeletonAnimationResourceManager& operator=(const SkeletonAnimationResourceManager&) = delete;
+		void updateSkeletonAnimationControllers(size_t startIndex, size_t endIndex, float pastSecondsSinceLastFrame);
 
 
 	//[-------------------------------------------------------]
@@ -130,7 +156,10 @@ namespace RERenderer
 	private:
     IRenderer& mRenderer;
 		SkeletonAnimationControllers mSkeletonAnimationControllers;	///< Don't destroy the instanced, they are not owned here
-    RECore::ResourceManagerTemplate<SkeletonAnimationResource, SkeletonAnimationResourceLoader, SkeletonAnimationResourceId, 2048>* mInternalResourceManager;
+		bool						 mSkeletonAnimationControllersSorted;	///< "true" if the skeleton animation controllers are sorted by skeleton resource ID, else "false"
+		float						 mUpdateRateLodDistance;		///< World space distance to camera after which one additional frame is skipped between two evaluations, zero if the update rate LOD is disabled
+		RECore::uint8				 mMaximumNumberOfSkippedFrames;	///< Maximum number of frames to skip between two evaluations
+    RECore::ResourceManagerTemplate<SkeletonAnimationResource, SkeletonAnimationResourceLoader, SkeletonAnimationResourceId, 2048>* mInternalResourceManager;	///< Resources are allocated in pages of 2048 resources, not a capacity limit
 
 
 	};
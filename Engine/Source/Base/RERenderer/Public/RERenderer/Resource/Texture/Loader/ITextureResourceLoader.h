@@ -110,7 +110,8 @@ namespace RERenderer
 			IResourceLoader(resourceManager),
 			mRenderer(renderer),
 			mTextureResource(nullptr),
-			mTexture(nullptr)
+			mTexture(nullptr),
+			mNumberOfTextureBytes(0)
 		{
 			// Nothing here
 		}
@@ -131,6 +132,7 @@ namespace RERenderer
 		IRenderer&		 mRenderer;			///< Renderer instance, do not destroy the instance
 		TextureResource* mTextureResource;	///< Destination resource
 		RERHI::RHITexture*	 mTexture;			///< In case the used RHI implementation supports native multithreading we also create the RHI resource asynchronous, but the final resource pointer reassignment must still happen synchronous
+		RECore::uint32	 mNumberOfTextureBytes;	///< Estimated number of bytes of the RHI texture data, set by the concrete texture resource loader, 0 if unknown
 
 
 	};
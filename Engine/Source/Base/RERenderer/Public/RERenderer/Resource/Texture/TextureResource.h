@@ -38,7 +38,7 @@ namespace RERenderer {
 class TextureResource;
 }
 namespace RECore {
-	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, RECore::uint32 NUMBER_OF_ELEMENTS_PER_PAGE> class PagedPackedElementManager;
 }
 
 
@@ -71,7 +71,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 		friend class TextureResourceManager;
 		friend class ITextureResourceLoader;
-		friend RECore::PackedElementManager<TextureResource, TextureResourceId, 2048>;	// Type definition of template class
+		friend RECore::PagedPackedElementManager<TextureResource, TextureResourceId, 2048>;	// Type definition of template class
 
 
 	//[-------------------------------------------------------]
@@ -88,7 +88,19 @@ namespace RERenderer
 			return mTexture;
 		}
 
-		inline void setTexture(RERHI::RHITexture* texture)
+		/**
+		*  @brief
+		*    Return the estimated number of bytes of the RHI texture data
+		*
+		*  @return
+		*    The estimated number of bytes, 0 if unknown
+		*/
+		[[nodiscard]] inline RECore::uint32 getNumberOfBytes() const
+		{
+			return mNumberOfBytes;
+		}
+
+		inline void setTexture(RERHI::RHITexture* texture, RECore::uint32 numberOfBytes = 0)
 		{
 			// Sanity check
 			ASSERT(LoadingState::LOADED == getLoadingState() || LoadingState::UNLOADED == getLoadingState(), "Texture resource change while in-flight inside the resource streamer")
@@ -99,6 +111,7 @@ namespace RERenderer
 				setLoadingState(LoadingState::UNLOADED);
 			}
 			mTexture = texture;
+			mNumberOfBytes = (nullptr != texture) ? numberOfBytes : 0;
 			setLoadingState(LoadingState::LOADED);
 		}
 
@@ -108,7 +121,8 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
 		inline TextureResource() :
-			mRgbHardwareGammaCorrection(false)
+			mRgbHardwareGammaCorrection(false),
+			mNumberOfBytes(0)
 		{
 			// Nothing here
 		}
@@ -130,6 +144,7 @@ namespace RERenderer
 			// Swap data
 			std::swap(mRgbHardwareGammaCorrection, textureResource.mRgbHardwareGammaCorrection);
 			std::swap(mTexture,					   textureResource.mTexture);
+			std::swap(mNumberOfBytes,			   textureResource.mNumberOfBytes);
 
 			// Done
 			return *this;
@@ -151,6 +166,7 @@ namespace RERenderer
 		{
 			// Reset everything
 			mTexture = nullptr;
+			mNumberOfBytes = 0;
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -163,6 +179,7 @@ namespace RERenderer
 	private:
 		bool			 mRgbHardwareGammaCorrection;	///< If true, sRGB texture formats will be used meaning the GPU will return linear space colors instead of gamma space colors when fetching texels inside a shader (the alpha channel always remains linear)
 		RERHI::RHITexturePtr mTexture;						///< RHI texture, can be a null pointer
+		RECore::uint32	 mNumberOfBytes;				///< Estimated number of bytes of the RHI texture data, 0 if unknown
 
 
 	};
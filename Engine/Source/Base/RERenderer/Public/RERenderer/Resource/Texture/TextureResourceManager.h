@@ -29,6 +29,8 @@
 //[-------------------------------------------------------]
 #include <RECore/Resource/ResourceManager.h>
 
+#include <unordered_map>
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -124,10 +126,11 @@ namespace RERenderer
 		}
 
 		void setNumberOfTopMipmapsToRemove(RECore::uint8 numberOfTopMipmapsToRemove);
-		[[nodiscard]] TextureResource* getTextureResourceByAssetId(AssetId assetId) const;		// Considered to be inefficient, avoid method whenever possible
-		[[nodiscard]] TextureResourceId getTextureResourceIdByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
+		[[nodiscard]] TextureResource* getTextureResourceByAssetId(AssetId assetId) const;		// Hash map lookup, when used each frame better keep the texture resource ID instead
+		[[nodiscard]] TextureResourceId getTextureResourceIdByAssetId(AssetId assetId) const;	// Hash map lookup, when used each frame better keep the texture resource ID instead
+		[[nodiscard]] TextureResource* getTextureResourceByAssetId(AssetId assetId, TextureResourceId& textureResourceId) const;	// "textureResourceId" is a texture resource ID cache owned by the caller, it's only resolved again if it no longer refers to a texture resource using the given asset ID
 		void loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, RECore::IResourceListener* resourceListener = nullptr, bool rgbHardwareGammaCorrection = false, bool reload = false, RECore::ResourceLoaderTypeId resourceLoaderTypeId = RECore::getInvalid<RECore::ResourceLoaderTypeId>());	// Asynchronous
-		TextureResourceId createTextureResourceByAssetId(AssetId assetId, RERHI::RHITexture& texture, bool rgbHardwareGammaCorrection = false);	// Texture resource is not allowed to exist, yet
+		TextureResourceId createTextureResourceByAssetId(AssetId assetId, RERHI::RHITexture& texture, bool rgbHardwareGammaCorrection = false, RECore::uint32 numberOfBytes = 0);	// Texture resource is not allowed to exist, yet, "numberOfBytes" is the estimated number of bytes of the texture data, 0 if unknown
 		void destroyTextureResource(TextureResourceId textureResourceId);
 		void setInvalidResourceId(TextureResourceId& textureResourceId, RECore::IResourceListener& resourceListener) const;
 
@@ -147,6 +150,8 @@ namespace RERenderer
 			// Nothing here
 		}
 
+		[[nodiscard]] virtual RECore::uint64 getNumberOfResourceBytes() const override;
+
 
 	//[-------------------------------------------------------]
 	//[ Private virtual RECore::IResourceManager methods    ]
@@ -165,15 +170,23 @@ namespace RERenderer
 		TextureResourceManager& operator=(const TextureResourceManager&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::unordered_map<RECore::uint32, TextureResourceId> AssetIdToTextureResourceId;	///< Key = "RERenderer::AssetId"
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
     IRenderer& mRenderer;
 		RECore::uint8 mNumberOfTopMipmapsToRemove;	///< The number of top mipmaps to remove while loading textures for efficient texture quality reduction. By setting this to e.g. two a 4096x4096 texture will become 1024x1024.
+		AssetIdToTextureResourceId mAssetIdToTextureResourceId;	///< Texture resource index, kept in sync with the texture resources of the internal resource manager
 
 		// Internal resource manager implementation
-    RECore::ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>* mInternalResourceManager;	///< Resources are allocated in pages of 2048 resources, not a capacity limit
 
 
 	};
@@ -119,7 +119,7 @@ namespace RERenderer
 	//[-------------------------------------------------------]
 	private:
     IRenderer& mRenderer;
-    RECore::ResourceManagerTemplate<VertexAttributesResource, VertexAttributesResourceLoader, VertexAttributesResourceId, 32>* mInternalResourceManager;
+    RECore::ResourceManagerTemplate<VertexAttributesResource, VertexAttributesResourceLoader, VertexAttributesResourceId, 32>* mInternalResourceManager;	///< Resources are allocated in pages of 32 resources, not a capacity limit
 
 
 	};
@@ -13,6 +13,7 @@ set(FILES
   Private/Core/Renderer/FramebufferManager.cpp
   Private/Core/Renderer/RenderPassManager.cpp
   Private/Core/Renderer/RenderTargetTextureManager.cpp
+  Private/Core/Renderer/RenderThread.cpp
 
   # DebugGui
   Private/DebugGui/DebugGuiManager.cpp
@@ -24,6 +25,7 @@ set(FILES
   Private/RenderQueue/RenderQueue.cpp
 
   # Resource
+  Private/Resource/LoadAsync.cpp
   Private/Resource/RendererResourceManager.cpp
   Private/Resource/CompositorNode/CompositorNodeInstance.cpp
   Private/Resource/CompositorNode/CompositorNodeResource.cpp
@@ -95,6 +97,7 @@ set(FILES
   Private/Resource/Scene/Item/Grass/GrassSceneItem.cpp
   Private/Resource/Scene/Item/Light/SunlightSceneItem.cpp
   Private/Resource/Scene/Item/Light/LightSceneItem.cpp
+  Private/Resource/Scene/Item/Particles/ParticleEmitter.cpp
   Private/Resource/Scene/Item/Particles/ParticlesSceneItem.cpp
   Private/Resource/Scene/Item/Sky/HosekWilkieSky.cpp
   Private/Resource/Scene/Item/Sky/SkySceneItem.cpp
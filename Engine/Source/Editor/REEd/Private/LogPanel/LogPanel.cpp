@@ -27,7 +27,8 @@
 #include <REGui/Widget/Layout/VerticalBoxLayout.h>
 #include <REGui/Widget/Button/Button.h>
 #include <REGui/Widget/Control/CheckBox.h>
-#include <REGui/Widget/Text/Text.h>
+#include <REGui/Widget/Table/VirtualTable.h>
+#include <RECore/Log/Log.h>
 
 
 //[-------------------------------------------------------]
@@ -42,7 +43,17 @@ re_class_metadata_end(LogPanel)
 //[ Classes                                               ]
 //[-------------------------------------------------------]
 LogPanel::LogPanel()
-: REGui::Panel() {
+: REGui::Panel()
+, SlotNewLogEntry(&LogPanel::onNewLogEntry, this)
+, SlotClear(&LogPanel::onClear, this)
+, mInfoCheckBox(nullptr)
+, mWarningCheckBox(nullptr)
+, mErrorCheckBox(nullptr)
+, mTable(nullptr)
+, mShowInfo(true)
+, mShowWarning(true)
+, mShowError(true)
+, mClear(false) {
   REGui::Panel::ConstructionArguments args;
   args.setTitle("Log");
   args.setLayout(
@@ -54,38 +65,127 @@ LogPanel::LogPanel()
         [
           gui_new(REGui::Button)
             .setText("Clear")
+            .setSlotOnClicked(SlotClear)
         ]
         +REGui::HorizontalBoxLayout::Slot()
         [
-          gui_new(REGui::CheckBox)
+          gui_assign(mInfoCheckBox, REGui::CheckBox)
             .setText("Info")
+            .setValue(mShowInfo)
         ]
         +REGui::HorizontalBoxLayout::Slot()
         [
-          gui_new(REGui::CheckBox)
+          gui_assign(mWarningCheckBox, REGui::CheckBox)
             .setText("Warning")
+            .setValue(mShowWarning)
         ]
         +REGui::HorizontalBoxLayout::Slot()
         [
-          gui_new(REGui::CheckBox)
+          gui_assign(mErrorCheckBox, REGui::CheckBox)
             .setText("Error")
+            .setValue(mShowError)
         ]
       ]
       +REGui::VerticalBoxLayout::Slot()
       [
-        gui_new(REGui::Text)
-          .setText("Text Output")
+        gui_assign(mTable, REGui::VirtualTable)
+          .setAutoScroll(true)
+          .setCellCallback([this](RECore::uint32 row, RECore::uint32 column) { drawCell(row, column); })
       ]
   );
 
   construct(args);
+
+  // Receive new messages
+  RECore::Log::instance().EventNewEntry.connect(SlotNewLogEntry);
 }
 
 LogPanel::~LogPanel() {
-
+  RECore::Log::instance().EventNewEntry.disconnect(SlotNewLogEntry);
 }
 
 
 void LogPanel::onDraw() {
+  // Clearing is done here to not modify the entries while the table is drawn
+  if (mClear) {
+    mEntries.clear();
+    mVisibleEntries.clear();
+    mTable->setNumberOfRows(0);
+    mClear = false;
+  }
+
+  // The filter only has to be re-applied to all messages when it changed
+  if (mInfoCheckBox->getValue() != mShowInfo || mWarningCheckBox->getValue() != mShowWarning || mErrorCheckBox->getValue() != mShowError) {
+    mShowInfo = mInfoCheckBox->getValue();
+    mShowWarning = mWarningCheckBox->getValue();
+    mShowError = mErrorCheckBox->getValue();
+    mVisibleEntries.clear();
+    for (RECore::uint32 i = 0; i < mEntries.size(); ++i) {
+      if (isVisible(mEntries[i])) {
+        mVisibleEntries.push_back(i);
+      }
+    }
+    mTable->setNumberOfRows(static_cast<RECore::uint32>(mVisibleEntries.size()));
+  }
+
+  // Take over the new messages, this is an append and doesn't touch the existing rows
+  {
+    std::lock_guard<std::mutex> lock(mPendingEntriesMutex);
+    for (Entry& entry : mPendingEntries) {
+      if (isVisible(entry)) {
+        mVisibleEntries.push_back(static_cast<RECore::uint32>(mEntries.size()));
+      }
+      mEntries.push_back(std::move(entry));
+    }
+    mPendingEntries.clear();
+  }
+  mTable->appendRows(static_cast<RECore::uint32>(mVisibleEntries.size()) - mTable->getNumberOfRows());
+
   REGui::Panel::onDraw();
-}
\ No newline at end of file
+}
+
+void LogPanel::onNewLogEntry(RECore::uint8 logLevel, RECore::String text) {
+  // The filter only knows about errors, warnings and everything else
+  if (logLevel == RECore::Log::Critical) {
+    logLevel = RECore::Log::Error;
+  } else if (logLevel != RECore::Log::Error && logLevel != RECore::Log::Warning) {
+    logLevel = RECore::Log::Info;
+  }
+
+  std::lock_guard<std::mutex> lock(mPendingEntriesMutex);
+  mPendingEntries.push_back({logLevel, std::move(text)});
+}
+
+void LogPanel::onClear() {
+  mClear = true;
+}
+
+bool LogPanel::isVisible(const Entry& entry) const {
+  switch (entry.logLevel) {
+    case RECore::Log::Error:
+      return mShowError;
+    case RECore::Log::Warning:
+      return mShowWarning;
+    default:
+      return mShowInfo;
+  }
+}
+
+void LogPanel::drawCell(RECore::uint32 row, RECore::uint32 column) {
+  const Entry& entry = mEntries[mVisibleEntries[row]];
+  switch (entry.logLevel) {
+    case RECore::Log::Error:
+      ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.4f, 0.4f, 1.0f));
+      ImGui::TextUnformatted(entry.text.cstr());
+      ImGui::PopStyleColor();
+      break;
+    case RECore::Log::Warning:
+      ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.3f, 1.0f));
+      ImGui::TextUnformatted(entry.text.cstr());
+      ImGui::PopStyleColor();
+      break;
+    default:
+      ImGui::TextUnformatted(entry.text.cstr());
+      break;
+  }
+}
@@ -30,19 +30,34 @@
 //[-------------------------------------------------------]
 #include "REGui/REGui.h"
 #include "REGui/Widget/Panel/Panel.h"
+#include <mutex>
+#include <vector>
 
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
 //[-------------------------------------------------------]
 namespace REGui {
+class CheckBox;
 class Layout;
+class VirtualTable;
 }
 
 
 //[-------------------------------------------------------]
 //[ Classes                                               ]
 //[-------------------------------------------------------]
+/**
+ * @class
+ * LogPanel
+ *
+ * @brief
+ * Shows the messages of the log.
+ *
+ * @remarks
+ * The messages are collected from "RECore::Log::EventNewEntry", which can be emitted by any thread, and are
+ * shown through a virtual table, so only the visible messages are drawn regardless of the number of messages.
+ */
 class LogPanel : public REGui::Panel {
 
   //[-------------------------------------------------------]
@@ -74,6 +89,59 @@ public:
 
 private:
 
-  bool mAutoScroll;
+  struct Entry {
+    /** Log level of the message, see "RECore::Log::LogLevel" */
+    RECore::uint8 logLevel;
+    RECore::String text;
+  };
+
+  /**
+   * @brief
+   * Called by the log for each new message, may be called by any thread.
+   *
+   * @param[in] logLevel
+   * Log level of the message, see "RECore::Log::LogLevel"
+   * @param[in] text
+   * Text of the message
+   */
+  void onNewLogEntry(RECore::uint8 logLevel, RECore::String text);
+
+  /**
+   * @brief
+   * Called when the clear button has been clicked.
+   */
+  void onClear();
+
+  /**
+   * @brief
+   * Return whether or not an entry passes the log level filter.
+   */
+  [[nodiscard]] bool isVisible(const Entry& entry) const;
+
+  /**
+   * @brief
+   * Draw the cell of a table row.
+   */
+  void drawCell(RECore::uint32 row, RECore::uint32 column);
+
+private:
+
+  RECore::EventHandler<RECore::uint8, RECore::String> SlotNewLogEntry;
+  RECore::EventHandler<> SlotClear;
+  REGui::CheckBox* mInfoCheckBox;
+  REGui::CheckBox* mWarningCheckBox;
+  REGui::CheckBox* mErrorCheckBox;
+  REGui::VirtualTable* mTable;
+  /** All messages */
+  std::vector<Entry> mEntries;
+  /** Indices of the messages passing the log level filter, one per table row */
+  std::vector<RECore::uint32> mVisibleEntries;
+  /** Messages not yet taken over by the main thread, guarded by "mPendingEntriesMutex" */
+  std::vector<Entry> mPendingEntries;
+  std::mutex mPendingEntriesMutex;
+  bool mShowInfo;
+  bool mShowWarning;
+  bool mShowError;
+  bool mClear;
 
 };
@@ -569,9 +569,10 @@ namespace
 						ELSE_IF_VALUE(ALLOW_MULTISAMPLE)
 						ELSE_IF_VALUE(GENERATE_MIPMAPS)
 						ELSE_IF_VALUE(ALLOW_RESOLUTION_SCALE)
+						ELSE_IF_VALUE(TRANSIENT)
 						else
 						{
-							throw std::runtime_error('\"' + std::string(propertyName) + "\" doesn't know the flag " + flagAsString + ". Must be \"UNORDERED_ACCESS\", \"SHADER_RESOURCE\", \"RENDER_TARGET\", \"ALLOW_MULTISAMPLE\", \"GENERATE_MIPMAPS\" or \"ALLOW_RESOLUTION_SCALE\".");
+							throw std::runtime_error('\"' + std::string(propertyName) + "\" doesn't know the flag " + flagAsString + ". Must be \"UNORDERED_ACCESS\", \"SHADER_RESOURCE\", \"RENDER_TARGET\", \"ALLOW_MULTISAMPLE\", \"GENERATE_MIPMAPS\", \"ALLOW_RESOLUTION_SCALE\" or \"TRANSIENT\".");
 						}
 
 						// Apply value
@@ -990,6 +990,9 @@ void RHIDynamicRHI::initializeCapabilities()
   // The null RHI has native multithreading
   mCapabilities.nativeMultithreading = true;
 
+  // The null RHI isn't bound to a thread
+  mCapabilities.threadedSubmission = true;
+
   // The null RHI has no shader bytecode support
   mCapabilities.shaderBytecode = false;
 
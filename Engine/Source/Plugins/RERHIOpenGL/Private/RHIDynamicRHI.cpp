@@ -700,10 +700,13 @@ void RHIDynamicRHI::dispatchCommandBufferInternal(const RERHI::RHICommandBuffer&
   RERHI::ConstCommandPacket constCommandPacket = commandPacketBuffer;
   while (nullptr != constCommandPacket)
   {
-    { // Dispatch command packet
+    { // Dispatch command packet, unless it doesn't change the bound state
       const RERHI::CommandDispatchFunctionIndex commandDispatchFunctionIndex = RERHI::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
       const void* command = RERHI::CommandPacketHelper::loadCommand(constCommandPacket);
-      detail::DISPATCH_FUNCTIONS[static_cast<RECore::uint32>(commandDispatchFunctionIndex)](command, *this);
+      if (!mRedundantCommandFilter.isRedundant(commandDispatchFunctionIndex, command))
+      {
+        detail::DISPATCH_FUNCTIONS[static_cast<RECore::uint32>(commandDispatchFunctionIndex)](command, *this);
+      }
     }
 
     { // Next command
@@ -2508,6 +2511,9 @@ void RHIDynamicRHI::dispatchCommandBuffer(const RERHI::RHICommandBuffer& command
   // Sanity check
   RHI_ASSERT(!commandBuffer.isEmpty(), "The OpenGL command buffer to dispatch mustn't be empty")
 
+  // Forget about the tracked bound state, the bound state might have been changed by direct RHI usage in between
+  mRedundantCommandFilter.reset();
+
   // Dispatch command buffer
   dispatchCommandBufferInternal(commandBuffer);
 }
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RERHIOpenGL/RERHIOpenGL.h"
 #include <RERHI/RHIDynamicRHI.h>
+#include <RERHI/Buffer/RHIRedundantCommandFilter.h>
 
 // RERHIOPENGL_API extern "C"
 RERHIOPENGL_API RERHI::RHIDynamicRHI* createOpenGLRhiInstance(const RERHI::RHIContext& context);
@@ -222,6 +223,10 @@ public:
   //[ Operation                                             ]
   //[-------------------------------------------------------]
   virtual void dispatchCommandBuffer(const RERHI::RHICommandBuffer& commandBuffer) override;
+  [[nodiscard]] inline virtual RERHI::RHIRedundantCommandFilter* getRedundantCommandFilter() override
+  {
+    return &mRedundantCommandFilter;
+  }
 
 
   //[-------------------------------------------------------]
@@ -333,6 +338,7 @@ private:
   RERHI::RHISamplerState*   mDefaultSamplerState;				///< Default rasterizer state (we keep a reference to it), can be a null pointer
   GLuint				  mOpenGLCopyResourceFramebuffer;	///< OpenGL framebuffer ("container" object, not shared between OpenGL contexts) used by "OpenGLRhi::OpenGLRhi::copyResource()" if the "GL_ARB_copy_image"-extension isn't available, can be zero if no resource is allocated
   GLuint				  mDefaultOpenGLVertexArray;		///< Default OpenGL vertex array ("container" object, not shared between OpenGL contexts) to enable attribute-less rendering, can be zero if no resource is allocated
+  RERHI::RHIRedundantCommandFilter mRedundantCommandFilter;	///< Strips redundant command packets during command buffer dispatch
   // States
   GraphicsPipelineState* mGraphicsPipelineState;	///< Currently set graphics pipeline state (we keep a reference to it), can be a null pointer
   ComputePipelineState*  mComputePipelineState;	///< Currently set compute pipeline state (we keep a reference to it), can be a null pointer
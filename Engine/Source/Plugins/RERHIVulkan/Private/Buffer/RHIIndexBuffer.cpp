@@ -37,14 +37,14 @@ IndexBuffer::IndexBuffer(RHIDynamicRHI& vulkanRhi, RECore::uint32 numberOfBytes,
 RHIIndexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 mVkIndexType(Mapping::getVulkanType(vulkanRhi.getContext(), indexBufferFormat)),
 mVkBuffer(VK_NULL_HANDLE),
-mVkDeviceMemory(VK_NULL_HANDLE)
+mMemoryAllocation{}
 {
   int vkBufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
   if ((bufferFlags & RERHI::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & RERHI::BufferFlag::SHADER_RESOURCE) != 0)
   {
     vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
   }
-  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mMemoryAllocation);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -53,7 +53,6 @@ mVkDeviceMemory(VK_NULL_HANDLE)
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IBO", 6)	// 6 = "IBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (RECore::uint64)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
 				}
 #endif
 }
@@ -64,7 +63,7 @@ mVkDeviceMemory(VK_NULL_HANDLE)
 */
 IndexBuffer::~IndexBuffer()
 {
-Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mMemoryAllocation);
 }
 
 
@@ -36,7 +36,7 @@ namespace RERHIVulkan {
 IndirectBuffer::IndirectBuffer(RHIDynamicRHI& vulkanRhi, RECore::uint32 numberOfBytes, const void* data, RECore::uint32 indirectBufferFlags, [[maybe_unused]] RERHI::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 RHIIndirectBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 mVkBuffer(VK_NULL_HANDLE),
-mVkDeviceMemory(VK_NULL_HANDLE)
+mMemoryAllocation{}
 {
   // Sanity checks
   RHI_ASSERT((indirectBufferFlags & RERHI::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & RERHI::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Vulkan flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
@@ -50,7 +50,7 @@ mVkDeviceMemory(VK_NULL_HANDLE)
   {
     vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
   }
-  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mMemoryAllocation);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -59,7 +59,6 @@ mVkDeviceMemory(VK_NULL_HANDLE)
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IndirectBufferObject", 23)	// 23 = "IndirectBufferObject: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (RECore::uint64)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
 				}
 #endif
 }
@@ -70,7 +69,7 @@ mVkDeviceMemory(VK_NULL_HANDLE)
 */
 IndirectBuffer::~IndirectBuffer()
 {
-Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mMemoryAllocation);
 }
 
 
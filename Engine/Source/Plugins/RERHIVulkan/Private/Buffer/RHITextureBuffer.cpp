@@ -39,7 +39,7 @@ TextureBuffer::TextureBuffer(RHIDynamicRHI &vulkanRhi, RECore::uint32 numberOfBy
                              RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
   RHITextureBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkBuffer(VK_NULL_HANDLE),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkBufferView(VK_NULL_HANDLE) {
   // Sanity check
   RHI_ASSERT((numberOfBytes % RERHI::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0,
@@ -55,7 +55,7 @@ TextureBuffer::TextureBuffer(RHIDynamicRHI &vulkanRhi, RECore::uint32 numberOfBy
   }
   Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits),
                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                                    numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+                                    numberOfBytes, data, mVkBuffer, mMemoryAllocation);
 
   // Create Vulkan buffer view
   if ((bufferFlags & RERHI::BufferFlag::SHADER_RESOURCE) != 0 ||
@@ -83,7 +83,6 @@ TextureBuffer::TextureBuffer(RHIDynamicRHI &vulkanRhi, RECore::uint32 numberOfBy
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TBO", 6)	// 6 = "TBO: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (RECore::uint64)mVkBuffer, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_VIEW_EXT, (RECore::uint64)mVkBufferView, detailedDebugName);
         }
 #endif
@@ -99,7 +98,7 @@ TextureBuffer::~TextureBuffer() {
     vkDestroyBufferView(vulkanRhi.getVulkanContext().getVkDevice(), mVkBufferView,
                         vulkanRhi.getVkAllocationCallbacks());
   }
-  Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mVkDeviceMemory);
+  Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mMemoryAllocation);
 }
 
 
@@ -35,14 +35,14 @@ namespace RERHIVulkan {
 VertexBuffer::VertexBuffer(RHIDynamicRHI& vulkanRhi, RECore::uint32 numberOfBytes, const void* data, RECore::uint32 bufferFlags, [[maybe_unused]] RERHI::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
   RHIVertexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkBuffer(VK_NULL_HANDLE),
-  mVkDeviceMemory(VK_NULL_HANDLE)
+  mMemoryAllocation{}
 {
   int vkBufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
   if ((bufferFlags & RERHI::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & RERHI::BufferFlag::SHADER_RESOURCE) != 0)
   {
     vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
   }
-  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+  Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mMemoryAllocation);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -51,7 +51,6 @@ VertexBuffer::VertexBuffer(RHIDynamicRHI& vulkanRhi, RECore::uint32 numberOfByte
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "VBO", 6)	// 6 = "VBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (RECore::uint64)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
 				}
 #endif
 }
@@ -62,7 +61,7 @@ VertexBuffer::VertexBuffer(RHIDynamicRHI& vulkanRhi, RECore::uint32 numberOfByte
 */
 VertexBuffer::~VertexBuffer()
 {
-  Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+  Helper::destroyAndFreeVkBuffer(static_cast<const RHIDynamicRHI&>(getRhi()), mVkBuffer, mMemoryAllocation);
 }
 
 
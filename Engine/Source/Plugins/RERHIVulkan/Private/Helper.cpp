@@ -24,8 +24,12 @@
 #include "RERHIVulkan/Helper.h"
 #include "RERHIVulkan/RHIDynamicRHI.h"
 #include "RERHIVulkan/VulkanContext.h"
+#include "RERHIVulkan/UploadContext.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 #include "RERHIVulkan/Mapping.h"
 
+#include <numeric>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -65,6 +69,9 @@ void Helper::endSingleTimeCommands(const RHIDynamicRHI& vulkanRhi, VkCommandBuff
   // End Vulkan command buffer
   vkEndCommandBuffer(vkCommandBuffer);
 
+  // Submit pending uploads first, the Vulkan command buffer might use the uploaded resources
+  vulkanContext.getUploadContext().flush();
+
   // Submit Vulkan command buffer
   const VkSubmitInfo vkSubmitInfo =
     {
@@ -100,14 +107,8 @@ void Helper::endSingleTimeCommands(const RHIDynamicRHI& vulkanRhi, VkCommandBuff
 //[-------------------------------------------------------]
 void Helper::transitionVkImageLayout(const RHIDynamicRHI& vulkanRhi, VkImage vkImage, VkImageAspectFlags vkImageAspectFlags, VkImageLayout oldVkImageLayout, VkImageLayout newVkImageLayout)
 {
-  // Create and begin Vulkan command buffer
-  VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
-
-  // Vulkan image memory barrier
-  transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, 1, 1, oldVkImageLayout, newVkImageLayout);
-
-  // End and destroy Vulkan command buffer
-  endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
+  // Vulkan image memory barrier, recorded into the upload context which is submitted before the frame command buffer
+  transitionVkImageLayout(vulkanRhi, vulkanRhi.getVulkanContext().getUploadContext().getGraphicsVkCommandBuffer(), vkImage, vkImageAspectFlags, 1, 1, oldVkImageLayout, newVkImageLayout);
 }
 
 void Helper::transitionVkImageLayout(const RHIDynamicRHI& vulkanRhi, VkCommandBuffer vkCommandBuffer, VkImage vkImage, VkImageAspectFlags vkImageAspectFlags, RECore::uint32 levelCount, RECore::uint32 layerCount, VkImageLayout oldVkImageLayout, VkImageLayout newVkImageLayout)
@@ -325,8 +326,7 @@ void Helper::transitionVkImageLayout(const RHIDynamicRHI& vulkanRhi, VkCommandBu
 //[-------------------------------------------------------]
 //[ Buffer                                                ]
 //[-------------------------------------------------------]
-// TODO(naetherm) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-void Helper::createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+void Helper::createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, MemoryAllocation& memoryAllocation)
 {
   const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
   const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -351,27 +351,19 @@ void Helper::createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferU
   // Allocate memory for the Vulkan buffer
   VkMemoryRequirements vkMemoryRequirements = {};
   vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &vkMemoryRequirements);
-  const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-    {
-      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-      nullptr,																						// pNext (const void*)
-      vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-      vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (RECore::uint32)
-    };
-  if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+  if (!vulkanContext.getMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, true, memoryAllocation))
   {
     RE_LOG(Critical, "Failed to allocate the Vulkan buffer memory")
+    return;
   }
 
-  // Bind and fill memory
-  vkBindBufferMemory(vkDevice, vkBuffer, vkDeviceMemory, 0);
+  // Bind and fill memory, host visible memory is persistently mapped
+  vkBindBufferMemory(vkDevice, vkBuffer, memoryAllocation.vkDeviceMemory, memoryAllocation.offset);
   if (nullptr != data)
   {
-    void* mappedData = nullptr;
-    if (vkMapMemory(vkDevice, vkDeviceMemory, 0, vkBufferCreateInfo.size, 0, &mappedData) == VK_SUCCESS)
+    if (nullptr != memoryAllocation.mappedData)
     {
-      memcpy(mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
-      vkUnmapMemory(vkDevice, vkDeviceMemory);
+      memcpy(memoryAllocation.mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
     }
     else
     {
@@ -380,16 +372,13 @@ void Helper::createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferU
   }
 }
 
-void Helper::destroyAndFreeVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+void Helper::destroyAndFreeVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBuffer& vkBuffer, MemoryAllocation& memoryAllocation)
 {
   if (VK_NULL_HANDLE != vkBuffer)
   {
     const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
     vkDestroyBuffer(vkDevice, vkBuffer, vulkanRhi.getVkAllocationCallbacks());
-    if (VK_NULL_HANDLE != vkDeviceMemory)
-    {
-      vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-    }
+    vulkanRhi.getVulkanContext().getMemoryAllocator().free(memoryAllocation);
   }
 }
 
@@ -409,8 +398,7 @@ VkImageLayout Helper::getVkImageLayoutByTextureFlags(RECore::uint32 textureFlags
   return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 }
 
-// TODO(naetherm) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, RERHI::TextureFormat::Enum textureFormat, const void* data, RECore::uint32 textureFlags, RECore::uint8 numberOfMultisamples, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, RERHI::TextureFormat::Enum textureFormat, const void* data, RECore::uint32 textureFlags, RECore::uint8 numberOfMultisamples, VkImage& vkImage, MemoryAllocation& memoryAllocation, VkImageView& vkImageView)
 {
   // Calculate the number of mipmaps
   const bool dataContainsMipmaps = (textureFlags & RERHI::TextureFlag::DATA_CONTAINS_MIPMAPS);
@@ -480,7 +468,7 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
 
   { // Create and fill Vulkan image
     const VkImageCreateFlags vkImageCreateFlags = (VK_IMAGE_VIEW_TYPE_CUBE == vkImageViewType || VK_IMAGE_VIEW_TYPE_CUBE_ARRAY == vkImageViewType) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0u;
-    createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, vkDeviceMemory);
+    createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, memoryAllocation);
   }
 
   // Create the Vulkan image view
@@ -492,20 +480,33 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
   // Upload all mipmaps
   if (nullptr != data)
   {
-    // Create Vulkan staging buffer
-    VkBuffer stagingVkBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory stagingVkDeviceMemory = VK_NULL_HANDLE;
-    createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, stagingVkBuffer, stagingVkDeviceMemory);
+    // The upload is recorded into the upload context, there's no need to wait until the upload has been finished
+    // -> The copy from the staging memory to the image is executed on the dedicated transfer queue, if there's one
+    // -> Everything else (layout transitions into the final layout, mipmap generation via blits) is executed on the graphics queue
+    UploadContext& uploadContext = vulkanRhi.getVulkanContext().getUploadContext();
 
     { // Upload all mipmaps
       const RECore::uint32 numberOfUploadedMipmaps = generateMipmaps ? 1 : numberOfMipmaps;
 
-      // Create and begin Vulkan command buffer
-      VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
+      // Get staging memory and fill it, Vulkan requires buffer to image copy offsets to be a multiple of four and of the texel block size
+      VkBuffer stagingVkBuffer = VK_NULL_HANDLE;
+      VkDeviceSize stagingOffset = 0;
+      const VkDeviceSize alignment = std::lcm<VkDeviceSize>(4, RERHI::TextureFormat::getNumberOfBytesPerSlice(textureFormat, 1, 1));
+      void* stagingData = uploadContext.allocateStagingMemory(numberOfBytes, alignment, stagingVkBuffer, stagingOffset);
+      if (nullptr == stagingData)
+      {
+        // Error!
+        RE_LOG(Critical, "Failed to allocate Vulkan staging memory")
+        return vkFormat;
+      }
+      memcpy(stagingData, data, numberOfBytes);
+
+      // Begin the upload on the transfer command buffer
+      VkCommandBuffer vkCommandBuffer = uploadContext.getTransferVkCommandBuffer();
       transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
       // Upload all mipmaps
-      RECore::uint32 bufferOffset  = 0;
+      VkDeviceSize bufferOffset = stagingOffset;
       RECore::uint32 currentWidth  = vkExtent3D.width;
       RECore::uint32 currentHeight = vkExtent3D.height;
       RECore::uint32 currentDepth  = depth;
@@ -539,7 +540,20 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
       // Copy Vulkan buffer to Vulkan image
       vkCmdCopyBufferToImage(vkCommandBuffer, stagingVkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<RECore::uint32>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
 
-      // End and destroy Vulkan command buffer
+      { // Hand the uploaded mipmaps over to the graphics queue
+        const VkImageSubresourceRange vkImageSubresourceRange =
+          {
+            vkImageAspectFlags,			// aspectMask (VkImageAspectFlags)
+            0,							// baseMipLevel (RECore::uint32)
+            numberOfUploadedMipmaps,	// levelCount (RECore::uint32)
+            0,							// baseArrayLayer (RECore::uint32)
+            layerCount					// layerCount (RECore::uint32)
+          };
+        uploadContext.transferVkImageOwnership(vkImage, vkImageSubresourceRange, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+      }
+
+      // Transition into the final layout on the graphics command buffer
+      vkCommandBuffer = uploadContext.getGraphicsVkCommandBuffer();
       if (generateMipmaps)
       {
         const VkImageSubresourceRange vkImageSubresourceRange =
@@ -556,16 +570,12 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
       {
         transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
       }
-      endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
     }
 
-    // Destroy Vulkan staging buffer
-    destroyAndFreeVkBuffer(vulkanRhi, stagingVkBuffer, stagingVkDeviceMemory);
-
     // Generate a complete texture mip-chain at runtime from a base image using image blits and proper image barriers
     // -> Basing on https://github.com/SaschaWillems/Vulkan/tree/master/examples/texturemipmapgen and "Mipmap generation : Transfers, transition layout" by Antoine MORRIER published January 12, 2017 at http://cpp-rendering.io/mipmap-generation/
     // -> We copy down the whole mip chain doing a blit from mip-1 to mip. An alternative way would be to always blit from the first mip level and sample that one down.
-    // TODO(naetherm) Some GPUs also offer "asynchronous transfer queues" (check for queue families with only the "VK_QUEUE_TRANSFER_BIT" set) that may be used to speed up such operations
+    // -> Blits require a graphics queue, so this is recorded into the graphics command buffer of the upload context
     if (generateMipmaps)
     {
 #ifdef DEBUG
@@ -580,8 +590,7 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
 					}
 #endif
 
-      // Create and begin Vulkan command buffer
-      VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
+      VkCommandBuffer vkCommandBuffer = uploadContext.getGraphicsVkCommandBuffer();
 
       // Copy down mips from n-1 to n
       for (RECore::uint32 i = 1; i < numberOfMipmaps; ++i)
@@ -639,9 +648,6 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
           };
         transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, vkImageSubresourceRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
       }
-
-      // End and destroy Vulkan command buffer
-      endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
     }
   }
 
@@ -649,7 +655,7 @@ VkFormat Helper::createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageTyp
   return vkFormat;
 }
 
-void Helper::createAndAllocateVkImage(const RHIDynamicRHI& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, RECore::uint32 mipLevels, RECore::uint32 arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+void Helper::createAndAllocateVkImage(const RHIDynamicRHI& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, RECore::uint32 mipLevels, RECore::uint32 arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, MemoryAllocation& memoryAllocation)
 {
   const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
   const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -682,47 +688,40 @@ void Helper::createAndAllocateVkImage(const RHIDynamicRHI& vulkanRhi, VkImageCre
   { // Allocate Vulkan memory
     VkMemoryRequirements vkMemoryRequirements = {};
     vkGetImageMemoryRequirements(vkDevice, vkImage, &vkMemoryRequirements);
-    const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-      {
-        VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-        nullptr,																						// pNext (const void*)
-        vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-        vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (RECore::uint32)
-      };
-    if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+    if (!vulkanContext.getMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, VK_IMAGE_TILING_LINEAR == vkImageTiling, memoryAllocation))
     {
       RE_LOG(Critical, "Failed to allocate the Vulkan memory")
+      return;
     }
-    if (vkBindImageMemory(vkDevice, vkImage, vkDeviceMemory, 0) != VK_SUCCESS)
+    if (vkBindImageMemory(vkDevice, vkImage, memoryAllocation.vkDeviceMemory, memoryAllocation.offset) != VK_SUCCESS)
     {
       RE_LOG(Critical, "Failed to bind the Vulkan image memory")
     }
   }
 }
 
-void Helper::destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+void Helper::destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, MemoryAllocation& memoryAllocation)
 {
   if (VK_NULL_HANDLE != vkImage)
   {
+    // The image might still be referenced by an upload in flight
+    vulkanRhi.getVulkanContext().getUploadContext().waitForVkImage(vkImage);
+
     const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
     vkDestroyImage(vkDevice, vkImage, vulkanRhi.getVkAllocationCallbacks());
     vkImage = VK_NULL_HANDLE;
-    if (VK_NULL_HANDLE != vkDeviceMemory)
-    {
-      vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-      vkDeviceMemory = VK_NULL_HANDLE;
-    }
+    vulkanRhi.getVulkanContext().getMemoryAllocator().free(memoryAllocation);
   }
 }
 
-void Helper::destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+void Helper::destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, MemoryAllocation& memoryAllocation, VkImageView& vkImageView)
 {
   if (VK_NULL_HANDLE != vkImageView)
   {
     vkDestroyImageView(vulkanRhi.getVulkanContext().getVkDevice(), vkImageView, vulkanRhi.getVkAllocationCallbacks());
     vkImageView = VK_NULL_HANDLE;
   }
-  destroyAndFreeVkImage(vulkanRhi, vkImage, vkDeviceMemory);
+  destroyAndFreeVkImage(vulkanRhi, vkImage, memoryAllocation);
 }
 
 void Helper::createVkImageView(const RHIDynamicRHI& vulkanRhi, VkImage vkImage, VkImageViewType vkImageViewType, RECore::uint32 levelCount, RECore::uint32 layerCount, VkFormat vkFormat, VkImageAspectFlags vkImageAspectFlags, VkImageView& vkImageView)
@@ -0,0 +1,320 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERHIVulkan/MemoryAllocator.h"
+#include "RERHIVulkan/VulkanContext.h"
+#include "RERHIVulkan/RHIDynamicRHI.h"
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+namespace detail
+{
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+[[nodiscard]] inline VkDeviceSize getOrderSize(RECore::uint32 order)
+{
+  return (RERHIVulkan::MemoryAllocator::MINIMUM_ALLOCATION_SIZE << order);
+}
+
+[[nodiscard]] RECore::uint32 getOrder(VkDeviceSize numberOfBytes)
+{
+  RECore::uint32 order = 0;
+  while (getOrderSize(order) < numberOfBytes)
+  {
+    ++order;
+  }
+  return order;
+}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERHIVulkan {
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+MemoryAllocator::MemoryAllocator(const VulkanContext& vulkanContext) :
+mVulkanContext(vulkanContext),
+mVkPhysicalDeviceMemoryProperties{},
+mStatistics{}
+{
+  static_assert(MINIMUM_ALLOCATION_SIZE << (NUMBER_OF_ORDERS - 1) == BLOCK_SIZE, "Invalid number of memory allocator orders");
+  vkGetPhysicalDeviceMemoryProperties(mVulkanContext.getVkPhysicalDevice(), &mVkPhysicalDeviceMemoryProperties);
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+  RHI_ASSERT(0 == mStatistics.numberOfAllocations, "Vulkan memory allocator is destroyed while there are still allocations")
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+  for (const Blocks& blocks : mPools)
+  {
+    for (const Block& block : blocks)
+    {
+      if (VK_NULL_HANDLE != block.vkDeviceMemory)
+      {
+        // Freeing mapped memory implicitly unmaps it
+        vkFreeMemory(vkDevice, block.vkDeviceMemory, vkAllocationCallbacks);
+      }
+    }
+  }
+}
+
+bool MemoryAllocator::allocate(const VkMemoryRequirements& vkMemoryRequirements, VkMemoryPropertyFlags vkMemoryPropertyFlags, bool linear, MemoryAllocation& memoryAllocation)
+{
+  memoryAllocation = {};
+  memoryAllocation.blockIndex = ~0u;
+  const RECore::uint32 memoryTypeIndex = mVulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags);
+  if (~0u == memoryTypeIndex)
+  {
+    // Error! "RERHIVulkan::VulkanContext::findMemoryTypeIndex()" already logged the reason.
+    return false;
+  }
+  memoryAllocation.poolIndex = memoryTypeIndex * 2 + (linear ? 0u : 1u);
+  std::lock_guard<std::mutex> mutexLock(mMutex);
+
+  // Large allocations get a dedicated Vulkan device memory, they would waste too much of a block
+  const VkDeviceSize numberOfBytes = std::max(vkMemoryRequirements.size, vkMemoryRequirements.alignment);
+  if (numberOfBytes > BLOCK_SIZE / 2)
+  {
+    if (!allocateVkDeviceMemory(memoryTypeIndex, vkMemoryRequirements.size, memoryAllocation.vkDeviceMemory, &memoryAllocation.mappedData))
+    {
+      return false;
+    }
+    memoryAllocation.size = vkMemoryRequirements.size;
+    ++mStatistics.numberOfDedicatedAllocations;
+    ++mStatistics.numberOfAllocations;
+    mStatistics.numberOfAllocatedBytes += memoryAllocation.size;
+    mStatistics.numberOfUsedBytes += memoryAllocation.size;
+    return true;
+  }
+
+  // Try the existing blocks of the pool first
+  const RECore::uint32 order = ::detail::getOrder(numberOfBytes);
+  Blocks& blocks = mPools[memoryAllocation.poolIndex];
+  RECore::uint32 blockIndex = ~0u;
+  VkDeviceSize offset = 0;
+  for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(blocks.size()); ++i)
+  {
+    if (VK_NULL_HANDLE != blocks[i].vkDeviceMemory && allocateFromBlock(blocks[i], order, offset))
+    {
+      blockIndex = i;
+      break;
+    }
+  }
+
+  // Create a new block, reuse an unused block slot if there's one
+  if (~0u == blockIndex)
+  {
+    Block* block = nullptr;
+    for (RECore::uint32 i = 0; i < static_cast<RECore::uint32>(blocks.size()); ++i)
+    {
+      if (VK_NULL_HANDLE == blocks[i].vkDeviceMemory)
+      {
+        blockIndex = i;
+        block = &blocks[i];
+        break;
+      }
+    }
+    if (nullptr == block)
+    {
+      blockIndex = static_cast<RECore::uint32>(blocks.size());
+      block = &blocks.emplace_back();
+    }
+    void* mappedData = nullptr;
+    if (!allocateVkDeviceMemory(memoryTypeIndex, BLOCK_SIZE, block->vkDeviceMemory, &mappedData))
+    {
+      return false;
+    }
+    block->mappedData = static_cast<RECore::uint8*>(mappedData);
+    block->numberOfUsedBytes = 0;
+    block->freeOffsets[NUMBER_OF_ORDERS - 1].insert(0);
+    ++mStatistics.numberOfBlocks;
+    mStatistics.numberOfAllocatedBytes += BLOCK_SIZE;
+    [[maybe_unused]] const bool result = allocateFromBlock(*block, order, offset);
+    RHI_ASSERT(result, "A new Vulkan memory block must be able to serve the allocation")
+  }
+
+  // Done
+  Block& block = blocks[blockIndex];
+  block.numberOfUsedBytes += ::detail::getOrderSize(order);
+  memoryAllocation.vkDeviceMemory = block.vkDeviceMemory;
+  memoryAllocation.offset = offset;
+  memoryAllocation.size = ::detail::getOrderSize(order);
+  memoryAllocation.mappedData = (nullptr != block.mappedData) ? (block.mappedData + offset) : nullptr;
+  memoryAllocation.blockIndex = blockIndex;
+  memoryAllocation.order = order;
+  ++mStatistics.numberOfAllocations;
+  mStatistics.numberOfUsedBytes += memoryAllocation.size;
+  return true;
+}
+
+void MemoryAllocator::free(MemoryAllocation& memoryAllocation)
+{
+  if (VK_NULL_HANDLE == memoryAllocation.vkDeviceMemory)
+  {
+    // Nothing to do in here
+    return;
+  }
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+  std::lock_guard<std::mutex> mutexLock(mMutex);
+  RHI_ASSERT(mStatistics.numberOfAllocations > 0, "Invalid Vulkan memory allocator statistics")
+  --mStatistics.numberOfAllocations;
+  mStatistics.numberOfUsedBytes -= memoryAllocation.size;
+
+  if (~0u == memoryAllocation.blockIndex)
+  {
+    // Dedicated allocation
+    vkFreeMemory(vkDevice, memoryAllocation.vkDeviceMemory, vkAllocationCallbacks);
+    --mStatistics.numberOfDedicatedAllocations;
+    mStatistics.numberOfAllocatedBytes -= memoryAllocation.size;
+  }
+  else
+  {
+    Blocks& blocks = mPools[memoryAllocation.poolIndex];
+    Block& block = blocks[memoryAllocation.blockIndex];
+    RHI_ASSERT(block.vkDeviceMemory == memoryAllocation.vkDeviceMemory, "Invalid Vulkan memory allocation")
+
+    // Merge with the free buddies as long as possible
+    VkDeviceSize offset = memoryAllocation.offset;
+    RECore::uint32 order = memoryAllocation.order;
+    while (order < NUMBER_OF_ORDERS - 1 && block.freeOffsets[order].erase(offset ^ ::detail::getOrderSize(order)) > 0)
+    {
+      offset &= ~::detail::getOrderSize(order);
+      ++order;
+    }
+    block.freeOffsets[order].insert(offset);
+    block.numberOfUsedBytes -= memoryAllocation.size;
+
+    // Release empty blocks, but keep at least one block per pool to avoid allocation ping-pong
+    if (0 == block.numberOfUsedBytes)
+    {
+      const bool otherBlockExists = std::any_of(blocks.cbegin(), blocks.cend(), [&block](const Block& otherBlock) { return (&otherBlock != &block && VK_NULL_HANDLE != otherBlock.vkDeviceMemory); });
+      if (otherBlockExists)
+      {
+        vkFreeMemory(vkDevice, block.vkDeviceMemory, vkAllocationCallbacks);
+        block.vkDeviceMemory = VK_NULL_HANDLE;
+        block.mappedData = nullptr;
+        block.freeOffsets[NUMBER_OF_ORDERS - 1].clear();
+        --mStatistics.numberOfBlocks;
+        mStatistics.numberOfAllocatedBytes -= BLOCK_SIZE;
+      }
+    }
+  }
+
+  // Done
+  memoryAllocation = {};
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool MemoryAllocator::allocateVkDeviceMemory(RECore::uint32 memoryTypeIndex, VkDeviceSize numberOfBytes, VkDeviceMemory& vkDeviceMemory, void** mappedData) const
+{
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+
+  // Allocate the Vulkan device memory
+  const VkMemoryAllocateInfo vkMemoryAllocateInfo =
+    {
+      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	// sType (VkStructureType)
+      nullptr,								// pNext (const void*)
+      numberOfBytes,							// allocationSize (VkDeviceSize)
+      memoryTypeIndex							// memoryTypeIndex (RECore::uint32)
+    };
+  if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vkAllocationCallbacks, &vkDeviceMemory) != VK_SUCCESS)
+  {
+    RE_LOG(Critical, "Failed to allocate the Vulkan memory")
+    vkDeviceMemory = VK_NULL_HANDLE;
+    return false;
+  }
+
+  // Persistently map host visible Vulkan device memory
+  *mappedData = nullptr;
+  if ((mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0 && vkMapMemory(vkDevice, vkDeviceMemory, 0, VK_WHOLE_SIZE, 0, mappedData) != VK_SUCCESS)
+  {
+    RE_LOG(Critical, "Failed to map the Vulkan memory")
+    vkFreeMemory(vkDevice, vkDeviceMemory, vkAllocationCallbacks);
+    vkDeviceMemory = VK_NULL_HANDLE;
+    *mappedData = nullptr;
+    return false;
+  }
+
+  // Done
+  return true;
+}
+
+bool MemoryAllocator::allocateFromBlock(Block& block, RECore::uint32 order, VkDeviceSize& offset) const
+{
+  // Find the smallest free buddy which is large enough
+  RECore::uint32 freeOrder = order;
+  while (freeOrder < NUMBER_OF_ORDERS && block.freeOffsets[freeOrder].empty())
+  {
+    ++freeOrder;
+  }
+  if (NUMBER_OF_ORDERS == freeOrder)
+  {
+    // The block has no free buddy which is large enough
+    return false;
+  }
+
+  // Take the free buddy and split it down to the requested order, the upper halves become free buddies
+  FreeOffsets::iterator iterator = block.freeOffsets[freeOrder].begin();
+  offset = *iterator;
+  block.freeOffsets[freeOrder].erase(iterator);
+  while (freeOrder > order)
+  {
+    --freeOrder;
+    block.freeOffsets[freeOrder].insert(offset + ::detail::getOrderSize(freeOrder));
+  }
+
+  // Done
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERHIVulkan
@@ -24,6 +24,7 @@
 #include "RERHIVulkan/RHIDynamicRHI.h"
 #include "RERHIVulkan/Helper.h"
 #include "RERHIVulkan/Mapping.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 #include "RERHIVulkan/VulkanContext.h"
 #include "RERHIVulkan/VulkanRuntimeLinking.h"
 #include "RERHIVulkan/RHIResourceGroup.h"
@@ -440,6 +441,8 @@ RHIDynamicRHI::RHIDynamicRHI(const RERHI::RHIContext& context) :
   mDefaultSamplerState(nullptr),
   mInsideVulkanRenderPass(false),
   mVkClearValues{},
+  mFrameNumber(0),
+  mNumberOfFramesInFlight(1),
   mVertexArray(nullptr),
   mRenderTarget(nullptr)
 {
@@ -545,10 +548,13 @@ void RHIDynamicRHI::dispatchCommandBufferInternal(const RERHI::RHICommandBuffer&
   RERHI::ConstCommandPacket constCommandPacket = commandPacketBuffer;
   while (nullptr != constCommandPacket)
   {
-    { // Dispatch command packet
+    { // Dispatch command packet, unless it doesn't change the bound state
       const RERHI::CommandDispatchFunctionIndex commandDispatchFunctionIndex = RERHI::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket);
       const void* command = RERHI::CommandPacketHelper::loadCommand(constCommandPacket);
-      detail::DISPATCH_FUNCTIONS[static_cast<RECore::uint32>(commandDispatchFunctionIndex)](command, *this);
+      if (!mRedundantCommandFilter.isRedundant(commandDispatchFunctionIndex, command))
+      {
+        detail::DISPATCH_FUNCTIONS[static_cast<RECore::uint32>(commandDispatchFunctionIndex)](command, *this);
+      }
     }
 
     { // Next command
@@ -1284,42 +1290,48 @@ bool RHIDynamicRHI::map(RERHI::RHIResource& resource, RECore::uint32, RERHI::Map
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<VertexBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::INDEX_BUFFER:
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<IndexBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::TEXTURE_BUFFER:
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<TextureBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::STRUCTURED_BUFFER:
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<StructuredBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::INDIRECT_BUFFER:
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<IndirectBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::UNIFORM_BUFFER:
     {
       mappedSubresource.rowPitch   = 0;
       mappedSubresource.depthPitch = 0;
-      return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+      mappedSubresource.data	   = static_cast<UniformBuffer&>(resource).getMemoryAllocation().mappedData;
+      return (nullptr != mappedSubresource.data);
     }
 
     case RERHI::ResourceType::TEXTURE_1D:
@@ -1401,37 +1413,37 @@ void RHIDynamicRHI::unmap(RERHI::RHIResource& resource, RECore::uint32)
   {
     case RERHI::ResourceType::VERTEX_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
     case RERHI::ResourceType::INDEX_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
     case RERHI::ResourceType::TEXTURE_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
     case RERHI::ResourceType::STRUCTURED_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
     case RERHI::ResourceType::INDIRECT_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
     case RERHI::ResourceType::UNIFORM_BUFFER:
     {
-      vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory());
+      // Nothing to do in here, host visible memory is persistently mapped
       break;
     }
 
@@ -1579,6 +1591,9 @@ void RHIDynamicRHI::dispatchCommandBuffer(const RERHI::RHICommandBuffer& command
     };
   if (vkBeginCommandBuffer(getVulkanContext().getVkCommandBuffer(), &vkCommandBufferBeginInfo) == VK_SUCCESS)
   {
+    // Forget about the tracked bound state, each dispatch records into a freshly begun Vulkan command buffer
+    mRedundantCommandFilter.reset();
+
     // Dispatch command buffer
     dispatchCommandBufferInternal(commandBuffer);
 
@@ -1596,6 +1611,9 @@ void RHIDynamicRHI::dispatchCommandBuffer(const RERHI::RHICommandBuffer& command
       // Error!
       RE_LOG(Critical, "Failed to end Vulkan command buffer instance")
     }
+
+    // The recorded frame is complete, submit the uploads it might use right away instead of leaving them in the staging ring until the next present or until the ring is full
+    getVulkanContext().getUploadContext().flush();
   }
   else
   {
@@ -1605,6 +1623,94 @@ void RHIDynamicRHI::dispatchCommandBuffer(const RERHI::RHICommandBuffer& command
 }
 
 
+//[-------------------------------------------------------]
+//[ Memory statistics                                     ]
+//[-------------------------------------------------------]
+bool RHIDynamicRHI::getMemoryStatistics(RERHI::MemoryStatistics& memoryStatistics) const
+{
+  if (!mVulkanContext->isInitialized())
+  {
+    // Error! There's no memory allocator without an initialized Vulkan context.
+    memoryStatistics = {};
+    return false;
+  }
+  memoryStatistics = mVulkanContext->getMemoryAllocator().getStatistics();
+  return true;
+}
+
+
+//[-------------------------------------------------------]
+//[ Pipeline cache                                        ]
+//[-------------------------------------------------------]
+bool RHIDynamicRHI::getPipelineCacheData(RECore::uint32& numberOfDataBytes, RECore::uint8* data)
+{
+  const VkPipelineCache vkPipelineCache = getVulkanContext().getVkPipelineCache();
+  if (VK_NULL_HANDLE == vkPipelineCache)
+  {
+    numberOfDataBytes = 0;
+    return false;
+  }
+
+  // Either query the number of bytes required or receive the Vulkan pipeline cache data, the data starts with a "VkPipelineCacheHeaderVersionOne" header
+  size_t dataSize = (nullptr != data) ? numberOfDataBytes : 0;
+  const VkResult vkResult = vkGetPipelineCacheData(getVulkanContext().getVkDevice(), vkPipelineCache, &dataSize, data);
+  numberOfDataBytes = static_cast<RECore::uint32>(dataSize);
+  return (VK_SUCCESS == vkResult);
+}
+
+bool RHIDynamicRHI::setPipelineCacheData(RECore::uint32 numberOfDataBytes, const RECore::uint8* data)
+{
+  // Sanity check
+  RHI_ASSERT(nullptr != data, "Invalid Vulkan pipeline cache data")
+
+  const VkPipelineCache vkPipelineCache = getVulkanContext().getVkPipelineCache();
+  if (VK_NULL_HANDLE == vkPipelineCache || numberOfDataBytes < sizeof(VkPipelineCacheHeaderVersionOne))
+  {
+    return false;
+  }
+
+  { // Validate the header, a pipeline cache is only valid for the very same device and driver
+    // -> Drivers have to ignore incompatible data, but there are enough drivers out there crashing instead
+    VkPipelineCacheHeaderVersionOne vkPipelineCacheHeaderVersionOne;
+    memcpy(&vkPipelineCacheHeaderVersionOne, data, sizeof(VkPipelineCacheHeaderVersionOne));
+    VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+    vkGetPhysicalDeviceProperties(getVulkanContext().getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
+    if (vkPipelineCacheHeaderVersionOne.headerSize < sizeof(VkPipelineCacheHeaderVersionOne) ||
+        vkPipelineCacheHeaderVersionOne.headerSize > numberOfDataBytes ||
+        VK_PIPELINE_CACHE_HEADER_VERSION_ONE != vkPipelineCacheHeaderVersionOne.headerVersion ||
+        vkPhysicalDeviceProperties.vendorID != vkPipelineCacheHeaderVersionOne.vendorID ||
+        vkPhysicalDeviceProperties.deviceID != vkPipelineCacheHeaderVersionOne.deviceID ||
+        memcmp(vkPhysicalDeviceProperties.pipelineCacheUUID, vkPipelineCacheHeaderVersionOne.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+      RE_LOG(Info, "Ignoring Vulkan pipeline cache data which was created by another device or driver version")
+      return false;
+    }
+  }
+
+  // Create a temporary Vulkan pipeline cache with the given data and merge it into the Vulkan pipeline cache used for pipeline creation
+  const VkDevice vkDevice = getVulkanContext().getVkDevice();
+  const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+  {
+    VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+    nullptr,										// pNext (const void*)
+    0,												// flags (VkPipelineCacheCreateFlags)
+    numberOfDataBytes,								// initialDataSize (size_t)
+    data											// pInitialData (const void*)
+  };
+  VkPipelineCache sourceVkPipelineCache = VK_NULL_HANDLE;
+  if (vkCreatePipelineCache(vkDevice, &vkPipelineCacheCreateInfo, getVkAllocationCallbacks(), &sourceVkPipelineCache) != VK_SUCCESS)
+  {
+    RE_LOG(Warning, "Failed to create the Vulkan pipeline cache from serialized data")
+    return false;
+  }
+  const bool result = (vkMergePipelineCaches(vkDevice, vkPipelineCache, 1, &sourceVkPipelineCache) == VK_SUCCESS);
+  vkDestroyPipelineCache(vkDevice, sourceVkPipelineCache, getVkAllocationCallbacks());
+
+  // Done
+  return result;
+}
+
+
 //[-------------------------------------------------------]
 //[ Private methods                                       ]
 //[-------------------------------------------------------]
@@ -1699,6 +1805,9 @@ void RHIDynamicRHI::initializeCapabilities()
   // Vulkan has native multithreading
   mCapabilities.nativeMultithreading = false;	// TODO(naetherm) Enable native multithreading when done
 
+  // Vulkan objects aren't bound to a thread, command buffers can be dispatched and swap chains presented by a dedicated render thread
+  mCapabilities.threadedSubmission = true;
+
   // Vulkan has shader bytecode support
   mCapabilities.shaderBytecode = false;	// TODO(naetherm) Vulkan has shader bytecode support, set "mCapabilities.shaderBytecode" to true later on
 
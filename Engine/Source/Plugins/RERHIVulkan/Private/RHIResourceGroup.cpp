@@ -49,17 +49,26 @@
 //[-------------------------------------------------------]
 namespace RERHIVulkan {
 
-ResourceGroup::ResourceGroup(RootSignature &rootSignature, RECore::uint32 rootParameterIndex, VkDescriptorSet vkDescriptorSet,
+ResourceGroup::ResourceGroup(RootSignature &rootSignature, RECore::uint32 rootParameterIndex, RECore::uint64 contentHash,
                              RECore::uint32 numberOfResources, RERHI::RHIResource **resources,
                              RERHI::RHISamplerState **samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
   RHIResourceGroup(rootSignature.getRhi() RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mRootSignature(rootSignature),
-  mVkDescriptorSet(vkDescriptorSet),
+  mContentHash(contentHash),
+  mVkDescriptorSet(VK_NULL_HANDLE),
   mNumberOfResources(numberOfResources),
   mResources(RHI_MALLOC_TYPED(rootSignature.getRhi().getContext(), RERHI::RHIResource*, mNumberOfResources)),
   mSamplerStates(nullptr) {
   mRootSignature.AddReference();
 
+  // Acquire the Vulkan descriptor set, sampler resource groups have none since Vulkan is using combined image samplers
+  bool writeVkDescriptorSet = false;
+  if ((*resources)->getResourceType() != RERHI::ResourceType::SAMPLER_STATE) {
+    bool vkDescriptorSetWritten = false;
+    mVkDescriptorSet = mRootSignature.acquireVkDescriptorSet(rootParameterIndex, mContentHash, numberOfResources, resources, samplerStates, vkDescriptorSetWritten);
+    writeVkDescriptorSet = (VK_NULL_HANDLE != mVkDescriptorSet && !vkDescriptorSetWritten);
+  }
+
   // Process all resources and add our reference to the RHI resource
   const RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(getRhi());
   const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
@@ -78,6 +87,11 @@ ResourceGroup::ResourceGroup(RootSignature &rootSignature, RECore::uint32 rootPa
     mResources[resourceIndex] = resource;
     resource->AddReference();
 
+    // Nothing to write in case there is no Vulkan descriptor set or it is shared with resource groups having the very same content
+    if (!writeVkDescriptorSet) {
+      continue;
+    }
+
     // Check the type of resource to set
     // TODO(naetherm) Some additional resource type root signature security checks in debug build?
     const RERHI::ResourceType resourceType = resource->getResourceType();
@@ -406,10 +420,9 @@ ResourceGroup::~ResourceGroup() {
   }
   RHI_FREE(context, mResources);
 
-// Free Vulkan descriptor set
+// Release Vulkan descriptor set
   if (VK_NULL_HANDLE != mVkDescriptorSet) {
-    vkFreeDescriptorSets(static_cast<RHIDynamicRHI &>(mRootSignature.getRhi()).getVulkanContext().getVkDevice(),
-                         mRootSignature.getVkDescriptorPool(), 1, &mVkDescriptorSet);
+    mRootSignature.releaseVkDescriptorSet(mContentHash, mVkDescriptorSet);
   }
   mRootSignature.Release();
 }
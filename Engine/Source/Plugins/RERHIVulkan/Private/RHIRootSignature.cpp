@@ -27,6 +27,9 @@
 #include "RERHIVulkan/RHIDynamicRHI.h"
 #include "RERHIVulkan/Helper.h"
 #include "RERHIVulkan/Mapping.h"
+#include <RECore/Math/Math.h>
+
+#include <algorithm>
 
 
 //[-------------------------------------------------------]
@@ -38,10 +41,7 @@ RootSignature::RootSignature(RHIDynamicRHI &vulkanRhi, const RERHI::RootSignatur
                              RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
   RHIRootSignature(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mRootSignature(rootSignature),
-  mVkPipelineLayout(VK_NULL_HANDLE),
-  mVkDescriptorPool(VK_NULL_HANDLE) {
-  static constexpr RECore::uint32 maxSets = 4242;  // TODO(naetherm) We probably need to get this provided from the outside
-
+  mVkPipelineLayout(VK_NULL_HANDLE) {
   // Copy the parameter data
   const RERHI::RHIContext &context = vulkanRhi.getContext();
   const RECore::uint32 numberOfRootParameters = mRootSignature.numberOfParameters;
@@ -87,6 +87,7 @@ RootSignature::RootSignature(RHIDynamicRHI &vulkanRhi, const RERHI::RootSignatur
     // Fill the Vulkan descriptor set layout bindings
     vkDescriptorSetLayouts.reserve(numberOfRootParameters);
     mVkDescriptorSetLayouts.resize(numberOfRootParameters);
+    mFreeVkDescriptorSets.resize(numberOfRootParameters);
     std::fill(mVkDescriptorSetLayouts.begin(), mVkDescriptorSetLayouts.end(),
               static_cast<VkDescriptorSetLayout>(VK_NULL_HANDLE));  // TODO(naetherm) Get rid of this
     typedef std::vector<VkDescriptorSetLayoutBinding> VkDescriptorSetLayoutBindings;
@@ -281,75 +282,39 @@ RootSignature::RootSignature(RHIDynamicRHI &vulkanRhi, const RERHI::RootSignatur
     }
   }
 
-  { // Create the Vulkan descriptor pool
-    typedef std::array<VkDescriptorPoolSize, 3> VkDescriptorPoolSizes;
-    VkDescriptorPoolSizes vkDescriptorPoolSizes;
-    RECore::uint32 numberOfVkDescriptorPoolSizes = 0;
+  { // Gather the Vulkan descriptor pool sizes, the Vulkan descriptor pools themselves are created on demand when allocating Vulkan descriptor sets
+    mVkDescriptorPoolSizes.reserve(6);
 
     // "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
     if (numberOfCombinedImageSamplers > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfCombinedImageSamplers;    // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfCombinedImageSamplers});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
     // "VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER"
     if (numberOfUniformTexelBuffers > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformTexelBuffers;  // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfUniformTexelBuffers});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
     // "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER"
     if (numberOfStorageTexelBuffers > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageTexelBuffers;  // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfStorageTexelBuffers});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
     // "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER"
     if (numberOfUniformBuffers > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformBuffers;  // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfUniformBuffers});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
     // "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE"
     if (numberOfStorageImage > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageImage;    // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfStorageImage});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
     // "VK_DESCRIPTOR_TYPE_STORAGE_BUFFER"
     if (numberOfStorageBuffers > 0) {
-      VkDescriptorPoolSize &vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-      vkDescriptorPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;  // type (VkDescriptorType)
-      vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageBuffers;  // descriptorCount (RECore::uint32)
-      ++numberOfVkDescriptorPoolSizes;
+      mVkDescriptorPoolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, NUMBER_OF_DESCRIPTOR_SETS_PER_POOL * numberOfStorageBuffers});  // type (VkDescriptorType), descriptorCount (RECore::uint32)
     }
 
-    // Create the Vulkan descriptor pool
-    if (numberOfVkDescriptorPoolSizes > 0) {
-      const VkDescriptorPoolCreateInfo VkDescriptorPoolCreateInfo =
-        {
-          VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,    // sType (VkStructureType)
-          nullptr,                      // pNext (const void*)
-          VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,  // flags (VkDescriptorPoolCreateFlags)
-          maxSets,                      // maxSets (RECore::uint32)
-          numberOfVkDescriptorPoolSizes,            // poolSizeCount (RECore::uint32)
-          vkDescriptorPoolSizes.data()            // pPoolSizes (const VkDescriptorPoolSize*)
-        };
-      if (vkCreateDescriptorPool(vkDevice, &VkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(),
-                                 &mVkDescriptorPool) != VK_SUCCESS) {
-        RE_LOG(Critical, "Failed to create the Vulkan descriptor pool")
-      }
-    }
   }
 
   // Assign a default name to the resource for debugging purposes
@@ -362,7 +327,6 @@ RootSignature::RootSignature(RHIDynamicRHI &vulkanRhi, const RERHI::RootSignatur
             Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT_EXT, (RECore::uint64)vkDescriptorSetLayout, detailedDebugName);
           }
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT, (RECore::uint64)mVkPipelineLayout, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT, (RECore::uint64)mVkDescriptorPool, detailedDebugName);
         }
 #endif
 }
@@ -375,9 +339,9 @@ RootSignature::~RootSignature() {
   const RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(getRhi());
   const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 
-// Destroy the Vulkan descriptor pool
-  if (VK_NULL_HANDLE != mVkDescriptorPool) {
-    vkDestroyDescriptorPool(vkDevice, mVkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
+// Destroy the Vulkan descriptor pools, this implicitly frees all Vulkan descriptor sets allocated from them
+  for (VkDescriptorPool vkDescriptorPool: mVkDescriptorPools) {
+    vkDestroyDescriptorPool(vkDevice, vkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
   }
 
 // Destroy the Vulkan pipeline layout
@@ -408,6 +372,96 @@ RootSignature::~RootSignature() {
 }
 
 
+VkDescriptorSet RootSignature::acquireVkDescriptorSet(RECore::uint32 rootParameterIndex, RECore::uint64 contentHash, RECore::uint32 numberOfResources, RERHI::RHIResource* const* resources, RERHI::RHISamplerState* const* samplerStates, bool& vkDescriptorSetWritten) {
+  // Sanity check
+  RHI_ASSERT(rootParameterIndex < mVkDescriptorSetLayouts.size(), "The Vulkan root parameter index is out-of-bounds")
+
+  // Share the Vulkan descriptor set with resource groups having the very same content, if there's one
+  // -> The content hash only selects the candidates, a collision must not result in a Vulkan descriptor set referencing the wrong resources
+  const std::pair<CachedDescriptorSets::iterator, CachedDescriptorSets::iterator> range = mCachedDescriptorSets.equal_range(contentHash);
+  for (CachedDescriptorSets::iterator iterator = range.first; iterator != range.second; ++iterator) {
+    CachedDescriptorSet &cachedDescriptorSet = iterator->second;
+    if (cachedDescriptorSet.rootParameterIndex == rootParameterIndex && cachedDescriptorSet.resources.size() == numberOfResources &&
+        std::equal(cachedDescriptorSet.resources.cbegin(), cachedDescriptorSet.resources.cend(), resources) &&
+        (nullptr == samplerStates ? cachedDescriptorSet.samplerStates.empty() : (cachedDescriptorSet.samplerStates.size() == numberOfResources && std::equal(cachedDescriptorSet.samplerStates.cbegin(), cachedDescriptorSet.samplerStates.cend(), samplerStates)))) {
+      ++cachedDescriptorSet.numberOfReferences;
+      vkDescriptorSetWritten = true;
+      return cachedDescriptorSet.vkDescriptorSet;
+    }
+  }
+  vkDescriptorSetWritten = false;
+
+  // Vulkan descriptor sets released during frames the GPU is done with can be recycled
+  const RHIDynamicRHI &vulkanRhi = static_cast<const RHIDynamicRHI &>(getRhi());
+  for (size_t i = 0; i < mReleasedDescriptorSets.size();) {
+    const ReleasedDescriptorSet &releasedDescriptorSet = mReleasedDescriptorSets[i];
+    if (vulkanRhi.isFrameCompleted(releasedDescriptorSet.frameNumber)) {
+      mFreeVkDescriptorSets[releasedDescriptorSet.rootParameterIndex].push_back(releasedDescriptorSet.vkDescriptorSet);
+      mReleasedDescriptorSets[i] = mReleasedDescriptorSets.back();
+      mReleasedDescriptorSets.pop_back();
+    } else {
+      ++i;
+    }
+  }
+
+  // Get a Vulkan descriptor set, either a recycled one or a new one
+  VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+  VkDescriptorSets &freeVkDescriptorSets = mFreeVkDescriptorSets[rootParameterIndex];
+  if (freeVkDescriptorSets.empty()) {
+    // Allocate from the current Vulkan descriptor pool, create a new Vulkan descriptor pool in case the current one is exhausted
+    const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
+    for (int attempt = 0; attempt < 2 && VK_NULL_HANDLE == vkDescriptorSet; ++attempt) {
+      if (mVkDescriptorPools.empty() || attempt > 0) {
+        const VkDescriptorPool vkDescriptorPool = createVkDescriptorPool();
+        if (VK_NULL_HANDLE == vkDescriptorPool) {
+          break;
+        }
+        mVkDescriptorPools.push_back(vkDescriptorPool);
+      }
+      const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
+        {
+          VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,  // sType (VkStructureType)
+          nullptr,                    // pNext (const void*)
+          mVkDescriptorPools.back(),          // descriptorPool (VkDescriptorPool)
+          1,                        // descriptorSetCount (RECore::uint32)
+          &mVkDescriptorSetLayouts[rootParameterIndex]  // pSetLayouts (const VkDescriptorSetLayout*)
+        };
+      if (vkAllocateDescriptorSets(vkDevice, &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS) {
+        vkDescriptorSet = VK_NULL_HANDLE;
+      }
+    }
+    if (VK_NULL_HANDLE == vkDescriptorSet) {
+      RE_LOG(Critical, "Failed to allocate the Vulkan descriptor set")
+      return VK_NULL_HANDLE;
+    }
+  } else {
+    vkDescriptorSet = freeVkDescriptorSets.back();
+    freeVkDescriptorSets.pop_back();
+  }
+
+  // Register the Vulkan descriptor set so resource groups with the very same content can share it
+  mCachedDescriptorSets.emplace(contentHash, CachedDescriptorSet{vkDescriptorSet, rootParameterIndex, 1, Resources(resources, resources + numberOfResources),
+    (nullptr != samplerStates) ? SamplerStates(samplerStates, samplerStates + numberOfResources) : SamplerStates()});
+
+  // Done
+  return vkDescriptorSet;
+}
+
+void RootSignature::releaseVkDescriptorSet(RECore::uint64 contentHash, VkDescriptorSet vkDescriptorSet) {
+  const std::pair<CachedDescriptorSets::iterator, CachedDescriptorSets::iterator> range = mCachedDescriptorSets.equal_range(contentHash);
+  CachedDescriptorSets::iterator iterator = std::find_if(range.first, range.second, [vkDescriptorSet](const CachedDescriptorSets::value_type &value) { return value.second.vkDescriptorSet == vkDescriptorSet; });
+  RHI_ASSERT(range.second != iterator, "Unknown Vulkan descriptor set")
+  RHI_ASSERT(iterator->second.numberOfReferences > 0, "Invalid Vulkan descriptor set number of references")
+  --iterator->second.numberOfReferences;
+  if (0 == iterator->second.numberOfReferences) {
+    // The GPU might still use the Vulkan descriptor set in the frames in flight, so it can't be recycled right now
+    mReleasedDescriptorSets.push_back(
+      {iterator->second.vkDescriptorSet, iterator->second.rootParameterIndex, static_cast<const RHIDynamicRHI &>(getRhi()).getFrameNumber()});
+    mCachedDescriptorSets.erase(iterator);
+  }
+}
+
+
 // TODO(naetherm) Try to somehow simplify the internal dependencies to be able to put this method directly into the class
 RERHI::RHIResourceGroup *RootSignature::createResourceGroup(RECore::uint32 rootParameterIndex, RECore::uint32 numberOfResources,
                                                             RERHI::RHIResource **resources,
@@ -417,34 +471,51 @@ RERHI::RHIResourceGroup *RootSignature::createResourceGroup(RECore::uint32 rootP
   const RERHI::RHIContext &context = vulkanRhi.getContext();
 
   // Sanity checks
-  RHI_ASSERT(VK_NULL_HANDLE != mVkDescriptorPool, "The Vulkan descriptor pool instance must be valid")
+  RHI_ASSERT(!mVkDescriptorPoolSizes.empty() || (*resources)->getResourceType() == RERHI::ResourceType::SAMPLER_STATE, "The Vulkan descriptor pool sizes must be valid")
   RHI_ASSERT(rootParameterIndex < mVkDescriptorSetLayouts.size(), "The Vulkan root parameter index is out-of-bounds")
   RHI_ASSERT(numberOfResources > 0, "The number of Vulkan resources must not be zero")
   RHI_ASSERT(nullptr != resources, "The Vulkan resource pointers must be valid")
 
-  // Allocate Vulkan descriptor set
-  VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
-  if ((*resources)->getResourceType() != RERHI::ResourceType::SAMPLER_STATE) {
-    const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
-      {
-        VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,  // sType (VkStructureType)
-        nullptr,                    // pNext (const void*)
-        mVkDescriptorPool,                // descriptorPool (VkDescriptorPool)
-        1,                        // descriptorSetCount (RECore::uint32)
-        &mVkDescriptorSetLayouts[rootParameterIndex]  // pSetLayouts (const VkDescriptorSetLayout*)
-      };
-    if (vkAllocateDescriptorSets(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorSetAllocateInfo,
-                                 &vkDescriptorSet) != VK_SUCCESS) {
-      RE_LOG(Critical, "Failed to allocate the Vulkan descriptor set")
-    }
+  // Calculate the content hash, resource groups with the very same content share a Vulkan descriptor set
+  // -> The resource group keeps a reference to the resources and sampler states, so their addresses can't be reused as long as the Vulkan descriptor set is shared
+  RECore::uint64 contentHash = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(&rootParameterIndex), sizeof(RECore::uint32));
+  contentHash = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(resources), sizeof(RERHI::RHIResource*) * numberOfResources, contentHash);
+  if (nullptr != samplerStates) {
+    contentHash = RECore::Math::calculateFNV1a64(reinterpret_cast<const RECore::uint8*>(samplerStates), sizeof(RERHI::RHISamplerState*) * numberOfResources, contentHash);
   }
 
   // Create resource group
-  return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorSet, numberOfResources, resources,
+  return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, contentHash, numberOfResources, resources,
                                          samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 }
 
 
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+VkDescriptorPool RootSignature::createVkDescriptorPool() const {
+  const RHIDynamicRHI &vulkanRhi = static_cast<const RHIDynamicRHI &>(getRhi());
+
+  // No "VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT", Vulkan descriptor sets are recycled instead of freed
+  const VkDescriptorPoolCreateInfo vkDescriptorPoolCreateInfo =
+    {
+      VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,              // sType (VkStructureType)
+      nullptr,                                // pNext (const void*)
+      0,                                    // flags (VkDescriptorPoolCreateFlags)
+      NUMBER_OF_DESCRIPTOR_SETS_PER_POOL,                    // maxSets (RECore::uint32)
+      static_cast<RECore::uint32>(mVkDescriptorPoolSizes.size()),        // poolSizeCount (RECore::uint32)
+      mVkDescriptorPoolSizes.data()                        // pPoolSizes (const VkDescriptorPoolSize*)
+    };
+  VkDescriptorPool vkDescriptorPool = VK_NULL_HANDLE;
+  if (vkCreateDescriptorPool(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(),
+                             &vkDescriptorPool) != VK_SUCCESS) {
+    RE_LOG(Critical, "Failed to create the Vulkan descriptor pool")
+    vkDescriptorPool = VK_NULL_HANDLE;
+  }
+  return vkDescriptorPool;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -24,6 +24,7 @@
 #include "RERHIVulkan/RenderTarget/RHISwapChain.h"
 #include "RERHIVulkan/RenderTarget/RHIRenderPass.h"
 #include "RERHIVulkan/VulkanContext.h"
+#include "RERHIVulkan/UploadContext.h"
 #include "RERHIVulkan/RHIDynamicRHI.h"
 #include "RERHIVulkan/Helper.h"
 #include "RERHIVulkan/Mapping.h"
@@ -75,7 +76,7 @@ SwapChain::SwapChain(RERHI::RHIRenderPass &renderPass, RERHI::WindowHandle windo
   mDepthVkFormat(
     Mapping::getVulkanFormat(static_cast<RenderPass &>(renderPass).getDepthStencilAttachmentTextureFormat())),
   mDepthVkImage(VK_NULL_HANDLE),
-  mDepthVkDeviceMemory(VK_NULL_HANDLE),
+  mDepthMemoryAllocation{},
   mDepthVkImageView(VK_NULL_HANDLE) {
   // Create the Vulkan presentation surface instance depending on the operation system
   RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(renderPass.getRhi());
@@ -208,9 +209,12 @@ if (nullptr != mRenderWindow)
 */
 
 // Get the Vulkan context
-  const RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(getRhi());
+  RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(getRhi());
   const VulkanContext &vulkanContext = vulkanRhi.getVulkanContext();
 
+  // Submit pending uploads first, the frame command buffer might use the uploaded resources
+  vulkanContext.getUploadContext().flush();
+
   { // Queue submit
     const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
     const VkCommandBuffer vkCommandBuffer = vulkanContext.getVkCommandBuffer();
@@ -258,6 +262,9 @@ if (nullptr != mRenderWindow)
       }
     }
     vkQueueWaitIdle(vulkanContext.getPresentVkQueue());
+
+    // The GPU is done with the frame, resources released so far can be recycled
+    vulkanRhi.advanceFrameNumber();
   }
 
 // Acquire next image
@@ -267,7 +274,7 @@ if (nullptr != mRenderWindow)
 
 void SwapChain::createVulkanSwapChain() {
   // Get the Vulkan physical device
-  const RHIDynamicRHI &vulkanRhi = static_cast<const RHIDynamicRHI &>(getRhi());
+  RHIDynamicRHI &vulkanRhi = static_cast<RHIDynamicRHI &>(getRhi());
   const RERHI::RHIContext &context = vulkanRhi.getContext();
   const VulkanContext &vulkanContext = vulkanRhi.getVulkanContext();
   const VkPhysicalDevice vkPhysicalDevice = vulkanContext.getVkPhysicalDevice();
@@ -370,6 +377,9 @@ void SwapChain::createVulkanSwapChain() {
       return;
     }
 
+    // Resources released during a frame are recycled only after all frames which might use one of the swap chain images are done
+    vulkanRhi.registerNumberOfFramesInFlight(swapchainImageCount);
+
     // Get the swap chain buffers containing the image and image view
     mSwapChainBuffer.resize(swapchainImageCount);
     const bool hasDepthStencilAttachment = (VK_FORMAT_UNDEFINED != mDepthVkFormat);
@@ -490,7 +500,7 @@ void SwapChain::createDepthRenderTarget(const VkExtent2D &vkExtent2D) {
                                      static_cast<RenderPass &>(getRenderPass()).getVkSampleCountFlagBits(),
                                      VK_IMAGE_TILING_OPTIMAL,
                                      VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
-                                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthVkDeviceMemory);
+                                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthMemoryAllocation);
     Helper::createVkImageView(vulkanRhi, mDepthVkImage, VK_IMAGE_VIEW_TYPE_2D, 1, 1, mDepthVkFormat,
                               VK_IMAGE_ASPECT_DEPTH_BIT, mDepthVkImageView);
     // TODO(naetherm) File "racoonengine\source\rhi\private\vulkanrhi\vulkanrhi.cpp" | Line 1036 | Critical: Vulkan debug report callback: Object type: "VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT" Object: "103612336" Location: "0" Message code: "461375810" Layer prefix: "Validation" Message: " [ VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185 ] Object: 0x62cffb0 (Type = 6) | vkCmdPipelineBarrier(): pImageMemBarriers[0].dstAccessMask (0x600) is not supported by dstStageMask (0x1). The spec valid usage text states 'Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not have any access flag included in its dstAccessMask member if that bit is not supported by any of the pipeline stages in dstStageMask, as specified in the table of supported access types.' (https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185)"
@@ -500,9 +510,9 @@ void SwapChain::createDepthRenderTarget(const VkExtent2D &vkExtent2D) {
 
 void SwapChain::destroyDepthRenderTarget() {
   if (VK_NULL_HANDLE != mDepthVkImage) {
-    RHI_ASSERT(VK_NULL_HANDLE != mDepthVkDeviceMemory, "Invalid Vulkan depth device memory")
+    RHI_ASSERT(VK_NULL_HANDLE != mDepthMemoryAllocation.vkDeviceMemory, "Invalid Vulkan depth device memory")
     RHI_ASSERT(VK_NULL_HANDLE != mDepthVkImageView, "Invalid Vulkan depth image view")
-    Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mDepthVkImage, mDepthVkDeviceMemory,
+    Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mDepthVkImage, mDepthMemoryAllocation,
                                   mDepthVkImageView);
   }
 }
@@ -65,7 +65,7 @@ ComputePipelineState::ComputePipelineState(RHIDynamicRHI &vulkanRhi, RERHI::RHIR
       VK_NULL_HANDLE,                              // basePipelineHandle (VkPipeline)
       0                                    // basePipelineIndex (int32_t)
     };
-  if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1,
+  if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVulkanContext().getVkPipelineCache(), 1,
                                &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) ==
       VK_SUCCESS) {
     // Assign a default name to the resource for debugging purposes
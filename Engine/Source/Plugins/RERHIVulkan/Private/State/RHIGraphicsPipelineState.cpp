@@ -310,7 +310,7 @@ GraphicsPipelineState::GraphicsPipelineState(RHIDynamicRHI &vulkanRhi,
       VK_NULL_HANDLE,                            // basePipelineHandle (VkPipeline)
       0                                  // basePipelineIndex (RECore::int32)
     };
-  if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1,
+  if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVulkanContext().getVkPipelineCache(), 1,
                                 &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) ==
       VK_SUCCESS) {
 // Assign a default name to the resource for debugging purposes
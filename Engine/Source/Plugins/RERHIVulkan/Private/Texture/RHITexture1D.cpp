@@ -37,10 +37,10 @@ Texture1D::Texture1D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RERHI::Text
   RHITexture1D(vulkanRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkImage(VK_NULL_HANDLE),
   mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkImageView(VK_NULL_HANDLE) {
   Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, {width, 1, 1}, textureFormat, data,
-                               textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+                               textureFlags, 1, mVkImage, mMemoryAllocation, mVkImageView);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -49,7 +49,6 @@ Texture1D::Texture1D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RERHI::Text
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "1D texture", 13)	// 13 = "1D texture: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (RECore::uint64)mVkImage, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (RECore::uint64)mVkImageView, detailedDebugName);
         }
 #endif
@@ -60,7 +59,7 @@ Texture1D::Texture1D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RERHI::Text
 *    Destructor
 */
 Texture1D::~Texture1D() {
-  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mMemoryAllocation, mVkImageView);
 }
 
 
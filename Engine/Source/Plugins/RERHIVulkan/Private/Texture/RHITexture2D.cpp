@@ -39,12 +39,12 @@ Texture2D::Texture2D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
   RHITexture2D(vulkanRhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVrVulkanTextureData{},
   mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkImageView(VK_NULL_HANDLE) {
   mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D,
                                                                 {width, height, 1}, textureFormat, data, textureFlags,
                                                                 numberOfMultisamples, mVrVulkanTextureData.m_nImage,
-                                                                mVkDeviceMemory, mVkImageView);
+                                                                mMemoryAllocation, mVkImageView);
 
   // Fill the rest of the "VRVulkanTextureData_t"-structure
   const VulkanContext &vulkanContext = vulkanRhi.getVulkanContext();
@@ -67,7 +67,6 @@ Texture2D::Texture2D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture", 13)	// 13 = "2D texture: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (RECore::uint64)mVrVulkanTextureData.m_nImage, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (RECore::uint64)mVkImageView, detailedDebugName);
         }
 #endif
@@ -78,7 +77,7 @@ Texture2D::Texture2D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
 *    Destructor
 */
 Texture2D::~Texture2D() {
-  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVrVulkanTextureData.m_nImage, mVkDeviceMemory,
+  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVrVulkanTextureData.m_nImage, mMemoryAllocation,
                                 mVkImageView);
 }
 
@@ -38,11 +38,11 @@ Texture2DArray::Texture2DArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, R
   RHITexture2DArray(vulkanRhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkImage(VK_NULL_HANDLE),
   mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkImageView(VK_NULL_HANDLE),
   mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY,
                                          {width, height, numberOfSlices}, textureFormat, data, textureFlags, 1,
-                                         mVkImage, mVkDeviceMemory, mVkImageView)) {
+                                         mVkImage, mMemoryAllocation, mVkImageView)) {
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
   if (nullptr != vkDebugMarkerSetObjectNameEXT)
@@ -50,7 +50,6 @@ Texture2DArray::Texture2DArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, R
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture array", 19)	// 19 = "2D texture array: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (RECore::uint64)mVkImage, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (RECore::uint64)mVkImageView, detailedDebugName);
         }
 #endif
@@ -61,7 +60,7 @@ Texture2DArray::Texture2DArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, R
 *    Destructor
 */
 Texture2DArray::~Texture2DArray() {
-  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mMemoryAllocation, mVkImageView);
 }
 
 
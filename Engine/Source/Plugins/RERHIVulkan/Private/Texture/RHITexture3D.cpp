@@ -38,10 +38,10 @@ Texture3D::Texture3D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
   RHITexture3D(vulkanRhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkImage(VK_NULL_HANDLE),
   mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkImageView(VK_NULL_HANDLE) {
   Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, {width, height, depth},
-                               textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+                               textureFormat, data, textureFlags, 1, mVkImage, mMemoryAllocation, mVkImageView);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -50,7 +50,6 @@ Texture3D::Texture3D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "3D texture", 13)	// 13 = "3D texture: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (RECore::uint64)mVkImage, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (RECore::uint64)mVkImageView, detailedDebugName);
         }
 #endif
@@ -61,7 +60,7 @@ Texture3D::Texture3D(RHIDynamicRHI &vulkanRhi, RECore::uint32 width, RECore::uin
 *    Destructor
 */
 Texture3D::~Texture3D() {
-  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mMemoryAllocation, mVkImageView);
 }
 
 
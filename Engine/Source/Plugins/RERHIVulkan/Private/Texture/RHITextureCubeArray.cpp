@@ -38,11 +38,11 @@ TextureCubeArray::TextureCubeArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 widt
   RHITextureCubeArray(vulkanRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
   mVkImage(VK_NULL_HANDLE),
   mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-  mVkDeviceMemory(VK_NULL_HANDLE),
+  mMemoryAllocation{},
   mVkImageView(VK_NULL_HANDLE) {
   Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY,
                                {width, width, numberOfSlices * 6}, textureFormat, data, textureFlags, 1, mVkImage,
-                               mVkDeviceMemory, mVkImageView);
+                               mMemoryAllocation, mVkImageView);
 
   // Assign a default name to the resource for debugging purposes
 #ifdef DEBUG
@@ -51,7 +51,6 @@ TextureCubeArray::TextureCubeArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 widt
           RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Cube texture array", 21)	// 21 = "Cube texture array: " including terminating zero
           const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (RECore::uint64)mVkImage, detailedDebugName);
-          Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (RECore::uint64)mVkDeviceMemory, detailedDebugName);
           Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (RECore::uint64)mVkImageView, detailedDebugName);
         }
 #endif
@@ -62,7 +61,7 @@ TextureCubeArray::TextureCubeArray(RHIDynamicRHI &vulkanRhi, RECore::uint32 widt
 *    Destructor
 */
 TextureCubeArray::~TextureCubeArray() {
-  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+  Helper::destroyAndFreeVkImage(static_cast<RHIDynamicRHI &>(getRhi()), mVkImage, mMemoryAllocation, mVkImageView);
 }
 
 
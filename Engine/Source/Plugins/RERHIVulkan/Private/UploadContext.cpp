@@ -0,0 +1,494 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERHIVulkan/UploadContext.h"
+#include "RERHIVulkan/VulkanContext.h"
+#include "RERHIVulkan/RHIDynamicRHI.h"
+#include "RERHIVulkan/Helper.h"
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERHIVulkan {
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+UploadContext::UploadContext(const VulkanContext& vulkanContext) :
+mVulkanContext(vulkanContext),
+mTransferVkCommandPool(VK_NULL_HANDLE),
+mGraphicsVkCommandPool(VK_NULL_HANDLE),
+mStagingRingBufferVkBuffer(VK_NULL_HANDLE),
+mStagingRingBufferVkDeviceMemory(VK_NULL_HANDLE),
+mStagingRingBufferData(nullptr),
+mStagingRingBufferHead(0),
+mBatches{},
+mCurrentBatchIndex(0)
+{
+  const RHIDynamicRHI& vulkanRhi = mVulkanContext.getRHIDynamicRHI();
+  const RERHI::RHIContext& context = vulkanRhi.getContext();
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+
+  // Create the Vulkan command pools
+  mGraphicsVkCommandPool = ::detail::createVkCommandPool(context, vulkanRhi.getVkAllocationCallbacks(), vkDevice, mVulkanContext.getGraphicsQueueFamilyIndex());
+  if (VK_NULL_HANDLE == mGraphicsVkCommandPool)
+  {
+    return;
+  }
+  if (hasDedicatedTransferQueue())
+  {
+    mTransferVkCommandPool = ::detail::createVkCommandPool(context, vulkanRhi.getVkAllocationCallbacks(), vkDevice, mVulkanContext.getTransferQueueFamilyIndex());
+    if (VK_NULL_HANDLE == mTransferVkCommandPool)
+    {
+      return;
+    }
+  }
+
+  // Create the batches
+  static constexpr VkFenceCreateInfo vkFenceCreateInfo =
+    {
+      VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// sType (VkStructureType)
+      nullptr,								// pNext (const void*)
+      0										// flags (VkFenceCreateFlags)
+    };
+  static constexpr VkSemaphoreCreateInfo vkSemaphoreCreateInfo =
+    {
+      VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,	// sType (VkStructureType)
+      nullptr,									// pNext (const void*)
+      0											// flags (VkSemaphoreCreateFlags)
+    };
+  for (Batch& batch : mBatches)
+  {
+    batch.graphicsVkCommandBuffer = ::detail::createVkCommandBuffer(context, vkDevice, mGraphicsVkCommandPool);
+    if (VK_NULL_HANDLE != mTransferVkCommandPool)
+    {
+      batch.transferVkCommandBuffer = ::detail::createVkCommandBuffer(context, vkDevice, mTransferVkCommandPool);
+      if (vkCreateSemaphore(vkDevice, &vkSemaphoreCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &batch.vkSemaphore) != VK_SUCCESS)
+      {
+        RE_LOG(Critical, "Failed to create the Vulkan upload semaphore")
+        return;
+      }
+    }
+    if (vkCreateFence(vkDevice, &vkFenceCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &batch.vkFence) != VK_SUCCESS)
+    {
+      RE_LOG(Critical, "Failed to create the Vulkan upload fence")
+      return;
+    }
+  }
+
+  // Create the persistently mapped staging ring buffer
+  void* mappedData = nullptr;
+  if (createStagingBuffer(STAGING_RING_BUFFER_SIZE, mStagingRingBufferVkBuffer, mStagingRingBufferVkDeviceMemory, &mappedData))
+  {
+    mStagingRingBufferData = static_cast<RECore::uint8*>(mappedData);
+  }
+}
+
+UploadContext::~UploadContext()
+{
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+
+  // Wait for pending uploads, this also destroys dedicated staging buffers
+  if (isInitialized())
+  {
+    waitIdle();
+  }
+
+  // Destroy the staging ring buffer
+  if (VK_NULL_HANDLE != mStagingRingBufferVkDeviceMemory)
+  {
+    vkUnmapMemory(vkDevice, mStagingRingBufferVkDeviceMemory);
+  }
+  destroyStagingBuffer(mStagingRingBufferVkBuffer, mStagingRingBufferVkDeviceMemory);
+
+  // Destroy the batches, command buffers are freed together with their command pools
+  for (Batch& batch : mBatches)
+  {
+    if (VK_NULL_HANDLE != batch.vkFence)
+    {
+      vkDestroyFence(vkDevice, batch.vkFence, vkAllocationCallbacks);
+    }
+    if (VK_NULL_HANDLE != batch.vkSemaphore)
+    {
+      vkDestroySemaphore(vkDevice, batch.vkSemaphore, vkAllocationCallbacks);
+    }
+  }
+
+  // Destroy the Vulkan command pools
+  if (VK_NULL_HANDLE != mTransferVkCommandPool)
+  {
+    vkDestroyCommandPool(vkDevice, mTransferVkCommandPool, vkAllocationCallbacks);
+  }
+  if (VK_NULL_HANDLE != mGraphicsVkCommandPool)
+  {
+    vkDestroyCommandPool(vkDevice, mGraphicsVkCommandPool, vkAllocationCallbacks);
+  }
+}
+
+bool UploadContext::hasDedicatedTransferQueue() const
+{
+  return (mVulkanContext.getTransferQueueFamilyIndex() != mVulkanContext.getGraphicsQueueFamilyIndex());
+}
+
+VkCommandBuffer UploadContext::getTransferVkCommandBuffer()
+{
+  const Batch& batch = getRecordingBatch();
+  return (VK_NULL_HANDLE != batch.transferVkCommandBuffer) ? batch.transferVkCommandBuffer : batch.graphicsVkCommandBuffer;
+}
+
+VkCommandBuffer UploadContext::getGraphicsVkCommandBuffer()
+{
+  return getRecordingBatch().graphicsVkCommandBuffer;
+}
+
+void* UploadContext::allocateStagingMemory(VkDeviceSize numberOfBytes, VkDeviceSize alignment, VkBuffer& vkBuffer, VkDeviceSize& offset)
+{
+  RHI_ASSERT(isInitialized(), "The Vulkan upload context isn't initialized")
+  retireCompletedBatches();
+
+  // Uploads which don't fit into the staging ring buffer at all get a dedicated staging buffer which lives as long as the batch
+  if (numberOfBytes > STAGING_RING_BUFFER_SIZE)
+  {
+    Batch& batch = getRecordingBatch();
+    DedicatedStagingBuffer dedicatedStagingBuffer = {};
+    void* mappedData = nullptr;
+    if (createStagingBuffer(numberOfBytes, dedicatedStagingBuffer.vkBuffer, dedicatedStagingBuffer.vkDeviceMemory, &mappedData))
+    {
+      batch.dedicatedStagingBuffers.push_back(dedicatedStagingBuffer);
+      vkBuffer = dedicatedStagingBuffer.vkBuffer;
+      offset = 0;
+      return mappedData;
+    }
+    return nullptr;
+  }
+
+  // Get the aligned staging ring buffer offset, a batch must not wrap around so the used staging ring buffer range of a batch stays contiguous
+  alignment = std::max<VkDeviceSize>(alignment, 1);
+  VkDeviceSize stagingRingBufferOffset = ((mStagingRingBufferHead + alignment - 1) / alignment) * alignment;
+  if (stagingRingBufferOffset + numberOfBytes > STAGING_RING_BUFFER_SIZE)
+  {
+    const Batch& currentBatch = mBatches[mCurrentBatchIndex];
+    if (currentBatch.recording && currentBatch.stagingRingBufferEnd > currentBatch.stagingRingBufferBegin)
+    {
+      flush();
+    }
+    stagingRingBufferOffset = 0;
+  }
+  Batch& batch = getRecordingBatch();
+
+  // Wait for batches in flight which are still reading from the requested staging ring buffer range
+  const VkDeviceSize stagingRingBufferEnd = stagingRingBufferOffset + numberOfBytes;
+  for (Batch& pendingBatch : mBatches)
+  {
+    if (pendingBatch.submitted && pendingBatch.stagingRingBufferBegin < stagingRingBufferEnd && stagingRingBufferOffset < pendingBatch.stagingRingBufferEnd)
+    {
+      retireBatch(pendingBatch, true);
+    }
+  }
+
+  // Done
+  if (batch.stagingRingBufferEnd == batch.stagingRingBufferBegin)
+  {
+    batch.stagingRingBufferBegin = stagingRingBufferOffset;
+  }
+  batch.stagingRingBufferEnd = stagingRingBufferEnd;
+  mStagingRingBufferHead = stagingRingBufferEnd;
+  vkBuffer = mStagingRingBufferVkBuffer;
+  offset = stagingRingBufferOffset;
+  return mStagingRingBufferData + stagingRingBufferOffset;
+}
+
+void UploadContext::transferVkImageOwnership(VkImage vkImage, const VkImageSubresourceRange& vkImageSubresourceRange, VkImageLayout vkImageLayout)
+{
+  Batch& batch = getRecordingBatch();
+  batch.vkImages.push_back(vkImage);
+  if (hasDedicatedTransferQueue())
+  {
+    // Release the image on the transfer queue and acquire it on the graphics queue, the semaphore between both submissions takes care of the execution dependency
+    VkImageMemoryBarrier vkImageMemoryBarrier =
+      {
+        VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,				// sType (VkStructureType)
+        nullptr,											// pNext (const void*)
+        VK_ACCESS_TRANSFER_WRITE_BIT,						// srcAccessMask (VkAccessFlags)
+        0,													// dstAccessMask (VkAccessFlags)
+        vkImageLayout,										// oldLayout (VkImageLayout)
+        vkImageLayout,										// newLayout (VkImageLayout)
+        mVulkanContext.getTransferQueueFamilyIndex(),		// srcQueueFamilyIndex (RECore::uint32)
+        mVulkanContext.getGraphicsQueueFamilyIndex(),		// dstQueueFamilyIndex (RECore::uint32)
+        vkImage,											// image (VkImage)
+        vkImageSubresourceRange								// subresourceRange (VkImageSubresourceRange)
+      };
+    vkCmdPipelineBarrier(batch.transferVkCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &vkImageMemoryBarrier);
+    vkImageMemoryBarrier.srcAccessMask = 0;
+    vkImageMemoryBarrier.dstAccessMask = (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    vkCmdPipelineBarrier(batch.graphicsVkCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &vkImageMemoryBarrier);
+  }
+}
+
+void UploadContext::flush()
+{
+  Batch& batch = mBatches[mCurrentBatchIndex];
+  if (!batch.recording)
+  {
+    // Nothing to submit
+    return;
+  }
+
+  // End the Vulkan command buffers
+  const bool dedicatedTransferQueue = hasDedicatedTransferQueue();
+  if (dedicatedTransferQueue)
+  {
+    vkEndCommandBuffer(batch.transferVkCommandBuffer);
+  }
+  vkEndCommandBuffer(batch.graphicsVkCommandBuffer);
+
+  // Submit the transfer command buffer to the dedicated transfer queue
+  if (dedicatedTransferQueue)
+  {
+    const VkSubmitInfo vkSubmitInfo =
+      {
+        VK_STRUCTURE_TYPE_SUBMIT_INFO,		// sType (VkStructureType)
+        nullptr,							// pNext (const void*)
+        0,									// waitSemaphoreCount (RECore::uint32)
+        nullptr,							// pWaitSemaphores (const VkSemaphore*)
+        nullptr,							// pWaitDstStageMask (const VkPipelineStageFlags*)
+        1,									// commandBufferCount (RECore::uint32)
+        &batch.transferVkCommandBuffer,		// pCommandBuffers (const VkCommandBuffer*)
+        1,									// signalSemaphoreCount (RECore::uint32)
+        &batch.vkSemaphore					// pSignalSemaphores (const VkSemaphore*)
+      };
+    if (vkQueueSubmit(mVulkanContext.getTransferVkQueue(), 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+    {
+      // Error!
+      RE_LOG(Critical, "Vulkan transfer queue submit failed")
+    }
+  }
+
+  { // Submit the graphics command buffer to the graphics queue, everything submitted to the graphics queue afterwards sees the uploaded data
+    static constexpr VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    const VkSubmitInfo vkSubmitInfo =
+      {
+        VK_STRUCTURE_TYPE_SUBMIT_INFO,							// sType (VkStructureType)
+        nullptr,												// pNext (const void*)
+        dedicatedTransferQueue ? 1u : 0u,						// waitSemaphoreCount (RECore::uint32)
+        dedicatedTransferQueue ? &batch.vkSemaphore : nullptr,	// pWaitSemaphores (const VkSemaphore*)
+        dedicatedTransferQueue ? &waitDstStageMask : nullptr,	// pWaitDstStageMask (const VkPipelineStageFlags*)
+        1,														// commandBufferCount (RECore::uint32)
+        &batch.graphicsVkCommandBuffer,							// pCommandBuffers (const VkCommandBuffer*)
+        0,														// signalSemaphoreCount (RECore::uint32)
+        nullptr													// pSignalSemaphores (const VkSemaphore*)
+      };
+    if (vkQueueSubmit(mVulkanContext.getGraphicsVkQueue(), 1, &vkSubmitInfo, batch.vkFence) != VK_SUCCESS)
+    {
+      // Error!
+      RE_LOG(Critical, "Vulkan graphics queue submit failed")
+    }
+  }
+
+  // The batch is now in flight, move on to the next batch
+  batch.recording = false;
+  batch.submitted = true;
+  mCurrentBatchIndex = (mCurrentBatchIndex + 1) % NUMBER_OF_BATCHES;
+}
+
+void UploadContext::waitForVkImage(VkImage vkImage)
+{
+  for (Batch& batch : mBatches)
+  {
+    if (std::find(batch.vkImages.cbegin(), batch.vkImages.cend(), vkImage) != batch.vkImages.cend())
+    {
+      if (batch.recording)
+      {
+        flush();
+      }
+      retireBatch(batch, true);
+    }
+  }
+}
+
+void UploadContext::waitIdle()
+{
+  flush();
+  for (Batch& batch : mBatches)
+  {
+    retireBatch(batch, true);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+UploadContext::Batch& UploadContext::getRecordingBatch()
+{
+  Batch& batch = mBatches[mCurrentBatchIndex];
+  if (!batch.recording)
+  {
+    // Batches are used round robin, so if the batch is still in flight it's the oldest one and we have to wait for it
+    retireBatch(batch, true);
+
+    // Begin the Vulkan command buffers, the Vulkan command pools allow implicit command buffer resets
+    static constexpr VkCommandBufferBeginInfo vkCommandBufferBeginInfo =
+      {
+        VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// sType (VkStructureType)
+        nullptr,										// pNext (const void*)
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// flags (VkCommandBufferUsageFlags)
+        nullptr											// pInheritanceInfo (const VkCommandBufferInheritanceInfo*)
+      };
+    if (VK_NULL_HANDLE != batch.transferVkCommandBuffer && vkBeginCommandBuffer(batch.transferVkCommandBuffer, &vkCommandBufferBeginInfo) != VK_SUCCESS)
+    {
+      RE_LOG(Critical, "Failed to begin Vulkan transfer command buffer instance")
+    }
+    if (vkBeginCommandBuffer(batch.graphicsVkCommandBuffer, &vkCommandBufferBeginInfo) != VK_SUCCESS)
+    {
+      RE_LOG(Critical, "Failed to begin Vulkan graphics command buffer instance")
+    }
+    batch.recording = true;
+  }
+  return batch;
+}
+
+bool UploadContext::retireBatch(Batch& batch, bool wait)
+{
+  if (!batch.submitted)
+  {
+    // Nothing to retire
+    return true;
+  }
+
+  // Check or wait for the batch fence
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  if (wait)
+  {
+    if (vkWaitForFences(vkDevice, 1, &batch.vkFence, VK_TRUE, UINT64_MAX) != VK_SUCCESS)
+    {
+      RE_LOG(Critical, "Failed to wait for the Vulkan upload fence")
+    }
+  }
+  else if (vkGetFenceStatus(vkDevice, batch.vkFence) != VK_SUCCESS)
+  {
+    // The batch is still in flight
+    return false;
+  }
+  vkResetFences(vkDevice, 1, &batch.vkFence);
+
+  // Release the batch resources
+  for (const DedicatedStagingBuffer& dedicatedStagingBuffer : batch.dedicatedStagingBuffers)
+  {
+    destroyStagingBuffer(dedicatedStagingBuffer.vkBuffer, dedicatedStagingBuffer.vkDeviceMemory);
+  }
+  batch.dedicatedStagingBuffers.clear();
+  batch.vkImages.clear();
+  batch.stagingRingBufferBegin = batch.stagingRingBufferEnd = 0;
+  batch.submitted = false;
+
+  // Done
+  return true;
+}
+
+void UploadContext::retireCompletedBatches()
+{
+  for (Batch& batch : mBatches)
+  {
+    retireBatch(batch, false);
+  }
+}
+
+bool UploadContext::createStagingBuffer(VkDeviceSize numberOfBytes, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory, void** mappedData) const
+{
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+
+  // Create the Vulkan buffer
+  const VkBufferCreateInfo vkBufferCreateInfo =
+    {
+      VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,	// sType (VkStructureType)
+      nullptr,								// pNext (const void*)
+      0,										// flags (VkBufferCreateFlags)
+      numberOfBytes,							// size (VkDeviceSize)
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT,		// usage (VkBufferUsageFlags)
+      VK_SHARING_MODE_EXCLUSIVE,				// sharingMode (VkSharingMode)
+      0,										// queueFamilyIndexCount (RECore::uint32)
+      nullptr									// pQueueFamilyIndices (const RECore::uint32*)
+    };
+  if (vkCreateBuffer(vkDevice, &vkBufferCreateInfo, vkAllocationCallbacks, &vkBuffer) != VK_SUCCESS)
+  {
+    RE_LOG(Critical, "Failed to create the Vulkan staging buffer")
+    return false;
+  }
+
+  // Allocate, bind and map host visible memory for the Vulkan buffer
+  VkMemoryRequirements vkMemoryRequirements = {};
+  vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &vkMemoryRequirements);
+  const VkMemoryAllocateInfo vkMemoryAllocateInfo =
+    {
+      VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,																												// sType (VkStructureType)
+      nullptr,																																			// pNext (const void*)
+      vkMemoryRequirements.size,																															// allocationSize (VkDeviceSize)
+      mVulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)	// memoryTypeIndex (RECore::uint32)
+    };
+  if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vkAllocationCallbacks, &vkDeviceMemory) != VK_SUCCESS)
+  {
+    RE_LOG(Critical, "Failed to allocate the Vulkan staging buffer memory")
+    destroyStagingBuffer(vkBuffer, VK_NULL_HANDLE);
+    vkBuffer = VK_NULL_HANDLE;
+    return false;
+  }
+  if (vkBindBufferMemory(vkDevice, vkBuffer, vkDeviceMemory, 0) != VK_SUCCESS || vkMapMemory(vkDevice, vkDeviceMemory, 0, numberOfBytes, 0, mappedData) != VK_SUCCESS)
+  {
+    RE_LOG(Critical, "Failed to map the Vulkan staging buffer memory")
+    destroyStagingBuffer(vkBuffer, vkDeviceMemory);
+    vkBuffer = VK_NULL_HANDLE;
+    vkDeviceMemory = VK_NULL_HANDLE;
+    return false;
+  }
+
+  // Done
+  return true;
+}
+
+void UploadContext::destroyStagingBuffer(VkBuffer vkBuffer, VkDeviceMemory vkDeviceMemory) const
+{
+  const VkDevice vkDevice = mVulkanContext.getVkDevice();
+  const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanContext.getRHIDynamicRHI().getVkAllocationCallbacks();
+  if (VK_NULL_HANDLE != vkBuffer)
+  {
+    vkDestroyBuffer(vkDevice, vkBuffer, vkAllocationCallbacks);
+  }
+  if (VK_NULL_HANDLE != vkDeviceMemory)
+  {
+    // Freeing mapped memory implicitly unmaps it
+    vkFreeMemory(vkDevice, vkDeviceMemory, vkAllocationCallbacks);
+  }
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERHIVulkan
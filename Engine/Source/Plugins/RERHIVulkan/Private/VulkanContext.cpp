@@ -23,6 +23,8 @@
 //[-------------------------------------------------------]
 #include "RERHIVulkan/VulkanContext.h"
 #include "RERHIVulkan/RHIDynamicRHI.h"
+#include "RERHIVulkan/UploadContext.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 #include "RERHIVulkan/Helper.h"
 #include "RERHIVulkan/Mapping.h"
 
@@ -38,10 +40,15 @@ mVkPhysicalDevice(VK_NULL_HANDLE),
 mVkDevice(VK_NULL_HANDLE),
 mGraphicsQueueFamilyIndex(~0u),
 mPresentQueueFamilyIndex(~0u),
+mTransferQueueFamilyIndex(~0u),
 mGraphicsVkQueue(VK_NULL_HANDLE),
 mPresentVkQueue(VK_NULL_HANDLE),
+mTransferVkQueue(VK_NULL_HANDLE),
 mVkCommandPool(VK_NULL_HANDLE),
-mVkCommandBuffer(VK_NULL_HANDLE)
+mVkCommandBuffer(VK_NULL_HANDLE),
+mVkPipelineCache(VK_NULL_HANDLE),
+mMemoryAllocator(nullptr),
+mUploadContext(nullptr)
 {
   const VulkanRuntimeLinking& vulkanRuntimeLinking = mRHIDynamicRHI.getVulkanRuntimeLinking();
 
@@ -60,7 +67,7 @@ mVkCommandBuffer(VK_NULL_HANDLE)
   // Create the logical Vulkan device instance
   if (VK_NULL_HANDLE != mVkPhysicalDevice)
   {
-    mVkDevice = ::detail::createVkDevice(mRHIDynamicRHI.getContext(), mRHIDynamicRHI.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
+    mVkDevice = ::detail::createVkDevice(mRHIDynamicRHI.getContext(), mRHIDynamicRHI.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex, mTransferQueueFamilyIndex);
     if (VK_NULL_HANDLE != mVkDevice)
     {
       // Load device based instance level Vulkan function pointers
@@ -72,7 +79,10 @@ mVkCommandBuffer(VK_NULL_HANDLE)
         {
           // Get the Vulkan device present queue
           vkGetDeviceQueue(mVkDevice, mPresentQueueFamilyIndex, 0, &mPresentVkQueue);
-          if (VK_NULL_HANDLE != mPresentVkQueue)
+
+          // Get the Vulkan device transfer queue, falls back to the graphics queue if there's no dedicated transfer queue family
+          vkGetDeviceQueue(mVkDevice, mTransferQueueFamilyIndex, 0, &mTransferVkQueue);
+          if (VK_NULL_HANDLE != mPresentVkQueue && VK_NULL_HANDLE != mTransferVkQueue)
           {
             // Create Vulkan command pool instance
             mVkCommandPool = ::detail::createVkCommandPool(mRHIDynamicRHI.getContext(), mRHIDynamicRHI.getVkAllocationCallbacks(), mVkDevice, mGraphicsQueueFamilyIndex);
@@ -80,6 +90,37 @@ mVkCommandBuffer(VK_NULL_HANDLE)
             {
               // Create Vulkan command buffer instance
               mVkCommandBuffer = ::detail::createVkCommandBuffer(mRHIDynamicRHI.getContext(), mVkDevice, mVkCommandPool);
+
+              // Create the memory allocator and upload context instances
+              if (VK_NULL_HANDLE != mVkCommandBuffer)
+              {
+                { // Create the initially empty Vulkan pipeline cache, serialized pipeline cache data gets merged into it by "RERHIVulkan::RHIDynamicRHI::setPipelineCacheData()"
+                  static constexpr VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+                  {
+                    VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+                    nullptr,										// pNext (const void*)
+                    0,												// flags (VkPipelineCacheCreateFlags)
+                    0,												// initialDataSize (size_t)
+                    nullptr											// pInitialData (const void*)
+                  };
+                  if (vkCreatePipelineCache(mVkDevice, &vkPipelineCacheCreateInfo, mRHIDynamicRHI.getVkAllocationCallbacks(), &mVkPipelineCache) != VK_SUCCESS)
+                  {
+                    // Not critical, pipelines are just created without a pipeline cache
+                    RE_LOG(Warning, "Failed to create the Vulkan pipeline cache")
+                    mVkPipelineCache = VK_NULL_HANDLE;
+                  }
+                }
+                mMemoryAllocator = RHI_NEW(mRHIDynamicRHI.getContext(), MemoryAllocator)(*this);
+                mUploadContext = RHI_NEW(mRHIDynamicRHI.getContext(), UploadContext)(*this);
+                if (!mUploadContext->isInitialized())
+                {
+                  // Error! The Vulkan context is considered to be uninitialized without an upload context.
+                  RHI_DELETE(mRHIDynamicRHI.getContext(), UploadContext, mUploadContext);
+                  mUploadContext = nullptr;
+                  vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &mVkCommandBuffer);
+                  mVkCommandBuffer = VK_NULL_HANDLE;
+                }
+              }
             }
             else
             {
@@ -106,6 +147,18 @@ VulkanContext::~VulkanContext()
 {
   if (VK_NULL_HANDLE != mVkDevice)
   {
+    if (nullptr != mUploadContext)
+    {
+      RHI_DELETE(mRHIDynamicRHI.getContext(), UploadContext, mUploadContext);
+    }
+    if (nullptr != mMemoryAllocator)
+    {
+      RHI_DELETE(mRHIDynamicRHI.getContext(), MemoryAllocator, mMemoryAllocator);
+    }
+    if (VK_NULL_HANDLE != mVkPipelineCache)
+    {
+      vkDestroyPipelineCache(mVkDevice, mVkPipelineCache, mRHIDynamicRHI.getVkAllocationCallbacks());
+    }
     if (VK_NULL_HANDLE != mVkCommandPool)
     {
       if (VK_NULL_HANDLE != mVkCommandBuffer)
@@ -163,6 +163,8 @@ bool VulkanRuntimeLinking::loadDeviceLevelVulkanEntryPoints(VkDevice vkDevice, b
   IMPORT_FUNC(vkCreateFence)
   IMPORT_FUNC(vkDestroyFence)
   IMPORT_FUNC(vkWaitForFences)
+  IMPORT_FUNC(vkResetFences)
+  IMPORT_FUNC(vkGetFenceStatus)
   IMPORT_FUNC(vkCreateCommandPool)
   IMPORT_FUNC(vkDestroyCommandPool)
   IMPORT_FUNC(vkAllocateCommandBuffers)
@@ -177,6 +179,8 @@ bool VulkanRuntimeLinking::loadDeviceLevelVulkanEntryPoints(VkDevice vkDevice, b
   IMPORT_FUNC(vkDestroyFramebuffer)
   IMPORT_FUNC(vkCreatePipelineCache)
   IMPORT_FUNC(vkDestroyPipelineCache)
+  IMPORT_FUNC(vkGetPipelineCacheData)
+  IMPORT_FUNC(vkMergePipelineCaches)
   IMPORT_FUNC(vkCreatePipelineLayout)
   IMPORT_FUNC(vkDestroyPipelineLayout)
   IMPORT_FUNC(vkCreateGraphicsPipelines)
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 #include <RERHI/Buffer/RHIIndexBuffer.h>
 
 
@@ -106,14 +107,14 @@ public:
 
   /**
   *  @brief
-  *    Return the Vulkan device memory
+  *    Return the Vulkan device memory allocation
   *
   *  @return
-  *    The Vulkan device memory
+  *    The Vulkan device memory allocation
   */
-  [[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+  [[nodiscard]] inline const MemoryAllocation& getMemoryAllocation() const
   {
-    return mVkDeviceMemory;
+    return mMemoryAllocation;
   }
 
 
@@ -141,7 +142,7 @@ private:
 private:
   VkIndexType	   mVkIndexType;	///< Vulkan vertex type
   VkBuffer	   mVkBuffer;		///< Vulkan vertex buffer
-  VkDeviceMemory mVkDeviceMemory;	///< Vulkan vertex memory
+  MemoryAllocation mMemoryAllocation;	///< Vulkan vertex memory allocation
 
 
 };
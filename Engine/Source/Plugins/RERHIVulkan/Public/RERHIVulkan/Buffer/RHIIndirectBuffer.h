@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -91,14 +92,14 @@ public:
 
   /**
   *  @brief
-  *    Return the Vulkan device memory
+  *    Return the Vulkan device memory allocation
   *
   *  @return
-  *    The Vulkan device memory
+  *    The Vulkan device memory allocation
   */
-  [[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+  [[nodiscard]] inline const MemoryAllocation& getMemoryAllocation() const
   {
-    return mVkDeviceMemory;
+    return mMemoryAllocation;
   }
 
 
@@ -135,7 +136,7 @@ private:
   //[-------------------------------------------------------]
 private:
   VkBuffer	   mVkBuffer;		///< Vulkan indirect buffer
-  VkDeviceMemory mVkDeviceMemory;	///< Vulkan indirect memory
+  MemoryAllocation mMemoryAllocation;	///< Vulkan indirect memory allocation
 
 
 };
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -93,14 +94,14 @@ public:
 
   /**
   *  @brief
-  *    Return the Vulkan device memory
+  *    Return the Vulkan device memory allocation
   *
   *  @return
-  *    The Vulkan device memory
+  *    The Vulkan device memory allocation
   */
-  [[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+  [[nodiscard]] inline const MemoryAllocation& getMemoryAllocation() const
   {
-    return mVkDeviceMemory;
+    return mMemoryAllocation;
   }
 
   /**
@@ -139,7 +140,7 @@ private:
   //[-------------------------------------------------------]
 private:
   VkBuffer	   mVkBuffer;		///< Vulkan uniform texel buffer
-  VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform texel memory
+  MemoryAllocation mMemoryAllocation;	///< Vulkan uniform texel memory allocation
   VkBufferView   mVkBufferView;	///< Vulkan buffer view
 
 
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -89,14 +90,14 @@ public:
 
   /**
   *  @brief
-  *    Return the Vulkan device memory
+  *    Return the Vulkan device memory allocation
   *
   *  @return
-  *    The Vulkan device memory
+  *    The Vulkan device memory allocation
   */
-  [[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+  [[nodiscard]] inline const MemoryAllocation& getMemoryAllocation() const
   {
-    return mVkDeviceMemory;
+    return mMemoryAllocation;
   }
 
 
@@ -123,7 +124,7 @@ private:
   //[-------------------------------------------------------]
 private:
   VkBuffer	   mVkBuffer;		///< Vulkan uniform buffer
-  VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform memory
+  MemoryAllocation mMemoryAllocation;	///< Vulkan uniform memory allocation
 
 
 };
@@ -364,7 +364,7 @@ void enumeratePhysicalDevices(const RERHI::RHIContext& context, VkInstance vkIns
   return VK_NULL_HANDLE;
 }
 
-[[nodiscard]] VkResult createVkDevice(const RERHI::RHIContext& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, const VkDeviceQueueCreateInfo& vkDeviceQueueCreateInfo, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, VkDevice& vkDevice)
+[[nodiscard]] VkResult createVkDevice(const RERHI::RHIContext& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, const VkDeviceQueueCreateInfo* vkDeviceQueueCreateInfos, RECore::uint32 numberOfVkDeviceQueueCreateInfos, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, VkDevice& vkDevice)
 {
   // See http://vulkan.gpuinfo.org/listfeatures.php to check out GPU hardware capabilities
   std::vector<const char*> enabledExtensions =
@@ -448,8 +448,8 @@ void enumeratePhysicalDevices(const RERHI::RHIContext& context, VkInstance vkIns
       VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,									// sType (VkStructureType)
       hasMeshShaderSupport ? &vkPhysicalDeviceMeshShaderFeaturesNV : nullptr,	// pNext (const void*)
       0,																		// flags (VkDeviceCreateFlags)
-      1,																		// queueCreateInfoCount (RECore::uint32)
-      &vkDeviceQueueCreateInfo,												// pQueueCreateInfos (const VkDeviceQueueCreateInfo*)
+      numberOfVkDeviceQueueCreateInfos,										// queueCreateInfoCount (RECore::uint32)
+      vkDeviceQueueCreateInfos,												// pQueueCreateInfos (const VkDeviceQueueCreateInfo*)
       enableValidation ? NUMBER_OF_VALIDATION_LAYERS : 0,						// enabledLayerCount (RECore::uint32)
       enableValidation ? VALIDATION_LAYER_NAMES : nullptr,					// ppEnabledLayerNames (const char* const*)
       static_cast<RECore::uint32>(enabledExtensions.size()),						// enabledExtensionCount (RECore::uint32)
@@ -487,7 +487,7 @@ void enumeratePhysicalDevices(const RERHI::RHIContext& context, VkInstance vkIns
   return vkResult;
 }
 
-[[nodiscard]] VkDevice createVkDevice(const RERHI::RHIContext& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, RECore::uint32& graphicsQueueFamilyIndex, RECore::uint32& presentQueueFamilyIndex)
+[[nodiscard]] VkDevice createVkDevice(const RERHI::RHIContext& context, const VkAllocationCallbacks* vkAllocationCallbacks, VkPhysicalDevice vkPhysicalDevice, bool enableValidation, bool enableDebugMarker, bool hasMeshShaderSupport, RECore::uint32& graphicsQueueFamilyIndex, RECore::uint32& presentQueueFamilyIndex, RECore::uint32& transferQueueFamilyIndex)
 {
   VkDevice vkDevice = VK_NULL_HANDLE;
 
@@ -506,27 +506,54 @@ void enumeratePhysicalDevices(const RERHI::RHIContext& context, VkInstance vkIns
     {
       if (vkQueueFamilyProperties[graphicsQueueIndex].queueFlags & VK_QUEUE_GRAPHICS_BIT)
       {
+        // Find a dedicated transfer queue family, usually backed by DMA engines, so uploads can run asynchronously to rendering
+        // -> Without a transfer granularity of one texel we would have to align all copy regions, in this case just use the graphics queue for uploads as well
+        RECore::uint32 transferQueueIndex = graphicsQueueIndex;
+        for (RECore::uint32 i = 0; i < queueFamilyPropertyCount; ++i)
+        {
+          const VkQueueFamilyProperties& currentVkQueueFamilyProperties = vkQueueFamilyProperties[i];
+          const VkExtent3D& minImageTransferGranularity = currentVkQueueFamilyProperties.minImageTransferGranularity;
+          if ((currentVkQueueFamilyProperties.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 && (currentVkQueueFamilyProperties.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0 &&
+            currentVkQueueFamilyProperties.queueCount > 0 && 1 == minImageTransferGranularity.width && 1 == minImageTransferGranularity.height && 1 == minImageTransferGranularity.depth)
+          {
+            transferQueueIndex = i;
+            break;
+          }
+        }
+
         // Create logical Vulkan device instance
         static constexpr std::array<float, 1> queuePriorities = { 0.0f };
-        const VkDeviceQueueCreateInfo vkDeviceQueueCreateInfo =
-          {
-            VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
-            nullptr,									// pNext (const void*)
-            0,											// flags (VkDeviceQueueCreateFlags)
-            graphicsQueueIndex,							// queueFamilyIndex (RECore::uint32)
-            1,											// queueCount (RECore::uint32)
-            queuePriorities.data()						// pQueuePriorities (const float*)
-          };
-        VkResult vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfo, enableValidation, enableDebugMarker, hasMeshShaderSupport, vkDevice);
+        const std::array<VkDeviceQueueCreateInfo, 2> vkDeviceQueueCreateInfos =
+          {{
+            {
+              VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
+              nullptr,									// pNext (const void*)
+              0,											// flags (VkDeviceQueueCreateFlags)
+              graphicsQueueIndex,							// queueFamilyIndex (RECore::uint32)
+              1,											// queueCount (RECore::uint32)
+              queuePriorities.data()						// pQueuePriorities (const float*)
+            },
+            {
+              VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// sType (VkStructureType)
+              nullptr,									// pNext (const void*)
+              0,											// flags (VkDeviceQueueCreateFlags)
+              transferQueueIndex,							// queueFamilyIndex (RECore::uint32)
+              1,											// queueCount (RECore::uint32)
+              queuePriorities.data()						// pQueuePriorities (const float*)
+            }
+          }};
+        const RECore::uint32 numberOfVkDeviceQueueCreateInfos = (transferQueueIndex != graphicsQueueIndex) ? 2u : 1u;
+        VkResult vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfos.data(), numberOfVkDeviceQueueCreateInfos, enableValidation, enableDebugMarker, hasMeshShaderSupport, vkDevice);
         if (VK_ERROR_LAYER_NOT_PRESENT == vkResult && enableValidation)
         {
           // Error! Since the show must go on, try creating a Vulkan device instance without validation enabled...
           RE_LOG(Warning, "Failed to create the Vulkan device instance with validation enabled, layer is not present")
-          vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfo, false, enableDebugMarker, hasMeshShaderSupport, vkDevice);
+          vkResult = createVkDevice(context, vkAllocationCallbacks, vkPhysicalDevice, vkDeviceQueueCreateInfos.data(), numberOfVkDeviceQueueCreateInfos, false, enableDebugMarker, hasMeshShaderSupport, vkDevice);
         }
         // TODO(naetherm) Error handling: Evaluate "vkResult"?
         graphicsQueueFamilyIndex = graphicsQueueIndex;
         presentQueueFamilyIndex = graphicsQueueIndex;	// TODO(naetherm) Handle the case of the graphics queue doesn't support present
+        transferQueueFamilyIndex = transferQueueIndex;
 
         // We're done, get us out of the loop
         graphicsQueueIndex = queueFamilyPropertyCount;
@@ -1301,6 +1328,7 @@ namespace RERHIVulkan {
 //[ Forward declaration                                   ]
 //[-------------------------------------------------------]
 class RHIDynamicRHI;
+struct MemoryAllocation;
 
 
 /**
@@ -1334,24 +1362,22 @@ public:
   //[-------------------------------------------------------]
   //[ Buffer                                                ]
   //[-------------------------------------------------------]
-  // TODO(naetherm) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-  static void createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory);
+  static void createAndAllocateVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, MemoryAllocation& memoryAllocation);
 
-  static void destroyAndFreeVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory);
+  static void destroyAndFreeVkBuffer(const RHIDynamicRHI& vulkanRhi, VkBuffer& vkBuffer, MemoryAllocation& memoryAllocation);
 
   //[-------------------------------------------------------]
   //[ Image                                                 ]
   //[-------------------------------------------------------]
   [[nodiscard]] static VkImageLayout getVkImageLayoutByTextureFlags(RECore::uint32 textureFlags);
 
-  // TODO(naetherm) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-  static VkFormat createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, RERHI::TextureFormat::Enum textureFormat, const void* data, RECore::uint32 textureFlags, RECore::uint8 numberOfMultisamples, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView);
+  static VkFormat createAndFillVkImage(const RHIDynamicRHI& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, RERHI::TextureFormat::Enum textureFormat, const void* data, RECore::uint32 textureFlags, RECore::uint8 numberOfMultisamples, VkImage& vkImage, MemoryAllocation& memoryAllocation, VkImageView& vkImageView);
 
-  static void createAndAllocateVkImage(const RHIDynamicRHI& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, RECore::uint32 mipLevels, RECore::uint32 arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory);
+  static void createAndAllocateVkImage(const RHIDynamicRHI& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, RECore::uint32 mipLevels, RECore::uint32 arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, MemoryAllocation& memoryAllocation);
 
-  static void destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory);
+  static void destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, MemoryAllocation& memoryAllocation);
 
-  static void destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView);
+  static void destroyAndFreeVkImage(const RHIDynamicRHI& vulkanRhi, VkImage& vkImage, MemoryAllocation& memoryAllocation, VkImageView& vkImageView);
 
   static void createVkImageView(const RHIDynamicRHI& vulkanRhi, VkImage vkImage, VkImageViewType vkImageViewType, RECore::uint32 levelCount, RECore::uint32 layerCount, VkFormat vkFormat, VkImageAspectFlags vkImageAspectFlags, VkImageView& vkImageView);
 
@@ -0,0 +1,204 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERHIVulkan/RERHIVulkan.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+#include <unordered_set>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERHIVulkan {
+
+
+//[-------------------------------------------------------]
+//[ Forward declaration                                   ]
+//[-------------------------------------------------------]
+class VulkanContext;
+
+
+/**
+*  @brief
+*    Vulkan device memory allocation, a range inside a Vulkan device memory block or a dedicated Vulkan device memory
+*/
+struct MemoryAllocation final
+{
+  VkDeviceMemory vkDeviceMemory;	///< Vulkan device memory the allocation lives in, shared with other allocations, null handle if invalid
+  VkDeviceSize   offset;			///< Offset inside the Vulkan device memory, use it when binding buffers and images
+  VkDeviceSize   size;			///< Number of bytes reserved for the allocation, might be more than requested
+  void*		   mappedData;		///< Persistently mapped memory of the allocation, null pointer if the memory isn't host visible
+  RECore::uint32 poolIndex;		///< Memory allocator internal pool index
+  RECore::uint32 blockIndex;		///< Memory allocator internal block index, ~0u for dedicated allocations
+  RECore::uint32 order;			///< Memory allocator internal buddy order
+};
+
+
+/**
+*  @brief
+*    Vulkan device memory allocator class
+*
+*  @remarks
+*    Drivers only support a limited number of Vulkan device memory allocations ("VkPhysicalDeviceLimits::maxMemoryAllocationCount", often just 4096)
+*    and each allocation has a noticeable cost. So buffers and images don't allocate own Vulkan device memory, instead they get a range inside a
+*    large Vulkan device memory block. Ranges are handed out using a buddy allocator per block, the minimum allocation size is 256 bytes and a range
+*    of the size 2^n is always aligned to 2^n which automatically satisfies Vulkan alignment requirements (which are always a power of two).
+*
+*    There's a pool of blocks per memory type and resource kind. Linear resources (buffers) and optimal tiling resources (images) never share a block,
+*    this way "VkPhysicalDeviceLimits::bufferImageGranularity" never needs to be taken into account. Allocations larger than half a block, e.g. huge
+*    textures, get their own dedicated Vulkan device memory. Blocks of host visible memory types are persistently mapped.
+*
+*  @note
+*    - Thread-safe, resources might be destroyed by another thread than the one which created them (e.g. renderer resource streaming)
+*/
+class MemoryAllocator final
+{
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  static constexpr VkDeviceSize   BLOCK_SIZE			  = 64 * 1024 * 1024;	///< Size of a single Vulkan device memory block
+  static constexpr VkDeviceSize   MINIMUM_ALLOCATION_SIZE = 256;				///< Size of the smallest buddy
+  static constexpr RECore::uint32 NUMBER_OF_ORDERS		  = 19;					///< log2(BLOCK_SIZE / MINIMUM_ALLOCATION_SIZE) + 1
+
+  typedef RERHI::MemoryStatistics Statistics;	///< Exposed through "RERHI::RHIDynamicRHI::getMemoryStatistics()"
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] vulkanContext
+  *    Owner Vulkan context instance, the device must already have been created
+  */
+  explicit MemoryAllocator(const VulkanContext& vulkanContext);
+
+  /**
+  *  @brief
+  *    Destructor
+  *
+  *  @note
+  *    - All allocations must have been freed
+  */
+  ~MemoryAllocator();
+
+  /**
+  *  @brief
+  *    Return the memory allocator statistics
+  *
+  *  @return
+  *    A snapshot of the memory allocator statistics
+  */
+  [[nodiscard]] inline Statistics getStatistics() const
+  {
+    std::lock_guard<std::mutex> mutexLock(mMutex);
+    return mStatistics;
+  }
+
+  /**
+  *  @brief
+  *    Allocate Vulkan device memory
+  *
+  *  @param[in] vkMemoryRequirements
+  *    Vulkan memory requirements of the buffer or image the memory is for
+  *  @param[in] vkMemoryPropertyFlags
+  *    Required Vulkan memory property flags
+  *  @param[in] linear
+  *    "true" for buffers and linear tiling images, "false" for optimal tiling images
+  *  @param[out] memoryAllocation
+  *    Receives the allocation, only valid if "true" is returned
+  *
+  *  @return
+  *    "true" if all went fine, else "false"
+  */
+  [[nodiscard]] bool allocate(const VkMemoryRequirements& vkMemoryRequirements, VkMemoryPropertyFlags vkMemoryPropertyFlags, bool linear, MemoryAllocation& memoryAllocation);
+
+  /**
+  *  @brief
+  *    Free Vulkan device memory
+  *
+  *  @param[in, out] memoryAllocation
+  *    Allocation to free, reset to an invalid allocation, invalid allocations are ignored
+  */
+  void free(MemoryAllocation& memoryAllocation);
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  typedef std::unordered_set<VkDeviceSize> FreeOffsets;
+  struct Block final
+  {
+    VkDeviceMemory							vkDeviceMemory;	///< Null handle if the block slot is currently unused
+    RECore::uint8*							mappedData;		///< Null pointer if the memory type isn't host visible
+    VkDeviceSize							numberOfUsedBytes;
+    std::array<FreeOffsets, NUMBER_OF_ORDERS> freeOffsets;		///< Free buddy offsets per order
+  };
+  typedef std::vector<Block> Blocks;
+  typedef std::array<Blocks, VK_MAX_MEMORY_TYPES * 2> Pools;	///< Index is "<memory type index> * 2 + <0 for linear, 1 for optimal tiling>"
+
+
+  //[-------------------------------------------------------]
+  //[ Private methods                                       ]
+  //[-------------------------------------------------------]
+private:
+  explicit MemoryAllocator(const MemoryAllocator& source) = delete;
+  MemoryAllocator& operator =(const MemoryAllocator& source) = delete;
+  [[nodiscard]] bool allocateVkDeviceMemory(RECore::uint32 memoryTypeIndex, VkDeviceSize numberOfBytes, VkDeviceMemory& vkDeviceMemory, void** mappedData) const;
+  [[nodiscard]] bool allocateFromBlock(Block& block, RECore::uint32 order, VkDeviceSize& offset) const;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  const VulkanContext&			 mVulkanContext;					///< Owner Vulkan context instance
+  VkPhysicalDeviceMemoryProperties mVkPhysicalDeviceMemoryProperties;
+  mutable std::mutex				 mMutex;							///< Guards the pools and the statistics
+  Pools							 mPools;
+  Statistics					 mStatistics;
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERHIVulkan
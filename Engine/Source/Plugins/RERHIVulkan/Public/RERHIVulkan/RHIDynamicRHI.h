@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
 #include <RERHI/RHIDynamicRHI.h>
+#include <RERHI/Buffer/RHIRedundantCommandFilter.h>
 
 // RERHIVULKAN_API extern "C"
 RERHIVULKAN_API RERHI::RHIDynamicRHI* createVulkanRhiInstance(const RERHI::RHIContext& context);
@@ -143,6 +144,75 @@ public:
     return *mVulkanContext;
   }
 
+  /**
+  *  @brief
+  *    Return the number of the current frame
+  *
+  *  @return
+  *    The number of the current frame, incremented each time a swap chain was presented
+  *
+  *  @note
+  *    - Use "RERHIVulkan::RHIDynamicRHI::isFrameCompleted()" to check whether or not resources released during a frame can be recycled
+  */
+  [[nodiscard]] inline RECore::uint64 getFrameNumber() const
+  {
+    return mFrameNumber;
+  }
+
+  /**
+  *  @brief
+  *    Return the maximum number of frames the GPU might still be working on
+  *
+  *  @return
+  *    The number of frames in flight, at least one
+  *
+  *  @note
+  *    - Each image of a swap chain might belong to a frame in flight, so this is the highest number of swap chain images reported via "RERHIVulkan::RHIDynamicRHI::registerNumberOfFramesInFlight()"
+  */
+  [[nodiscard]] inline RECore::uint32 getNumberOfFramesInFlight() const
+  {
+    return mNumberOfFramesInFlight;
+  }
+
+  /**
+  *  @brief
+  *    Register the number of frames a swap chain might have in flight
+  *
+  *  @param[in] numberOfFramesInFlight
+  *    Number of frames in flight, usually the number of swap chain images
+  */
+  inline void registerNumberOfFramesInFlight(RECore::uint32 numberOfFramesInFlight)
+  {
+    if (mNumberOfFramesInFlight < numberOfFramesInFlight)
+    {
+      mNumberOfFramesInFlight = numberOfFramesInFlight;
+    }
+  }
+
+  /**
+  *  @brief
+  *    Return whether or not the GPU is done with a frame
+  *
+  *  @param[in] frameNumber
+  *    Number of the frame to check, see "RERHIVulkan::RHIDynamicRHI::getFrameNumber()"
+  *
+  *  @return
+  *    "true" if the GPU is done with the given frame and resources released during it can be recycled, else "false"
+  */
+  [[nodiscard]] inline bool isFrameCompleted(RECore::uint64 frameNumber) const
+  {
+    return (frameNumber + getNumberOfFramesInFlight() <= mFrameNumber);
+  }
+
+  /**
+  *  @brief
+  *    Advance to the next frame, called by the swap chain after presenting
+  */
+  inline void advanceFrameNumber()
+  {
+    ++mFrameNumber;
+  }
+
   void dispatchCommandBufferInternal(const RERHI::RHICommandBuffer& commandBuffer);
 
   //[-------------------------------------------------------]
@@ -227,6 +297,20 @@ public:
   //[ Operation                                             ]
   //[-------------------------------------------------------]
   virtual void dispatchCommandBuffer(const RERHI::RHICommandBuffer& commandBuffer) override;
+  [[nodiscard]] inline virtual RERHI::RHIRedundantCommandFilter* getRedundantCommandFilter() override
+  {
+    return &mRedundantCommandFilter;
+  }
+  //[-------------------------------------------------------]
+  //[ Memory statistics                                     ]
+  //[-------------------------------------------------------]
+  [[nodiscard]] virtual bool getMemoryStatistics(RERHI::MemoryStatistics& memoryStatistics) const override;
+
+  //[-------------------------------------------------------]
+  //[ Pipeline cache                                        ]
+  //[-------------------------------------------------------]
+  [[nodiscard]] virtual bool getPipelineCacheData(RECore::uint32& numberOfDataBytes, RECore::uint8* data) override;
+  [[nodiscard]] virtual bool setPipelineCacheData(RECore::uint32 numberOfDataBytes, const RECore::uint8* data) override;
 
 
   //[-------------------------------------------------------]
@@ -278,6 +362,9 @@ private:
   RERHI::RHISamplerState*	  mDefaultSamplerState;		///< Default rasterizer state (we keep a reference to it), can be a null pointer
   bool				  mInsideVulkanRenderPass;	///< Some Vulkan commands like "vkCmdClearColorImage()" can only be executed outside a Vulkan render pass, so need to delay starting a Vulkan render pass
   VkClearValues		  mVkClearValues;
+  RECore::uint64		  mFrameNumber;				///< Number of the current frame, see "RERHIVulkan::RHIDynamicRHI::getFrameNumber()"
+  RECore::uint32		  mNumberOfFramesInFlight;	///< Maximum number of frames the GPU might still be working on, see "RERHIVulkan::RHIDynamicRHI::getNumberOfFramesInFlight()"
+  RERHI::RHIRedundantCommandFilter mRedundantCommandFilter;	///< Strips redundant command packets during command buffer dispatch
   //[-------------------------------------------------------]
   //[ Input-assembler (IA) stage                            ]
   //[-------------------------------------------------------]
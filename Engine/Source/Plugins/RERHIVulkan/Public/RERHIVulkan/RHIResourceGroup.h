@@ -63,8 +63,8 @@ public:
   *    Root signature
   *  @param[in] rootParameterIndex
   *    Root parameter index
-  *  @param[in] vkDescriptorSet
-  *    Wrapped Vulkan descriptor set
+  *  @param[in] contentHash
+  *    Hash of the resources and sampler states, resource groups with the very same content share a Vulkan descriptor set
   *  @param[in] numberOfResources
   *    Number of resources, having no resources is invalid
   *  @param[in] resources
@@ -72,7 +72,7 @@ public:
   *  @param[in] samplerStates
   *    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the resource group will keep a reference to the sampler states
   */
-  ResourceGroup(RootSignature& rootSignature, RECore::uint32 rootParameterIndex, VkDescriptorSet vkDescriptorSet, RECore::uint32 numberOfResources, RERHI::RHIResource** resources, RERHI::RHISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER);
+  ResourceGroup(RootSignature& rootSignature, RECore::uint32 rootParameterIndex, RECore::uint64 contentHash, RECore::uint32 numberOfResources, RERHI::RHIResource** resources, RERHI::RHISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER);
 
   /**
   *  @brief
@@ -116,7 +116,8 @@ private:
   //[-------------------------------------------------------]
 private:
   RootSignature&		 mRootSignature;		///< Root signature
-  VkDescriptorSet		 mVkDescriptorSet;		///< "mVkDescriptorPool" of the root signature is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
+  RECore::uint64			 mContentHash;			///< Hash of the resources and sampler states, used to release the Vulkan descriptor set
+  VkDescriptorSet		 mVkDescriptorSet;		///< The root signature is the owner which manages the memory and might share it with other resource groups, can be a null handle (e.g. for a sampler resource group)
   RECore::uint32			 mNumberOfResources;	///< Number of resources this resource group groups together
   RERHI::RHIResource**	 mResources;			///< RHI resource, we keep a reference to it
   RERHI::RHISamplerState** mSamplerStates;		///< Sampler states, we keep a reference to it
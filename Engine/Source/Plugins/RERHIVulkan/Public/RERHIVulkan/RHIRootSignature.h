@@ -30,6 +30,9 @@
 #include "RERHIVulkan/RERHIVulkan.h"
 #include <RERHI/RHIRootSignature.h>
 
+#include <unordered_map>
+#include <vector>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -98,15 +101,43 @@ public:
 
   /**
   *  @brief
-  *    Return the Vulkan descriptor pool
+  *    Acquire a Vulkan descriptor set with the given content
+  *
+  *  @param[in] rootParameterIndex
+  *    Root parameter index, the Vulkan descriptor set uses the Vulkan descriptor set layout of this root parameter
+  *  @param[in] contentHash
+  *    Hash of the resources and sampler states the Vulkan descriptor set references
+  *  @param[in] numberOfResources
+  *    Number of resources, having the number of descriptor ranges defined inside the root parameter
+  *  @param[in] resources
+  *    Resources the Vulkan descriptor set references, must stay valid as long as the Vulkan descriptor set is acquired
+  *  @param[in] samplerStates
+  *    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the sampler states must stay valid as long as the Vulkan descriptor set is acquired
+  *  @param[out] vkDescriptorSetWritten
+  *    Receives "true" if the Vulkan descriptor set is shared with resource groups having the very same content and is already written, else "false"
   *
   *  @return
-  *    The Vulkan descriptor pool
+  *    The Vulkan descriptor set, null handle on error, release it via "RERHIVulkan::RootSignature::releaseVkDescriptorSet()" if you no longer need it
+  *
+  *  @note
+  *    - Not thread-safe, the Vulkan RHI has no native multithreading support
+  *    - A Vulkan descriptor set is only shared if the content is really the same, content hash collisions result in separate Vulkan descriptor sets
   */
-  [[nodiscard]] inline VkDescriptorPool getVkDescriptorPool() const
-  {
-    return mVkDescriptorPool;
-  }
+  [[nodiscard]] VkDescriptorSet acquireVkDescriptorSet(RECore::uint32 rootParameterIndex, RECore::uint64 contentHash, RECore::uint32 numberOfResources, RERHI::RHIResource* const* resources, RERHI::RHISamplerState* const* samplerStates, bool& vkDescriptorSetWritten);
+
+  /**
+  *  @brief
+  *    Release a Vulkan descriptor set previously acquired via "RERHIVulkan::RootSignature::acquireVkDescriptorSet()"
+  *
+  *  @param[in] contentHash
+  *    Hash of the resources and sampler states the Vulkan descriptor set references
+  *  @param[in] vkDescriptorSet
+  *    Vulkan descriptor set to release
+  *
+  *  @note
+  *    - The Vulkan descriptor set is recycled as soon as the GPU is done with all frames in flight, see "RERHIVulkan::RHIDynamicRHI::isFrameCompleted()"
+  */
+  void releaseVkDescriptorSet(RECore::uint64 contentHash, VkDescriptorSet vkDescriptorSet);
 
 
   //[-------------------------------------------------------]
@@ -132,13 +163,38 @@ protected:
 private:
   explicit RootSignature(const RootSignature& source) = delete;
   RootSignature& operator =(const RootSignature& source) = delete;
+  [[nodiscard]] VkDescriptorPool createVkDescriptorPool() const;
 
 
   //[-------------------------------------------------------]
   //[ Private definitions                                   ]
   //[-------------------------------------------------------]
 private:
+  static constexpr RECore::uint32 NUMBER_OF_DESCRIPTOR_SETS_PER_POOL = 1024;	///< Maximum number of Vulkan descriptor sets per Vulkan descriptor pool, Vulkan descriptor pools are created on demand
+
+  typedef std::vector<RERHI::RHIResource*> Resources;
+  typedef std::vector<RERHI::RHISamplerState*> SamplerStates;
+  struct CachedDescriptorSet final
+  {
+    VkDescriptorSet vkDescriptorSet;
+    RECore::uint32  rootParameterIndex;
+    RECore::uint32  numberOfReferences;	///< Number of resource groups sharing the Vulkan descriptor set
+    Resources		resources;			///< Referenced resources, compared before sharing the Vulkan descriptor set since the content hash might collide
+    SamplerStates	samplerStates;		///< Referenced sampler states, empty if there are none
+  };
+  struct ReleasedDescriptorSet final
+  {
+    VkDescriptorSet vkDescriptorSet;
+    RECore::uint32  rootParameterIndex;
+    RECore::uint64  frameNumber;		///< Number of the frame the Vulkan descriptor set was released in, see "RERHIVulkan::RHIDynamicRHI::isFrameCompleted()"
+  };
   typedef std::vector<VkDescriptorSetLayout> VkDescriptorSetLayouts;
+  typedef std::vector<VkDescriptorPoolSize> VkDescriptorPoolSizes;
+  typedef std::vector<VkDescriptorPool> VkDescriptorPools;
+  typedef std::vector<VkDescriptorSet> VkDescriptorSets;
+  typedef std::vector<VkDescriptorSets> FreeVkDescriptorSets;						///< Index = root parameter index
+  typedef std::unordered_multimap<RECore::uint64, CachedDescriptorSet> CachedDescriptorSets;	///< Key = content hash, multiple entries in case of content hash collisions
+  typedef std::vector<ReleasedDescriptorSet> ReleasedDescriptorSets;
 
 
   //[-------------------------------------------------------]
@@ -148,7 +204,11 @@ private:
   RERHI::RootSignature	   mRootSignature;
   VkDescriptorSetLayouts mVkDescriptorSetLayouts;
   VkPipelineLayout	   mVkPipelineLayout;
-  VkDescriptorPool	   mVkDescriptorPool;
+  VkDescriptorPoolSizes  mVkDescriptorPoolSizes;	///< Vulkan descriptor pool sizes used when creating a new Vulkan descriptor pool, empty if the root signature has no Vulkan descriptor sets
+  VkDescriptorPools	   mVkDescriptorPools;		///< Vulkan descriptor pools the Vulkan descriptor sets are allocated from, the last one is the current one
+  CachedDescriptorSets   mCachedDescriptorSets;	///< Vulkan descriptor sets currently used by at least one resource group
+  ReleasedDescriptorSets mReleasedDescriptorSets;	///< Vulkan descriptor sets no longer used by resource groups, but maybe still used by the GPU
+  FreeVkDescriptorSets   mFreeVkDescriptorSets;	///< Vulkan descriptor sets ready for reuse
 
 
 };
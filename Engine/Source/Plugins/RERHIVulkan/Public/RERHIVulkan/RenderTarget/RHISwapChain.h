@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -243,7 +244,7 @@ private:
   // Depth render target related
   VkFormat		mDepthVkFormat;	///< Can be "VK_FORMAT_UNDEFINED" if no depth stencil buffer is needed
   VkImage			mDepthVkImage;
-  VkDeviceMemory  mDepthVkDeviceMemory;
+  MemoryAllocation mDepthMemoryAllocation;
   VkImageView		mDepthVkImageView;
 
 
@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -140,7 +141,7 @@ private:
 private:
   VkImage		   mVkImage;
   VkImageLayout  mVkImageLayout;
-  VkDeviceMemory mVkDeviceMemory;
+  MemoryAllocation mMemoryAllocation;
   VkImageView	   mVkImageView;
   VkFormat	   mVkFormat;
 
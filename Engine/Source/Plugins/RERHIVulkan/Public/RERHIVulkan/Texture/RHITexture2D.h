@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -187,7 +188,7 @@ private:
 private:
   VRVulkanTextureData_t mVrVulkanTextureData;
   VkImageLayout		  mVkImageLayout;
-  VkDeviceMemory		  mVkDeviceMemory;
+  MemoryAllocation	  mMemoryAllocation;
   VkImageView			  mVkImageView;
 
 
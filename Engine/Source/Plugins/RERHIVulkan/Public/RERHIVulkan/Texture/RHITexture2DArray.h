@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "RERHIVulkan/RERHIVulkan.h"
+#include "RERHIVulkan/MemoryAllocator.h"
 
 
 //[-------------------------------------------------------]
@@ -142,7 +143,7 @@ private:
 private:
   VkImage		   mVkImage;
   VkImageLayout  mVkImageLayout;
-  VkDeviceMemory mVkDeviceMemory;
+  MemoryAllocation mMemoryAllocation;
   VkImageView	   mVkImageView;
   VkFormat	   mVkFormat;
 
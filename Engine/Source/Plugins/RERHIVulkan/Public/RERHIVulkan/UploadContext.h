@@ -0,0 +1,261 @@
+/*********************************************************\
+ * Copyright (c) 2012-2022 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "RERHIVulkan/RERHIVulkan.h"
+
+#include <array>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace RERHIVulkan {
+
+
+//[-------------------------------------------------------]
+//[ Forward declaration                                   ]
+//[-------------------------------------------------------]
+class VulkanContext;
+
+
+/**
+*  @brief
+*    Vulkan upload context class
+*
+*  @remarks
+*    Resource uploads are recorded into batches instead of submitting and waiting for each single resource. A batch consists of
+*    - a transfer command buffer executed on the dedicated transfer queue, in case there's one (usually backed by DMA engines)
+*    - a graphics command buffer executed on the graphics queue after the transfer command buffer, for everything the transfer queue can't do (e.g. mipmap generation via blits)
+*
+*    Source data is written into a persistently mapped staging ring buffer. Batches are submitted when the renderer presents,
+*    when the staging ring buffer wraps around or when a resource still referenced by a pending batch is going to be destroyed.
+*    Submitted batches are tracked by fences which are only waited for when their staging memory or batch slot is needed again,
+*    so resource creation doesn't drain the queues.
+*
+*  @note
+*    - Not thread-safe, the Vulkan RHI has no native multithreading support
+*/
+class UploadContext final
+{
+
+
+  //[-------------------------------------------------------]
+  //[ Public definitions                                    ]
+  //[-------------------------------------------------------]
+public:
+  static constexpr VkDeviceSize   STAGING_RING_BUFFER_SIZE = 64 * 1024 * 1024;	///< Uploads larger than this use a dedicated staging buffer
+  static constexpr RECore::uint32 NUMBER_OF_BATCHES		 = 4;					///< Maximum number of batches in flight
+
+
+  //[-------------------------------------------------------]
+  //[ Public methods                                        ]
+  //[-------------------------------------------------------]
+public:
+  /**
+  *  @brief
+  *    Constructor
+  *
+  *  @param[in] vulkanContext
+  *    Owner Vulkan context instance, the device and queues must already have been created
+  */
+  explicit UploadContext(const VulkanContext& vulkanContext);
+
+  /**
+  *  @brief
+  *    Destructor
+  *
+  *  @note
+  *    - Waits until all pending uploads are done
+  */
+  ~UploadContext();
+
+  /**
+  *  @brief
+  *    Return whether or not the upload context is initialized
+  *
+  *  @return
+  *    "true" if the upload context is initialized, else "false"
+  */
+  [[nodiscard]] inline bool isInitialized() const
+  {
+    return (nullptr != mStagingRingBufferData);
+  }
+
+  /**
+  *  @brief
+  *    Return whether or not uploads are executed on a dedicated transfer queue
+  *
+  *  @return
+  *    "true" if a dedicated transfer queue is used, else "false" (uploads are executed on the graphics queue)
+  */
+  [[nodiscard]] bool hasDedicatedTransferQueue() const;
+
+  /**
+  *  @brief
+  *    Return the Vulkan command buffer to record copy commands into
+  *
+  *  @return
+  *    Vulkan command buffer of the currently recorded batch, only supports transfer commands, don't destroy the instance
+  */
+  [[nodiscard]] VkCommandBuffer getTransferVkCommandBuffer();
+
+  /**
+  *  @brief
+  *    Return the Vulkan command buffer to record graphics queue commands into, executed after the transfer commands of the same batch
+  *
+  *  @return
+  *    Vulkan command buffer of the currently recorded batch, don't destroy the instance
+  */
+  [[nodiscard]] VkCommandBuffer getGraphicsVkCommandBuffer();
+
+  /**
+  *  @brief
+  *    Allocate staging memory for the currently recorded batch
+  *
+  *  @param[in] numberOfBytes
+  *    Number of bytes to allocate
+  *  @param[in] alignment
+  *    Required offset alignment, doesn't need to be a power of two
+  *  @param[out] vkBuffer
+  *    Receives the Vulkan staging buffer to copy from
+  *  @param[out] offset
+  *    Receives the offset inside the Vulkan staging buffer
+  *
+  *  @return
+  *    Mapped staging memory to write the source data to, null pointer on error
+  *
+  *  @note
+  *    - Only stalls if the staging ring buffer range is still used by a batch in flight
+  */
+  [[nodiscard]] void* allocateStagingMemory(VkDeviceSize numberOfBytes, VkDeviceSize alignment, VkBuffer& vkBuffer, VkDeviceSize& offset);
+
+  /**
+  *  @brief
+  *    Record the queue family ownership transfer of an uploaded Vulkan image from the transfer queue to the graphics queue
+  *
+  *  @param[in] vkImage
+  *    Vulkan image which was written by the transfer command buffer, the image is remembered so it can't be destroyed while the batch is pending
+  *  @param[in] vkImageSubresourceRange
+  *    Vulkan image subresource range written by the transfer command buffer
+  *  @param[in] vkImageLayout
+  *    Vulkan image layout the subresources are in, the layout isn't changed
+  *
+  *  @note
+  *    - Without a dedicated transfer queue no ownership transfer is needed, the image is only remembered
+  */
+  void transferVkImageOwnership(VkImage vkImage, const VkImageSubresourceRange& vkImageSubresourceRange, VkImageLayout vkImageLayout);
+
+  /**
+  *  @brief
+  *    Submit the currently recorded batch, in case there's one
+  *
+  *  @note
+  *    - Doesn't wait for the GPU, must be called before command buffers using the uploaded resources are submitted
+  *    - Called when a command buffer has been dispatched, before single time commands are submitted and before presenting
+  */
+  void flush();
+
+  /**
+  *  @brief
+  *    Wait until a Vulkan image is no longer referenced by any pending batch, call this before destroying the image
+  *
+  *  @param[in] vkImage
+  *    Vulkan image to wait for
+  */
+  void waitForVkImage(VkImage vkImage);
+
+  /**
+  *  @brief
+  *    Submit the currently recorded batch and wait until all batches are done
+  */
+  void waitIdle();
+
+
+  //[-------------------------------------------------------]
+  //[ Private definitions                                   ]
+  //[-------------------------------------------------------]
+private:
+  struct DedicatedStagingBuffer final
+  {
+    VkBuffer	   vkBuffer;
+    VkDeviceMemory vkDeviceMemory;
+  };
+  struct Batch final
+  {
+    VkCommandBuffer						transferVkCommandBuffer;	///< Only used if there's a dedicated transfer queue, else the graphics command buffer is used for transfer commands as well
+    VkCommandBuffer						graphicsVkCommandBuffer;
+    VkSemaphore							vkSemaphore;				///< Signaled by the transfer command buffer submission, waited for by the graphics command buffer submission, only used if there's a dedicated transfer queue
+    VkFence								vkFence;					///< Signaled as soon as the whole batch has been executed
+    VkDeviceSize						stagingRingBufferBegin;		///< Staging ring buffer range used by the batch, a batch never wraps around
+    VkDeviceSize						stagingRingBufferEnd;
+    bool								recording;
+    bool								submitted;
+    std::vector<VkImage>				vkImages;					///< Vulkan images written by the batch, not owned by the batch
+    std::vector<DedicatedStagingBuffer>	dedicatedStagingBuffers;	///< Owned by the batch, destroyed as soon as the batch is done
+  };
+  typedef std::array<Batch, NUMBER_OF_BATCHES> Batches;
+
+
+  //[-------------------------------------------------------]
+  //[ Private methods                                       ]
+  //[-------------------------------------------------------]
+private:
+  explicit UploadContext(const UploadContext& source) = delete;
+  UploadContext& operator =(const UploadContext& source) = delete;
+  [[nodiscard]] Batch& getRecordingBatch();
+  bool retireBatch(Batch& batch, bool wait);
+  void retireCompletedBatches();
+  [[nodiscard]] bool createStagingBuffer(VkDeviceSize numberOfBytes, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory, void** mappedData) const;
+  void destroyStagingBuffer(VkBuffer vkBuffer, VkDeviceMemory vkDeviceMemory) const;
+
+
+  //[-------------------------------------------------------]
+  //[ Private data                                          ]
+  //[-------------------------------------------------------]
+private:
+  const VulkanContext& mVulkanContext;					///< Owner Vulkan context instance
+  VkCommandPool		 mTransferVkCommandPool;			///< Vulkan command pool for the dedicated transfer queue family, can be a null handle
+  VkCommandPool		 mGraphicsVkCommandPool;			///< Vulkan command pool for the graphics queue family
+  VkBuffer			 mStagingRingBufferVkBuffer;		///< Persistently mapped staging ring buffer
+  VkDeviceMemory	 mStagingRingBufferVkDeviceMemory;
+  RECore::uint8*	 mStagingRingBufferData;			///< Mapped staging ring buffer memory, null pointer if not initialized
+  VkDeviceSize		 mStagingRingBufferHead;			///< Next free staging ring buffer offset
+  Batches			 mBatches;							///< Batches are used round robin, so the next batch to record is always the oldest one
+  RECore::uint32	 mCurrentBatchIndex;				///< Index of the batch which is currently recorded or will be recorded next
+
+
+};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // RERHIVulkan
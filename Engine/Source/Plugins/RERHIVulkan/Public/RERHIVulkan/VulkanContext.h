@@ -40,6 +40,8 @@ namespace RERHIVulkan {
 //[ Forward declaration                                   ]
 //[-------------------------------------------------------]
 class RHIDynamicRHI;
+class UploadContext;
+class MemoryAllocator;
 
 
 /**
@@ -141,6 +143,18 @@ public:
     return mPresentQueueFamilyIndex;
   }
 
+  /**
+  *  @brief
+  *    Return the used transfer queue family index
+  *
+  *  @return
+  *    Transfer queue family index, ~0u if invalid, identical to the graphics queue family index if there's no dedicated transfer queue
+  */
+  [[nodiscard]] inline RECore::uint32 getTransferQueueFamilyIndex() const
+  {
+    return mTransferQueueFamilyIndex;
+  }
+
   /**
   *  @brief
   *    Return the handle to the Vulkan device graphics queue that command buffers are submitted to
@@ -165,6 +179,18 @@ public:
     return mPresentVkQueue;
   }
 
+  /**
+  *  @brief
+  *    Return the handle to the Vulkan device transfer queue
+  *
+  *  @return
+  *    Handle to the Vulkan device transfer queue, identical to the graphics queue if there's no dedicated transfer queue
+  */
+  [[nodiscard]] inline VkQueue getTransferVkQueue() const
+  {
+    return mTransferVkQueue;
+  }
+
   /**
   *  @brief
   *    Return the used Vulkan command buffer pool instance
@@ -189,7 +215,42 @@ public:
     return mVkCommandBuffer;
   }
 
-  // TODO(naetherm) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
+  /**
+  *  @brief
+  *    Return the Vulkan pipeline cache all graphics and compute pipelines are created with
+  *
+  *  @return
+  *    The Vulkan pipeline cache, can be a null handle
+  */
+  [[nodiscard]] inline VkPipelineCache getVkPipelineCache() const
+  {
+    return mVkPipelineCache;
+  }
+
+  /**
+  *  @brief
+  *    Return the memory allocator all Vulkan device memory of buffers and images is allocated with
+  *
+  *  @return
+  *    The memory allocator, only valid if the Vulkan context is initialized
+  */
+  [[nodiscard]] inline MemoryAllocator& getMemoryAllocator() const
+  {
+    return *mMemoryAllocator;
+  }
+
+  /**
+  *  @brief
+  *    Return the upload context used for asynchronous resource uploads
+  *
+  *  @return
+  *    The upload context, only valid if the Vulkan context is initialized
+  */
+  [[nodiscard]] inline UploadContext& getUploadContext() const
+  {
+    return *mUploadContext;
+  }
+
   [[nodiscard]] RECore::uint32 findMemoryTypeIndex(RECore::uint32 typeFilter, VkMemoryPropertyFlags vkMemoryPropertyFlags) const;
 
   [[nodiscard]] VkCommandBuffer createVkCommandBuffer() const;
@@ -214,10 +275,15 @@ private:
   VkDevice		 mVkDevice;					///< Vulkan device instance this context is using (equivalent of a OpenGL context or Direct3D 11 device)
   RECore::uint32		 mGraphicsQueueFamilyIndex;	///< Graphics queue family index, ~0u if invalid
   RECore::uint32		 mPresentQueueFamilyIndex;	///< Present queue family index, ~0u if invalid
+  RECore::uint32		 mTransferQueueFamilyIndex;	///< Transfer queue family index, ~0u if invalid
   VkQueue			 mGraphicsVkQueue;			///< Handle to the Vulkan device graphics queue that command buffers are submitted to
   VkQueue			 mPresentVkQueue;			///< Handle to the Vulkan device present queue
+  VkQueue			 mTransferVkQueue;			///< Handle to the Vulkan device transfer queue
   VkCommandPool	 mVkCommandPool;			///< Vulkan command buffer pool instance
   VkCommandBuffer  mVkCommandBuffer;			///< Vulkan command buffer instance
+  VkPipelineCache  mVkPipelineCache;			///< Vulkan pipeline cache instance, can be a null handle
+  MemoryAllocator* mMemoryAllocator;			///< Memory allocator instance, can be a null pointer, we're responsible for destroying the instance
+  UploadContext*	 mUploadContext;			///< Upload context instance, can be a null pointer, we're responsible for destroying the instance
 
 
 };
@@ -303,6 +303,8 @@ FNPTR(vkDestroySemaphore)
 FNPTR(vkCreateFence)
 FNPTR(vkDestroyFence)
 FNPTR(vkWaitForFences)
+FNPTR(vkResetFences)
+FNPTR(vkGetFenceStatus)
 FNPTR(vkCreateCommandPool)
 FNPTR(vkDestroyCommandPool)
 FNPTR(vkAllocateCommandBuffers)
@@ -317,6 +319,8 @@ FNPTR(vkCreateFramebuffer)
 FNPTR(vkDestroyFramebuffer)
 FNPTR(vkCreatePipelineCache)
 FNPTR(vkDestroyPipelineCache)
+FNPTR(vkGetPipelineCacheData)
+FNPTR(vkMergePipelineCaches)
 FNPTR(vkCreatePipelineLayout)
 FNPTR(vkDestroyPipelineLayout)
 FNPTR(vkCreateGraphicsPipelines)
@@ -7,6 +7,8 @@ set(FILES
   Private/RHIResourceGroup.cpp
   Private/RHIRootSignature.cpp
   Private/VulkanContext.cpp
+  Private/UploadContext.cpp
+  Private/MemoryAllocator.cpp
   Private/VulkanRuntimeLinking.cpp
 
   # Buffer
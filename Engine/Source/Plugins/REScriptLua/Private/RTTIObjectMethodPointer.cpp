@@ -26,9 +26,96 @@ extern "C" {
 	#include <Lua/lua.h>
 }
 #include <RECore/Reflect/Object.h>
+#include <RECore/Reflect/Func/DynParams.h>
 #include "REScriptLua/Script.h"
 #include "REScriptLua/LuaContext.h"
 #include "REScriptLua/RTTIObjectMethodPointer.h"
+#include <cstddef>
+#include <limits>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr RECore::uint32 MAXIMUM_PARAMS_SIZE = 512;	///< Typed parameters which are larger are called by using the generic string path
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Returns the Lua value at the given stack index as number, booleans and numeric strings are converted
+		*/
+		[[nodiscard]] lua_Number toNumber(lua_State *pLuaState, int nIndex)
+		{
+			return lua_isboolean(pLuaState, nIndex) ? static_cast<lua_Number>(lua_toboolean(pLuaState, nIndex)) : lua_tonumber(pLuaState, nIndex);
+		}
+
+		/**
+		*  @brief
+		*    Writes the Lua value at the given stack index as integer of the given type, returns 'false' if the number is outside the range of the integer type
+		*
+		*  @note
+		*    - Converting a floating point number which isn't representable by the integer type is undefined behaviour (e.g. a negative number into an unsigned integer), so the range is checked first
+		*/
+		template <typename T>
+		[[nodiscard]] bool toInteger(lua_State *pLuaState, int nIndex, void *pValue)
+		{
+			const lua_Number fNumber = toNumber(pLuaState, nIndex);
+			if (fNumber >= static_cast<lua_Number>(std::numeric_limits<T>::min()) && fNumber < static_cast<lua_Number>(std::numeric_limits<T>::max()) + 1) {
+				*static_cast<T*>(pValue) = static_cast<T>(fNumber);
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Returns the Lua value at the given stack index as boolean, numbers and strings are interpreted like the string conversion does
+		*/
+		[[nodiscard]] bool toBoolean(lua_State *pLuaState, int nIndex)
+		{
+			if (lua_isboolean(pLuaState, nIndex))
+				return (lua_toboolean(pLuaState, nIndex) != 0);
+			else if (lua_type(pLuaState, nIndex) == LUA_TNUMBER)
+				return (lua_tonumber(pLuaState, nIndex) != 0);
+			else if (lua_isstring(pLuaState, nIndex))
+				return RECore::String(lua_tolstring(pLuaState, nIndex, nullptr)).getBool();
+			else
+				return false;
+		}
+
+		/**
+		*  @brief
+		*    Returns the RTTI object of the user data at the given stack index, null pointer if it's no RTTI object
+		*/
+		[[nodiscard]] RECore::Object *toObject(lua_State *pLuaState, int nIndex)
+		{
+			if (lua_isuserdata(pLuaState, nIndex)) {
+				// [TODO] Do any type tests in here?
+				REScriptLua::LuaUserData *pLuaUserData = REScriptLua::LuaUserData::getUserDataFromLuaStack(pLuaState, nIndex);
+				if (pLuaUserData)
+					return reinterpret_cast<REScriptLua::RTTIObjectPointerBase*>(pLuaUserData)->getObject();
+			}
+			return nullptr;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -50,6 +137,9 @@ String RTTIObjectMethodPointer::getLuaFunctionParametersAsString(Script &cScript
 	// Get the Lua state
 	lua_State *pLuaState = cScript.getLuaState();
 
+	// The temporary strings are referenced by address, so the list must never reallocate
+	lstTempStrings.reserve(lstTempStrings.size() + cDynSignature.getNumOfParameters());
+
 	// Get the number of arguments Lua gave to us
 	String sParams;
 	uint32 nParameterIndex = 0;
@@ -152,6 +242,135 @@ String RTTIObjectMethodPointer::getLuaFunctionParametersAsString(Script &cScript
 	return sParams;
 }
 
+/**
+*  @brief
+*    Writes the current Lua function parameters on the Lua stack into the given typed dynamic parameters
+*/
+bool RTTIObjectMethodPointer::getLuaFunctionParameters(Script &cScript, DynParams &cDynParams, bool bIsMethod)
+{
+	// Get the Lua state
+	lua_State *pLuaState = cScript.getLuaState();
+
+	// Get the number of arguments Lua gave to us, additional arguments are ignored and missing arguments keep their default constructed value
+	const uint32 nNumOfParameters		= cDynParams.getNumOfParameters();
+	const int	 nOffset				= bIsMethod ? 2 : 0;
+	const int	 nIndexOfFirstArgument	= 1+nOffset;
+	const int	 nIndexOfLastArgument	= lua_gettop(pLuaState);
+	uint32 nParameterIndex = 0;
+	for (int i=nIndexOfFirstArgument; i<=nIndexOfLastArgument && nParameterIndex<nNumOfParameters; i++, nParameterIndex++) {
+		void *pValue = cDynParams.getPointerToParameterValue(nParameterIndex);
+		bool bValidNumber = true;
+		switch (cDynParams.getParameterTypeID(nParameterIndex)) {
+			case TypeBool:		*static_cast<bool*>  (pValue) = detail::toBoolean(pLuaState, i);						break;
+			case TypeDouble:	*static_cast<double*>(pValue) = static_cast<double>(detail::toNumber(pLuaState, i));	break;
+			case TypeFloat:		*static_cast<float*> (pValue) = static_cast<float> (detail::toNumber(pLuaState, i));	break;
+			case TypeInt:		bValidNumber = detail::toInteger<int>   (pLuaState, i, pValue);							break;
+			case TypeInt8:		bValidNumber = detail::toInteger<int8>  (pLuaState, i, pValue);							break;
+			case TypeInt16:		bValidNumber = detail::toInteger<int16> (pLuaState, i, pValue);							break;
+			case TypeInt32:		bValidNumber = detail::toInteger<int32> (pLuaState, i, pValue);							break;
+			case TypeInt64:		bValidNumber = detail::toInteger<int64> (pLuaState, i, pValue);							break;
+			case TypeUInt8:		bValidNumber = detail::toInteger<uint8> (pLuaState, i, pValue);							break;
+			case TypeUInt16:	bValidNumber = detail::toInteger<uint16>(pLuaState, i, pValue);							break;
+			case TypeUInt32:	bValidNumber = detail::toInteger<uint32>(pLuaState, i, pValue);							break;
+			case TypeUInt64:	bValidNumber = detail::toInteger<uint64>(pLuaState, i, pValue);							break;
+
+			// The string is written into a pooled string of the script, so there's no heap allocation once the pool is warmed up
+			case TypeString:
+				if (lua_isboolean(pLuaState, i)) {
+					cScript.acquireStringParameter((lua_toboolean(pLuaState, i) != 0) ? "1" : "0", 1, static_cast<String*>(pValue));
+				} else if (lua_isstring(pLuaState, i)) {
+					size_t nLength = 0;
+					const char *pszValue = lua_tolstring(pLuaState, i, &nLength);
+					cScript.acquireStringParameter(pszValue, nLength, static_cast<String*>(pValue));
+				}
+				break;
+
+			// Strings are somewhat of a special case... see "getLuaFunctionParametersAsString()" documentation for details
+			// -> The storage type of references and pointers is a pointer
+			case TypeRef:
+			case TypePtr:
+				if (lua_type(pLuaState, i) == LUA_TSTRING) {
+					size_t nLength = 0;
+					const char *pszValue = lua_tolstring(pLuaState, i, &nLength);
+					*static_cast<void**>(pValue) = &cScript.acquireStringParameter(pszValue, nLength, nullptr);
+				} else {
+					*static_cast<void**>(pValue) = detail::toObject(pLuaState, i);
+				}
+				break;
+
+			case TypeObjectPtr:
+				*static_cast<Object**>(pValue) = detail::toObject(pLuaState, i);
+				break;
+
+			default:
+				// Unknown type, there's no generic way to convert the Lua function parameter
+				lua_pushfstring(pLuaState, "Parameter %d has a type which can't be passed from Lua", static_cast<int>(nParameterIndex));
+				return false;
+		}
+		if (!bValidNumber) {
+			lua_pushfstring(pLuaState, "Parameter %d: The number %f is outside the range of the integer parameter type", static_cast<int>(nParameterIndex), detail::toNumber(pLuaState, i));
+			return false;
+		}
+	}
+
+	// Does the RTTI signature demand more parameters as the script programmer provided?
+	// -> In here, TypePtr is not interesting because it automatically results in a null pointer
+	// -> The referenced type of a reference is unknown at runtime ("RECore::Type<T&>" erases it), so there's nothing valid a missing reference could be bound to
+	for (; nParameterIndex<nNumOfParameters; nParameterIndex++) {
+		if (cDynParams.getParameterTypeID(nParameterIndex) == TypeRef) {
+			lua_pushfstring(pLuaState, "Parameter %d is a reference and must be provided", static_cast<int>(nParameterIndex));
+			return false;
+		}
+	}
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Pushes the return value of the given typed dynamic parameters onto the Lua stack
+*/
+int RTTIObjectMethodPointer::pushReturnValue(Script &cScript, DynParams &cDynParams)
+{
+	// Get the Lua state
+	lua_State *pLuaState = cScript.getLuaState();
+
+	// Process the functor return
+	const void *pValue = cDynParams.getPointerToReturnValue();
+	switch (cDynParams.getReturnTypeID()) {
+		case TypeVoid:																									return 0;	// The function returns nothing
+		case TypeBool:		lua_pushboolean(pLuaState, *static_cast<const bool*>(pValue));												break;
+		case TypeDouble:	lua_pushnumber (pLuaState, *static_cast<const double*>(pValue));											break;
+		case TypeFloat:		lua_pushnumber (pLuaState, *static_cast<const float*>(pValue));												break;
+		case TypeInt:		lua_pushinteger(pLuaState, *static_cast<const int*>(pValue));												break;
+		case TypeInt8:		lua_pushinteger(pLuaState, *static_cast<const int8*>(pValue));												break;
+		case TypeInt16:		lua_pushinteger(pLuaState, *static_cast<const int16*>(pValue));												break;
+		case TypeInt32:		lua_pushinteger(pLuaState, *static_cast<const int32*>(pValue));												break;
+		case TypeInt64:		lua_pushinteger(pLuaState, static_cast<lua_Integer>(*static_cast<const int64*>(pValue)));					break;	// [TODO] TypeInt64 is currently handled just as long
+		case TypeUInt8:		lua_pushinteger(pLuaState, *static_cast<const uint8*>(pValue));												break;
+		case TypeUInt16:	lua_pushinteger(pLuaState, *static_cast<const uint16*>(pValue));											break;
+		case TypeUInt32:	lua_pushinteger(pLuaState, *static_cast<const uint32*>(pValue));											break;
+		case TypeUInt64:	lua_pushinteger(pLuaState, static_cast<lua_Integer>(*static_cast<const uint64*>(pValue)));					break;	// [TODO] TypeUInt64 is currently handled just as long
+		case TypeString:	lua_pushstring (pLuaState, *static_cast<const String*>(pValue));											break;
+
+		// [HACK] Currently, classes derived from "RECore::Object" are just recognized as type "void*"... but "RECore::Object*" type would be perfect
+		// -> The storage type of references and pointers is a pointer
+		case TypeRef:
+		case TypePtr:
+		case TypeObjectPtr:
+			RTTIObjectPointer::LuaStackPush(cScript, *static_cast<Object* const*>(pValue));
+			break;
+
+		// Unknown type, there's no generic way to convert it
+		default:
+			return 0;
+	}
+
+	// The function returns one argument
+	return 1;
+}
+
 /**
 *  @brief
 *    Calls the current Lua stack dynamic function
@@ -163,6 +382,26 @@ int RTTIObjectMethodPointer::callDynFunc(Script &cScript, DynFunc &cDynFunc, boo
 
 	// Has the given dynamic function any parameters?
 	if (cDynFunc.getNumOfParameters()) {
+		// Typed parameters: The Lua function parameters are written directly into parameters matching the function signature
+		// which are constructed on the C runtime stack, so there's no string conversion and no heap allocation
+		if (cDynFunc.getParamsSize() <= detail::MAXIMUM_PARAMS_SIZE) {
+			alignas(alignof(std::max_align_t)) uint8 nParamsMemory[detail::MAXIMUM_PARAMS_SIZE];
+			DynParams *pDynParams = cDynFunc.constructParams(nParamsMemory);
+			if (pDynParams) {
+				int nNumOfResults = -1;	// Stays negative if the Lua function parameters are invalid, the error message is on top of the Lua stack in this case
+				const uint32 nNumOfUsedStringParameters = cScript.m_nNumOfUsedStringParameters;
+				if (getLuaFunctionParameters(cScript, *pDynParams, bIsMethod)) {
+					cDynFunc.call(*pDynParams);
+					nNumOfResults = pushReturnValue(cScript, *pDynParams);
+				}
+				cScript.releaseStringParameters(nNumOfUsedStringParameters);
+				pDynParams->~DynParams();
+
+				// "lua_error()" doesn't return but performs a long jump, so it must only be called after all C++ objects have been destroyed
+				return (nNumOfResults >= 0) ? nNumOfResults : lua_error(pLuaState);
+			}
+		}
+
 		// This is a bit more complex due to parameter conversion
 
 		// Get the current Lua function parameters on the Lua stack as string
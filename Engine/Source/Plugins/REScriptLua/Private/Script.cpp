@@ -28,6 +28,7 @@ extern "C" {
 	#include <Lua/lauxlib.h>
 }
 #include <RECore/Log/Log.h>
+#include <RECore/Utility/GetInvalid.h>
 #include "REScriptLua/LuaContext.h"
 #include "REScriptLua/RTTIObjectPointer.h"
 #include "REScriptLua/RTTIObjectMethodPointer.h"
@@ -65,7 +66,8 @@ re_class_metadata_end(Script)
 Script::Script() :
 	m_pLuaState(nullptr),
 	m_bFunctionResult(false),
-	m_nCurrentArgument(0)
+	m_nCurrentArgument(0),
+	m_nNumOfUsedStringParameters(0)
 {
 	// Add a context reference
 	LuaContext::addContextReference();
@@ -160,6 +162,123 @@ void Script::luaStackDump()
 	}
 }
 
+/**
+*  @brief
+*    Prepares a global function call
+*/
+uint32 Script::prepareCall(const String &sFunctionName, const String &sFunctionSignature, const String &sNamespace)
+{
+	// Each function must have a name!
+	if (!sFunctionName.length())
+		return getInvalid<uint32>();	// Error!
+
+	// Reuse an already prepared call to the same function
+	const bool bFunctionResult = (sFunctionSignature.compare(0, 5, "void(") != 0);
+	for (uint32 i=0; i<m_lstPreparedCalls.size(); i++) {
+		const PreparedCall &cPreparedCall = m_lstPreparedCalls[i];
+		if (cPreparedCall.bFunctionResult == bFunctionResult && cPreparedCall.sFunction == sFunctionName && cPreparedCall.sNamespace == sNamespace)
+			return i;
+	}
+
+	// Add the prepared call, the function itself is resolved lazily by the first call
+	PreparedCall cPreparedCall;
+	cPreparedCall.sFunction				= sFunctionName;
+	cPreparedCall.sNamespace			= sNamespace;
+	cPreparedCall.bFunctionResult		= bFunctionResult;
+	cPreparedCall.nLuaFunctionReference	= LUA_NOREF;
+	m_lstPreparedCalls.push_back(cPreparedCall);
+
+	// Done
+	return static_cast<uint32>(m_lstPreparedCalls.size() - 1);
+}
+
+/**
+*  @brief
+*    Starts a prepared global function call
+*/
+bool Script::beginPreparedCall(uint32 nPreparedCall)
+{
+	// Is there a Lua state and is the prepared call handle valid?
+	if (m_pLuaState && nPreparedCall < m_lstPreparedCalls.size()) {
+		// Push the function to be called onto the Lua state stack
+		PreparedCall &cPreparedCall = m_lstPreparedCalls[nPreparedCall];
+		if (pushPreparedCallFunction(cPreparedCall)) {
+			// Backup the name of the current function (we may need it for error log output)
+			m_sCurrentFunction = cPreparedCall.sFunction;
+
+			// Has the current function a result?
+			m_bFunctionResult = cPreparedCall.bFunctionResult;
+
+			// Current argument is 0
+			m_nCurrentArgument = 0;
+
+			// Done
+			return true;
+		}
+	}
+
+	// Error!
+	return false;
+}
+
+/**
+*  @brief
+*    Calls a prepared global function once for each of the given objects
+*/
+bool Script::callPreparedForObjects(uint32 nPreparedCall, Object *const *ppObjects, uint32 nNumberOfObjects)
+{
+	// Is there a Lua state and is the prepared call handle valid?
+	if (!m_pLuaState || nPreparedCall >= m_lstPreparedCalls.size())
+		return false;	// Error!
+
+	// Resolve the function once for the whole batch
+	PreparedCall &cPreparedCall = m_lstPreparedCalls[nPreparedCall];
+	if (!pushPreparedCallFunction(cPreparedCall))
+		return false;	// Error!
+	const int nFunctionIndex = lua_gettop(m_pLuaState);
+
+	// Call the function for each object
+	bool bResult = true;	// By default, all went fine
+	for (uint32 i=0; i<nNumberOfObjects; i++) {
+		// Push a copy of the function as well as the object as the only argument onto the Lua stack
+		lua_pushvalue(m_pLuaState, nFunctionIndex);
+		RTTIObjectPointer::LuaStackPush(*this, ppObjects[i]);
+
+		// Do the call (1 argument, results are ignored)
+		if (lua_pcall(m_pLuaState, 1, 0, 0)) {
+			// Error!
+			logOutput(Log::Error, "Error running function '" + cPreparedCall.sFunction + "' (Batch call " + i + ')');
+
+			// Report Lua errors
+			reportErrors();
+			bResult = false;
+		}
+	}
+
+	// Pop the function from the Lua stack
+	lua_pop(m_pLuaState, 1);
+
+	// Perform an incremental step of garbage collection, see "endCall()" for details
+	lua_gc(m_pLuaState, LUA_GCSTEP, 1);
+
+	// Done
+	return bResult;
+}
+
+/**
+*  @brief
+*    Removes all prepared calls
+*/
+void Script::removeAllPreparedCalls()
+{
+	// Release the pinned Lua functions
+	if (m_pLuaState) {
+		for (PreparedCall &cPreparedCall : m_lstPreparedCalls)
+			luaL_unref(m_pLuaState, LUA_REGISTRYINDEX, cPreparedCall.nLuaFunctionReference);
+	}
+	m_lstPreparedCalls.clear();
+}
+
 
 //[-------------------------------------------------------]
 //[ Public virtual RECore::Script functions               ]
@@ -1147,7 +1266,8 @@ int Script::luaFunctionCallback(lua_State *pLuaState)
 Script::Script(const Script &cSource) :
 	m_pLuaState(nullptr),
 	m_bFunctionResult(false),
-	m_nCurrentArgument(0)
+	m_nCurrentArgument(0),
+	m_nNumOfUsedStringParameters(0)
 {
 	// No implementation because the copy constructor is never used
 }
@@ -1211,6 +1331,10 @@ void Script::clear()
 		// Destroy the metatable for LuaUserData events
 		LuaUserData::destroyMetatable(m_pLuaState);
 
+		// The pinned Lua functions of the prepared calls are gone together with the Lua state, they're resolved again by the next call
+		for (PreparedCall &cPreparedCall : m_lstPreparedCalls)
+			cPreparedCall.nLuaFunctionReference = LUA_NOREF;
+
 		// Close the Lua state
 		lua_close(m_pLuaState);
 		m_pLuaState = nullptr;
@@ -1364,6 +1488,89 @@ bool Script::getNestedTable(const String &sTableName)
 	return true;
 }
 
+/**
+*  @brief
+*    Pushes the function of a prepared call onto the Lua stack
+*/
+bool Script::pushPreparedCallFunction(PreparedCall &cPreparedCall)
+{
+	// Resolve and pin the function inside the Lua registry, if not already done
+	if (cPreparedCall.nLuaFunctionReference == LUA_NOREF) {
+		// Get a nested Lua table
+		if (!getNestedTable(cPreparedCall.sNamespace)) {
+			// Error!
+			logOutput(Log::Error, "The namespace '" + cPreparedCall.sNamespace + "' of the function '" + cPreparedCall.sFunction + "' was not found");
+			return false;
+		}
+
+		// Get the function from the Lua table
+		lua_pushstring(m_pLuaState, cPreparedCall.sFunction);	// Push the function name onto the Lua stack
+		lua_gettable(m_pLuaState, -2);
+		if (!lua_isfunction(m_pLuaState, -1)) {
+			// Error!
+			lua_pop(m_pLuaState, 2);
+			if (cPreparedCall.sNamespace.length())
+				logOutput(Log::Error, "The function '" + cPreparedCall.sFunction + "' was not found within the namespace '" + cPreparedCall.sNamespace + '\'');
+			else
+				logOutput(Log::Error, "The function '" + cPreparedCall.sFunction + "' was not found");
+			return false;
+		}
+
+		// Pin the function inside the Lua registry, this pops the function from the Lua stack
+		cPreparedCall.nLuaFunctionReference = luaL_ref(m_pLuaState, LUA_REGISTRYINDEX);
+
+		// Pop the table from the Lua stack
+		lua_pop(m_pLuaState, 1);
+	}
+
+	// Push the pinned function onto the Lua stack
+	lua_rawgeti(m_pLuaState, LUA_REGISTRYINDEX, cPreparedCall.nLuaFunctionReference);
+
+	// Done
+	return true;
+}
+
+/**
+*  @brief
+*    Acquires a pooled string for passing a Lua string to a typed RTTI function parameter
+*/
+String &Script::acquireStringParameter(const char *pszValue, size_t nLength, String *pParameter)
+{
+	// Grow the pool if required, a deque never moves already acquired strings
+	if (m_nNumOfUsedStringParameters == m_lstStringParameters.size())
+		m_lstStringParameters.push_back({ String(), nullptr });
+	StringParameter &cStringParameter = m_lstStringParameters[m_nNumOfUsedStringParameters++];
+
+	// Assigning reuses the capacity of the pooled string
+	cStringParameter.sValue.assign(pszValue, static_cast<String::SizeType>(nLength));
+	if (pParameter) {
+		// Swapping doesn't allocate, the typed string parameter now owns the pooled memory until the strings are released
+		pParameter->swap(cStringParameter.sValue);
+		cStringParameter.pParameter = pParameter;
+		return *pParameter;
+	} else {
+		cStringParameter.pParameter = nullptr;
+		return cStringParameter.sValue;
+	}
+}
+
+/**
+*  @brief
+*    Releases pooled strings
+*/
+void Script::releaseStringParameters(uint32 nNumOfUsedStringParameters)
+{
+	// Get back the pooled memory from the typed string parameters
+	for (uint32 i=nNumOfUsedStringParameters; i<m_nNumOfUsedStringParameters; i++) {
+		StringParameter &cStringParameter = m_lstStringParameters[i];
+		if (cStringParameter.pParameter) {
+			cStringParameter.pParameter->swap(cStringParameter.sValue);
+			cStringParameter.pParameter = nullptr;
+		}
+	}
+	m_nNumOfUsedStringParameters = nNumOfUsedStringParameters;
+}
+
 /**
 *  @brief
 *    Returns event user data key
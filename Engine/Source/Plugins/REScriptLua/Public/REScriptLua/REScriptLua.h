@@ -39,5 +39,5 @@
 	#define RESCRIPTLUA_API			RE_GENERIC_API_EXPORT
 #else
 	// To import classes, methods and variables
-	#define ReSCRIPTLUA_API			RE_GENERIC_API_IMPORT
+	#define RESCRIPTLUA_API			RE_GENERIC_API_IMPORT
 #endif
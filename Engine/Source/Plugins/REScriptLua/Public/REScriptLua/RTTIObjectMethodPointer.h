@@ -91,6 +91,43 @@ class RTTIObjectMethodPointer : public RTTIObjectPointerBase {
 		*/
 		static RECore::String getLuaFunctionParametersAsString(Script &cScript, RECore::DynSignature &cDynSignature, bool bIsMethod, std::vector<RECore::String> &lstTempStrings);
 
+		/**
+		*  @brief
+		*    Writes the current Lua function parameters on the Lua stack into the given typed dynamic parameters
+		*
+		*  @param[in]  cScript
+		*    The owner script instance
+		*  @param[out] cDynParams
+		*    Typed dynamic parameters matching the signature of the function to be called, usually created by "RECore::DynFunc::constructParams()"
+		*  @param[in]  bIsMethod
+		*    'true' if the dynamic function is a method, 'false' if it's a global function
+		*
+		*  @return
+		*    'true' if all given Lua function parameters could be converted, else 'false' and an error message was pushed onto the Lua stack
+		*
+		*  @note
+		*    - Typed counterpart of "getLuaFunctionParametersAsString()" without any string formatting and parsing
+		*    - A Lua function parameter of a type which can't be passed from Lua or a number which is outside the range of the integer parameter type is an error
+		*    - A missing reference parameter is an error, the referenced type is unknown so there's no value it could be bound to
+		*    - Strings are stored inside pooled strings of the script, see "getLuaFunctionParametersAsString()" for details about strings passed
+		*      to reference or pointer parameters, "REScriptLua::Script::releaseStringParameters()" must be called before the typed parameters are destroyed
+		*/
+		[[nodiscard]] static bool getLuaFunctionParameters(Script &cScript, RECore::DynParams &cDynParams, bool bIsMethod);
+
+		/**
+		*  @brief
+		*    Pushes the return value of the given typed dynamic parameters onto the Lua stack
+		*
+		*  @param[in] cScript
+		*    The owner script instance
+		*  @param[in] cDynParams
+		*    Typed dynamic parameters of the called function
+		*
+		*  @return
+		*    Number of results on the Lua stack
+		*/
+		static int pushReturnValue(Script &cScript, RECore::DynParams &cDynParams);
+
 		/**
 		*  @brief
 		*    Calls the current Lua stack dynamic function
@@ -104,6 +141,9 @@ class RTTIObjectMethodPointer : public RTTIObjectPointerBase {
 		*
 		*  @return
 		*    Number of results on the Lua stack
+		*
+		*  @note
+		*    - Raises a Lua error if the Lua function parameters can't be converted into the typed parameters of the dynamic function
 		*/
 		static int callDynFunc(Script &cScript, RECore::DynFunc &cDynFunc, bool bIsMethod);
 
@@ -30,6 +30,7 @@
 //[-------------------------------------------------------]
 #include <RECore/Scripting/Script.h>
 #include "REScriptLua/REScriptLua.h"
+#include <deque>
 
 
 //[-------------------------------------------------------]
@@ -58,6 +59,7 @@ class Script : public RECore::Script {
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 	friend class RTTIObjectSignalMethodPointer;
+	friend class RTTIObjectMethodPointer;
 
 
 	//[-------------------------------------------------------]
@@ -101,6 +103,78 @@ class Script : public RECore::Script {
 		*/
 		RESCRIPTLUA_API void luaStackDump();
 
+		//[-------------------------------------------------------]
+		//[ Prepared global function call                         ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Prepares a global function call
+		*
+		*  @param[in] sFunctionName
+		*    Name of the function to call
+		*  @param[in] sFunctionSignature
+		*    Signature of the function to call (e.g. "void(int,float)")
+		*  @param[in] sNamespace
+		*    Optional namespace (e.g. "MyNamespace", "MyNamespace.MyOtherNamespace" and so on)
+		*
+		*  @return
+		*    Prepared call handle, "RECore::getInvalid<RECore::uint32>()" on error
+		*
+		*  @remarks
+		*    The function is resolved only once and pinned inside the Lua registry, the signature is parsed only once.
+		*    Starting a prepared call is therefore just a single registry lookup instead of walking the namespace tables
+		*    by name as "beginCall()" does. Use this for functions which are called frequently, e.g. per frame update hooks.
+		*
+		*  @note
+		*    - The handle stays valid until "removeAllPreparedCalls()" is called or the script is destroyed
+		*    - Setting new source code drops the pinned function, it's resolved again by the next call
+		*/
+		RESCRIPTLUA_API RECore::uint32 prepareCall(const RECore::String &sFunctionName, const RECore::String &sFunctionSignature, const RECore::String &sNamespace = "");
+
+		/**
+		*  @brief
+		*    Starts a prepared global function call
+		*
+		*  @param[in] nPreparedCall
+		*    Prepared call handle as returned by "prepareCall()"
+		*
+		*  @return
+		*    'true' if all went fine, else 'false'
+		*
+		*  @note
+		*    - Same usage as "beginCall()", continue with "pushArgument()", "endCall()" and "getReturn()"
+		*/
+		RESCRIPTLUA_API bool beginPreparedCall(RECore::uint32 nPreparedCall);
+
+		/**
+		*  @brief
+		*    Calls a prepared global function once for each of the given objects
+		*
+		*  @param[in] nPreparedCall
+		*    Prepared call handle as returned by "prepareCall()"
+		*  @param[in] ppObjects
+		*    Objects, each one is passed as the only argument of one function call, must be valid if "nNumberOfObjects" is not 0
+		*  @param[in] nNumberOfObjects
+		*    Number of objects
+		*
+		*  @return
+		*    'true' if all calls went fine, else 'false' (failed calls are written into the log, the remaining calls are still performed)
+		*
+		*  @note
+		*    - Function results are ignored
+		*    - The incremental garbage collection step is performed once for the whole batch instead of once per call
+		*/
+		RESCRIPTLUA_API bool callPreparedForObjects(RECore::uint32 nPreparedCall, RECore::Object *const *ppObjects, RECore::uint32 nNumberOfObjects);
+
+		/**
+		*  @brief
+		*    Removes all prepared calls
+		*
+		*  @note
+		*    - All previously returned prepared call handles become invalid
+		*/
+		RESCRIPTLUA_API void removeAllPreparedCalls();
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual RECore::Script functions               ]
@@ -207,6 +281,26 @@ class Script : public RECore::Script {
 			int						 	nLuaFunctionReference;	/**< The Lua-function or C-function to be called, never LUA_NOREF (use luaL_unref(<LuaState>, LUA_REGISTRYINDEX, <Reference>) when no longer required) */
 		};
 
+		/**
+		*  @brief
+		*    A prepared global function call
+		*/
+		struct PreparedCall {
+			RECore::String sFunction;				/**< Name of the function to call */
+			RECore::String sNamespace;				/**< Optional namespace (e.g. "MyNamespace", "MyNamespace.MyOtherNamespace" and so on) */
+			bool		   bFunctionResult;			/**< Has the function a result? */
+			int			   nLuaFunctionReference;	/**< Pinned Lua function inside the Lua registry, LUA_NOREF if not resolved, yet */
+		};
+
+		/**
+		*  @brief
+		*    A pooled string used to pass a Lua string to a typed RTTI function parameter
+		*/
+		struct StringParameter {
+			RECore::String  sValue;			/**< String value, keeps its capacity between calls */
+			RECore::String *pParameter;		/**< Typed string parameter the value is currently swapped into, null pointer if the value is referenced by address */
+		};
+
 
 	//[-------------------------------------------------------]
 	//[ Private functions                                     ]
@@ -282,6 +376,53 @@ class Script : public RECore::Script {
 		*/
 		bool getNestedTable(const RECore::String &sTableName);
 
+		/**
+		*  @brief
+		*    Pushes the function of a prepared call onto the Lua stack
+		*
+		*  @param[in] cPreparedCall
+		*    Prepared call, the function is resolved and pinned inside the Lua registry if this wasn't done, yet
+		*
+		*  @return
+		*    'true' if all went fine and the function is on the Lua stack, else 'false'
+		*
+		*  @note
+		*    - m_pLuaState must be valid
+		*/
+		bool pushPreparedCallFunction(PreparedCall &cPreparedCall);
+
+		/**
+		*  @brief
+		*    Acquires a pooled string for passing a Lua string to a typed RTTI function parameter
+		*
+		*  @param[in] pszValue
+		*    String value, must be valid
+		*  @param[in] nLength
+		*    Length of the string value
+		*  @param[in] pParameter
+		*    Typed string parameter to swap the pooled string into, null pointer if the pooled string is referenced by address
+		*
+		*  @return
+		*    The string holding the value, valid until "releaseStringParameters()"
+		*
+		*  @note
+		*    - The pooled strings keep their capacity, so once the pool is warmed up there are no heap allocations
+		*    - Nested calls (Lua -> C++ -> Lua -> C++) just acquire further pooled strings, acquired strings never move
+		*/
+		RECore::String &acquireStringParameter(const char *pszValue, size_t nLength, RECore::String *pParameter);
+
+		/**
+		*  @brief
+		*    Releases pooled strings
+		*
+		*  @param[in] nNumOfUsedStringParameters
+		*    Number of used pooled strings to return to, all pooled strings acquired since then are released
+		*
+		*  @note
+		*    - Pooled strings swapped into typed string parameters are swapped back, so this must be called before the typed parameters are destroyed
+		*/
+		void releaseStringParameters(RECore::uint32 nNumOfUsedStringParameters);
+
 		//[-------------------------------------------------------]
 		//[ Event and event handler stuff                         ]
 		//[-------------------------------------------------------]
@@ -347,6 +488,9 @@ class Script : public RECore::Script {
 		RECore::uint32									 m_nCurrentArgument;	/**< Current argument, used during function call */
   std::vector<GlobalFunction*>				     m_lstGlobalFunctions;	/**< List of global functions */
 		std::map<RECore::String, EventUserData*>  m_mapEventUserData;	/**< Map holding all event user data instances */
+		std::vector<PreparedCall>				 m_lstPreparedCalls;	/**< List of prepared calls, the index is the prepared call handle */
+		std::deque<StringParameter>				 m_lstStringParameters;			/**< Pool of strings for passing Lua strings to typed RTTI function parameters, a deque so acquired strings never move */
+		RECore::uint32							 m_nNumOfUsedStringParameters;	/**< Number of currently used pooled strings */
 
 
 };
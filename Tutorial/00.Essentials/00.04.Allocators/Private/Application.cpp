@@ -0,0 +1,361 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <RECore/Memory/DefaultAllocator.h>
+#include <RECore/Memory/LinearAllocator.h>
+#include <RECore/Memory/MemoryTracker.h>
+#include <RECore/Memory/TlsfAllocator.h>
+#include <RECore/Platform/Platform.h>
+#include <RECore/System/DynLib.h>
+#include <RECore/Log/Log.h>
+#include <RERHI/Rhi.h>
+
+#include <atomic>
+#include <cstdlib>	// For "malloc()", "aligned_alloc()" and "free()"
+#include <cstring>	// For "memset()" and "memcmp()"
+#include <new>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr size_t CAPACITY = 16 * 1024;	///< Linear allocator capacity in bytes
+    static constexpr size_t RHI_POOL_SIZE = 64 * 1024;	///< TLSF allocator pool size in bytes for the RHI objects of the frame loop
+    static constexpr RECore::uint32 NUMBER_OF_WARM_UP_FRAMES = 10;	///< Frames allowed to grow caches and buffers
+    static constexpr RECore::uint32 NUMBER_OF_MEASURED_FRAMES = 100;	///< Frames which must not touch the global allocators
+    static constexpr RECore::uint32 NUMBER_OF_COMMANDS_PER_FRAME = 1000;
+    static constexpr RECore::uint32 UNIFORM_BUFFER_SIZE = 256;
+
+
+    //[-------------------------------------------------------]
+    //[ Global variables                                      ]
+    //[-------------------------------------------------------]
+    std::atomic<RECore::uint64> g_NumberOfGlobalAllocations(0);	///< Number of allocations passed to the replaced global "operator new"
+
+
+    //[-------------------------------------------------------]
+    //[ Classes                                               ]
+    //[-------------------------------------------------------]
+    /**
+    *  @brief
+    *    Backing allocator counting the allocations passed to the default allocator
+    */
+    class CountingAllocator final : public RECore::IAllocator
+    {
+
+      // Public methods
+    public:
+      inline CountingAllocator() :
+        IAllocator(&CountingAllocator::staticReallocate),
+        mNumberOfAllocations(0),
+        mNumberOfLiveAllocations(0)
+      {
+        // Nothing here
+      }
+
+      inline virtual ~CountingAllocator() override
+      {
+        // Nothing here
+      }
+
+      [[nodiscard]] inline RECore::uint32 getNumberOfAllocations() const
+      {
+        return mNumberOfAllocations;
+      }
+
+      [[nodiscard]] inline RECore::uint32 getNumberOfLiveAllocations() const
+      {
+        return mNumberOfLiveAllocations;
+      }
+
+      // Private static methods
+    private:
+      [[nodiscard]] static void* staticReallocate(RECore::IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+      {
+        CountingAllocator& countingAllocator = static_cast<CountingAllocator&>(allocator);
+        void* newPointer = countingAllocator.mDefaultAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+        if (nullptr == oldPointer && nullptr != newPointer)
+        {
+          ++countingAllocator.mNumberOfAllocations;
+          ++countingAllocator.mNumberOfLiveAllocations;
+        }
+        else if (nullptr != oldPointer && 0 == newNumberOfBytes)
+        {
+          --countingAllocator.mNumberOfLiveAllocations;
+        }
+        return newPointer;
+      }
+
+      // Private data
+    private:
+      RECore::DefaultAllocator mDefaultAllocator;
+      RECore::uint32           mNumberOfAllocations;      ///< Total number of allocations
+      RECore::uint32           mNumberOfLiveAllocations;  ///< Number of allocations which haven't been freed, yet
+
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    [[nodiscard]] bool isAligned(const void* pointer, size_t alignment)
+    {
+      return (0 == (reinterpret_cast<uintptr_t>(pointer) & (alignment - 1)));
+    }
+
+    /**
+    *  @brief
+    *    Return the number of allocations made through the global allocators so far
+    *
+    *  @remarks
+    *    The global "operator new" is replaced by this executable. The global "RECore::Memory" allocator can only be
+    *    observed if "RECORE_MEMORY_TRACKING" is enabled, all memory tags are summed up in this case.
+    */
+    [[nodiscard]] RECore::uint64 getNumberOfGlobalAllocations()
+    {
+      RECore::uint64 numberOfGlobalAllocations = g_NumberOfGlobalAllocations.load(std::memory_order_relaxed);
+#ifdef RECORE_MEMORY_TRACKING
+      const RECore::uint32 numberOfTags = RECore::MemoryTracker::getNumberOfTags();
+      for (RECore::uint32 tagIndex = 0; tagIndex < numberOfTags; ++tagIndex) {
+        numberOfGlobalAllocations += RECore::MemoryTracker::getStatistics(tagIndex).getNumberOfAllocations();
+      }
+#endif
+      return numberOfGlobalAllocations;
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Global functions                                      ]
+//[-------------------------------------------------------]
+// Replace the global allocation functions to hook every "new" of the process, the array and the "std::nothrow" variants forward to these
+void* operator new(size_t numberOfBytes)
+{
+  ++::detail::g_NumberOfGlobalAllocations;
+  void* pointer = malloc((0 != numberOfBytes) ? numberOfBytes : 1);
+  if (nullptr == pointer) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void* operator new(size_t numberOfBytes, std::align_val_t alignment)
+{
+  ++::detail::g_NumberOfGlobalAllocations;
+  const size_t alignmentInBytes = static_cast<size_t>(alignment);
+  void* pointer = aligned_alloc(alignmentInBytes, (numberOfBytes + alignmentInBytes - 1) & ~(alignmentInBytes - 1));
+  if (nullptr == pointer) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept
+{
+  free(pointer);
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  bool succeeded = true;
+
+  { // Linear allocator
+    ::detail::CountingAllocator countingAllocator;
+    {
+      RECore::LinearAllocator linearAllocator("Tutorial", ::detail::CAPACITY, countingAllocator);
+      succeeded &= Tutorial::check(1 == countingAllocator.getNumberOfAllocations(), "The buffer is the only backing allocation");
+
+      // Several frames which fit into the buffer
+      for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 100; ++i) {
+          void* pointer = linearAllocator.reallocate(nullptr, 0, 64, 16);
+          succeeded &= (nullptr != pointer && ::detail::isAligned(pointer, 16));
+        }
+        linearAllocator.reset();
+      }
+      succeeded &= Tutorial::check(1 == countingAllocator.getNumberOfAllocations() && 0 == linearAllocator.getStatistics().getNumberOfBackingAllocations(), "Steady-state frames don't touch the backing allocator");
+      succeeded &= Tutorial::check(0 == linearAllocator.getNumberOfUsedBytes() && 0 == linearAllocator.getStatistics().getLiveBytes(), "Reset releases all allocations");
+
+      // Most recent allocation grows in place
+      RECore::uint8* pointer = static_cast<RECore::uint8*>(linearAllocator.reallocate(nullptr, 0, 128, 16));
+      succeeded &= Tutorial::check(pointer == linearAllocator.reallocate(pointer, 128, 256, 16), "The most recent allocation grows in place");
+
+      // Overflow
+      RECore::uint8* overflowPointer = static_cast<RECore::uint8*>(linearAllocator.reallocate(nullptr, 0, ::detail::CAPACITY, 64));
+      succeeded &= Tutorial::check(nullptr != overflowPointer && ::detail::isAligned(overflowPointer, 64), "An allocation exceeding the buffer is properly aligned");
+      succeeded &= Tutorial::check(2 == countingAllocator.getNumberOfLiveAllocations() && 1 == linearAllocator.getStatistics().getNumberOfBackingAllocations(), "An allocation exceeding the buffer is passed to the backing allocator");
+      memset(overflowPointer, 42, ::detail::CAPACITY);
+      RECore::uint8* grownOverflowPointer = static_cast<RECore::uint8*>(linearAllocator.reallocate(overflowPointer, 0, 2 * ::detail::CAPACITY, 64));
+      bool preserved = (nullptr != grownOverflowPointer);
+      for (size_t i = 0; preserved && i < ::detail::CAPACITY; ++i) {
+        preserved = (42 == grownOverflowPointer[i]);
+      }
+      succeeded &= Tutorial::check(preserved && 3 == countingAllocator.getNumberOfLiveAllocations(), "Growing an overflow allocation keeps its content, the old overflow block stays alive until the reset");
+      linearAllocator.reallocate(grownOverflowPointer, 0, 0, 64);
+      succeeded &= Tutorial::check(3 == countingAllocator.getNumberOfLiveAllocations(), "Freeing an overflow allocation is deferred to the reset");
+
+      // Reset releases the overflow blocks
+      linearAllocator.reset();
+      succeeded &= Tutorial::check(1 == countingAllocator.getNumberOfLiveAllocations() && 0 == linearAllocator.getStatistics().getLiveBytes(), "Reset releases the overflow blocks");
+
+      // Overflow blocks of the last frame are released by the destructor
+      succeeded &= (nullptr != linearAllocator.reallocate(nullptr, 0, 2 * ::detail::CAPACITY, 16));
+    }
+    succeeded &= Tutorial::check(0 == countingAllocator.getNumberOfLiveAllocations(), "The destructor releases the buffer and all overflow blocks");
+  }
+
+  { // Frame loop, RHI objects and command packets must not touch the global allocators once warmed up
+    // The null RHI is sufficient, the commands are dispatched but nothing is rendered
+    RECore::DynLib rhiLibrary;
+    const RECore::String rhiLibraryName = RECore::Platform::instance().getSharedLibraryPrefix() + "RERHINull." + RECore::Platform::instance().getSharedLibraryExtension();
+    typedef RERHI::RHIDynamicRHI* (*RHI_INSTANCER)(const RERHI::RHIContext&);
+    RHI_INSTANCER rhiInstancer = rhiLibrary.load(rhiLibraryName) ? reinterpret_cast<RHI_INSTANCER>(rhiLibrary.getSymbol("createRhiInstance")) : nullptr;
+    succeeded &= Tutorial::check(nullptr != rhiInstancer, "The null RHI was loaded");
+    if (nullptr != rhiInstancer) {
+      ::detail::CountingAllocator countingAllocator;
+      RECore::TlsfAllocator rhiAllocator("Rhi", ::detail::RHI_POOL_SIZE, countingAllocator);
+      RERHI::RHIContext rhiContext;
+      rhiContext.setAllocator(rhiAllocator);
+      RERHI::RHIDynamicRHI* rhi = rhiInstancer(rhiContext);
+      rhi->AddReference();
+      {
+        RECore::LinearAllocator frameAllocator("Frame", ::detail::CAPACITY, countingAllocator);
+        RERHI::RHICommandBuffer commandBuffer(rhiAllocator);
+        RERHI::RHIBufferManager* bufferManager = rhi->createBufferManager();
+        bufferManager->AddReference();
+        RERHI::RHIRootSignature* rootSignature = nullptr;
+        {
+          RERHI::DescriptorRangeBuilder ranges[1];
+          ranges[0].initialize(RERHI::ResourceType::UNIFORM_BUFFER, 0, "UniformBuffer", RERHI::ShaderVisibility::ALL);
+          RERHI::RootParameterBuilder rootParameters[1];
+          rootParameters[0].initializeAsDescriptorTable(1, &ranges[0]);
+          RERHI::RootSignatureBuilder rootSignatureBuilder;
+          rootSignatureBuilder.initialize(1, rootParameters, 0, nullptr, RERHI::RootSignatureFlags::NONE);
+          rootSignature = rhi->createRootSignature(rootSignatureBuilder);
+          rootSignature->AddReference();
+        }
+
+        RECore::uint64 numberOfGlobalAllocations = 0;
+        RECore::uint64 numberOfBackingAllocations = 0;
+        RECore::uint64 numberOfRhiAllocations = 0;
+        for (RECore::uint32 frame = 0; frame < ::detail::NUMBER_OF_WARM_UP_FRAMES + ::detail::NUMBER_OF_MEASURED_FRAMES; ++frame) {
+          if (::detail::NUMBER_OF_WARM_UP_FRAMES == frame) {
+            numberOfGlobalAllocations = ::detail::getNumberOfGlobalAllocations();
+            numberOfBackingAllocations = countingAllocator.getNumberOfAllocations();
+            numberOfRhiAllocations = rhiAllocator.getStatistics().getNumberOfAllocations();
+          }
+          frameAllocator.reset();
+
+          // Per-frame RHI objects: A uniform buffer filled from frame scratch memory and a resource group referencing it
+          void* uniformBufferData = frameAllocator.reallocate(nullptr, 0, ::detail::UNIFORM_BUFFER_SIZE, 16);
+          memset(uniformBufferData, static_cast<int>(frame), ::detail::UNIFORM_BUFFER_SIZE);
+          RERHI::RHIResource* uniformBuffer = bufferManager->createUniformBuffer(::detail::UNIFORM_BUFFER_SIZE, uniformBufferData);
+          RERHI::RHIResourceGroup* resourceGroup = rootSignature->createResourceGroup(0, 1, &uniformBuffer, nullptr);
+          resourceGroup->AddReference();
+
+          // Command packets
+          RERHI::Command::SetGraphicsRootSignature::create(commandBuffer, rootSignature);
+          for (RECore::uint32 i = 0; i < ::detail::NUMBER_OF_COMMANDS_PER_FRAME; ++i) {
+            RERHI::Command::SetGraphicsResourceGroup::create(commandBuffer, 0, resourceGroup);
+          }
+          commandBuffer.dispatchToRhiAndClear(*rhi);
+
+          // The resource group owns the only reference to the uniform buffer
+          resourceGroup->Release();
+        }
+        numberOfGlobalAllocations = ::detail::getNumberOfGlobalAllocations() - numberOfGlobalAllocations;
+        numberOfBackingAllocations = countingAllocator.getNumberOfAllocations() - numberOfBackingAllocations;
+        numberOfRhiAllocations = rhiAllocator.getStatistics().getNumberOfAllocations() - numberOfRhiAllocations;
+        succeeded &= Tutorial::check(0 == numberOfGlobalAllocations, "No global allocations after the warm-up frames");
+        succeeded &= Tutorial::check(0 == numberOfBackingAllocations, "The frame and RHI allocators don't grow after the warm-up frames");
+        succeeded &= Tutorial::check(numberOfRhiAllocations >= ::detail::NUMBER_OF_MEASURED_FRAMES, "Per-frame RHI objects are allocated through the RHI context allocator");
+
+        rootSignature->Release();
+        bufferManager->Release();
+      }
+      rhi->Release();
+    }
+  }
+
+  { // Default allocator
+    RECore::DefaultAllocator defaultAllocator;
+    RECore::uint8* pointer = static_cast<RECore::uint8*>(defaultAllocator.reallocate(nullptr, 0, 100, 256));
+    memset(pointer, 42, 100);
+    RECore::uint8* newPointer = static_cast<RECore::uint8*>(defaultAllocator.reallocate(pointer, 100, 10000, 256));
+    bool preserved = (nullptr != newPointer && ::detail::isAligned(newPointer, 256));
+    for (size_t i = 0; preserved && i < 100; ++i) {
+      preserved = (42 == newPointer[i]);
+    }
+    succeeded &= Tutorial::check(preserved, "Reallocation keeps the alignment and the content");
+    defaultAllocator.reallocate(newPointer, 10000, 0, 256);
+  }
+
+  if (!succeeded) {
+    exit(1);
+  }
+}
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <REScriptLua/Script.h>
+#include <RECore/Reflect/Func/FuncDynFunc.h>
+#include <RECore/Reflect/Func/FuncFunPtr.h>
+#include <RECore/Time/Stopwatch.h>
+#include <RECore/Log/Log.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr RECore::uint32 NUMBER_OF_CALLS = 1000000;	///< Number of measured calls from Lua into C++ per benchmark
+    static constexpr const char* TEXT = "A string which is too long for the small string optimization";
+    static constexpr const char* SOURCE_CODE =
+      "function callNumbers(n)\n"
+      "  local s = 0\n"
+      "  for i = 1, n do s = Benchmark.add(s, 1) end\n"
+      "  return s\n"
+      "end\n"
+      "function callStrings(n, text)\n"
+      "  local s = 0\n"
+      "  for i = 1, n do s = s + Benchmark.length(text) end\n"
+      "  return s\n"
+      "end\n"
+      "function callStringReferences(n, text)\n"
+      "  local s = 0\n"
+      "  for i = 1, n do s = s + Benchmark.referenceLength(text) end\n"
+      "  return s\n"
+      "end\n"
+      "function callMissingReference()\n"
+      "  return (pcall(Benchmark.referenceLength))\n"
+      "end\n";
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    int add(int a, int b)
+    {
+      return a + b;
+    }
+
+    int length(RECore::String text)
+    {
+      return static_cast<int>(text.length());
+    }
+
+    int referenceLength(const RECore::String& text)
+    {
+      return static_cast<int>(text.length());
+    }
+
+    [[nodiscard]] RECore::uint32 measureCalls(REScriptLua::Script& script, const char* functionName, const char* functionSignature, bool passText)
+    {
+      // Calls per second from Lua into C++, the Lua loop overhead is included
+      RECore::Stopwatch stopwatch(true);
+      RECore::uint32 result = 0;
+      if (script.beginCall(functionName, functionSignature)) {
+        script.pushArgument(NUMBER_OF_CALLS);
+        if (passText) {
+          script.pushArgument(RECore::String(TEXT));
+        }
+        if (script.endCall()) {
+          result = script.getReturn(result);
+        }
+      }
+      const float seconds = stopwatch.getSeconds();
+      RE_LOG(Info, RECore::String(functionName) + ": " + static_cast<RECore::uint32>(static_cast<float>(NUMBER_OF_CALLS) / seconds) + " calls/second")
+      return result;
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  bool succeeded = true;
+
+  // Global functions called by Lua, the function wrappers pass the Lua arguments as typed parameters without any string formatting
+  REScriptLua::Script script;
+  RECore::FuncWrapper<int, int, int> addFunction(new RECore::FuncFunPtr<int, int, int>(&::detail::add), true);
+  RECore::FuncWrapper<int, RECore::String> lengthFunction(new RECore::FuncFunPtr<int, RECore::String>(&::detail::length), true);
+  RECore::FuncWrapper<int, const RECore::String&> referenceLengthFunction(new RECore::FuncFunPtr<int, const RECore::String&>(&::detail::referenceLength), true);
+  script.addGlobalFunction("add", addFunction, "Benchmark");
+  script.addGlobalFunction("length", lengthFunction, "Benchmark");
+  script.addGlobalFunction("referenceLength", referenceLengthFunction, "Benchmark");
+  succeeded &= Tutorial::check(script.setSourceCode(::detail::SOURCE_CODE), "The Lua script was compiled");
+
+  // The first round warms up the pooled strings of the script, the second round is measured
+  const RECore::uint32 textLength = static_cast<RECore::uint32>(RECore::String(::detail::TEXT).length());
+  for (int round = 0; round < 2; ++round) {
+    RE_LOG(Info, (0 == round) ? "Warm up" : "Measure")
+    succeeded &= Tutorial::check(::detail::measureCalls(script, "callNumbers", "int(int)", false) == ::detail::NUMBER_OF_CALLS, "Numbers are passed by value");
+    succeeded &= Tutorial::check(::detail::measureCalls(script, "callStrings", "int(int,string)", true) == ::detail::NUMBER_OF_CALLS * textLength, "Strings are passed by value");
+    succeeded &= Tutorial::check(::detail::measureCalls(script, "callStringReferences", "int(int,string)", true) == ::detail::NUMBER_OF_CALLS * textLength, "Strings are passed by reference");
+  }
+
+  // A missing reference parameter can't be bound to anything and must raise a Lua error
+  bool called = true;
+  if (script.beginCall("callMissingReference", "bool()") && script.endCall()) {
+    called = script.getReturn(called);
+  }
+  succeeded &= Tutorial::check(!called, "A missing reference parameter raises a Lua error");
+
+  if (!succeeded) {
+    exit(1);
+  }
+}
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <REGui/Widget/Table/VirtualTable.h>
+#include <RECore/Time/Stopwatch.h>
+#include <RECore/Log/Log.h>
+#include <imgui.h>
+
+#include <cstdio>	// For "snprintf()"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr RECore::uint32 ROW_COUNTS[] = { 1000, 10000, 100000, 1000000 };	///< Benchmarked number of rows
+    static constexpr RECore::uint32 MAXIMUM_LIST_ROW_COUNT = 100000;					///< Drawing all rows gets too slow above this
+    static constexpr int			NUMBER_OF_FRAMES = 100;								///< Number of measured frames per row count
+    static constexpr float			DISPLAY_WIDTH = 1280.0f;
+    static constexpr float			DISPLAY_HEIGHT = 720.0f;
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    void drawRow(RECore::uint32 row)
+    {
+      // Formatted on the fly like a log message, so the costs scale with the number of emitted rows
+      char text[64];
+      snprintf(text, sizeof(text), "(Info) Log message number %u", row);
+      ImGui::TextUnformatted(text);
+    }
+
+    template <typename T>
+    [[nodiscard]] float measureFrames(int numberOfFrames, const T& draw)
+    {
+      // Average CPU time of a whole ImGui frame in milliseconds, no rendering backend is involved
+      RECore::Stopwatch stopwatch(true);
+      for (int frame = 0; frame < numberOfFrames; ++frame) {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+        ImGui::SetNextWindowSize(ImVec2(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+        ImGui::Begin("Log", nullptr, ImGuiWindowFlags_NoDecoration);
+        draw();
+        ImGui::End();
+        ImGui::Render();
+      }
+      return stopwatch.getMilliseconds() / static_cast<float>(numberOfFrames);
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  bool succeeded = true;
+
+  // Headless ImGui context, building the font atlas is all a frame needs
+  ImGui::CreateContext();
+  ImGuiIO& io = ImGui::GetIO();
+  io.DisplaySize = ImVec2(::detail::DISPLAY_WIDTH, ::detail::DISPLAY_HEIGHT);
+  io.DeltaTime = 1.0f / 60.0f;
+  io.IniFilename = nullptr;
+  unsigned char* pixels = nullptr;
+  int width = 0;
+  int height = 0;
+  io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+  RE_LOG(Info, "Rows      | Virtual table ms/frame | Drawn rows | Plain list ms/frame")
+  RECore::uint32 firstNumberOfDrawnRows = 0;
+  bool boundedDrawnRows = true;
+  for (RECore::uint32 numberOfRows : ::detail::ROW_COUNTS) {
+    // Virtual table scrolled to the end, like the log panel following new messages
+    REGui::VirtualTable table;
+    REGui::VirtualTable::ConstructionArguments args;
+    args.setNumberOfRows(numberOfRows);
+    args.setAutoScroll(true);
+    args.setCellCallback([](RECore::uint32 row, RECore::uint32) { ::detail::drawRow(row); });
+    table.construct(args);
+    [[maybe_unused]] const float warmUp = ::detail::measureFrames(2, [&table]() { table.onDraw(); });
+    table.scrollToRow(numberOfRows - 1);
+    const float virtualTableTime = ::detail::measureFrames(::detail::NUMBER_OF_FRAMES, [&table]() { table.onDraw(); });
+    if (0 == firstNumberOfDrawnRows) {
+      firstNumberOfDrawnRows = table.getNumberOfDrawnRows();
+    }
+    boundedDrawnRows &= (table.getNumberOfDrawnRows() > 0 && table.getNumberOfDrawnRows() <= firstNumberOfDrawnRows + 2);
+
+    // Plain list emitting every row, what the log panel did before
+    RECore::String listTime = "-";
+    if (numberOfRows <= ::detail::MAXIMUM_LIST_ROW_COUNT) {
+      listTime = RECore::String() + ::detail::measureFrames(::detail::NUMBER_OF_FRAMES / 10, [numberOfRows]() {
+        for (RECore::uint32 row = 0; row < numberOfRows; ++row) {
+          ::detail::drawRow(row);
+        }
+      });
+    }
+
+    RE_LOG(Info, RECore::String() + numberOfRows + " | " + virtualTableTime + " | " + table.getNumberOfDrawnRows() + " | " + listTime)
+  }
+  succeeded &= Tutorial::check(boundedDrawnRows, "The number of drawn rows doesn't depend on the number of rows");
+
+  ImGui::DestroyContext();
+
+  if (!succeeded) {
+    exit(1);
+  }
+}
@@ -0,0 +1,6 @@
+
+
+set(FILES
+  Private/Main.cpp
+  Private/Application.cpp
+)
\ No newline at end of file
@@ -0,0 +1,4 @@
+set(FILES
+  Private/Main.cpp
+  Private/Application.cpp
+)
\ No newline at end of file
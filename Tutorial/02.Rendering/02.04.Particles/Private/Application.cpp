@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <RERenderer/Resource/Scene/Item/Particles/ParticleEmitter.h>
+#include <RECore/Log/Log.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr float PAST_SECONDS = 0.125f;	///< Simulation step, exactly representable so the expected particle counts are exact
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    [[nodiscard]] RERenderer::ParticleEmitter::Settings getTestSettings()
+    {
+      // 64 particles per second living exactly one second, moving up with two units per second
+      RERenderer::ParticleEmitter::Settings settings;
+      settings.emissionRate = 64.0f;
+      settings.minimumLifetime = 1.0f;
+      settings.maximumLifetime = 1.0f;
+      settings.velocity = glm::vec3(0.0f, 2.0f, 0.0f);
+      settings.velocitySpread = glm::vec3(0.0f, 0.0f, 0.0f);
+      settings.acceleration = glm::vec3(0.0f, 0.0f, 0.0f);
+      settings.startSize = 0.1f;
+      settings.endSize = 0.1f;
+      return settings;
+    }
+
+    void simulate(RERenderer::ParticleEmitter& particleEmitter, RECore::uint32 numberOfSteps)
+    {
+      for (RECore::uint32 i = 0; i < numberOfSteps; ++i)
+      {
+        particleEmitter.update(PAST_SECONDS);
+      }
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  // Headless particle simulation, no RHI or renderer instance required
+  bool succeeded = true;
+
+  { // Emission and lifetime
+    RERenderer::ParticleEmitter particleEmitter(1024);
+    particleEmitter.setSettings(::detail::getTestSettings());
+    ::detail::simulate(particleEmitter, 4);
+    succeeded &= Tutorial::check(32 == particleEmitter.getNumberOfParticles(), "Half a second emits 32 particles");
+    ::detail::simulate(particleEmitter, 12);
+    succeeded &= Tutorial::check(64 == particleEmitter.getNumberOfParticles(), "Particles die after their lifetime, the number of particles stays at the steady state");
+    particleEmitter.setEmitting(false);
+    ::detail::simulate(particleEmitter, 8);
+    succeeded &= Tutorial::check(0 == particleEmitter.getNumberOfParticles(), "All particles are dead one lifetime after the emission was stopped");
+  }
+
+  { // Particle budget
+    RERenderer::ParticleEmitter particleEmitter(10);
+    particleEmitter.setSettings(::detail::getTestSettings());
+    ::detail::simulate(particleEmitter, 4);
+    succeeded &= Tutorial::check(10 == particleEmitter.getNumberOfParticles(), "The number of particles is clamped to the maximum number of particles");
+    particleEmitter.clear();
+    succeeded &= Tutorial::check(0 == particleEmitter.getNumberOfParticles(), "Clear kills all particles");
+  }
+
+  { // Integration and transform of the particle data
+    RERenderer::ParticleEmitter particleEmitter(1024);
+    particleEmitter.setSettings(::detail::getTestSettings());
+    ::detail::simulate(particleEmitter, 4);
+    std::vector<RERenderer::ParticleEmitter::ParticleDataStruct> particleData(particleEmitter.getNumberOfParticles());
+    particleEmitter.fillParticleData(particleData.data(), glm::mat3(2.0f));
+    bool valid = true;
+    for (const RERenderer::ParticleEmitter::ParticleDataStruct& currentParticleData : particleData)
+    {
+      // The oldest particles were integrated three times: 3 * 0.125 seconds * 2 units per second * scale 2 = 1.5
+      valid &= (0.0f <= currentParticleData.PositionSize[1] && currentParticleData.PositionSize[1] <= 1.5f);
+      valid &= (0.2f == currentParticleData.PositionSize[3]);
+    }
+    succeeded &= Tutorial::check(valid, "The particle data is scaled by the given transform");
+  }
+
+  if (!succeeded) {
+    exit(1);
+  }
+}
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <RERenderer/Context.h>
+#include <RERenderer/RendererImpl.h>
+#include <RERenderer/Resource/ShaderBlueprint/ShaderBlueprintResource.h>
+#include <RERenderer/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h>
+#include <RERenderer/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+#include <RERenderer/Resource/ShaderPiece/ShaderPieceResourceManager.h>
+#include <RERHI/Rhi.h>
+#include <RECore/Asset/AssetManager.h>
+#include <RECore/Asset/AssetPackage.h>
+#include <RECore/File/FileSystemHelper.h>
+#include <RECore/File/PhysicsFSFileManager.h>
+#include <RECore/Platform/Platform.h>
+#include <RECore/System/DynLib.h>
+#include <RECore/Time/Stopwatch.h>
+#include <RECore/Log/Log.h>
+
+#include <algorithm>
+#include <cstring>	// For "strlen()" and "strcmp()"
+#include <thread>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr const char*	SHADER_BLUEPRINT_EXTENSION = ".shader_blueprint";
+    static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_VARIED_PROPERTIES = 8;		///< Per shader blueprint, the first referenced shader properties are switched on and off, limits the permutations to 256 per shader blueprint
+    static constexpr RECore::uint32 MAXIMUM_NUMBER_OF_LOADING_UPDATES = 100000;	///< One millisecond each
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    [[nodiscard]] bool isShaderBlueprintAsset(const RECore::Asset& asset)
+    {
+      const size_t length = strlen(asset.virtualFilename);
+      const size_t extensionLength = strlen(SHADER_BLUEPRINT_EXTENSION);
+      return (length > extensionLength && 0 == strcmp(asset.virtualFilename + length - extensionLength, SHADER_BLUEPRINT_EXTENSION));
+    }
+
+    [[nodiscard]] bool isLoading(const RECore::IResourceManager& resourceManager)
+    {
+      for (RECore::uint32 i = 0; i < resourceManager.getNumberOfResources(); ++i)
+      {
+        const RECore::IResource::LoadingState loadingState = resourceManager.getResourceByIndex(i).getLoadingState();
+        if (RECore::IResource::LoadingState::UNLOADED == loadingState || RECore::IResource::LoadingState::LOADING == loadingState)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+    *  @brief
+    *    Build all permutations of all loaded shader blueprints
+    *
+    *  @param[in] renderer
+    *    Renderer instance
+    *  @param[in] sharedShaderBuilder
+    *    'true' to use one shader builder for all permutations like the pipeline state compiler does, 'false' to use a new shader builder per permutation like the shader cache manager does
+    *  @param[out] numberOfPermutations
+    *    Receives the number of built permutations
+    *  @param[out] numberOfEmptyPermutations
+    *    Receives the number of permutations which resulted in empty source code
+    *
+    *  @return
+    *    The required time in milliseconds
+    */
+    [[nodiscard]] float buildPermutations(const RERenderer::IRenderer& renderer, bool sharedShaderBuilder, RECore::uint32& numberOfPermutations, RECore::uint32& numberOfEmptyPermutations)
+    {
+      const RERenderer::ShaderBlueprintResourceManager& shaderBlueprintResourceManager = renderer.getShaderBlueprintResourceManager();
+      const RERenderer::ShaderPieceResourceManager& shaderPieceResourceManager = renderer.getShaderPieceResourceManager();
+      const RERHI::RHIContext& context = renderer.getRhi().getContext();
+      numberOfPermutations = 0;
+      numberOfEmptyPermutations = 0;
+
+      RECore::Stopwatch stopwatch(true);
+      RERenderer::ShaderBuilder shaderBuilder(context);
+      RERenderer::ShaderBuilder::BuildShader buildShader;
+      RERenderer::ShaderProperties shaderProperties;
+      for (RECore::uint32 i = 0; i < shaderBlueprintResourceManager.getNumberOfResources(); ++i)
+      {
+        const RERenderer::ShaderBlueprintResource& shaderBlueprintResource = static_cast<const RERenderer::ShaderBlueprintResource&>(shaderBlueprintResourceManager.getResourceByIndex(i));
+        if (RECore::IResource::LoadingState::LOADED != shaderBlueprintResource.getLoadingState())
+        {
+          continue;
+        }
+
+        // Switch the first referenced shader properties on and off
+        const RERenderer::ShaderProperties::SortedPropertyVector& referencedProperties = shaderBlueprintResource.getReferencedShaderProperties().getSortedPropertyVector();
+        const RECore::uint32 numberOfVariedProperties = std::min(static_cast<RECore::uint32>(referencedProperties.size()), MAXIMUM_NUMBER_OF_VARIED_PROPERTIES);
+        for (RECore::uint32 permutation = 0; permutation < (1u << numberOfVariedProperties); ++permutation)
+        {
+          shaderProperties.clear();
+          for (RECore::uint32 property = 0; property < numberOfVariedProperties; ++property)
+          {
+            if (permutation & (1u << property))
+            {
+              shaderProperties.setPropertyValue(referencedProperties[property].shaderPropertyId, 1);
+            }
+          }
+          buildShader = RERenderer::ShaderBuilder::BuildShader();
+          if (sharedShaderBuilder)
+          {
+            shaderBuilder.createSourceCode(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties, buildShader);
+          }
+          else
+          {
+            RERenderer::ShaderBuilder(context).createSourceCode(shaderPieceResourceManager, shaderBlueprintResource, shaderProperties, buildShader);
+          }
+          ++numberOfPermutations;
+          if (buildShader.sourceCode.empty())
+          {
+            ++numberOfEmptyPermutations;
+          }
+        }
+      }
+      return stopwatch.getMilliseconds();
+    }
+
+    void logResult(const char* name, RECore::uint32 numberOfPermutations, float milliseconds)
+    {
+      const float permutationsPerSecond = (milliseconds > 0.0f) ? (static_cast<float>(numberOfPermutations) * 1000.0f / milliseconds) : 0.0f;
+      RE_LOG(Info, RECore::String(name) + ": " + numberOfPermutations + " permutations in " + milliseconds + " ms = " + permutationsPerSecond + " permutations/sec")
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  bool succeeded = true;
+
+  // The compiled example project is expected next to the binaries, see "02.02.ProjectCompiler"
+  RECore::PhysicsFSFileManager fileManager(std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+  getCoreContext().initialize(fileManager);
+
+  // The null RHI is sufficient, shader source code is only built and never compiled
+  RECore::DynLib rhiLibrary;
+  const RECore::String rhiLibraryName = RECore::Platform::instance().getSharedLibraryPrefix() + "RERHINull." + RECore::Platform::instance().getSharedLibraryExtension();
+  typedef RERHI::RHIDynamicRHI* (*RHI_INSTANCER)(const RERHI::RHIContext&);
+  RHI_INSTANCER rhiInstancer = rhiLibrary.load(rhiLibraryName) ? reinterpret_cast<RHI_INSTANCER>(rhiLibrary.getSymbol("createRhiInstance")) : nullptr;
+  if (nullptr == rhiInstancer) {
+    RE_LOG(Critical, "Unable to load " + rhiLibraryName)
+    exit(1);
+  }
+  RERHI::RHIContext rhiContext;
+  RERHI::RHIDynamicRHI* rhi = rhiInstancer(rhiContext);
+  rhi->AddReference();
+
+  {
+    RERenderer::Context rendererContext(*rhi, getCoreContext());
+    RERenderer::RendererImpl* rendererImpl = new RERenderer::RendererImpl(rendererContext);
+    RERenderer::IRenderer& renderer = *rendererImpl;
+    const RECore::AssetPackage* assetPackage = renderer.getAssetManager().mountAssetPackage("../DataPc/Example/Content", "Example");
+    succeeded &= Tutorial::check(nullptr != assetPackage, "The compiled example project was found, run \"02.02.ProjectCompiler\" first");
+    if (nullptr != assetPackage) {
+      // Load all shader blueprints, the included shader pieces are loaded along the way
+      RECore::uint32 numberOfShaderBlueprints = 0;
+      for (const RECore::Asset& asset : assetPackage->getSortedAssetVector()) {
+        if (::detail::isShaderBlueprintAsset(asset)) {
+          RERenderer::ShaderBlueprintResourceId shaderBlueprintResourceId = RECore::getInvalid<RERenderer::ShaderBlueprintResourceId>();
+          renderer.getShaderBlueprintResourceManager().loadShaderBlueprintResourceByAssetId(asset.assetId, shaderBlueprintResourceId);
+          ++numberOfShaderBlueprints;
+        }
+      }
+      RECore::uint32 numberOfLoadingUpdates = 0;
+      while ((::detail::isLoading(renderer.getShaderBlueprintResourceManager()) || ::detail::isLoading(renderer.getShaderPieceResourceManager())) && numberOfLoadingUpdates < ::detail::MAXIMUM_NUMBER_OF_LOADING_UPDATES) {
+        renderer.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++numberOfLoadingUpdates;
+      }
+      succeeded &= Tutorial::check(numberOfShaderBlueprints > 0 && numberOfLoadingUpdates < ::detail::MAXIMUM_NUMBER_OF_LOADING_UPDATES, "All shader blueprints of the example project have been loaded");
+      RE_LOG(Info, RECore::String("Shader blueprints: ") + numberOfShaderBlueprints + ", shader pieces: " + renderer.getShaderPieceResourceManager().getNumberOfResources())
+
+      // A warm up round, followed by the measured rounds
+      RECore::uint32 numberOfPermutations = 0;
+      RECore::uint32 numberOfEmptyPermutations = 0;
+      [[maybe_unused]] const float warmUp = ::detail::buildPermutations(renderer, true, numberOfPermutations, numberOfEmptyPermutations);
+      const float separateTime = ::detail::buildPermutations(renderer, false, numberOfPermutations, numberOfEmptyPermutations);
+      ::detail::logResult("New shader builder per permutation", numberOfPermutations, separateTime);
+      const float sharedTime = ::detail::buildPermutations(renderer, true, numberOfPermutations, numberOfEmptyPermutations);
+      ::detail::logResult("Shared shader builder with memoized shader pieces", numberOfPermutations, sharedTime);
+      succeeded &= Tutorial::check(numberOfPermutations > 0 && 0 == numberOfEmptyPermutations, "All permutations resulted in shader source code");
+    }
+    delete rendererImpl;
+  }
+
+  rhi->Release();
+
+  if (!succeeded) {
+    exit(1);
+  }
+}
@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019 - 2022 RacoonStudios
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+// to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Application.h"
+#include <Tutorial/Check.h>
+#include <RERenderer/Context.h>
+#include <RERenderer/RendererImpl.h>
+#include <RERenderer/Core/Renderer/RenderThread.h>
+#include <RERHI/Rhi.h>
+#include <RECore/File/FileSystemHelper.h>
+#include <RECore/File/PhysicsFSFileManager.h>
+#include <RECore/Platform/Platform.h>
+#include <RECore/System/DynLib.h>
+#include <RECore/Time/Stopwatch.h>
+#include <RECore/Color/Color4.h>
+#include <RECore/Log/Log.h>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+  namespace detail
+  {
+
+
+    //[-------------------------------------------------------]
+    //[ Global definitions                                    ]
+    //[-------------------------------------------------------]
+    static constexpr RECore::uint32 NUMBER_OF_FRAMES = 1000;
+    static constexpr RECore::uint32 RENDER_TARGET_SIZE = 64;
+
+    struct CreateRequest final
+    {
+      RERHI::RHIResource* resource = nullptr;
+      bool                completed = false;
+    };
+
+
+    //[-------------------------------------------------------]
+    //[ Global functions                                      ]
+    //[-------------------------------------------------------]
+    RERHI::RHIResource* createSamplerState(RERHI::RHIDynamicRHI& rhi, [[maybe_unused]] void* userData)
+    {
+      // Called by the submission thread, reference counters are left alone
+      return rhi.createSamplerState(RERHI::RHISamplerState::getDefaultSamplerState() RHI_RESOURCE_DEBUG_NAME("Render thread tutorial"));
+    }
+
+    void onSamplerStateCreated(RERHI::RHIResource* resource, void* userData)
+    {
+      // Called by the main thread, from now on we're responsible for the resource
+      CreateRequest* createRequest = static_cast<CreateRequest*>(userData);
+      createRequest->resource = resource;
+      createRequest->completed = true;
+      if (nullptr != resource)
+      {
+        resource->AddReference();
+      }
+    }
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+  } // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+Application::Application()
+: RECore::CoreApplication() {
+
+}
+
+Application::~Application() {
+
+}
+
+void Application::main() {
+  bool succeeded = true;
+
+  RECore::PhysicsFSFileManager fileManager(std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+  getCoreContext().initialize(fileManager);
+
+  // The null RHI supports threaded submission and has no driver cost, so the timings show the overhead of the render thread itself
+  RECore::DynLib rhiLibrary;
+  const RECore::String rhiLibraryName = RECore::Platform::instance().getSharedLibraryPrefix() + "RERHINull." + RECore::Platform::instance().getSharedLibraryExtension();
+  typedef RERHI::RHIDynamicRHI* (*RHI_INSTANCER)(const RERHI::RHIContext&);
+  RHI_INSTANCER rhiInstancer = rhiLibrary.load(rhiLibraryName) ? reinterpret_cast<RHI_INSTANCER>(rhiLibrary.getSymbol("createRhiInstance")) : nullptr;
+  if (nullptr == rhiInstancer) {
+    RE_LOG(Critical, "Unable to load " + rhiLibraryName)
+    exit(1);
+  }
+  RERHI::RHIContext rhiContext;
+  RERHI::RHIDynamicRHI* rhi = rhiInstancer(rhiContext);
+  rhi->AddReference();
+
+  {
+    RERenderer::Context rendererContext(*rhi, getCoreContext());
+    RERenderer::RendererImpl* rendererImpl = new RERenderer::RendererImpl(rendererContext);
+    RERenderer::IRenderer& renderer = *rendererImpl;
+    RERenderer::RenderThread& renderThread = renderer.getRenderThread();
+
+    {
+      // Render into a framebuffer, the null RHI needs no window for it
+      const RERHI::TextureFormat::Enum textureFormat = RERHI::TextureFormat::R8G8B8A8;
+      RERHI::RHIRenderPassPtr renderPassPtr(rhi->createRenderPass(1, &textureFormat, RERHI::TextureFormat::UNKNOWN, 1 RHI_RESOURCE_DEBUG_NAME("Render thread tutorial")));
+      RERHI::RHITexturePtr texturePtr(renderer.getTextureManager().createTexture2D(::detail::RENDER_TARGET_SIZE, ::detail::RENDER_TARGET_SIZE, textureFormat, nullptr, RERHI::TextureFlag::RENDER_TARGET, RERHI::TextureUsage::DEFAULT, 1, nullptr RHI_RESOURCE_DEBUG_NAME("Render thread tutorial")));
+      const RERHI::FramebufferAttachment colorFramebufferAttachment(texturePtr);
+      RERHI::RHIFramebufferPtr framebufferPtr(rhi->createFramebuffer(*renderPassPtr, &colorFramebufferAttachment, nullptr RHI_RESOURCE_DEBUG_NAME("Render thread tutorial")));
+      RERHI::RHICommandBuffer commandBuffer;
+      RERHI::Command::SetGraphicsRenderTarget::create(commandBuffer, framebufferPtr);
+      RERHI::Command::ClearGraphics::create(commandBuffer, RERHI::ClearFlag::COLOR, RECore::Color4::GREEN);
+
+      renderThread.setEnabled(true);
+      succeeded &= Tutorial::check(renderThread.isEnabled(), "The render thread has been enabled");
+      succeeded &= Tutorial::check(0 == renderThread.getRecordingFrameIndex(), "The first frame is recorded for the first frame slot");
+
+      // A released resource must stay alive as long as submitted frames might reference it
+      RERHI::RHIUniformBuffer* uniformBuffer = renderer.getBufferManager().createUniformBuffer(sizeof(float) * 4, nullptr, RERHI::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Render thread tutorial"));
+      uniformBuffer->AddReference();
+      uniformBuffer->AddReference();
+      renderThread.releaseResource(*uniformBuffer);
+      succeeded &= Tutorial::check(2 == uniformBuffer->GetRefCount(), "A released resource is kept alive until the next submitted frame has been completed");
+
+      // A create request is executed by the submission thread and completed by the main thread
+      ::detail::CreateRequest createRequest;
+      renderThread.createResource(&::detail::createSamplerState, &::detail::onSamplerStateCreated, &createRequest);
+      succeeded &= Tutorial::check(!createRequest.completed, "A create request is handed over together with the next submitted frame");
+
+      // Submit the frames, the frame slots must be used one after another
+      bool frameSlotsCycled = true;
+      float waitMilliseconds = 0.0f;
+      float dispatchMilliseconds = 0.0f;
+      float presentMilliseconds = 0.0f;
+      RECore::Stopwatch stopwatch(true);
+      for (RECore::uint32 i = 0; i < ::detail::NUMBER_OF_FRAMES; ++i) {
+        frameSlotsCycled &= ((i % RERenderer::RenderThread::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT) == renderThread.getRecordingFrameIndex());
+        renderThread.submit(commandBuffer, *framebufferPtr);
+        waitMilliseconds += renderThread.getMainThreadWaitMilliseconds();
+        dispatchMilliseconds += renderThread.getDispatchMilliseconds();
+        presentMilliseconds += renderThread.getPresentMilliseconds();
+      }
+      const float submitMilliseconds = stopwatch.getMilliseconds();
+      renderThread.flush();
+      succeeded &= Tutorial::check(frameSlotsCycled, "The frame slots are used one after another");
+      succeeded &= Tutorial::check(1 == uniformBuffer->GetRefCount(), "The released resource has been released after the submitted frames have been completed");
+      succeeded &= Tutorial::check(createRequest.completed && nullptr != createRequest.resource, "The create request has been completed");
+      uniformBuffer->Release();
+      if (nullptr != createRequest.resource) {
+        createRequest.resource->Release();
+      }
+
+      // Timings, the dispatch and present timings are sampled once per submitted frame
+      const float numberOfFrames = static_cast<float>(::detail::NUMBER_OF_FRAMES);
+      RE_LOG(Info, RECore::String("Submitted ") + ::detail::NUMBER_OF_FRAMES + " frames in " + submitMilliseconds + " ms, " + renderThread.getMaximumNumberOfFramesInFlight() + " frames in flight")
+      RE_LOG(Info, RECore::String("Average main thread wait: ") + (waitMilliseconds / numberOfFrames) + " ms, dispatch: " + (dispatchMilliseconds / numberOfFrames) + " ms, present: " + (presentMilliseconds / numberOfFrames) + " ms")
+      succeeded &= Tutorial::check(waitMilliseconds <= submitMilliseconds, "The main thread waited less than the whole submission took");
+
+      renderThread.setEnabled(false);
+      succeeded &= Tutorial::check(!renderThread.isEnabled() && 0 == renderThread.getRecordingFrameIndex(), "The render thread has been disabled");
+    }
+    delete rendererImpl;
+  }
+
+  rhi->Release();
+
+  if (!succeeded) {
+    exit(1);
+  }
+}